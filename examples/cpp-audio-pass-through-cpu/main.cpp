@@ -0,0 +1,133 @@
+#include <OpenteraWebrtcNativeClient/StreamClient.h>
+
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <ctime>
+#include <future>
+#include <iomanip>
+#include <iostream>
+#include <thread>
+
+using namespace opentera;
+using namespace std;
+
+constexpr int BitsPerSample = 16;
+constexpr int SampleRate = 48000;
+constexpr size_t NumberOfChannels = 1;
+constexpr chrono::milliseconds FrameDuration(10);
+constexpr chrono::seconds StreamingDuration(20);
+constexpr chrono::seconds Timeout(30);
+constexpr int16_t Amplitude = 15000;
+constexpr double Frequency = 440;
+
+struct Scenario
+{
+    string name;
+    AudioSourceConfiguration configuration;
+};
+
+class ToneAudioSource : public AudioSource
+{
+    atomic_bool m_stopped;
+    thread m_thread;
+
+public:
+    explicit ToneAudioSource(AudioSourceConfiguration configuration)
+        : AudioSource(move(configuration), BitsPerSample, SampleRate, NumberOfChannels),
+          m_stopped(false),
+          m_thread(&ToneAudioSource::run, this)
+    {
+    }
+
+    ~ToneAudioSource() override
+    {
+        m_stopped.store(true);
+        m_thread.join();
+    }
+
+private:
+    void run()
+    {
+        vector<int16_t> data(FrameDuration.count() * SampleRate / 1000, 0);
+        for (size_t i = 0; i < data.size(); i++)
+        {
+            data[i] = static_cast<int16_t>(Amplitude * sin(2 * M_PI * Frequency * i / SampleRate));
+        }
+
+        // The frames are paced without busy waiting, so the generator does not hide the cost of the processing.
+        auto nextFrameTime = chrono::steady_clock::now();
+        while (!m_stopped.load())
+        {
+            sendFrame(data.data(), data.size());
+            nextFrameTime += FrameDuration;
+            this_thread::sleep_until(nextFrameTime);
+        }
+    }
+};
+
+static double measureCpuUsage(const Scenario& scenario)
+{
+    vector<IceServer> iceServers;
+    if (!IceServer::fetchFromServer("http://localhost:8080/iceservers", "abc", iceServers))
+    {
+        iceServers.clear();
+    }
+    auto webrtcConfiguration = WebrtcConfiguration::create(iceServers);
+
+    auto audioSource = make_shared<ToneAudioSource>(scenario.configuration);
+    StreamClient sender(
+        SignalingServerConfiguration::create("http://localhost:8080", "Sender", "pass-through-cpu", "abc"),
+        webrtcConfiguration,
+        audioSource);
+    StreamClient receiver(
+        SignalingServerConfiguration::create("http://localhost:8080", "Receiver", "pass-through-cpu", "abc"),
+        webrtcConfiguration);
+
+    promise<void> audioFramePromise;
+    atomic_bool isAudioFrameReceived(false);
+    receiver.setOnAudioFrameReceived(
+        [&](const Client&, const void*, int, int, size_t, size_t)
+        {
+            if (!isAudioFrameReceived.exchange(true))
+            {
+                audioFramePromise.set_value();
+            }
+        });
+    sender.setOnSignalingConnectionOpened([&]() { sender.callAll(); });
+
+    receiver.connect();
+    sender.connect();
+    if (audioFramePromise.get_future().wait_for(Timeout) != future_status::ready)
+    {
+        cout << scenario.name << ": no audio was received" << endl;
+        return 0.0;
+    }
+
+    clock_t startCpuTime = clock();
+    auto startTime = chrono::steady_clock::now();
+    this_thread::sleep_for(StreamingDuration);
+    double cpuDuration = static_cast<double>(clock() - startCpuTime) / CLOCKS_PER_SEC;
+    chrono::duration<double> duration = chrono::steady_clock::now() - startTime;
+
+    sender.closeSync();
+    receiver.closeSync();
+    return 100 * cpuDuration / duration.count();
+}
+
+int main(int argc, char* argv[])
+{
+    vector<Scenario> scenarios{
+        {"audio processing enabled", AudioSourceConfiguration::create(0, true, true, true, true, false, true)},
+        {"audio processing disabled", AudioSourceConfiguration::create(0, false, false, false, false, false, false)},
+        {"pass-through", AudioSourceConfiguration::createPassThrough()},
+    };
+
+    for (const auto& scenario : scenarios)
+    {
+        double cpuUsage = measureCpuUsage(scenario);
+        cout << setw(30) << left << scenario.name << fixed << setprecision(1) << cpuUsage << " % CPU" << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,134 @@
+#include <OpenteraWebrtcNativeClient/DataChannelClient.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+
+using namespace opentera;
+using namespace std;
+
+constexpr size_t MessageSize = 64;
+constexpr size_t MessageCount = 50000;
+constexpr size_t BatchSize = 100;
+constexpr chrono::seconds Timeout(60);
+
+class PeerState
+{
+    mutex m_mutex;
+    condition_variable m_conditionVariable;
+    bool m_isDataChannelOpened = false;
+    size_t m_receivedMessageCount = 0;
+
+public:
+    void onDataChannelOpened()
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_isDataChannelOpened = true;
+        m_conditionVariable.notify_all();
+    }
+
+    void onMessage()
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_receivedMessageCount++;
+        m_conditionVariable.notify_all();
+    }
+
+    bool waitForDataChannel()
+    {
+        unique_lock<mutex> lock(m_mutex);
+        return m_conditionVariable.wait_for(lock, Timeout, [this]() { return m_isDataChannelOpened; });
+    }
+
+    bool waitForMessageCount(size_t count)
+    {
+        unique_lock<mutex> lock(m_mutex);
+        return m_conditionVariable.wait_for(lock, Timeout, [this, count]() { return m_receivedMessageCount >= count; });
+    }
+};
+
+static void sendMessages(DataChannelClient& sender, const vector<string>& ids, bool isBatched)
+{
+    vector<uint8_t> message(MessageSize, 0x5A);
+    if (!isBatched)
+    {
+        for (size_t i = 0; i < MessageCount; i++)
+        {
+            sender.sendTo(message.data(), message.size(), ids);
+        }
+        return;
+    }
+
+    for (size_t i = 0; i < MessageCount; i += BatchSize)
+    {
+        DataChannelMessageBatch batch(BatchSize);
+        for (size_t j = i; j < min(i + BatchSize, MessageCount); j++)
+        {
+            batch.addTo(message.data(), message.size(), ids);
+        }
+        sender.sendBatch(move(batch));
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    vector<IceServer> iceServers;
+    if (!IceServer::fetchFromServer("http://localhost:8080/iceservers", "abc", iceServers))
+    {
+        iceServers.clear();
+    }
+
+    auto webrtcConfiguration = WebrtcConfiguration::create(iceServers);
+    auto dataChannelConfiguration = DataChannelConfiguration::create();
+    DataChannelClient sender(
+        SignalingServerConfiguration::create("http://localhost:8080", "Sender", "batch-send", "abc"),
+        webrtcConfiguration,
+        dataChannelConfiguration);
+    DataChannelClient receiver(
+        SignalingServerConfiguration::create("http://localhost:8080", "Receiver", "batch-send", "abc"),
+        webrtcConfiguration,
+        dataChannelConfiguration);
+
+    PeerState senderState;
+    PeerState receiverState;
+    sender.setOnDataChannelOpened([&](const Client&) { senderState.onDataChannelOpened(); });
+    receiver.setOnDataChannelOpened([&](const Client&) { receiverState.onDataChannelOpened(); });
+    receiver.setOnDataChannelMessageBinary([&](const Client&, const uint8_t*, size_t) { receiverState.onMessage(); });
+
+    receiver.connect();
+    sender.connect();
+    if (!senderState.waitForDataChannel() || !receiverState.waitForDataChannel())
+    {
+        cout << "The data channel did not open" << endl;
+        return 1;
+    }
+
+    vector<string> ids = sender.getConnectedRoomClientIds();
+    size_t expectedMessageCount = 0;
+    cout << setw(12) << left << "mode" << setw(24) << "submitted (messages/s)" << "delivered (messages/s)" << endl;
+    for (bool isBatched : {false, true})
+    {
+        auto start = chrono::steady_clock::now();
+        sendMessages(sender, ids, isBatched);
+        chrono::duration<double> submitDuration = chrono::steady_clock::now() - start;
+
+        expectedMessageCount += MessageCount;
+        bool isReceived = receiverState.waitForMessageCount(expectedMessageCount);
+        chrono::duration<double> deliveryDuration = chrono::steady_clock::now() - start;
+        if (!isReceived)
+        {
+            cout << "The messages were not received" << endl;
+            return 1;
+        }
+
+        cout << setw(12) << left << (isBatched ? "sendBatch" : "sendTo") << setw(24) << fixed << setprecision(0)
+             << MessageCount / submitDuration.count() << MessageCount / deliveryDuration.count() << endl;
+    }
+
+    sender.closeSync();
+    receiver.closeSync();
+    return 0;
+}
@@ -0,0 +1,147 @@
+#include <OpenteraWebrtcNativeClient/DataChannelClient.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+using namespace opentera;
+using namespace std;
+
+constexpr size_t MessageSize = 64 * 1024;
+constexpr size_t MessageCount = 1024;
+constexpr uint64_t MaxBufferedAmount = 4 * 1024 * 1024;
+constexpr chrono::seconds Timeout(60);
+
+struct Scenario
+{
+    string name;
+    bool isMessageFragmentationEnabled;
+    size_t maxFrameSize;
+    uint64_t frameSendBufferSize;
+};
+
+class PeerState
+{
+    mutex m_mutex;
+    condition_variable m_conditionVariable;
+    string m_peerId;
+    size_t m_receivedSize = 0;
+
+public:
+    void onDataChannelOpened(const Client& client)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_peerId = client.id();
+        m_conditionVariable.notify_all();
+    }
+
+    void onMessage(size_t size)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_receivedSize += size;
+        m_conditionVariable.notify_all();
+    }
+
+    bool waitForDataChannel()
+    {
+        unique_lock<mutex> lock(m_mutex);
+        return m_conditionVariable.wait_for(lock, Timeout, [this]() { return !m_peerId.empty(); });
+    }
+
+    bool waitForSize(size_t size)
+    {
+        unique_lock<mutex> lock(m_mutex);
+        return m_conditionVariable.wait_for(lock, Timeout, [this, size]() { return m_receivedSize >= size; });
+    }
+};
+
+static double measureThroughput(const Scenario& scenario)
+{
+    vector<IceServer> iceServers;
+    if (!IceServer::fetchFromServer("http://localhost:8080/iceservers", "abc", iceServers))
+    {
+        iceServers.clear();
+    }
+
+    auto webrtcConfiguration = WebrtcConfiguration::create(iceServers);
+    auto dataChannelConfiguration = DataChannelConfiguration::create();
+
+    DataChannelClient sender(
+        SignalingServerConfiguration::create("http://localhost:8080", "Sender", "throughput", "abc"),
+        webrtcConfiguration,
+        dataChannelConfiguration);
+    DataChannelClient receiver(
+        SignalingServerConfiguration::create("http://localhost:8080", "Receiver", "throughput", "abc"),
+        webrtcConfiguration,
+        dataChannelConfiguration);
+
+    for (DataChannelClient* client : {&sender, &receiver})
+    {
+        // All peers must use the same framing, so both clients are configured.
+        client->setMessageFragmentationEnabled(scenario.isMessageFragmentationEnabled);
+        client->setMaxFrameSize(scenario.maxFrameSize);
+        client->setFrameSendBufferSize(scenario.frameSendBufferSize);
+    }
+
+    PeerState senderState;
+    PeerState receiverState;
+    sender.setOnDataChannelOpened([&](const Client& client) { senderState.onDataChannelOpened(client); });
+    receiver.setOnDataChannelOpened([&](const Client& client) { receiverState.onDataChannelOpened(client); });
+    receiver.setOnDataChannelMessageBinary([&](const Client&, const uint8_t*, size_t size)
+                                           { receiverState.onMessage(size); });
+
+    receiver.connect();
+    sender.connect();
+    if (!senderState.waitForDataChannel() || !receiverState.waitForDataChannel())
+    {
+        cout << scenario.name << ": the data channel did not open" << endl;
+        return 0.0;
+    }
+
+    vector<string> ids = sender.getConnectedRoomClientIds();
+    vector<uint8_t> message(MessageSize, 0x5A);
+    auto start = chrono::steady_clock::now();
+    for (size_t i = 0; i < MessageCount; i++)
+    {
+        // The sender is paced by the buffered amount, so the data channel is not closed by a full send buffer.
+        while (sender.bufferedAmount(ids.front()) > MaxBufferedAmount)
+        {
+            this_thread::sleep_for(chrono::milliseconds(1));
+        }
+        sender.sendTo(message.data(), message.size(), ids);
+    }
+
+    bool isReceived = receiverState.waitForSize(MessageSize * MessageCount);
+    chrono::duration<double> duration = chrono::steady_clock::now() - start;
+
+    sender.closeSync();
+    receiver.closeSync();
+
+    if (!isReceived)
+    {
+        cout << scenario.name << ": the messages were not received" << endl;
+        return 0.0;
+    }
+    return MessageSize * MessageCount / duration.count() / (1024 * 1024);
+}
+
+int main(int argc, char* argv[])
+{
+    vector<Scenario> scenarios{
+        {"baseline", false, 16 * 1024, 256 * 1024},
+        {"fragmentation, 16 KiB frames", true, 16 * 1024, 256 * 1024},
+        {"fragmentation, 64 KiB frames", true, 64 * 1024, 256 * 1024},
+        {"fragmentation, 64 KiB frames, 4 MiB frame send buffer", true, 64 * 1024, 4 * 1024 * 1024},
+    };
+
+    for (const auto& scenario : scenarios)
+    {
+        double throughput = measureThroughput(scenario);
+        cout << setw(60) << left << scenario.name << fixed << setprecision(1) << throughput << " MiB/s" << endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,124 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_CONFIGURATIONS_AUDIO_SINK_CONFIGURATION_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_CONFIGURATIONS_AUDIO_SINK_CONFIGURATION_H
+
+#include <absl/types/optional.h>
+
+#include <cstddef>
+
+namespace opentera
+{
+    /**
+     * @brief Represents the format of the audio frames given to an audio frame callback.
+     *
+     * The unset values keep the values of the decoded audio.
+     */
+    class AudioSinkConfiguration
+    {
+        absl::optional<int> m_bitsPerSample;
+        absl::optional<int> m_sampleRate;
+        absl::optional<size_t> m_numberOfChannels;
+        absl::optional<size_t> m_numberOfFramesPerChunk;
+
+        AudioSinkConfiguration(
+            absl::optional<int> bitsPerSample,
+            absl::optional<int> sampleRate,
+            absl::optional<size_t> numberOfChannels,
+            absl::optional<size_t> numberOfFramesPerChunk);
+
+    public:
+        AudioSinkConfiguration(const AudioSinkConfiguration& other) = default;
+        AudioSinkConfiguration(AudioSinkConfiguration&& other) = default;
+        virtual ~AudioSinkConfiguration() = default;
+
+        static AudioSinkConfiguration create();
+        static AudioSinkConfiguration create(
+            absl::optional<int> bitsPerSample,
+            absl::optional<int> sampleRate,
+            absl::optional<size_t> numberOfChannels,
+            absl::optional<size_t> numberOfFramesPerChunk);
+
+        absl::optional<int> bitsPerSample() const;
+        absl::optional<int> sampleRate() const;
+        absl::optional<size_t> numberOfChannels() const;
+        absl::optional<size_t> numberOfFramesPerChunk() const;
+        bool isConversionEnabled() const;
+
+        AudioSinkConfiguration& operator=(const AudioSinkConfiguration& other) = default;
+        AudioSinkConfiguration& operator=(AudioSinkConfiguration&& other) = default;
+    };
+
+    /**
+     * @brief Creates an audio sink configuration that keeps the format of the decoded audio.
+     * @return An audio sink configuration with default values
+     */
+    inline AudioSinkConfiguration AudioSinkConfiguration::create()
+    {
+        return AudioSinkConfiguration(absl::nullopt, absl::nullopt, absl::nullopt, absl::nullopt);
+    }
+
+    /**
+     * @brief Creates an audio sink configuration with the specified values.
+     *
+     * @param bitsPerSample The sample size (8, 16 or 32 bits)
+     * @param sampleRate The sample rate (a multiple of 100 Hz)
+     * @param numberOfChannels The channel count
+     * @param numberOfFramesPerChunk The number of frames of each callback call (unset to use 10 ms frames)
+     * @return An audio sink configuration with the specified values
+     */
+    inline AudioSinkConfiguration AudioSinkConfiguration::create(
+        absl::optional<int> bitsPerSample,
+        absl::optional<int> sampleRate,
+        absl::optional<size_t> numberOfChannels,
+        absl::optional<size_t> numberOfFramesPerChunk)
+    {
+        return AudioSinkConfiguration(bitsPerSample, sampleRate, numberOfChannels, numberOfFramesPerChunk);
+    }
+
+    /**
+     * @brief Returns the sample size.
+     * @return The sample size
+     */
+    inline absl::optional<int> AudioSinkConfiguration::bitsPerSample() const
+    {
+        return m_bitsPerSample;
+    }
+
+    /**
+     * @brief Returns the sample rate.
+     * @return The sample rate
+     */
+    inline absl::optional<int> AudioSinkConfiguration::sampleRate() const
+    {
+        return m_sampleRate;
+    }
+
+    /**
+     * @brief Returns the channel count.
+     * @return The channel count
+     */
+    inline absl::optional<size_t> AudioSinkConfiguration::numberOfChannels() const
+    {
+        return m_numberOfChannels;
+    }
+
+    /**
+     * @brief Returns the number of frames of each callback call.
+     * @return The number of frames of each callback call
+     */
+    inline absl::optional<size_t> AudioSinkConfiguration::numberOfFramesPerChunk() const
+    {
+        return m_numberOfFramesPerChunk;
+    }
+
+    /**
+     * @brief Indicates if the decoded audio is converted before it is given to the callback.
+     * @return true if a value is set
+     */
+    inline bool AudioSinkConfiguration::isConversionEnabled() const
+    {
+        return m_bitsPerSample.has_value() || m_sampleRate.has_value() || m_numberOfChannels.has_value() ||
+               m_numberOfFramesPerChunk.has_value();
+    }
+}
+
+#endif
@@ -18,6 +18,7 @@ namespace opentera
         absl::optional<bool> m_highpassFilter;
         absl::optional<bool> m_stereoSwapping;
         absl::optional<bool> m_transientSuppression;
+        bool m_isPassThrough;
 
         AudioSourceConfiguration(
             uint32_t soundCardTotalDelayMs,
@@ -26,7 +27,8 @@ namespace opentera
             absl::optional<bool> noiseSuppression,
             absl::optional<bool> highpassFilter,
             absl::optional<bool> stereoSwapping,
-            absl::optional<bool> transientSuppression);
+            absl::optional<bool> transientSuppression,
+            bool isPassThrough);
 
     public:
         AudioSourceConfiguration(const AudioSourceConfiguration& other) = default;
@@ -42,6 +44,7 @@ namespace opentera
             absl::optional<bool> highpassFilter,
             absl::optional<bool> stereoSwapping,
             absl::optional<bool> transientSuppression);
+        static AudioSourceConfiguration createPassThrough();
 
         uint32_t soundCardTotalDelayMs() const;
         absl::optional<bool> echoCancellation() const;
@@ -50,6 +53,7 @@ namespace opentera
         absl::optional<bool> highpassFilter() const;
         absl::optional<bool> stereoSwapping() const;
         absl::optional<bool> transientSuppression() const;
+        bool isPassThrough() const;
 
         explicit operator cricket::AudioOptions() const;
         explicit operator webrtc::AudioProcessing::Config() const;
@@ -72,7 +76,8 @@ namespace opentera
             absl::nullopt,
             absl::nullopt,
             absl::nullopt,
-            absl::nullopt);
+            absl::nullopt,
+            false);
     }
 
     /**
@@ -103,7 +108,22 @@ namespace opentera
             noiseSuppression,
             highpassFilter,
             stereoSwapping,
-            transientSuppression);
+            transientSuppression,
+            false);
+    }
+
+    /**
+     * @brief Creates an audio source configuration that bypasses the audio processing.
+     *
+     * The frames are sent as they are, so this is intended for audio that is already processed (beamforming, echo
+     * cancellation, noise suppression...). The client is created without webrtc::AudioProcessing, which removes its
+     * buffering and format conversions from the capture path.
+     *
+     * @return An audio source configuration that bypasses the audio processing
+     */
+    inline AudioSourceConfiguration AudioSourceConfiguration::createPassThrough()
+    {
+        return AudioSourceConfiguration(0, false, false, false, false, false, false, true);
     }
 
     /**
@@ -168,6 +188,15 @@ namespace opentera
     {
         return m_transientSuppression;
     }
+
+    /**
+     * @brief Indicates if the audio processing is bypassed.
+     * @return true if the audio processing is bypassed
+     */
+    inline bool AudioSourceConfiguration::isPassThrough() const
+    {
+        return m_isPassThrough;
+    }
 }
 
 #endif
@@ -7,6 +7,17 @@
 
 namespace opentera
 {
+    /**
+     * @brief Represents the priority of a data channel relative to the other data channels of a peer connection.
+     */
+    enum class DataChannelPriority
+    {
+        VeryLow,
+        Low,
+        Medium,
+        High
+    };
+
     /**
      * @brief Represents a data channel configuration
      */
@@ -16,6 +27,7 @@ namespace opentera
         absl::optional<int> m_maxPacketLifeTime;  // It cannot be set with m_maxRetransmits
         absl::optional<int> m_maxRetransmits;  // It cannot be set with m_maxPacketLifeTime
         std::string m_protocol;
+        absl::optional<DataChannelPriority> m_priority;
 
         DataChannelConfiguration(
             bool ordered,
@@ -24,6 +36,22 @@ namespace opentera
             std::string&& protocol);
 
     public:
+        // The messages of the data channels that use this protocol are compressed with MessageCompressor.
+        static constexpr const char* CompressedProtocol = "opentera-lz4";
+        // The small messages of the data channels that use this protocol are packed with MessageCoalescer.
+        static constexpr const char* CoalescedProtocol = "opentera-coalesced";
+        // DataChannelClient appends this suffix to the protocol of the ordered and reliable data channels it creates
+        // when the message fragmentation is enabled, so both peers split the messages of these channels into frames.
+        static constexpr const char* FragmentedProtocolSuffix = "+fragmented";
+        // The data channels that use this protocol carry the topics published with DataChannelClient::publish.
+        static constexpr const char* PubSubProtocol = "opentera-pubsub";
+        // The data channels that use this protocol carry the clock synchronization exchanges of DataChannelClient.
+        static constexpr const char* ClockSyncProtocol = "opentera-clock";
+        // The data channels that use this protocol carry the files sent with DataChannelClient::sendFile.
+        static constexpr const char* FileTransferProtocol = "opentera-file";
+        // The data channels that use this protocol carry the remote procedure calls of DataChannelClient::call.
+        static constexpr const char* RpcProtocol = "opentera-rpc";
+
         DataChannelConfiguration(const DataChannelConfiguration& other) = default;
         DataChannelConfiguration(DataChannelConfiguration&& other) = default;
         virtual ~DataChannelConfiguration() = default;
@@ -48,6 +76,16 @@ namespace opentera
         const absl::optional<int>& maxPacketLifeTime() const;
         const absl::optional<int>& maxRetransmits() const;
         const std::string& protocol() const;
+        const absl::optional<DataChannelPriority>& priority() const;
+        bool isReliable() const;
+        bool isCompressed() const;
+        bool isCoalesced() const;
+        bool isPubSub() const;
+        bool isClockSync() const;
+        bool isFileTransfer() const;
+        bool isRpc() const;
+
+        DataChannelConfiguration withPriority(DataChannelPriority priority) const;
 
         explicit operator webrtc::DataChannelInit() const;
 
@@ -225,6 +263,77 @@ namespace opentera
      * @return The data channel protocol
      */
     inline const std::string& DataChannelConfiguration::protocol() const { return m_protocol; }
+
+    /**
+     * @brief Returns the data channel priority.
+     * @return The data channel priority, or absl::nullopt if the default priority of WebRTC is used
+     */
+    inline const absl::optional<DataChannelPriority>& DataChannelConfiguration::priority() const
+    {
+        return m_priority;
+    }
+
+    /**
+     * @brief Returns a copy of this configuration with the specified priority.
+     *
+     * The priority is announced to the peer when the data channel opens, but the SCTP implementation of the WebRTC
+     * version used by this library does not use it to schedule the messages. It does not share the bandwidth between
+     * the data channels; use the message fragmentation to keep a bulk transfer from blocking the small messages.
+     *
+     * @param priority The data channel priority
+     * @return A data channel configuration with the specified priority
+     */
+    inline DataChannelConfiguration DataChannelConfiguration::withPriority(DataChannelPriority priority) const
+    {
+        DataChannelConfiguration configuration(*this);
+        configuration.m_priority = priority;
+        return configuration;
+    }
+
+    /**
+     * @brief Indicates if the messages of the data channel are retransmitted until they are received.
+     * @return true if neither the maximum packet life time nor the maximum number of retransmits is set
+     */
+    inline bool DataChannelConfiguration::isReliable() const
+    {
+        return !m_maxPacketLifeTime.has_value() && !m_maxRetransmits.has_value();
+    }
+
+    /**
+     * @brief Indicates if the messages of the data channel are compressed.
+     * @return true if the protocol is CompressedProtocol
+     */
+    inline bool DataChannelConfiguration::isCompressed() const { return m_protocol == CompressedProtocol; }
+
+    /**
+     * @brief Indicates if the small messages of the data channel are packed together.
+     * @return true if the protocol is CoalescedProtocol
+     */
+    inline bool DataChannelConfiguration::isCoalesced() const { return m_protocol == CoalescedProtocol; }
+
+    /**
+     * @brief Indicates if the data channel carries the published topics.
+     * @return true if the protocol is PubSubProtocol
+     */
+    inline bool DataChannelConfiguration::isPubSub() const { return m_protocol == PubSubProtocol; }
+
+    /**
+     * @brief Indicates if the data channel carries the clock synchronization exchanges.
+     * @return true if the protocol is ClockSyncProtocol
+     */
+    inline bool DataChannelConfiguration::isClockSync() const { return m_protocol == ClockSyncProtocol; }
+
+    /**
+     * @brief Indicates if the data channel carries the file transfers.
+     * @return true if the protocol is FileTransferProtocol
+     */
+    inline bool DataChannelConfiguration::isFileTransfer() const { return m_protocol == FileTransferProtocol; }
+
+    /**
+     * @brief Indicates if the data channel carries the remote procedure calls.
+     * @return true if the protocol is RpcProtocol
+     */
+    inline bool DataChannelConfiguration::isRpc() const { return m_protocol == RpcProtocol; }
 }
 
 #endif
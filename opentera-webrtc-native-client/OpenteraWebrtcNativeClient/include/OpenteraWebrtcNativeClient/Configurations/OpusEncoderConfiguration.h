@@ -0,0 +1,128 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_CONFIGURATIONS_OPUS_ENCODER_CONFIGURATION_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_CONFIGURATIONS_OPUS_ENCODER_CONFIGURATION_H
+
+#include <api/audio_codecs/opus/audio_encoder_opus_config.h>
+
+namespace opentera
+{
+    /**
+     * @brief Represents the Opus encoder settings of the audio sent by a StreamClient.
+     *
+     * The unset values keep the values negotiated in the SDP.
+     */
+    class OpusEncoderConfiguration
+    {
+        absl::optional<int> m_bitrateBps;
+        absl::optional<int> m_complexity;
+        absl::optional<int> m_frameSizeMs;
+        absl::optional<bool> m_dtx;
+        absl::optional<bool> m_inbandFec;
+
+        OpusEncoderConfiguration(
+            absl::optional<int> bitrateBps,
+            absl::optional<int> complexity,
+            absl::optional<int> frameSizeMs,
+            absl::optional<bool> dtx,
+            absl::optional<bool> inbandFec);
+
+    public:
+        OpusEncoderConfiguration(const OpusEncoderConfiguration& other) = default;
+        OpusEncoderConfiguration(OpusEncoderConfiguration&& other) = default;
+        virtual ~OpusEncoderConfiguration() = default;
+
+        static OpusEncoderConfiguration create();
+        static OpusEncoderConfiguration create(
+            absl::optional<int> bitrateBps,
+            absl::optional<int> complexity,
+            absl::optional<int> frameSizeMs,
+            absl::optional<bool> dtx,
+            absl::optional<bool> inbandFec);
+
+        absl::optional<int> bitrateBps() const;
+        absl::optional<int> complexity() const;
+        absl::optional<int> frameSizeMs() const;
+        absl::optional<bool> dtx() const;
+        absl::optional<bool> inbandFec() const;
+
+        webrtc::AudioEncoderOpusConfig apply(webrtc::AudioEncoderOpusConfig config) const;
+
+        OpusEncoderConfiguration& operator=(const OpusEncoderConfiguration& other) = default;
+        OpusEncoderConfiguration& operator=(OpusEncoderConfiguration&& other) = default;
+    };
+
+    /**
+     * @brief Creates an Opus encoder configuration that keeps the negotiated values.
+     * @return An Opus encoder configuration with default values
+     */
+    inline OpusEncoderConfiguration OpusEncoderConfiguration::create()
+    {
+        return OpusEncoderConfiguration(absl::nullopt, absl::nullopt, absl::nullopt, absl::nullopt, absl::nullopt);
+    }
+
+    /**
+     * @brief Creates an Opus encoder configuration with the specified values.
+     *
+     * @param bitrateBps The target bitrate (6000 to 510000 bps)
+     * @param complexity The encoder complexity (0 to 10, lower values use less CPU)
+     * @param frameSizeMs The packet time (10, 20, 40, 60, 80, 100 or 120 ms)
+     * @param dtx Enable or disable the discontinuous transmission
+     * @param inbandFec Enable or disable the in-band forward error correction
+     * @return An Opus encoder configuration with the specified values
+     */
+    inline OpusEncoderConfiguration OpusEncoderConfiguration::create(
+        absl::optional<int> bitrateBps,
+        absl::optional<int> complexity,
+        absl::optional<int> frameSizeMs,
+        absl::optional<bool> dtx,
+        absl::optional<bool> inbandFec)
+    {
+        return OpusEncoderConfiguration(bitrateBps, complexity, frameSizeMs, dtx, inbandFec);
+    }
+
+    /**
+     * @brief Returns the target bitrate.
+     * @return The target bitrate (bps)
+     */
+    inline absl::optional<int> OpusEncoderConfiguration::bitrateBps() const
+    {
+        return m_bitrateBps;
+    }
+
+    /**
+     * @brief Returns the encoder complexity.
+     * @return The encoder complexity
+     */
+    inline absl::optional<int> OpusEncoderConfiguration::complexity() const
+    {
+        return m_complexity;
+    }
+
+    /**
+     * @brief Returns the packet time.
+     * @return The packet time (ms)
+     */
+    inline absl::optional<int> OpusEncoderConfiguration::frameSizeMs() const
+    {
+        return m_frameSizeMs;
+    }
+
+    /**
+     * @brief Indicates if the discontinuous transmission is enabled.
+     * @return true if the discontinuous transmission is enabled
+     */
+    inline absl::optional<bool> OpusEncoderConfiguration::dtx() const
+    {
+        return m_dtx;
+    }
+
+    /**
+     * @brief Indicates if the in-band forward error correction is enabled.
+     * @return true if the in-band forward error correction is enabled
+     */
+    inline absl::optional<bool> OpusEncoderConfiguration::inbandFec() const
+    {
+        return m_inbandFec;
+    }
+}
+
+#endif
@@ -4,52 +4,319 @@
 #include <OpenteraWebrtcNativeClient/SignalingClient.h>
 #include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
 #include <OpenteraWebrtcNativeClient/Configurations/DataChannelConfiguration.h>
+#include <OpenteraWebrtcNativeClient/Utils/BufferedAmountTracker.h>
+#include <OpenteraWebrtcNativeClient/Utils/ClockOffsetEstimator.h>
+#include <OpenteraWebrtcNativeClient/Utils/DataChannelMessage.h>
+#include <OpenteraWebrtcNativeClient/Utils/DataChannelMessageBatch.h>
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferFrame.h>
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferReceiver.h>
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferSender.h>
+#include <OpenteraWebrtcNativeClient/Utils/KeyedWorkerPool.h>
+#include <OpenteraWebrtcNativeClient/Utils/MessageCompressor.h>
+#include <OpenteraWebrtcNativeClient/Utils/RpcCallRegistry.h>
+#include <OpenteraWebrtcNativeClient/Utils/TopicRegistry.h>
+#include <OpenteraWebrtcNativeClient/Utils/WorkerPool.h>
 
+#include <absl/types/optional.h>
 #include <api/data_channel_interface.h>
+#include <api/task_queue/pending_task_safety_flag.h>
+
+#include <atomic>
+#include <future>
+#include <map>
+#include <mutex>
+#include <set>
 
 namespace opentera
 {
+    class DataChannelPeerConnectionHandler;
+
     /**
      * @brief Represents a client for data channel communication.
      */
     class DataChannelClient : public SignalingClient
     {
         DataChannelConfiguration m_dataChannelConfiguration;
+        std::map<std::string, DataChannelConfiguration> m_namedDataChannelConfigurations;
 
         std::function<void(const Client&)> m_onDataChannelOpened;
+        std::map<std::string, std::function<void(const Client&)>> m_onNamedDataChannelOpenedByChannel;
         std::function<void(const Client&)> m_onDataChannelClosed;
         std::function<void(const Client&, const std::string&)> m_onDataChannelError;
         std::function<void(const Client&, const uint8_t*, std::size_t)> m_onDataChannelMessageBinary;
         std::function<void(const Client&, const std::string&)> m_onDataChannelMessageString;
+        std::function<void(const Client&, const DataChannelMessage&)> m_onDataChannelMessage;
+        std::map<std::string, std::function<void(const Client&, const DataChannelMessage&)>>
+            m_onNamedDataChannelMessageByChannel;
+        std::map<std::string, std::function<void(const Client&, const uint8_t*, std::size_t)>>
+            m_onNamedDataChannelMessageBinaryByChannel;
+        std::map<std::string, std::function<void(const Client&, const std::string&)>>
+            m_onNamedDataChannelMessageStringByChannel;
+        std::function<void(const Client&)> m_onDataChannelBufferedAmountLow;
+        std::function<void(const Client&, uint32_t, const uint8_t*, std::size_t, std::size_t, std::size_t, bool)>
+            m_onDataChannelMessageChunk;
+        std::function<void(const Client&, uint16_t, const DataChannelMessage&)> m_onTopicMessage;
+        std::function<std::string(const Client&, const std::string&, uint64_t)> m_onFileTransferRequested;
+        std::function<void(const Client&, const std::string&, bool, uint64_t, uint64_t)> m_onFileTransferProgress;
+        std::map<std::string, std::function<DataChannelMessage(const Client&, const DataChannelMessage&)>>
+            m_rpcHandlersByMethod;
+
+        BufferedAmountTracker m_bufferedAmountTracker;
+        bool m_isMessageFragmentationEnabled;
+        size_t m_maxFrameSize;
+        uint64_t m_frameSendBufferSize;
+        MessageCompressor m_messageCompressor;
+        // It guards the message dispatch pool and the message callbacks, which are read from the signaling thread
+        // when the messages are posted to the pool.
+        mutable std::mutex m_messageDispatchMutex;
+        std::unique_ptr<KeyedWorkerPool> m_messageDispatchPool;
+        // It prevents the delayed tasks posted to the internal client thread from using the client after it is
+        // destroyed.
+        rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> m_taskSafetyFlag;
+
+        std::string m_pubSubChannel;
+        TopicRegistry m_topicRegistry;
+        std::set<uint16_t> m_subscribedTopics;
+
+        std::string m_clockSyncChannel;
+        std::map<std::string, ClockOffsetEstimator> m_clockOffsetEstimatorsById;
+
+        struct OutgoingFileTransfer
+        {
+            Client client;
+            std::unique_ptr<FileTransferSender> sender;
+        };
+
+        struct IncomingFileTransfer
+        {
+            uint64_t nonce;
+            std::unique_ptr<FileTransferReceiver> receiver;
+        };
+
+        std::string m_fileTransferChannel;
+        std::atomic<uint32_t> m_nextFileTransferId;
+        std::map<uint32_t, OutgoingFileTransfer> m_outgoingFileTransfersById;
+        // The incoming transfers are identified by the sender name and the transfer id, so they can be resumed when
+        // the sender reconnects with another client id. The nonce of the offer tells a resumed transfer from a new one
+        // whose id is reused by a restarted sender. They are removed when they are complete.
+        std::map<std::pair<std::string, uint32_t>, IncomingFileTransfer> m_incomingFileTransfers;
+
+        std::string m_rpcChannel;
+        std::atomic<uint32_t> m_nextRpcCallId;
+        std::atomic<int64_t> m_rpcTimeoutMs;
+        RpcCallRegistry m_rpcCallRegistry;
+        std::unique_ptr<WorkerPool> m_rpcWorkerPool;
 
     public:
         DataChannelClient(
             SignalingServerConfiguration signalingServerConfiguration,
             WebrtcConfiguration webrtcConfiguration,
             DataChannelConfiguration dataChannelConfiguration);
-        ~DataChannelClient() override = default;
+        DataChannelClient(
+            SignalingServerConfiguration signalingServerConfiguration,
+            WebrtcConfiguration webrtcConfiguration,
+            DataChannelConfiguration dataChannelConfiguration,
+            std::map<std::string, DataChannelConfiguration> namedDataChannelConfigurations);
+        ~DataChannelClient() override;
 
         DECLARE_NOT_COPYABLE(DataChannelClient);
         DECLARE_NOT_MOVABLE(DataChannelClient);
 
-        void sendTo(const uint8_t* data, std::size_t size, const std::vector<std::string>& ids);
-        void sendTo(const std::string& message, const std::vector<std::string>& ids);
-        void sendToAll(const uint8_t* data, std::size_t size);
-        void sendToAll(const std::string& message);
+        bool sendTo(const uint8_t* data, std::size_t size, const std::vector<std::string>& ids);
+        bool sendTo(const std::string& message, const std::vector<std::string>& ids);
+        bool sendToAll(const uint8_t* data, std::size_t size);
+        bool sendToAll(const std::string& message);
+        bool sendBatch(DataChannelMessageBatch batch);
+
+        bool sendTo(
+            const std::string& channel,
+            const uint8_t* data,
+            std::size_t size,
+            const std::vector<std::string>& ids);
+        bool sendTo(const std::string& channel, const std::string& message, const std::vector<std::string>& ids);
+        bool sendToAll(const std::string& channel, const uint8_t* data, std::size_t size);
+        bool sendToAll(const std::string& channel, const std::string& message);
+
+        void sendLatestTo(
+            const std::string& key,
+            const uint8_t* data,
+            std::size_t size,
+            const std::vector<std::string>& ids);
+        void sendLatestTo(const std::string& key, const std::string& message, const std::vector<std::string>& ids);
+        void sendLatestToAll(const std::string& key, const uint8_t* data, std::size_t size);
+        void sendLatestToAll(const std::string& key, const std::string& message);
+
+        void subscribe(uint16_t topic);
+        void unsubscribe(uint16_t topic);
+        bool publish(uint16_t topic, const uint8_t* data, std::size_t size);
+        bool publish(uint16_t topic, const std::string& message);
+        TopicStatistics topicStatistics(uint16_t topic) const;
+
+        absl::optional<int64_t> peerClockOffset(const std::string& id);
+        absl::optional<int64_t> peerRoundTripTime(const std::string& id);
+        absl::optional<int64_t> toPeerTime(const std::string& id, int64_t localTimeUs);
+        absl::optional<int64_t> fromPeerTime(const std::string& id, int64_t peerTimeUs);
+        static int64_t localTime();
+
+        uint32_t sendFile(const std::string& id, const std::string& path, const std::string& name);
+        void cancelFileTransfer(uint32_t transferId);
+
+        std::future<DataChannelMessage>
+            call(const std::string& id, const std::string& method, const uint8_t* data, std::size_t size);
+        std::future<DataChannelMessage>
+            call(const std::string& id, const std::string& method, const std::string& message);
+        void call(
+            const std::string& id,
+            const std::string& method,
+            const uint8_t* data,
+            std::size_t size,
+            const std::function<void(const absl::optional<DataChannelMessage>&, const std::string&)>& callback);
+        void call(
+            const std::string& id,
+            const std::string& method,
+            const std::string& message,
+            const std::function<void(const absl::optional<DataChannelMessage>&, const std::string&)>& callback);
+        void setRpcHandler(
+            const std::string& method,
+            const std::function<DataChannelMessage(const Client&, const DataChannelMessage&)>& handler);
+
+        void setRpcTimeout(int64_t timeoutMs);
+        int64_t rpcTimeout() const;
+        void setRpcWorkerCount(size_t count);
+        size_t rpcWorkerCount();
+
+        void setSendQueueWatermarks(uint64_t lowWatermark, uint64_t highWatermark);
+        uint64_t bufferedAmount(const std::string& id) const;
+
+        bool isMessageFragmentationEnabled();
+        void setMessageFragmentationEnabled(bool enabled);
+        void setMaxFrameSize(size_t size);
+        size_t maxFrameSize();
+        void setFrameSendBufferSize(uint64_t size);
+        uint64_t frameSendBufferSize();
+
+        void setCompressionThreshold(size_t threshold);
+        size_t compressionThreshold() const;
+        double compressionRatio() const;
+
+        void setMessageDispatchWorkerCount(size_t count);
+        size_t messageDispatchWorkerCount();
+        std::vector<size_t> messageDispatchQueueDepths();
 
         void setOnDataChannelOpened(const std::function<void(const Client&)>& callback);
+        void setOnDataChannelOpened(const std::string& channel, const std::function<void(const Client&)>& callback);
         void setOnDataChannelClosed(const std::function<void(const Client&)>& callback);
         void setOnDataChannelError(const std::function<void(const Client&, const std::string&)>& callback);
         void setOnDataChannelMessageBinary(
             const std::function<void(const Client&, const uint8_t*, std::size_t)>& callback);
         void setOnDataChannelMessageString(const std::function<void(const Client&, const std::string&)>& callback);
+        void setOnDataChannelMessage(const std::function<void(const Client&, const DataChannelMessage&)>& callback);
+        void setOnDataChannelMessageBinary(
+            const std::string& channel,
+            const std::function<void(const Client&, const uint8_t*, std::size_t)>& callback);
+        void setOnDataChannelMessageString(
+            const std::string& channel,
+            const std::function<void(const Client&, const std::string&)>& callback);
+        void setOnDataChannelMessage(
+            const std::string& channel,
+            const std::function<void(const Client&, const DataChannelMessage&)>& callback);
+        void setOnDataChannelBufferedAmountLow(const std::function<void(const Client&)>& callback);
+        void setOnDataChannelMessageChunk(
+            const std::function<
+                void(const Client&, uint32_t, const uint8_t*, std::size_t, std::size_t, std::size_t, bool)>& callback);
+        void setOnTopicMessage(const std::function<void(const Client&, uint16_t, const DataChannelMessage&)>& callback);
+        void setOnFileTransferRequested(
+            const std::function<std::string(const Client&, const std::string&, uint64_t)>& callback);
+        void setOnFileTransferProgress(
+            const std::function<void(const Client&, const std::string&, bool, uint64_t, uint64_t)>& callback);
 
     protected:
-        void sendTo(const webrtc::DataBuffer& buffer, const std::vector<std::string>& ids);
-        void sendToAll(const webrtc::DataBuffer& buffer);
+        bool sendTo(const std::string& channel, const webrtc::DataBuffer& message, const std::vector<std::string>& ids);
+        bool sendToAll(const std::string& channel, const webrtc::DataBuffer& message);
+        void sendLatestTo(
+            const std::string& key,
+            const webrtc::DataBuffer& message,
+            const std::vector<std::string>& ids);
+        void sendLatestToAll(const std::string& key, const webrtc::DataBuffer& message);
+        bool publish(uint16_t topic, const webrtc::DataBuffer& message);
+        std::future<DataChannelMessage>
+            call(const std::string& id, const std::string& method, const webrtc::DataBuffer& request);
+        void call(
+            const std::string& id,
+            const std::string& method,
+            const webrtc::DataBuffer& request,
+            const std::function<void(const absl::optional<DataChannelMessage>&, const std::string&)>& callback);
 
         std::unique_ptr<PeerConnectionHandler>
             createPeerConnectionHandler(const std::string& id, const Client& peerClient, bool isCaller) override;
+
+    private:
+        // The messages are encoded on the calling thread for the local protocol of the data channel. They are encoded
+        // again on the internal client thread for the peers that negotiated another protocol.
+        struct EncodedMessage
+        {
+            webrtc::DataBuffer message;
+            webrtc::DataBuffer buffer;
+            bool isCompressed;
+        };
+
+        bool isDataChannelCompressed(const std::string& channel) const;
+        EncodedMessage encodeMessage(const std::string& channel, const webrtc::DataBuffer& message);
+        const webrtc::DataBuffer& negotiateMessage(
+            const std::string& id,
+            const DataChannelPeerConnectionHandler& handler,
+            const std::string& channel,
+            const EncodedMessage& message,
+            absl::optional<webrtc::DataBuffer>& otherBuffer);
+        void sendEncodedMessage(
+            const std::string& id,
+            DataChannelPeerConnectionHandler* handler,
+            const std::string& channel,
+            const EncodedMessage& message,
+            absl::optional<webrtc::DataBuffer>& otherBuffer);
+        DataChannelPeerConnectionHandler* findDataChannelHandler(const std::string& id);
+
+        bool sendInternalFrame(const std::string& channel, const std::string& id, const webrtc::DataBuffer& frame);
+        void dispatchReceivedMessage(const Client& client, std::function<void()> callback);
+        bool tryDispatchDataChannelMessage(
+            const Client& client,
+            const std::string& channel,
+            const webrtc::DataBuffer& buffer);
+
+        void checkPubSubChannel() const;
+        void onPubSubFrame(const Client& client, const webrtc::DataBuffer& frame);
+
+        void sendClockSyncRequests();
+        void onClockSyncFrame(const Client& client, const webrtc::DataBuffer& frame);
+
+        void checkFileTransferChannel() const;
+        void sendFileChunks(OutgoingFileTransfer& transfer);
+        void onFileTransferFrame(const Client& client, const webrtc::DataBuffer& frame);
+        void onFileTransferOffer(
+            const Client& client,
+            uint32_t transferId,
+            uint64_t size,
+            uint64_t nonce,
+            const std::string& name);
+        void onFileTransferChunk(
+            const Client& client,
+            uint32_t transferId,
+            uint64_t offset,
+            uint32_t checksum,
+            const rtc::CopyOnWriteBuffer& data);
+        void onFileTransferAnswer(
+            const Client& client,
+            FileTransferFrame::Type type,
+            uint32_t transferId,
+            uint64_t offset);
+
+        void checkRpcChannel() const;
+        void onRpcFrame(const Client& client, const webrtc::DataBuffer& frame);
+        void onRpcRequest(
+            const Client& client,
+            uint32_t callId,
+            const std::string& method,
+            const DataChannelMessage& request);
     };
 
     /**
@@ -58,10 +325,11 @@ namespace opentera
      * @param data The binary data
      * @param size The binary data size
      * @param ids The client ids
+     * @return false if the data are not sent because the send queue of a client is full
      */
-    inline void DataChannelClient::sendTo(const uint8_t* data, size_t size, const std::vector<std::string>& ids)
+    inline bool DataChannelClient::sendTo(const uint8_t* data, size_t size, const std::vector<std::string>& ids)
     {
-        sendTo(webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true), ids);
+        return sendTo("", webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true), ids);
     }
 
     /**
@@ -69,10 +337,11 @@ namespace opentera
      *
      * @param message The string message
      * @param ids The client ids
+     * @return false if the message is not sent because the send queue of a client is full
      */
-    inline void DataChannelClient::sendTo(const std::string& message, const std::vector<std::string>& ids)
+    inline bool DataChannelClient::sendTo(const std::string& message, const std::vector<std::string>& ids)
     {
-        sendTo(webrtc::DataBuffer(message), ids);
+        return sendTo("", webrtc::DataBuffer(message), ids);
     }
 
     /**
@@ -80,18 +349,439 @@ namespace opentera
      *
      * @param data The binary data
      * @param size The binary data size
+     * @return false if the data are not sent because the send queue of a client is full
      */
-    inline void DataChannelClient::sendToAll(const uint8_t* data, size_t size)
+    inline bool DataChannelClient::sendToAll(const uint8_t* data, size_t size)
     {
-        sendToAll(webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true));
+        return sendToAll("", webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true));
     }
 
     /**
      * @brief Sends a string message to all clients.
      *
      * @param message The string message
+     * @return false if the message is not sent because the send queue of a client is full
+     */
+    inline bool DataChannelClient::sendToAll(const std::string& message)
+    {
+        return sendToAll("", webrtc::DataBuffer(message));
+    }
+
+    /**
+     * @brief Sends binary data to the specified clients on a named data channel.
+     *
+     * @param channel The data channel name
+     * @param data The binary data
+     * @param size The binary data size
+     * @param ids The client ids
+     * @return false if the data are not sent because the send queue of a client is full
+     */
+    inline bool DataChannelClient::sendTo(
+        const std::string& channel,
+        const uint8_t* data,
+        size_t size,
+        const std::vector<std::string>& ids)
+    {
+        return sendTo(channel, webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true), ids);
+    }
+
+    /**
+     * @brief Sends a string message to the specified clients on a named data channel.
+     *
+     * @param channel The data channel name
+     * @param message The string message
+     * @param ids The client ids
+     * @return false if the message is not sent because the send queue of a client is full
+     */
+    inline bool DataChannelClient::sendTo(
+        const std::string& channel,
+        const std::string& message,
+        const std::vector<std::string>& ids)
+    {
+        return sendTo(channel, webrtc::DataBuffer(message), ids);
+    }
+
+    /**
+     * @brief Sends binary data to all clients on a named data channel.
+     *
+     * @param channel The data channel name
+     * @param data The binary data
+     * @param size The binary data size
+     * @return false if the data are not sent because the send queue of a client is full
+     */
+    inline bool DataChannelClient::sendToAll(const std::string& channel, const uint8_t* data, size_t size)
+    {
+        return sendToAll(channel, webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true));
+    }
+
+    /**
+     * @brief Sends a string message to all clients on a named data channel.
+     *
+     * @param channel The data channel name
+     * @param message The string message
+     * @return false if the message is not sent because the send queue of a client is full
+     */
+    inline bool DataChannelClient::sendToAll(const std::string& channel, const std::string& message)
+    {
+        return sendToAll(channel, webrtc::DataBuffer(message));
+    }
+
+    /**
+     * @brief Sends binary data to the specified clients, replacing the unsent data that have the same key.
+     *
+     * The data are never refused by the send queue watermarks. When the link is congested, only the latest data of
+     * each key are kept in a bounded queue, so the clients receive fresh values instead of stale ones. The data are
+     * sent on the default data channel.
+     *
+     * @param key The data key (for example, the name of the value)
+     * @param data The binary data
+     * @param size The binary data size
+     * @param ids The client ids
+     */
+    inline void DataChannelClient::sendLatestTo(
+        const std::string& key,
+        const uint8_t* data,
+        size_t size,
+        const std::vector<std::string>& ids)
+    {
+        sendLatestTo(key, webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true), ids);
+    }
+
+    /**
+     * @brief Sends a string message to the specified clients, replacing the unsent message that has the same key.
+     *
+     * The message is never refused by the send queue watermarks. When the link is congested, only the latest
+     * message of each key is kept in a bounded queue, so the clients receive fresh values instead of stale ones. The
+     * message is sent on the default data channel.
+     *
+     * @param key The message key (for example, the name of the value)
+     * @param message The string message
+     * @param ids The client ids
+     */
+    inline void DataChannelClient::sendLatestTo(
+        const std::string& key,
+        const std::string& message,
+        const std::vector<std::string>& ids)
+    {
+        sendLatestTo(key, webrtc::DataBuffer(message), ids);
+    }
+
+    /**
+     * @brief Sends binary data to all clients, replacing the unsent data that have the same key.
+     *
+     * @param key The data key (for example, the name of the value)
+     * @param data The binary data
+     * @param size The binary data size
+     */
+    inline void DataChannelClient::sendLatestToAll(const std::string& key, const uint8_t* data, size_t size)
+    {
+        sendLatestToAll(key, webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true));
+    }
+
+    /**
+     * @brief Sends a string message to all clients, replacing the unsent message that has the same key.
+     *
+     * @param key The message key (for example, the name of the value)
+     * @param message The string message
+     */
+    inline void DataChannelClient::sendLatestToAll(const std::string& key, const std::string& message)
+    {
+        sendLatestToAll(key, webrtc::DataBuffer(message));
+    }
+
+    /**
+     * @brief Publishes binary data to the clients subscribed to a topic.
+     *
+     * The data are only sent to the clients that subscribed to the topic, on the data channel whose protocol is
+     * DataChannelConfiguration::PubSubProtocol.
+     *
+     * @param topic The topic
+     * @param data The binary data
+     * @param size The binary data size
+     * @return false if the data are not sent because the send queue of a subscriber is full
+     * @throw runtime_error if no data channel uses the pub/sub protocol
+     */
+    inline bool DataChannelClient::publish(uint16_t topic, const uint8_t* data, size_t size)
+    {
+        return publish(topic, webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true));
+    }
+
+    /**
+     * @brief Publishes a string message to the clients subscribed to a topic.
+     *
+     * @param topic The topic
+     * @param message The string message
+     * @return false if the message is not sent because the send queue of a subscriber is full
+     * @throw runtime_error if no data channel uses the pub/sub protocol
+     */
+    inline bool DataChannelClient::publish(uint16_t topic, const std::string& message)
+    {
+        return publish(topic, webrtc::DataBuffer(message));
+    }
+
+    /**
+     * @brief Returns the message and byte counters of a topic.
+     *
+     * @param topic The topic
+     * @return The counters of the topic
+     */
+    inline TopicStatistics DataChannelClient::topicStatistics(uint16_t topic) const
+    {
+        return m_topicRegistry.statistics(topic);
+    }
+
+    /**
+     * @brief Calls a method of a client with binary data as request.
+     *
+     * The request is sent on the data channel whose protocol is DataChannelConfiguration::RpcProtocol. Many calls
+     * can wait for their response at the same time, since each response carries the id of its call.
+     *
+     * @param id The client id
+     * @param method The method name
+     * @param data The request binary data
+     * @param size The request binary data size
+     * @return The future response, which throws runtime_error if the call fails or times out
+     * @throw runtime_error if no data channel uses the RPC protocol or if the method name is empty or longer than
+     * 255 bytes
+     */
+    inline std::future<DataChannelMessage>
+        DataChannelClient::call(const std::string& id, const std::string& method, const uint8_t* data, size_t size)
+    {
+        return call(id, method, webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true));
+    }
+
+    /**
+     * @brief Calls a method of a client with a string message as request.
+     *
+     * @param id The client id
+     * @param method The method name
+     * @param message The request string message
+     * @return The future response, which throws runtime_error if the call fails or times out
+     * @throw runtime_error if no data channel uses the RPC protocol or if the method name is empty or longer than
+     * 255 bytes
      */
-    inline void DataChannelClient::sendToAll(const std::string& message) { sendToAll(webrtc::DataBuffer(message)); }
+    inline std::future<DataChannelMessage>
+        DataChannelClient::call(const std::string& id, const std::string& method, const std::string& message)
+    {
+        return call(id, method, webrtc::DataBuffer(message));
+    }
+
+    /**
+     * @brief Calls a method of a client with binary data as request and passes the response to a callback.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - response: The response, or nothing if the call fails or times out
+     * - error: The error message, or an empty string if the call succeeds
+     * @endparblock
+     *
+     * @param id The client id
+     * @param method The method name
+     * @param data The request binary data
+     * @param size The request binary data size
+     * @param callback The callback
+     * @throw runtime_error if no data channel uses the RPC protocol or if the method name is empty or longer than
+     * 255 bytes
+     */
+    inline void DataChannelClient::call(
+        const std::string& id,
+        const std::string& method,
+        const uint8_t* data,
+        size_t size,
+        const std::function<void(const absl::optional<DataChannelMessage>&, const std::string&)>& callback)
+    {
+        call(id, method, webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true), callback);
+    }
+
+    /**
+     * @brief Calls a method of a client with a string message as request and passes the response to a callback.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - response: The response, or nothing if the call fails or times out
+     * - error: The error message, or an empty string if the call succeeds
+     * @endparblock
+     *
+     * @param id The client id
+     * @param method The method name
+     * @param message The request string message
+     * @param callback The callback
+     * @throw runtime_error if no data channel uses the RPC protocol or if the method name is empty or longer than
+     * 255 bytes
+     */
+    inline void DataChannelClient::call(
+        const std::string& id,
+        const std::string& method,
+        const std::string& message,
+        const std::function<void(const absl::optional<DataChannelMessage>&, const std::string&)>& callback)
+    {
+        call(id, method, webrtc::DataBuffer(message), callback);
+    }
+
+    /**
+     * @brief Sets the handler that answers the calls of a method.
+     *
+     * The handler returns the response. If it throws an exception, the caller receives its message as error. The
+     * calls of a method without handler fail. By default, the handlers are called from the internal client thread,
+     * so they should not block; setRpcWorkerCount moves them to a worker pool.
+     *
+     * @parblock
+     * Handler parameters:
+     * - client: The calling client
+     * - request: The request
+     * @endparblock
+     *
+     * @param method The method name
+     * @param handler The handler, or nullptr to remove it
+     */
+    inline void DataChannelClient::setRpcHandler(
+        const std::string& method,
+        const std::function<DataChannelMessage(const Client&, const DataChannelMessage&)>& handler)
+    {
+        callSync(getInternalClientThread(), [this, &method, &handler]() { m_rpcHandlersByMethod[method] = handler; });
+    }
+
+    /**
+     * @brief Returns the time after which the calls without response fail.
+     * @return The timeout (ms)
+     */
+    inline int64_t DataChannelClient::rpcTimeout() const { return m_rpcTimeoutMs; }
+
+    /**
+     * @brief Returns the number of threads that run the RPC handlers.
+     * @return The number of threads, or 0 if the handlers are called from the internal client thread
+     */
+    inline size_t DataChannelClient::rpcWorkerCount()
+    {
+        return callSync(
+            getInternalClientThread(),
+            [this]() { return m_rpcWorkerPool ? m_rpcWorkerPool->threadCount() : size_t(0); });
+    }
+
+    /**
+     * @brief Bounds the send queue of each client.
+     *
+     * A send call returns false without sending anything when it would make the number of bytes queued for a client
+     * exceed the high watermark. The buffered amount low callback is then called when the queue of this client falls
+     * to the low watermark. By default, the send queues are unbounded.
+     *
+     * @param lowWatermark The number of queued bytes at or under which the buffered amount low callback is called
+     * @param highWatermark The maximum number of queued bytes for a client
+     * @throw runtime_error if the low watermark is greater than the high watermark
+     */
+    inline void DataChannelClient::setSendQueueWatermarks(uint64_t lowWatermark, uint64_t highWatermark)
+    {
+        m_bufferedAmountTracker.setWatermarks(lowWatermark, highWatermark);
+    }
+
+    /**
+     * @brief Returns the number of bytes that are queued for a client and not sent yet.
+     *
+     * @param id The client id
+     * @return The number of bytes that are queued for the client
+     */
+    inline uint64_t DataChannelClient::bufferedAmount(const std::string& id) const
+    {
+        return m_bufferedAmountTracker.bufferedAmount(id);
+    }
+
+    /**
+     * @brief Sets the size under which the messages of the compressed data channels are sent uncompressed.
+     *
+     * The data channels whose protocol is DataChannelConfiguration::CompressedProtocol are compressed. The protocol is
+     * proposed by the caller, so the compression follows the configuration of the peer that makes the call. The
+     * messages are compressed on the thread that sends them, unless the protocol negotiated with a peer differs from
+     * the local one.
+     *
+     * @param threshold The threshold (bytes)
+     */
+    inline void DataChannelClient::setCompressionThreshold(size_t threshold)
+    {
+        m_messageCompressor.setThreshold(threshold);
+    }
+
+    /**
+     * @brief Returns the size under which the messages of the compressed data channels are sent uncompressed.
+     * @return The threshold (bytes)
+     */
+    inline size_t DataChannelClient::compressionThreshold() const { return m_messageCompressor.threshold(); }
+
+    /**
+     * @brief Returns the ratio between the sizes of the messages sent on the compressed data channels and the sizes
+     * of the sent data.
+     *
+     * @return The compression ratio, or 1 if no message was sent on a compressed data channel
+     */
+    inline double DataChannelClient::compressionRatio() const { return m_messageCompressor.compressionRatio(); }
+
+    /**
+     * @brief Returns the number of threads that call the message callbacks.
+     * @return The number of threads, or 0 if the callbacks are called from the internal client thread
+     */
+    inline size_t DataChannelClient::messageDispatchWorkerCount()
+    {
+        std::lock_guard<std::mutex> lock(m_messageDispatchMutex);
+        return m_messageDispatchPool ? m_messageDispatchPool->threadCount() : 0;
+    }
+
+    /**
+     * @brief Returns the number of received messages that wait for each thread that calls the message callbacks.
+     * @return The number of waiting messages for each thread, or an empty vector if the callbacks are called from
+     * the internal client thread
+     */
+    inline std::vector<size_t> DataChannelClient::messageDispatchQueueDepths()
+    {
+        std::lock_guard<std::mutex> lock(m_messageDispatchMutex);
+        return m_messageDispatchPool ? m_messageDispatchPool->queueDepths() : std::vector<size_t>();
+    }
+
+    /**
+     * @brief Indicates if the messages are split into frames.
+     * @return true if the messages are split into frames
+     */
+    inline bool DataChannelClient::isMessageFragmentationEnabled()
+    {
+        return callSync(getInternalClientThread(), [this]() { return m_isMessageFragmentationEnabled; });
+    }
+
+    /**
+     * @brief Enables or disables the message fragmentation.
+     *
+     * When it is enabled, the messages are split into frames of 16 KiB (see setMaxFrameSize), which are
+     * interleaved fairly and reassembled by the receiver, so large messages do not block the small ones. It is
+     * proposed to the peers by appending DataChannelConfiguration::FragmentedProtocolSuffix to the protocol of the
+     * ordered and reliable data channels created by the calls of this client. Both peers split the messages of these
+     * data channels into frames, and the other data channels carry plain messages. The peers must use this library if
+     * it is enabled. It must be set before the calls are made.
+     *
+     * @param enabled Indicates if the messages are split into frames
+     */
+    inline void DataChannelClient::setMessageFragmentationEnabled(bool enabled)
+    {
+        callSync(getInternalClientThread(), [this, enabled]() { m_isMessageFragmentationEnabled = enabled; });
+    }
+
+    /**
+     * @brief Returns the maximum size of the frames and batches created by the message fragmentation and coalescing.
+     * @return The maximum size (bytes)
+     */
+    inline size_t DataChannelClient::maxFrameSize()
+    {
+        return callSync(getInternalClientThread(), [this]() { return m_maxFrameSize; });
+    }
+
+    /**
+     * @brief Returns the number of frame bytes that can wait in the buffer of a data channel.
+     * @return The frame send buffer size (bytes)
+     */
+    inline uint64_t DataChannelClient::frameSendBufferSize()
+    {
+        return callSync(getInternalClientThread(), [this]() { return m_frameSendBufferSize; });
+    }
 
     /**
      * @brief Sets the callback that is called when a data channel opens.
@@ -110,6 +800,31 @@ namespace opentera
         callSync(getInternalClientThread(), [this, &callback]() { m_onDataChannelOpened = callback; });
     }
 
+    /**
+     * @brief Sets the callback that is called when a named data channel opens.
+     *
+     * The named data channels open after the default one, and the messages sent on a named data channel before it
+     * opens are dropped.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client of the data channel that opens
+     * @endparblock
+     *
+     * @param channel The data channel name
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnDataChannelOpened(
+        const std::string& channel,
+        const std::function<void(const Client&)>& callback)
+    {
+        callSync(
+            getInternalClientThread(),
+            [this, &channel, &callback]() { m_onNamedDataChannelOpenedByChannel[channel] = callback; });
+    }
+
     /**
      * @brief Sets the callback that is called when a data channel closes.
      *
@@ -163,7 +878,13 @@ namespace opentera
     inline void DataChannelClient::setOnDataChannelMessageBinary(
         const std::function<void(const Client&, const uint8_t*, std::size_t)>& callback)
     {
-        callSync(getInternalClientThread(), [this, &callback]() { m_onDataChannelMessageBinary = callback; });
+        callSync(
+            getInternalClientThread(),
+            [this, &callback]()
+            {
+                std::lock_guard<std::mutex> lock(m_messageDispatchMutex);
+                m_onDataChannelMessageBinary = callback;
+            });
     }
 
     /**
@@ -182,7 +903,241 @@ namespace opentera
     inline void DataChannelClient::setOnDataChannelMessageString(
         const std::function<void(const Client&, const std::string&)>& callback)
     {
-        callSync(getInternalClientThread(), [this, &callback]() { m_onDataChannelMessageString = callback; });
+        callSync(
+            getInternalClientThread(),
+            [this, &callback]()
+            {
+                std::lock_guard<std::mutex> lock(m_messageDispatchMutex);
+                m_onDataChannelMessageString = callback;
+            });
+    }
+
+    /**
+     * @brief Sets the callback that is called when a message is received, without copying it.
+     *
+     * The callback is called from the internal client thread. The callback should not block. It is called in
+     * addition to the binary or string message callback. The message shares the received buffer, so it can be kept
+     * after the callback returns without copying the data.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client the message is from
+     * - message: The message
+     * @endparblock
+     *
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnDataChannelMessage(
+        const std::function<void(const Client&, const DataChannelMessage&)>& callback)
+    {
+        callSync(
+            getInternalClientThread(),
+            [this, &callback]()
+            {
+                std::lock_guard<std::mutex> lock(m_messageDispatchMutex);
+                m_onDataChannelMessage = callback;
+            });
+    }
+
+    /**
+     * @brief Sets the callback that is called when binary data are received on a named data channel.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client the binary data are from
+     * - data: The binary data
+     * - dataSize: The binary data size
+     * @endparblock
+     *
+     * @param channel The data channel name
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnDataChannelMessageBinary(
+        const std::string& channel,
+        const std::function<void(const Client&, const uint8_t*, std::size_t)>& callback)
+    {
+        callSync(
+            getInternalClientThread(),
+            [this, &channel, &callback]()
+            {
+                std::lock_guard<std::mutex> lock(m_messageDispatchMutex);
+                m_onNamedDataChannelMessageBinaryByChannel[channel] = callback;
+            });
+    }
+
+    /**
+     * @brief Sets the callback that is called when a string message is received on a named data channel.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client the string message is from
+     * - message: The string message
+     * @endparblock
+     *
+     * @param channel The data channel name
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnDataChannelMessageString(
+        const std::string& channel,
+        const std::function<void(const Client&, const std::string&)>& callback)
+    {
+        callSync(
+            getInternalClientThread(),
+            [this, &channel, &callback]()
+            {
+                std::lock_guard<std::mutex> lock(m_messageDispatchMutex);
+                m_onNamedDataChannelMessageStringByChannel[channel] = callback;
+            });
+    }
+
+    /**
+     * @brief Sets the callback that is called when a message is received on a named data channel, without copying
+     * it.
+     *
+     * The callback is called from the internal client thread. The callback should not block. It is called in
+     * addition to the binary or string message callback of the channel.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client the message is from
+     * - message: The message
+     * @endparblock
+     *
+     * @param channel The data channel name
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnDataChannelMessage(
+        const std::string& channel,
+        const std::function<void(const Client&, const DataChannelMessage&)>& callback)
+    {
+        callSync(
+            getInternalClientThread(),
+            [this, &channel, &callback]()
+            {
+                std::lock_guard<std::mutex> lock(m_messageDispatchMutex);
+                m_onNamedDataChannelMessageByChannel[channel] = callback;
+            });
+    }
+
+    /**
+     * @brief Sets the callback that is called when the send queue of a client falls to the low watermark after a
+     * send call was refused.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client that can receive data again
+     * @endparblock
+     *
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnDataChannelBufferedAmountLow(const std::function<void(const Client&)>& callback)
+    {
+        callSync(getInternalClientThread(), [this, &callback]() { m_onDataChannelBufferedAmountLow = callback; });
+    }
+
+    /**
+     * @brief Sets the callback that is called when a chunk of a fragmented message is received.
+     *
+     * When it is set, the messages larger than one frame are not reassembled, so they are never held in memory. These
+     * messages are passed chunk by chunk to this callback instead of the message callbacks. The messages that fit in
+     * one frame are still passed to the message callbacks. It is only used when the default data channel is fragmented
+     * and it must be set before the calls are made.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client the chunk is from
+     * - messageId: The id of the message, unique per sender
+     * - data: The chunk data
+     * - dataSize: The chunk size
+     * - offset: The chunk offset in the message
+     * - messageSize: The message size
+     * - isBinary: Indicates if the message is binary data or a string message
+     * @endparblock
+     *
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnDataChannelMessageChunk(
+        const std::function<void(const Client&, uint32_t, const uint8_t*, std::size_t, std::size_t, std::size_t, bool)>&
+            callback)
+    {
+        callSync(getInternalClientThread(), [this, &callback]() { m_onDataChannelMessageChunk = callback; });
+    }
+
+    /**
+     * @brief Sets the callback that is called when a message is received on a subscribed topic.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client the message is from
+     * - topic: The topic
+     * - message: The message
+     * @endparblock
+     *
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnTopicMessage(
+        const std::function<void(const Client&, uint16_t, const DataChannelMessage&)>& callback)
+    {
+        callSync(getInternalClientThread(), [this, &callback]() { m_onTopicMessage = callback; });
+    }
+
+    /**
+     * @brief Sets the callback that is called when a client offers a file.
+     *
+     * The callback returns the path of the destination file, which is created with the file size before the data
+     * are received, or an empty string to refuse the file. The offers are refused when the callback is not set. When
+     * the sender reconnects, the interrupted transfers are resumed without calling the callback again.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client that offers the file
+     * - name: The file name
+     * - size: The file size (bytes)
+     * @endparblock
+     *
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnFileTransferRequested(
+        const std::function<std::string(const Client&, const std::string&, uint64_t)>& callback)
+    {
+        callSync(getInternalClientThread(), [this, &callback]() { m_onFileTransferRequested = callback; });
+    }
+
+    /**
+     * @brief Sets the callback that is called when the receiver writes file data.
+     *
+     * The transfer is complete when the transferred size is equal to the file size. For an incoming file, the
+     * destination file is closed before the last call.
+     *
+     * The callback is called from the internal client thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client that sends or receives the file
+     * - name: The file name
+     * - isIncoming: Indicates if the file is received
+     * - transferredSize: The number of bytes written by the receiver
+     * - size: The file size (bytes)
+     * @endparblock
+     *
+     * @param callback The callback
+     */
+    inline void DataChannelClient::setOnFileTransferProgress(
+        const std::function<void(const Client&, const std::string&, bool, uint64_t, uint64_t)>& callback)
+    {
+        callSync(getInternalClientThread(), [this, &callback]() { m_onFileTransferProgress = callback; });
     }
 }
 
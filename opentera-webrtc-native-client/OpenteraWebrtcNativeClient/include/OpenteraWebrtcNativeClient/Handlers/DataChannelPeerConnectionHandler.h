@@ -3,25 +3,105 @@
 
 #include <OpenteraWebrtcNativeClient/Handlers/PeerConnectionHandler.h>
 #include <OpenteraWebrtcNativeClient/Configurations/DataChannelConfiguration.h>
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+#include <OpenteraWebrtcNativeClient/Utils/ConflatingQueue.h>
+#include <OpenteraWebrtcNativeClient/Utils/MessageCoalescer.h>
+#include <OpenteraWebrtcNativeClient/Utils/MessageCompressor.h>
+#include <OpenteraWebrtcNativeClient/Utils/MessageFragmenter.h>
+#include <OpenteraWebrtcNativeClient/Utils/MessageReassembler.h>
 
+#include <absl/types/optional.h>
 #include <api/data_channel_interface.h>
+#include <api/task_queue/pending_task_safety_flag.h>
+#include <rtc_base/thread.h>
 
 #include <functional>
+#include <map>
+#include <memory>
 
 namespace opentera
 {
-    class DataChannelPeerConnectionHandler : public PeerConnectionHandler, public webrtc::DataChannelObserver
+    using DataChannelMessageChunkCallback = std::function<void(
+        const Client& client,
+        uint32_t messageId,
+        const uint8_t* data,
+        size_t size,
+        size_t offset,
+        size_t messageSize,
+        bool isBinary)>;
+
+    class DataChannelPeerConnectionHandler : public PeerConnectionHandler
     {
+        // The default channel has an empty name and is labelled with the room name. The send state is only changed on
+        // the internal client thread, so the callbacks of the data channel post their work to it.
+        class Channel : public webrtc::DataChannelObserver
+        {
+            DataChannelPeerConnectionHandler& m_handler;
+            std::string m_name;
+            rtc::scoped_refptr<webrtc::DataChannelInterface> m_dataChannel;
+            bool m_isCompressed;
+            bool m_isCoalesced;
+
+            std::unique_ptr<MessageCoalescer> m_messageCoalescer;
+            uint64_t m_unreportedRecordHeaderSize;
+            bool m_isFlushScheduled;
+
+            std::unique_ptr<MessageFragmenter> m_messageFragmenter;
+            std::unique_ptr<MessageReassembler> m_messageReassembler;
+
+            ConflatingQueue m_latestMessages;
+            uint64_t m_pendingSize;
+
+            rtc::scoped_refptr<webrtc::PendingTaskSafetyFlag> m_safetyFlag;
+
+        public:
+            Channel(
+                DataChannelPeerConnectionHandler& handler,
+                std::string name,
+                rtc::scoped_refptr<webrtc::DataChannelInterface> dataChannel);
+            ~Channel() override;
+
+            DECLARE_NOT_COPYABLE(Channel);
+            DECLARE_NOT_MOVABLE(Channel);
+
+            bool isCompressed() const;
+            bool send(const webrtc::DataBuffer& buffer);
+            bool sendLatest(std::string key, const webrtc::DataBuffer& buffer);
+
+            void OnStateChange() override;
+            void OnMessage(const webrtc::DataBuffer& buffer) override;
+            void OnBufferedAmountChange(uint64_t sentDataSize) override;
+
+        private:
+            bool sendMessage(const webrtc::DataBuffer& buffer);
+            bool sendUncoalesced(const webrtc::DataBuffer& buffer);
+            void onDataSent(uint64_t sentDataSize);
+            void scheduleFlush();
+            void sendBatches();
+            void sendFrames();
+            void sendLatestMessages();
+            void reportSent(uint64_t sentMessageSize);
+            void releasePendingData();
+            void deliverMessage(const webrtc::DataBuffer& buffer);
+        };
+
+        rtc::Thread* m_internalClientThread;
         std::string m_room;
         DataChannelConfiguration m_dataChannelConfiguration;
+        std::map<std::string, DataChannelConfiguration> m_namedDataChannelConfigurations;
 
         std::function<void(const Client&)> m_onDataChannelOpen;
+        std::function<void(const Client&, const std::string&)> m_onNamedDataChannelOpen;
         std::function<void(const Client&)> m_onDataChannelClosed;
         std::function<void(const Client&, const std::string&)> m_onDataChannelError;
-        std::function<void(const Client&, const webrtc::DataBuffer& buffer)> m_onDataChannelMessageBinary;
-        std::function<void(const Client&, const std::string&)> m_onDataChannelMessageString;
+        std::function<void(const Client&, const std::string&, const webrtc::DataBuffer& buffer)> m_onDataChannelMessage;
+        std::function<void(const Client&, uint64_t)> m_onDataChannelBufferedAmountChange;
+        bool m_isMessageFragmentationEnabled;
+        size_t m_maxFrameSize;
+        uint64_t m_frameSendBufferSize;
+        DataChannelMessageChunkCallback m_onDataChannelMessageChunk;
 
-        rtc::scoped_refptr<webrtc::DataChannelInterface> m_dataChannel;
+        std::map<std::string, std::unique_ptr<Channel>> m_channelsByName;
 
         bool m_onDataChannelClosedCalled;
 
@@ -34,28 +114,38 @@ namespace opentera
             std::function<void(const std::string&)> onError,
             std::function<void(const Client&)> onClientConnected,
             std::function<void(const Client&)> onClientDisconnected,
+            rtc::Thread* internalClientThread,
             std::string room,
             DataChannelConfiguration dataChannelConfiguration,
+            std::map<std::string, DataChannelConfiguration> namedDataChannelConfigurations,
             std::function<void(const Client&)> onDataChannelOpen,
+            std::function<void(const Client&, const std::string&)> onNamedDataChannelOpen,
             std::function<void(const Client&)> onDataChannelClosed,
             std::function<void(const Client&, const std::string&)> onDataChannelError,
-            std::function<void(const Client&, const webrtc::DataBuffer& buffer)> onDataChannelMessageBinary,
-            std::function<void(const Client&, const std::string&)> onDataChannelMessageString);
+            std::function<void(const Client&, const std::string&, const webrtc::DataBuffer& buffer)>
+                onDataChannelMessage,
+            std::function<void(const Client&, uint64_t)> onDataChannelBufferedAmountChange,
+            bool isMessageFragmentationEnabled,
+            size_t maxFrameSize,
+            uint64_t frameSendBufferSize,
+            DataChannelMessageChunkCallback onDataChannelMessageChunk);
 
         ~DataChannelPeerConnectionHandler() override;
 
         void setPeerConnection(const rtc::scoped_refptr<webrtc::PeerConnectionInterface>& peerConnection) override;
 
-        void send(const webrtc::DataBuffer& buffer);
+        absl::optional<bool> isDataChannelCompressed(const std::string& channel) const;
+        bool send(const std::string& channel, const webrtc::DataBuffer& buffer);
+        bool sendLatest(const std::string& channel, std::string key, const webrtc::DataBuffer& buffer);
 
         // Observer methods
         void OnDataChannel(rtc::scoped_refptr<webrtc::DataChannelInterface> dataChannel) override;
 
-        void OnStateChange() override;
-        void OnMessage(const webrtc::DataBuffer& buffer) override;
-
     protected:
         void createAnswer() override;
+
+    private:
+        void createDataChannel(const std::string& name, const DataChannelConfiguration& configuration);
     };
 }
 
@@ -61,6 +61,8 @@ namespace opentera
 
         virtual void setPeerConnection(const rtc::scoped_refptr<webrtc::PeerConnectionInterface>& peerConnection);
 
+        const Client& peerClient() const;
+
         void makePeerCall();
         void receivePeerCall(const std::string& sdp);
         void receivePeerCallAnswer(const std::string& sdp);
@@ -91,6 +93,8 @@ namespace opentera
         virtual void createAnswer();
     };
 
+    inline const Client& PeerConnectionHandler::peerClient() const { return m_peerClient; }
+
     void setTransceiverDirection(
         const rtc::scoped_refptr<webrtc::RtpTransceiverInterface>& transceiver,
         webrtc::RtpTransceiverDirection direction);
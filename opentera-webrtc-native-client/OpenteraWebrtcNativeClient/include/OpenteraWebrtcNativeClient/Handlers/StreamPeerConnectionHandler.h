@@ -4,7 +4,9 @@
 #include <OpenteraWebrtcNativeClient/Handlers/PeerConnectionHandler.h>
 #include <OpenteraWebrtcNativeClient/Sinks/VideoSink.h>
 #include <OpenteraWebrtcNativeClient/Sinks/EncodedVideoSink.h>
+#include <OpenteraWebrtcNativeClient/Sinks/EncodedAudioSink.h>
 #include <OpenteraWebrtcNativeClient/Sinks/AudioSink.h>
+#include <OpenteraWebrtcNativeClient/Utils/MediaSynchronizer.h>
 
 #include <set>
 
@@ -27,11 +29,28 @@ namespace opentera
         int sampleRate,
         size_t numberOfChannels,
         size_t numberOfFrames)>;
+    using TimestampedAudioFrameReceivedCallback = std::function<void(
+        const Client& client,
+        const void* audioData,
+        int bitsPerSample,
+        int sampleRate,
+        size_t numberOfChannels,
+        size_t numberOfFrames,
+        uint64_t timestampUs)>;
+    using EncodedAudioFrameReceivedCallback = std::function<void(
+        const Client& client,
+        const uint8_t* data,
+        size_t dataSize,
+        size_t numberOfFrames,
+        uint32_t rtpTimestamp)>;
+    using AudioLevelChangedCallback = std::function<void(const Client& client, const AudioLevel& level)>;
 
     class StreamPeerConnectionHandler : public PeerConnectionHandler
     {
         bool m_offerToReceiveVideo;
         bool m_offerToReceiveAudio;
+        double m_remoteAudioGain;
+        bool m_isStereoAudioEnabled;
 
         rtc::scoped_refptr<webrtc::VideoTrackInterface> m_videoTrack;
         rtc::scoped_refptr<webrtc::AudioTrackInterface> m_audioTrack;
@@ -39,9 +58,11 @@ namespace opentera
         std::function<void(const Client&)> m_onAddRemoteStream;
         std::function<void(const Client&)> m_onRemoveRemoteStream;
 
+        std::unique_ptr<MediaSynchronizer> m_mediaSynchronizer;
         std::unique_ptr<VideoSink> m_videoSink;
         std::unique_ptr<EncodedVideoSink> m_encodedVideoSink;
         std::unique_ptr<AudioSink> m_audioSink;
+        rtc::scoped_refptr<EncodedAudioSink> m_encodedAudioSink;
 
         std::set<rtc::scoped_refptr<webrtc::MediaStreamTrackInterface>> m_tracks;
 
@@ -61,7 +82,13 @@ namespace opentera
             std::function<void(const Client&)> onRemoveRemoteStream,
             const VideoFrameReceivedCallback& onVideoFrameReceived,
             const EncodedVideoFrameReceivedCallback& onEncodedVideoFrameReceived,
-            const AudioFrameReceivedCallback& onAudioFrameReceived);
+            const AudioFrameReceivedCallback& onAudioFrameReceived,
+            const TimestampedAudioFrameReceivedCallback& onTimestampedAudioFrameReceived,
+            const AudioSinkConfiguration& audioSinkConfiguration,
+            const EncodedAudioFrameReceivedCallback& onEncodedAudioFrameReceived,
+            bool isAudioLevelMeteringEnabled,
+            const AudioLevelChangedCallback& onAudioLevelChanged,
+            bool isAudioVideoSynchronizationEnabled);
 
         ~StreamPeerConnectionHandler() override;
 
@@ -70,11 +97,17 @@ namespace opentera
         void setAllLocalAudioTracksEnabled(bool enabled);
         void setAllRemoteAudioTracksEnabled(bool enabled);
         void setAllVideoTracksEnabled(bool enabled);
+        void setRemoteAudioGain(double gain);
+        AudioLevel audioLevel() const;
+        void setAudioRecorder(std::shared_ptr<AudioRecorder> audioRecorder);
+        void setStereoAudioEnabled(bool enabled);
 
         // Observer methods
         void OnTrack(rtc::scoped_refptr<webrtc::RtpTransceiverInterface> transceiver) override;
         void OnRemoveTrack(rtc::scoped_refptr<webrtc::RtpReceiverInterface> receiver) override;
 
+        void OnCreateSessionDescriptionObserverSuccess(webrtc::SessionDescriptionInterface* desc) override;
+
     protected:
         void createAnswer() override;
 
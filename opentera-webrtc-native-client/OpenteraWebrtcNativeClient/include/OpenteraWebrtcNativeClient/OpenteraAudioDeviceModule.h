@@ -3,6 +3,8 @@
 
 #include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
 #include <OpenteraWebrtcNativeClient/Sinks/AudioSink.h>
+#include <OpenteraWebrtcNativeClient/Sinks/AudioRecorder.h>
+#include <OpenteraWebrtcNativeClient/Utils/AudioClock.h>
 
 #include <modules/audio_device/include/audio_device.h>
 
@@ -19,6 +21,8 @@ namespace opentera
     class OpenteraAudioDeviceModule : public webrtc::AudioDeviceModule
     {
         AudioSinkCallback m_onMixedAudioFrameReceived;
+        std::shared_ptr<AudioRecorder> m_mixedAudioRecorder;
+        std::shared_ptr<AudioClock> m_clock;
 
         bool m_isPlayoutInitialized;
         bool m_isRecordingInitialized;
@@ -43,6 +47,8 @@ namespace opentera
         DECLARE_NOT_MOVABLE(OpenteraAudioDeviceModule);
 
         void setOnMixedAudioFrameReceived(const AudioSinkCallback& onMixedAudioFrameReceived);
+        void setMixedAudioRecorder(std::shared_ptr<AudioRecorder> mixedAudioRecorder);
+        void setClock(std::shared_ptr<AudioClock> clock);
         void sendFrame(
             const void* audioData,
             int bitsPerSample,
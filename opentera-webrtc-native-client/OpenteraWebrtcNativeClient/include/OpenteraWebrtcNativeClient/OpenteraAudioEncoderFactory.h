@@ -0,0 +1,50 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_OPENTERA_AUDIO_ENCODER_FACTORY_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_OPENTERA_AUDIO_ENCODER_FACTORY_H
+
+#include <OpenteraWebrtcNativeClient/Configurations/OpusEncoderConfiguration.h>
+#include <OpenteraWebrtcNativeClient/Sources/EncodedAudioSource.h>
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <api/audio_codecs/audio_encoder_factory.h>
+
+#include <memory>
+
+namespace opentera
+{
+    class OpusEncoderConfigurationState;
+
+    /**
+     * @brief Audio encoder factory that creates the built-in encoders and applies an OpusEncoderConfiguration to the
+     * Opus encoders.
+     *
+     * The Opus encoders check the configuration at each packet boundary and are recreated when it changes, so the
+     * configuration can be changed during a call without renegotiating it. If an EncodedAudioSource is set, the
+     * Opus encoders send its packets instead of encoding the audio.
+     */
+    class OpenteraAudioEncoderFactory : public webrtc::AudioEncoderFactory
+    {
+        rtc::scoped_refptr<webrtc::AudioEncoderFactory> m_builtinAudioEncoderFactory;
+        std::shared_ptr<OpusEncoderConfigurationState> m_opusEncoderConfigurationState;
+        std::shared_ptr<EncodedAudioSource> m_encodedAudioSource;
+
+    public:
+        OpenteraAudioEncoderFactory();
+        ~OpenteraAudioEncoderFactory() override = default;
+
+        DECLARE_NOT_COPYABLE(OpenteraAudioEncoderFactory);
+        DECLARE_NOT_MOVABLE(OpenteraAudioEncoderFactory);
+
+        OpusEncoderConfiguration opusEncoderConfiguration() const;
+        void setOpusEncoderConfiguration(const OpusEncoderConfiguration& configuration);
+        void setEncodedAudioSource(std::shared_ptr<EncodedAudioSource> encodedAudioSource);
+
+        std::vector<webrtc::AudioCodecSpec> GetSupportedEncoders() override;
+        absl::optional<webrtc::AudioCodecInfo> QueryAudioEncoder(const webrtc::SdpAudioFormat& format) override;
+        std::unique_ptr<webrtc::AudioEncoder> MakeAudioEncoder(
+            int payloadType,
+            const webrtc::SdpAudioFormat& format,
+            absl::optional<webrtc::AudioCodecPairId> codecPairId) override;
+    };
+}
+
+#endif
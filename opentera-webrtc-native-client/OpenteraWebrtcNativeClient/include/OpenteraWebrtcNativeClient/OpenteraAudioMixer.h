@@ -0,0 +1,99 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_OPENTERA_AUDIO_MIXER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_OPENTERA_AUDIO_MIXER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <api/audio/audio_frame.h>
+#include <api/audio/audio_mixer.h>
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace opentera
+{
+    /**
+     * @brief Audio mixer that only mixes the N loudest active sources.
+     *
+     * Muted sources and sources whose level is below the silence threshold are never summed, so the mixing cost
+     * grows with the number of active speakers instead of the number of peers. The per-peer gain is applied by the
+     * receive streams before the frames reach the mixer (see StreamClient::setRemoteAudioGain).
+     */
+    class OpenteraAudioMixer : public webrtc::AudioMixer
+    {
+        struct SourceState
+        {
+            Source* source;
+            webrtc::AudioFrame frame;
+            double energy;
+        };
+
+        std::atomic<size_t> m_maxMixedSourceCount;
+        std::atomic<float> m_silenceThresholdDbfs;
+
+        std::mutex m_mutex;
+        std::vector<std::unique_ptr<SourceState>> m_sourceStates;
+        std::vector<SourceState*> m_activeSourceStates;
+        std::array<int32_t, webrtc::AudioFrame::kMaxDataSizeSamples> m_mixingBuffer;
+
+    public:
+        static constexpr size_t DefaultMaxMixedSourceCount = 3;
+        static constexpr float DefaultSilenceThresholdDbfs = -60.f;
+
+        explicit OpenteraAudioMixer(
+            size_t maxMixedSourceCount = DefaultMaxMixedSourceCount,
+            float silenceThresholdDbfs = DefaultSilenceThresholdDbfs);
+        ~OpenteraAudioMixer() override = default;
+
+        DECLARE_NOT_COPYABLE(OpenteraAudioMixer);
+        DECLARE_NOT_MOVABLE(OpenteraAudioMixer);
+
+        size_t maxMixedSourceCount() const;
+        void setMaxMixedSourceCount(size_t maxMixedSourceCount);
+
+        float silenceThresholdDbfs() const;
+        void setSilenceThresholdDbfs(float silenceThresholdDbfs);
+
+        bool AddSource(Source* source) override;
+        void RemoveSource(Source* source) override;
+        void Mix(size_t numberOfChannels, webrtc::AudioFrame* audioFrameForMixing) override;
+
+    private:
+        int calculateOutputSampleRate();
+        void mixActiveSources(size_t mixedSourceCount, webrtc::AudioFrame* audioFrameForMixing);
+    };
+
+    /**
+     * @brief Returns the maximum number of sources mixed together.
+     * @return The maximum number of sources mixed together
+     */
+    inline size_t OpenteraAudioMixer::maxMixedSourceCount() const { return m_maxMixedSourceCount.load(); }
+
+    /**
+     * @brief Sets the maximum number of sources mixed together.
+     * @param maxMixedSourceCount The maximum number of sources mixed together
+     */
+    inline void OpenteraAudioMixer::setMaxMixedSourceCount(size_t maxMixedSourceCount)
+    {
+        m_maxMixedSourceCount.store(maxMixedSourceCount);
+    }
+
+    /**
+     * @brief Returns the RMS level under which a source is considered silent.
+     * @return The RMS level under which a source is considered silent (dBFS)
+     */
+    inline float OpenteraAudioMixer::silenceThresholdDbfs() const { return m_silenceThresholdDbfs.load(); }
+
+    /**
+     * @brief Sets the RMS level under which a source is considered silent.
+     * @param silenceThresholdDbfs The RMS level under which a source is considered silent (dBFS)
+     */
+    inline void OpenteraAudioMixer::setSilenceThresholdDbfs(float silenceThresholdDbfs)
+    {
+        m_silenceThresholdDbfs.store(silenceThresholdDbfs);
+    }
+}
+
+#endif
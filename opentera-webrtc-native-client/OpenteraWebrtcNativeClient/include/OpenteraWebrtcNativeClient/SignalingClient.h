@@ -9,6 +9,8 @@
 #include <OpenteraWebrtcNativeClient/Handlers/PeerConnectionHandler.h>
 #include <OpenteraWebrtcNativeClient/Utils/FunctionTask.h>
 #include <OpenteraWebrtcNativeClient/OpenteraAudioDeviceModule.h>
+#include <OpenteraWebrtcNativeClient/OpenteraAudioEncoderFactory.h>
+#include <OpenteraWebrtcNativeClient/OpenteraAudioMixer.h>
 
 #include <sio_client.h>
 
@@ -65,12 +67,16 @@ namespace opentera
         std::map<std::string, std::unique_ptr<PeerConnectionHandler>> m_peerConnectionHandlersById;
 
         rtc::scoped_refptr<OpenteraAudioDeviceModule> m_audioDeviceModule;
+        rtc::scoped_refptr<webrtc::AudioMixer> m_audioMixer;
         rtc::scoped_refptr<webrtc::AudioProcessing> m_audioProcessing;
+        rtc::scoped_refptr<OpenteraAudioEncoderFactory> m_audioEncoderFactory;
 
     public:
         SignalingClient(
             SignalingServerConfiguration&& signalingServerConfiguration,
-            WebrtcConfiguration&& webrtcConfiguration);
+            WebrtcConfiguration&& webrtcConfiguration,
+            rtc::scoped_refptr<webrtc::AudioMixer> audioMixer = nullptr,
+            bool isAudioProcessingEnabled = true);
         virtual ~SignalingClient() = default;
 
         DECLARE_NOT_COPYABLE(SignalingClient);
@@ -0,0 +1,85 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_AUDIO_RECORDER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_AUDIO_RECORDER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace opentera
+{
+    enum class AudioRecordingFormat
+    {
+        Wav,
+        OggOpus
+    };
+
+    class AudioFileWriter;
+    struct AudioChunkHeader;
+
+    /**
+     * @brief Records an audio stream to a file.
+     *
+     * write only copies the audio data into a preallocated buffer, so it can be called from a real-time thread.
+     * The encoding and the file writes are done by a background thread in large batches.
+     * The WAV file keeps the format of the first frame. The Ogg/Opus file is encoded at 48000 Hz with at most 2
+     * channels, unless Opus packets are written as they are with writeEncoded.
+     * Frames that cannot be recorded (full buffer, format change) are dropped and counted.
+     */
+    class AudioRecorder
+    {
+        std::unique_ptr<AudioFileWriter> m_fileWriter;
+
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::vector<uint8_t> m_pendingBuffer;
+        size_t m_pendingSize;
+        std::vector<uint8_t> m_writingBuffer;
+        bool m_isClosing;
+
+        std::atomic<size_t> m_droppedFrameCount;
+        std::thread m_thread;
+
+    public:
+        static constexpr size_t DefaultBufferSize = 1 << 20;
+
+        AudioRecorder(
+            const std::string& path,
+            AudioRecordingFormat format,
+            size_t bufferSize = DefaultBufferSize);
+        virtual ~AudioRecorder();
+
+        DECLARE_NOT_COPYABLE(AudioRecorder);
+        DECLARE_NOT_MOVABLE(AudioRecorder);
+
+        void write(
+            const void* audioData,
+            int bitsPerSample,
+            int sampleRate,
+            size_t numberOfChannels,
+            size_t numberOfFrames);
+        void writeEncoded(const uint8_t* data, size_t dataSize, size_t numberOfChannels);
+        void close();
+
+        size_t droppedFrameCount() const;
+
+    private:
+        void queueChunk(const AudioChunkHeader& header, const void* data);
+        void run();
+        void writeChunks(size_t size);
+    };
+
+    /**
+     * @brief Returns the number of frames that were not recorded.
+     * @return The number of frames that were not recorded
+     */
+    inline size_t AudioRecorder::droppedFrameCount() const { return m_droppedFrameCount.load(); }
+}
+
+#endif
@@ -1,23 +1,54 @@
 #ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_AUDIO_SINK_H
 #define OPENTERA_WEBRTC_NATIVE_CLIENT_AUDIO_SINK_H
 
+#include <OpenteraWebrtcNativeClient/Configurations/AudioSinkConfiguration.h>
+#include <OpenteraWebrtcNativeClient/Sinks/AudioRecorder.h>
+#include <OpenteraWebrtcNativeClient/Utils/AudioConverter.h>
+#include <OpenteraWebrtcNativeClient/Utils/AudioLevelMeter.h>
+
 #include <api/media_stream_interface.h>
 
+#include <memory>
+
 namespace opentera
 {
     using AudioSinkCallback = std::function<
         void(const void* audioData, int bitsPerSample, int sampleRate, size_t numberOfChannels, size_t numberOfFrames)>;
+    using TimestampedAudioSinkCallback = std::function<void(
+        const void* audioData,
+        int bitsPerSample,
+        int sampleRate,
+        size_t numberOfChannels,
+        size_t numberOfFrames,
+        uint64_t timestampUs)>;
+    using AudioLevelSinkCallback = std::function<void(const AudioLevel& level)>;
 
     /**
      * @brief Class that sinks audio data from the WebRTC transport layer and feeds
      * it to the provided callback.
+     *
+     * The frames are timestamped when they are played out (rtc::TimeMicros clock). The video frames are
+     * timestamped with their render time in the same clock, so the timestamps of both streams can be compared.
      */
     class AudioSink : public webrtc::AudioTrackSinkInterface
     {
-        AudioSinkCallback m_onAudioFrameReceived;
+        TimestampedAudioSinkCallback m_onAudioFrameReceived;
+        AudioLevelSinkCallback m_onAudioLevelChanged;
+        std::unique_ptr<AudioLevelMeter> m_audioLevelMeter;
+        std::shared_ptr<AudioRecorder> m_audioRecorder;
+        std::unique_ptr<AudioConverter> m_audioConverter;
 
     public:
-        explicit AudioSink(AudioSinkCallback onAudioFrameReceived);
+        AudioSink(TimestampedAudioSinkCallback onAudioFrameReceived, const AudioSinkConfiguration& configuration);
+        AudioSink(
+            TimestampedAudioSinkCallback onAudioFrameReceived,
+            AudioLevelSinkCallback onAudioLevelChanged,
+            const AudioSinkConfiguration& configuration);
+
+        bool isAudioLevelMeteringEnabled() const;
+        AudioLevel audioLevel() const;
+
+        void setAudioRecorder(std::shared_ptr<AudioRecorder> audioRecorder);
 
         void OnData(
             const void* audioData,
@@ -26,6 +57,30 @@ namespace opentera
             size_t numberOfChannels,
             size_t numberOfFrames) override;
     };
+
+    /**
+     * @brief Indicates if the audio level is computed.
+     * @return true if the audio level is computed
+     */
+    inline bool AudioSink::isAudioLevelMeteringEnabled() const { return m_audioLevelMeter != nullptr; }
+
+    /**
+     * @brief Returns the last audio level.
+     * @return The last audio level (the default level if the metering is disabled)
+     */
+    inline AudioLevel AudioSink::audioLevel() const
+    {
+        return m_audioLevelMeter != nullptr ? m_audioLevelMeter->level() : AudioLevel();
+    }
+
+    /**
+     * @brief Sets the recorder that receives the audio data (nullptr to stop recording).
+     * @param audioRecorder The recorder
+     */
+    inline void AudioSink::setAudioRecorder(std::shared_ptr<AudioRecorder> audioRecorder)
+    {
+        std::atomic_store(&m_audioRecorder, std::move(audioRecorder));
+    }
 }
 
 #endif
@@ -0,0 +1,37 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_ENCODED_AUDIO_SINK_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_ENCODED_AUDIO_SINK_H
+
+#include <api/frame_transformer_interface.h>
+
+#include <functional>
+#include <mutex>
+
+namespace opentera
+{
+    using EncodedAudioSinkCallback =
+        std::function<void(const uint8_t* data, size_t dataSize, size_t numberOfFrames, uint32_t rtpTimestamp)>;
+
+    /**
+     * @brief Class that sinks the encoded audio packets of a webrtc stream before they are decoded.
+     *
+     * It is installed as the depacketizer to decoder frame transformer of an audio receiver. The packets are only
+     * forwarded to the decoder if the decoded audio is needed.
+     */
+    class EncodedAudioSink : public webrtc::FrameTransformerInterface
+    {
+        EncodedAudioSinkCallback m_onFrameReceived;
+        bool m_isDecodingEnabled;
+
+        std::mutex m_mutex;
+        rtc::scoped_refptr<webrtc::TransformedFrameCallback> m_transformedFrameCallback;
+
+    public:
+        EncodedAudioSink(EncodedAudioSinkCallback onFrameReceived, bool isDecodingEnabled);
+
+        void Transform(std::unique_ptr<webrtc::TransformableFrameInterface> frame) override;
+        void RegisterTransformedFrameCallback(rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback) override;
+        void UnregisterTransformedFrameCallback() override;
+    };
+}
+
+#endif
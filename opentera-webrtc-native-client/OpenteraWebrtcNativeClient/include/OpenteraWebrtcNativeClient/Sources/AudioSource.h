@@ -28,6 +28,9 @@ namespace opentera
         int m_sampleRate;
         size_t m_numberOfChannels;
         size_t m_bytesPerFrame;
+        std::vector<size_t> m_selectedChannels;
+        size_t m_sentNumberOfChannels;
+        size_t m_sentBytesPerFrame;
 
         size_t m_dataIndex;
         std::vector<uint8_t> m_data;  // 10 ms audio frame
@@ -38,6 +41,12 @@ namespace opentera
 
     public:
         AudioSource(AudioSourceConfiguration configuration, int bitsPerSample, int sampleRate, size_t numberOfChannels);
+        AudioSource(
+            AudioSourceConfiguration configuration,
+            int bitsPerSample,
+            int sampleRate,
+            size_t numberOfChannels,
+            std::vector<size_t> selectedChannels);
 
         DECLARE_NOT_COPYABLE(AudioSource);
         DECLARE_NOT_MOVABLE(AudioSource);
@@ -52,6 +61,9 @@ namespace opentera
         AudioSourceConfiguration configuration() const;
         size_t bytesPerSample() const;
         size_t bytesPerFrame() const;
+        int sampleRate() const;
+        size_t numberOfChannels() const;
+        const std::vector<size_t>& selectedChannels() const;
 
         void setAudioDeviceModule(const rtc::scoped_refptr<OpenteraAudioDeviceModule>& audioDeviceModule);
         void sendFrame(const void* audioData, size_t numberOfFrames);
@@ -61,6 +73,9 @@ namespace opentera
         // make because we can use a shared_ptr
         void AddRef() const override;
         rtc::RefCountReleaseStatus Release() const override;
+
+    private:
+        void copyFrames(const uint8_t* audioData, size_t numberOfFrames);
     };
 
     /**
@@ -68,6 +83,11 @@ namespace opentera
      */
     inline AudioSourceConfiguration AudioSource::configuration() const { return m_configuration; }
 
+    /**
+     * @return The channels that are sent (empty if all channels are sent)
+     */
+    inline const std::vector<size_t>& AudioSource::selectedChannels() const { return m_selectedChannels; }
+
     /**
      * Send an audio frame
      * @param audioData The audio data
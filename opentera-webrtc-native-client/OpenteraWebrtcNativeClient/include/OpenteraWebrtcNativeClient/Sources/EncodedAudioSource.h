@@ -0,0 +1,60 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_SOURCES_ENCODED_AUDIO_SOURCE_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_SOURCES_ENCODED_AUDIO_SOURCE_H
+
+#include <OpenteraWebrtcNativeClient/Sources/AudioSource.h>
+
+#include <deque>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace opentera
+{
+    /**
+     * @brief Bounded queue of Opus packets waiting to be sent to a peer (internal use only).
+     */
+    class EncodedAudioFrameQueue
+    {
+        std::mutex m_mutex;
+        std::deque<std::vector<uint8_t>> m_frames;
+
+    public:
+        static constexpr size_t MaxSize = 50;
+
+        EncodedAudioFrameQueue() = default;
+
+        DECLARE_NOT_COPYABLE(EncodedAudioFrameQueue);
+        DECLARE_NOT_MOVABLE(EncodedAudioFrameQueue);
+
+        void push(const uint8_t* data, size_t dataSize);
+        bool pop(std::vector<uint8_t>& frame);
+    };
+
+    /**
+     * @brief Represents an audio source that sends Opus packets without transcoding them.
+     *
+     * Pass a shared_ptr to an instance of this to the StreamClient and call sendEncodedFrame for each Opus packet.
+     * The packets are sent as they are to every peer, so the peers must negotiate Opus. The packets must last a
+     * multiple of 10 ms. Muting the local audio does not stop the packets, so stop calling sendEncodedFrame instead.
+     */
+    class EncodedAudioSource : public AudioSource
+    {
+        std::vector<int16_t> m_silence;
+
+        std::mutex m_queuesMutex;
+        std::set<EncodedAudioFrameQueue*> m_queues;
+
+    public:
+        explicit EncodedAudioSource(size_t numberOfChannels = 1);
+
+        DECLARE_NOT_COPYABLE(EncodedAudioSource);
+        DECLARE_NOT_MOVABLE(EncodedAudioSource);
+
+        bool sendEncodedFrame(const uint8_t* data, size_t dataSize);
+
+        void addEncodedAudioFrameQueue(EncodedAudioFrameQueue* queue);
+        void removeEncodedAudioFrameQueue(EncodedAudioFrameQueue* queue);
+    };
+}
+
+#endif
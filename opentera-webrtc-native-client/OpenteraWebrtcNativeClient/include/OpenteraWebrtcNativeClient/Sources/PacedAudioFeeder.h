@@ -0,0 +1,101 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_SOURCES_PACED_AUDIO_FEEDER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_SOURCES_PACED_AUDIO_FEEDER_H
+
+#include <OpenteraWebrtcNativeClient/Sources/AudioSource.h>
+#include <OpenteraWebrtcNativeClient/Utils/AudioClock.h>
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+#include <OpenteraWebrtcNativeClient/Utils/MemoryMappedFile.h>
+
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace opentera
+{
+    /**
+     * @brief Feeds an audio source in real time from queued buffers and WAV files.
+     *
+     * A timer thread sends exactly one 10 ms frame per period, so buffers can be queued faster than real time
+     * without flooding the transport. Silence is sent when the queue is empty, so the stream stays continuous. An
+     * underrun is reported once each time the queue runs out of audio.
+     *
+     * The queued audio must have the format of the audio source.
+     */
+    class PacedAudioFeeder
+    {
+        struct Buffer
+        {
+            std::shared_ptr<MemoryMappedFile> file;
+            std::vector<uint8_t> data;
+            size_t offset;
+            size_t size;
+        };
+
+        std::shared_ptr<AudioSource> m_audioSource;
+        std::shared_ptr<AudioClock> m_clock;
+        size_t m_numberOfFramesPerChunk;
+        std::vector<uint8_t> m_chunk;
+
+        std::mutex m_mutex;
+        std::deque<Buffer> m_buffers;
+        size_t m_queuedSize;
+        bool m_isUnderrun;
+        std::function<void()> m_onUnderrun;
+        std::atomic<size_t> m_underrunCount;
+
+        std::atomic_bool m_stopped;
+        std::unique_ptr<std::thread> m_thread;
+
+    public:
+        explicit PacedAudioFeeder(
+            std::shared_ptr<AudioSource> audioSource,
+            std::shared_ptr<AudioClock> clock = std::make_shared<RealTimeAudioClock>());
+        virtual ~PacedAudioFeeder();
+
+        DECLARE_NOT_COPYABLE(PacedAudioFeeder);
+        DECLARE_NOT_MOVABLE(PacedAudioFeeder);
+
+        const std::shared_ptr<AudioSource>& audioSource() const;
+
+        void start();
+        void stop();
+        bool isStarted() const;
+
+        void enqueue(const void* audioData, size_t numberOfFrames);
+        void enqueueWavFile(const std::string& path);
+        void clear();
+
+        size_t queuedNumberOfFrames();
+        size_t underrunCount() const;
+        void setOnUnderrun(std::function<void()> callback);
+
+    private:
+        void run();
+        void sendChunk();
+    };
+
+    /**
+     * @brief Returns the fed audio source.
+     * @return The fed audio source
+     */
+    inline const std::shared_ptr<AudioSource>& PacedAudioFeeder::audioSource() const { return m_audioSource; }
+
+    /**
+     * @brief Indicates if the timer thread is started.
+     * @return true if the timer thread is started
+     */
+    inline bool PacedAudioFeeder::isStarted() const { return !m_stopped.load(); }
+
+    /**
+     * @brief Returns the number of underruns since the feeder was created.
+     * @return The number of underruns
+     */
+    inline size_t PacedAudioFeeder::underrunCount() const { return m_underrunCount.load(); }
+}
+
+#endif
@@ -2,11 +2,13 @@
 #define OPENTERA_WEBRTC_NATIVE_CLIENT_STREAM_CLIENT_H
 
 #include <OpenteraWebrtcNativeClient/Sources/AudioSource.h>
+#include <OpenteraWebrtcNativeClient/Sources/EncodedAudioSource.h>
 #include <OpenteraWebrtcNativeClient/Sources/VideoSource.h>
 #include <OpenteraWebrtcNativeClient/Handlers/StreamPeerConnectionHandler.h>
 
 #include <OpenteraWebrtcNativeClient/SignalingClient.h>
 
+#include <map>
 #include <memory>
 
 namespace opentera
@@ -25,11 +27,21 @@ namespace opentera
         VideoFrameReceivedCallback m_onVideoFrameReceived;
         EncodedVideoFrameReceivedCallback m_onEncodedVideoFrameReceived;
         AudioFrameReceivedCallback m_onAudioFrameReceived;
+        TimestampedAudioFrameReceivedCallback m_onTimestampedAudioFrameReceived;
+        AudioSinkConfiguration m_audioSinkConfiguration;
+        EncodedAudioFrameReceivedCallback m_onEncodedAudioFrameReceived;
+        AudioLevelChangedCallback m_onAudioLevelChanged;
+        bool m_isAudioLevelMeteringEnabled;
+        bool m_isStereoAudioEnabled;
+        bool m_isAudioVideoSynchronizationEnabled;
 
         bool m_isLocalAudioMuted;
         bool m_isRemoteAudioMuted;
         bool m_isLocalVideoMuted;
 
+        std::map<std::string, double> m_remoteAudioGainsById;
+        std::map<std::string, std::shared_ptr<AudioRecorder>> m_remoteAudioRecordersById;
+
     public:
         StreamClient(
             SignalingServerConfiguration signalingServerConfiguration,
@@ -47,6 +59,12 @@ namespace opentera
             WebrtcConfiguration webrtcConfiguration,
             std::shared_ptr<VideoSource> videoSource,
             std::shared_ptr<AudioSource> audioSource);
+        StreamClient(
+            SignalingServerConfiguration signalingServerConfiguration,
+            WebrtcConfiguration webrtcConfiguration,
+            std::shared_ptr<VideoSource> videoSource,
+            std::shared_ptr<AudioSource> audioSource,
+            rtc::scoped_refptr<webrtc::AudioMixer> audioMixer);
         ~StreamClient() override;
 
         DECLARE_NOT_COPYABLE(StreamClient);
@@ -67,12 +85,38 @@ namespace opentera
         void unmuteLocalVideo();
         void setLocalVideoMuted(bool muted);
 
+        void setRemoteAudioGain(const std::string& id, double gain);
+
+        bool isAudioLevelMeteringEnabled();
+        void setAudioLevelMeteringEnabled(bool enabled);
+        std::map<std::string, AudioLevel> getRemoteAudioLevels();
+
+        bool isStereoAudioEnabled();
+        void setStereoAudioEnabled(bool enabled);
+
+        bool isAudioVideoSynchronizationEnabled();
+        void setAudioVideoSynchronizationEnabled(bool enabled);
+
+        void setRemoteAudioRecorder(const std::string& id, std::shared_ptr<AudioRecorder> audioRecorder);
+        void setMixedAudioRecorder(std::shared_ptr<AudioRecorder> audioRecorder);
+
+        void setAudioClock(std::shared_ptr<AudioClock> clock);
+
+        OpusEncoderConfiguration opusEncoderConfiguration();
+        void setOpusEncoderConfiguration(const OpusEncoderConfiguration& configuration);
+
         void setOnAddRemoteStream(const std::function<void(const Client&)>& callback);
         void setOnRemoveRemoteStream(const std::function<void(const Client&)>& callback);
         void setOnVideoFrameReceived(const VideoFrameReceivedCallback& callback);
         void setOnEncodedVideoFrameReceived(const EncodedVideoFrameReceivedCallback& callback);
         void setOnAudioFrameReceived(const AudioFrameReceivedCallback& callback);
+        void setOnAudioFrameReceived(
+            const AudioFrameReceivedCallback& callback,
+            const AudioSinkConfiguration& configuration);
+        void setOnTimestampedAudioFrameReceived(const TimestampedAudioFrameReceivedCallback& callback);
+        void setOnEncodedAudioFrameReceived(const EncodedAudioFrameReceivedCallback& callback);
         void setOnMixedAudioFrameReceived(const AudioSinkCallback& callback);
+        void setOnAudioLevelChanged(const AudioLevelChangedCallback& callback);
 
     protected:
         std::unique_ptr<PeerConnectionHandler>
@@ -137,6 +181,121 @@ namespace opentera
      */
     inline void StreamClient::unmuteLocalVideo() { setLocalVideoMuted(false); }
 
+    /**
+     * @brief Indicates if the audio level of the remote streams is computed.
+     * @return true if the audio level of the remote streams is computed
+     */
+    inline bool StreamClient::isAudioLevelMeteringEnabled()
+    {
+        return callSync(getInternalClientThread(), [this]() { return m_isAudioLevelMeteringEnabled; });
+    }
+
+    /**
+     * @brief Enables or disables the audio level computation of the remote streams.
+     *
+     * The remote audio streams are received even if there is no audio frame callback when it is enabled.
+     * It must be set before the calls are made.
+     *
+     * @param enabled Indicates if the audio level of the remote streams is computed
+     */
+    inline void StreamClient::setAudioLevelMeteringEnabled(bool enabled)
+    {
+        callSync(getInternalClientThread(), [this, enabled]() { m_isAudioLevelMeteringEnabled = enabled; });
+    }
+
+    /**
+     * @brief Indicates if stereo Opus is negotiated.
+     * @return true if stereo Opus is negotiated
+     */
+    inline bool StreamClient::isStereoAudioEnabled()
+    {
+        return callSync(getInternalClientThread(), [this]() { return m_isStereoAudioEnabled; });
+    }
+
+    /**
+     * @brief Enables or disables the stereo Opus negotiation (stereo=1 and sprop-stereo=1 in the SDP).
+     *
+     * The local audio is sent in stereo only if the audio source has 2 channels (or 2 selected channels) and the
+     * peer accepts stereo. It must be set before the calls are made.
+     *
+     * @param enabled Indicates if stereo Opus is negotiated
+     */
+    inline void StreamClient::setStereoAudioEnabled(bool enabled)
+    {
+        callSync(getInternalClientThread(), [this, enabled]() { m_isStereoAudioEnabled = enabled; });
+    }
+
+    /**
+     * @brief Indicates if the timestamped audio frames and the video frames are delivered in timestamp order.
+     * @return true if the timestamped audio frames and the video frames are delivered in timestamp order
+     */
+    inline bool StreamClient::isAudioVideoSynchronizationEnabled()
+    {
+        return callSync(getInternalClientThread(), [this]() { return m_isAudioVideoSynchronizationEnabled; });
+    }
+
+    /**
+     * @brief Enables or disables the synchronized delivery of the timestamped audio frames and the video frames.
+     *
+     * When it is enabled and both callbacks are set, the frames of each peer are buffered and delivered in
+     * timestamp order, so each video frame comes after the audio frames that precede it. The frames are delayed
+     * until the other stream reaches their timestamp (at most MediaSynchronizer::DefaultMaxDelayUs). It must be
+     * set before the calls are made.
+     *
+     * @param enabled Indicates if the frames are delivered in timestamp order
+     */
+    inline void StreamClient::setAudioVideoSynchronizationEnabled(bool enabled)
+    {
+        callSync(getInternalClientThread(), [this, enabled]() { m_isAudioVideoSynchronizationEnabled = enabled; });
+    }
+
+    /**
+     * @brief Sets the recorder of the mixed remote audio (nullptr to stop recording).
+     *
+     * The mixed audio is only received if a mixed audio frame callback is set.
+     *
+     * @param audioRecorder The recorder
+     */
+    inline void StreamClient::setMixedAudioRecorder(std::shared_ptr<AudioRecorder> audioRecorder)
+    {
+        m_audioDeviceModule->setMixedAudioRecorder(std::move(audioRecorder));
+    }
+
+    /**
+     * @brief Sets the clock that paces the mixed remote audio playout (nullptr to use the wall clock).
+     *
+     * A VirtualAudioClock makes the playout run faster than real time, which is useful for tests and offline
+     * processing. The local audio is never paced by the client, so it can be sent as fast as it is produced.
+     *
+     * @param clock The clock
+     */
+    inline void StreamClient::setAudioClock(std::shared_ptr<AudioClock> clock)
+    {
+        m_audioDeviceModule->setClock(std::move(clock));
+    }
+
+    /**
+     * @brief Returns the Opus encoder settings of the local audio.
+     * @return The Opus encoder settings of the local audio
+     */
+    inline OpusEncoderConfiguration StreamClient::opusEncoderConfiguration()
+    {
+        return m_audioEncoderFactory->opusEncoderConfiguration();
+    }
+
+    /**
+     * @brief Sets the Opus encoder settings of the local audio.
+     *
+     * The settings are applied to the current calls at the next packet boundary without renegotiation and to the
+     * future calls.
+     *
+     * @param configuration The Opus encoder settings
+     */
+    inline void StreamClient::setOpusEncoderConfiguration(const OpusEncoderConfiguration& configuration)
+    {
+        m_audioEncoderFactory->setOpusEncoderConfiguration(configuration);
+    }
+
     /**
      * @brief Sets the callback that is called when a stream is added.
      *
@@ -233,7 +392,88 @@ namespace opentera
      */
     inline void StreamClient::setOnAudioFrameReceived(const AudioFrameReceivedCallback& callback)
     {
-        callSync(getInternalClientThread(), [this, &callback]() { m_onAudioFrameReceived = callback; });
+        setOnAudioFrameReceived(callback, AudioSinkConfiguration::create());
+    }
+
+    /**
+     * @brief Sets the callback that is called when an audio stream frame is received and the format of the frames.
+     *
+     * The decoded audio is converted to the specified format for each peer before it is given to the callback (and
+     * to the timestamped audio frame callback), so no conversion is needed in the application. The conversion does
+     * not change the audio level and the recorded audio. The configuration only applies to the peers that connect
+     * after this call.
+     *
+     * The callback is called from a WebRTC processing thread. The callback should not block.
+     *
+     * @param callback The callback (see setOnAudioFrameReceived(const AudioFrameReceivedCallback&))
+     * @param configuration The format of the frames given to the callback
+     * @throw runtime_error if a value of the configuration is invalid
+     */
+    inline void StreamClient::setOnAudioFrameReceived(
+        const AudioFrameReceivedCallback& callback,
+        const AudioSinkConfiguration& configuration)
+    {
+        // Validate the configuration in the caller thread.
+        AudioConverter converter(configuration);
+
+        callSync(
+            getInternalClientThread(),
+            [this, &callback, &configuration]()
+            {
+                m_onAudioFrameReceived = callback;
+                m_audioSinkConfiguration = configuration;
+            });
+    }
+
+    /**
+     * @brief Sets the callback that is called when an audio stream frame is received, with its timestamp.
+     *
+     * The timestamp is the playout time of the frame in microseconds (rtc::TimeMicros clock). It can be compared
+     * with the timestamp of the video frame callback, which is the render time in the same clock. The format
+     * set with setOnAudioFrameReceived also applies to this callback.
+     *
+     * The callback is called from a WebRTC processing thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client of the stream frame
+     * - audioData: The audio data
+     * - bitsPerSample: The audio stream sample size (8, 16 or 32 bits)
+     * - sampleRate: The audio stream sample rate
+     * - numberOfChannels: The audio stream channel count
+     * - numberOfFrames: The number of frames
+     * - timestampUs: The timestamp of the first frame in microseconds
+     * @endparblock
+     *
+     * @param callback The callback
+     */
+    inline void StreamClient::setOnTimestampedAudioFrameReceived(const TimestampedAudioFrameReceivedCallback& callback)
+    {
+        callSync(getInternalClientThread(), [this, &callback]() { m_onTimestampedAudioFrameReceived = callback; });
+    }
+
+    /**
+     * @brief Sets the callback that is called when an encoded audio packet is received.
+     *
+     * The packets are given before they are decoded. They are only decoded if an audio frame callback, an audio
+     * level callback, a mixed audio frame callback or the audio level metering is set.
+     *
+     * The callback is called from a WebRTC processing thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client of the stream packet
+     * - data: The Opus packet
+     * - dataSize: The Opus packet size
+     * - numberOfFrames: The number of frames of the packet at 48000 Hz
+     * - rtpTimestamp: The RTP timestamp of the packet
+     * @endparblock
+     *
+     * @param callback The callback
+     */
+    inline void StreamClient::setOnEncodedAudioFrameReceived(const EncodedAudioFrameReceivedCallback& callback)
+    {
+        callSync(getInternalClientThread(), [this, &callback]() { m_onEncodedAudioFrameReceived = callback; });
     }
 
     /**
@@ -262,6 +502,25 @@ namespace opentera
 
         m_audioDeviceModule->setOnMixedAudioFrameReceived(callback);
     }
+
+    /**
+     * @brief Sets the callback that is called when the audio level of a remote stream is updated (every 100 ms).
+     *
+     * The audio level is computed even if no audio frame callback is set.
+     * The callback is called from a WebRTC processing thread. The callback should not block.
+     *
+     * @parblock
+     * Callback parameters:
+     * - client: The client of the stream
+     * - level: The audio level of the last 100 ms and the voice activity
+     * @endparblock
+     *
+     * @param callback The callback
+     */
+    inline void StreamClient::setOnAudioLevelChanged(const AudioLevelChangedCallback& callback)
+    {
+        callSync(getInternalClientThread(), [this, &callback]() { m_onAudioLevelChanged = callback; });
+    }
 }
 
 #endif
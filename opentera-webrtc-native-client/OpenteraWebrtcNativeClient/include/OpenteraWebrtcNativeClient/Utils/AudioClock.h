@@ -0,0 +1,97 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_AUDIO_CLOCK_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_AUDIO_CLOCK_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace opentera
+{
+    /**
+     * @brief Represents the clock that paces the audio device module playout.
+     */
+    class AudioClock
+    {
+    public:
+        AudioClock() = default;
+        virtual ~AudioClock() = default;
+
+        DECLARE_NOT_COPYABLE(AudioClock);
+        DECLARE_NOT_MOVABLE(AudioClock);
+
+        /**
+         * @brief Returns the current time.
+         * @return The current time since the clock epoch
+         */
+        virtual std::chrono::nanoseconds now() = 0;
+
+        /**
+         * @brief Blocks until the specified time or until wakeUp is called.
+         * @param time The time since the clock epoch
+         */
+        virtual void sleepUntil(std::chrono::nanoseconds time) = 0;
+
+        /**
+         * @brief Wakes up the thread blocked in sleepUntil.
+         */
+        virtual void wakeUp() = 0;
+    };
+
+    /**
+     * @brief An audio clock that follows the wall clock.
+     */
+    class RealTimeAudioClock : public AudioClock
+    {
+    public:
+        RealTimeAudioClock() = default;
+        ~RealTimeAudioClock() override = default;
+
+        DECLARE_NOT_COPYABLE(RealTimeAudioClock);
+        DECLARE_NOT_MOVABLE(RealTimeAudioClock);
+
+        std::chrono::nanoseconds now() override;
+        void sleepUntil(std::chrono::nanoseconds time) override;
+        void wakeUp() override;
+    };
+
+    /**
+     * @brief An audio clock that does not follow the wall clock.
+     *
+     * In free-running mode, sleepUntil jumps to the requested time without blocking, so the playout advances as fast
+     * as the consumer handles the audio frames. Otherwise, the time only advances when advance is called, so the
+     * playout can be stepped deterministically.
+     */
+    class VirtualAudioClock : public AudioClock
+    {
+        bool m_isFreeRunning;
+
+        std::mutex m_mutex;
+        std::condition_variable m_condition;
+        std::chrono::nanoseconds m_time;
+        bool m_isWakeUpRequested;
+
+    public:
+        explicit VirtualAudioClock(bool isFreeRunning = true);
+        ~VirtualAudioClock() override = default;
+
+        DECLARE_NOT_COPYABLE(VirtualAudioClock);
+        DECLARE_NOT_MOVABLE(VirtualAudioClock);
+
+        bool isFreeRunning() const;
+        void advance(std::chrono::nanoseconds duration);
+
+        std::chrono::nanoseconds now() override;
+        void sleepUntil(std::chrono::nanoseconds time) override;
+        void wakeUp() override;
+    };
+
+    /**
+     * @brief Indicates if the clock is free-running.
+     * @return true if the clock is free-running
+     */
+    inline bool VirtualAudioClock::isFreeRunning() const { return m_isFreeRunning; }
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_AUDIO_CONVERTER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_AUDIO_CONVERTER_H
+
+#include <OpenteraWebrtcNativeClient/Configurations/AudioSinkConfiguration.h>
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <common_audio/resampler/include/push_resampler.h>
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace opentera
+{
+    /**
+     * @brief Converts decoded audio frames to the format of an AudioSinkConfiguration.
+     *
+     * The channels are mixed, the frames are resampled, the samples are converted and the frames are grouped in
+     * chunks. The buffers only grow, so no allocation is done once the format is stable. The partial chunk is
+     * dropped if the output format changes.
+     */
+    class AudioConverter
+    {
+        AudioSinkConfiguration m_configuration;
+
+        webrtc::PushResampler<int16_t> m_resampler;
+        std::vector<int16_t> m_mixedData;
+        std::vector<int16_t> m_resampledData;
+        std::vector<uint8_t> m_convertedData;
+
+        std::vector<uint8_t> m_chunkData;
+        size_t m_chunkFrameCount;
+        int m_chunkBitsPerSample;
+        int m_chunkSampleRate;
+        size_t m_chunkNumberOfChannels;
+        uint64_t m_chunkTimestampUs;
+
+    public:
+        using Callback = std::function<void(
+            const void* audioData,
+            int bitsPerSample,
+            int sampleRate,
+            size_t numberOfChannels,
+            size_t numberOfFrames,
+            uint64_t timestampUs)>;
+
+        explicit AudioConverter(AudioSinkConfiguration configuration);
+
+        DECLARE_NOT_COPYABLE(AudioConverter);
+        DECLARE_NOT_MOVABLE(AudioConverter);
+
+        void convert(
+            const void* audioData,
+            int bitsPerSample,
+            int sampleRate,
+            size_t numberOfChannels,
+            size_t numberOfFrames,
+            uint64_t timestampUs,
+            const Callback& callback);
+
+    private:
+        void addToChunk(
+            const uint8_t* data,
+            int bitsPerSample,
+            int sampleRate,
+            size_t numberOfChannels,
+            size_t numberOfFrames,
+            uint64_t timestampUs,
+            const Callback& callback);
+    };
+}
+
+#endif
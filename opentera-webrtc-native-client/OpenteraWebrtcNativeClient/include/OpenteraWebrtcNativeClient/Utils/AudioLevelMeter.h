@@ -0,0 +1,102 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_AUDIO_LEVEL_METER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_AUDIO_LEVEL_METER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <atomic>
+#include <cstddef>
+
+namespace opentera
+{
+    /**
+     * @brief Represents the audio level of a stream.
+     */
+    class AudioLevel
+    {
+        float m_levelDbfs;
+        bool m_isVoiceActive;
+
+    public:
+        AudioLevel();
+        AudioLevel(float levelDbfs, bool isVoiceActive);
+        AudioLevel(const AudioLevel& other) = default;
+        AudioLevel(AudioLevel&& other) = default;
+        virtual ~AudioLevel() = default;
+
+        float levelDbfs() const;
+        bool isVoiceActive() const;
+
+        AudioLevel& operator=(const AudioLevel& other) = default;
+        AudioLevel& operator=(AudioLevel&& other) = default;
+    };
+
+    /**
+     * @brief Returns the RMS level.
+     * @return The RMS level (dBFS, between -127 and 0)
+     */
+    inline float AudioLevel::levelDbfs() const { return m_levelDbfs; }
+
+    /**
+     * @brief Indicates if voice activity is detected.
+     * @return true if voice activity is detected
+     */
+    inline bool AudioLevel::isVoiceActive() const { return m_isVoiceActive; }
+
+    /**
+     * @brief Computes the RMS level of an audio stream over fixed intervals and detects voice activity with an
+     * energy threshold and a hangover.
+     *
+     * update is called from the audio thread, level can be called from any thread.
+     */
+    class AudioLevelMeter
+    {
+        size_t m_updateIntervalMs;
+        float m_vadThresholdDbfs;
+        size_t m_vadHangoverMs;
+
+        double m_intervalSumOfSquares;
+        size_t m_intervalSampleCount;
+        size_t m_intervalFrameCount;
+        size_t m_vadHangoverRemainingFrameCount;
+
+        std::atomic<float> m_levelDbfs;
+        std::atomic<bool> m_isVoiceActive;
+
+    public:
+        static constexpr float MinLevelDbfs = -127.f;
+        static constexpr size_t DefaultUpdateIntervalMs = 100;
+        static constexpr float DefaultVadThresholdDbfs = -50.f;
+        static constexpr size_t DefaultVadHangoverMs = 300;
+
+        explicit AudioLevelMeter(
+            size_t updateIntervalMs = DefaultUpdateIntervalMs,
+            float vadThresholdDbfs = DefaultVadThresholdDbfs,
+            size_t vadHangoverMs = DefaultVadHangoverMs);
+        virtual ~AudioLevelMeter() = default;
+
+        DECLARE_NOT_COPYABLE(AudioLevelMeter);
+        DECLARE_NOT_MOVABLE(AudioLevelMeter);
+
+        bool update(
+            const void* audioData,
+            int bitsPerSample,
+            int sampleRate,
+            size_t numberOfChannels,
+            size_t numberOfFrames);
+
+        AudioLevel level() const;
+    };
+
+    /**
+     * @brief Returns the level of the last complete interval and the current voice activity.
+     * @return The audio level
+     */
+    inline AudioLevel AudioLevelMeter::level() const
+    {
+        return AudioLevel(m_levelDbfs.load(std::memory_order_relaxed), m_isVoiceActive.load(std::memory_order_relaxed));
+    }
+
+    float computeRmsDbfs(const void* audioData, int bitsPerSample, size_t numberOfChannels, size_t numberOfFrames);
+}
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_BUFFERED_AMOUNT_TRACKER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_BUFFERED_AMOUNT_TRACKER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace opentera
+{
+    /**
+     * @brief Tracks the number of bytes accepted for each peer and not sent yet, and bounds it with watermarks.
+     *
+     * A reservation is refused when it would make the buffered amount of a peer exceed the high watermark. The peer
+     * is then marked as blocked until its buffered amount falls to the low watermark. This class is thread-safe.
+     */
+    class BufferedAmountTracker
+    {
+        struct PeerState
+        {
+            uint64_t bufferedAmount;
+            bool isBlocked;
+        };
+
+        mutable std::mutex m_mutex;
+        uint64_t m_lowWatermark;
+        uint64_t m_highWatermark;
+        std::map<std::string, PeerState> m_peerStatesById;
+
+    public:
+        static constexpr uint64_t UnboundedHighWatermark = std::numeric_limits<uint64_t>::max();
+
+        BufferedAmountTracker();
+
+        DECLARE_NOT_COPYABLE(BufferedAmountTracker);
+        DECLARE_NOT_MOVABLE(BufferedAmountTracker);
+
+        void setWatermarks(uint64_t lowWatermark, uint64_t highWatermark);
+        uint64_t lowWatermark() const;
+        uint64_t highWatermark() const;
+
+        void addPeer(const std::string& id);
+        void removePeer(const std::string& id);
+        std::vector<std::string> peerIds() const;
+
+        uint64_t bufferedAmount(const std::string& id) const;
+
+        bool tryReserve(const std::map<std::string, uint64_t>& sizesById);
+        bool tryReserve(const std::vector<std::string>& ids, uint64_t size);
+        bool tryReserveAll(uint64_t size);
+        void reserve(const std::vector<std::string>& ids, uint64_t size);
+        void reserveAll(uint64_t size);
+        bool release(const std::string& id, uint64_t size);
+    };
+}
+
+#endif
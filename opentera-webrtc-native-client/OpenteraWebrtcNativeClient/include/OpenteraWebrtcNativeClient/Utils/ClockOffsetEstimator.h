@@ -0,0 +1,79 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_CLOCK_OFFSET_ESTIMATOR_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_CLOCK_OFFSET_ESTIMATOR_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+
+namespace opentera
+{
+    /**
+     * @brief Estimates the clock offset and the round-trip time of a peer from NTP-like exchanges.
+     *
+     * As in the NTP clock filter, the offset is taken from the sample with the smallest round-trip time of the last
+     * samples, because this sample is the least affected by queuing delays. The round-trip time is smoothed like
+     * the TCP smoothed round-trip time.
+     */
+    class ClockOffsetEstimator
+    {
+        struct Sample
+        {
+            int64_t offsetUs;
+            int64_t roundTripTimeUs;
+        };
+
+        size_t m_windowSize;
+        std::deque<Sample> m_samples;
+        int64_t m_offsetUs;
+        int64_t m_roundTripTimeUs;
+        int64_t m_smoothedRoundTripTimeUs;
+
+    public:
+        static constexpr size_t DefaultWindowSize = 8;
+
+        explicit ClockOffsetEstimator(size_t windowSize = DefaultWindowSize);
+        virtual ~ClockOffsetEstimator() = default;
+
+        DECLARE_NOT_COPYABLE(ClockOffsetEstimator);
+        DECLARE_NOT_MOVABLE(ClockOffsetEstimator);
+
+        bool addSample(
+            int64_t originateTimeUs,
+            int64_t receiveTimeUs,
+            int64_t transmitTimeUs,
+            int64_t destinationTimeUs);
+
+        bool hasEstimate() const;
+        int64_t offsetUs() const;
+        int64_t roundTripTimeUs() const;
+        int64_t smoothedRoundTripTimeUs() const;
+    };
+
+    /**
+     * @brief Indicates if a sample was added.
+     * @return true if a sample was added
+     */
+    inline bool ClockOffsetEstimator::hasEstimate() const { return !m_samples.empty(); }
+
+    /**
+     * @brief Returns the estimated offset of the peer clock, which is the peer time minus the local time.
+     * @return The estimated offset (us)
+     */
+    inline int64_t ClockOffsetEstimator::offsetUs() const { return m_offsetUs; }
+
+    /**
+     * @brief Returns the round-trip time of the sample the offset is taken from.
+     * @return The round-trip time (us)
+     */
+    inline int64_t ClockOffsetEstimator::roundTripTimeUs() const { return m_roundTripTimeUs; }
+
+    /**
+     * @brief Returns the smoothed round-trip time of all samples.
+     * @return The smoothed round-trip time (us)
+     */
+    inline int64_t ClockOffsetEstimator::smoothedRoundTripTimeUs() const { return m_smoothedRoundTripTimeUs; }
+}
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_CLOCK_SYNC_FRAME_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_CLOCK_SYNC_FRAME_H
+
+#include <api/data_channel_interface.h>
+
+#include <cstdint>
+
+namespace opentera
+{
+    /**
+     * @brief Encodes and decodes the frames of the data channel that uses the clock synchronization protocol.
+     *
+     * Each frame is binary data made of the following fields, as in the NTP on-wire protocol:
+     * - type (uint8): 0 for a request and 1 for a response
+     * - originate time (int64, little endian): the time the request was sent, in the clock of the requester (us)
+     * - receive time (int64, little endian): the time the request was received, in the clock of the responder (us)
+     * - transmit time (int64, little endian): the time the response was sent, in the clock of the responder (us)
+     *
+     * The requests only have the type and the originate time.
+     */
+    class ClockSyncFrame
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            Request = 0,
+            Response = 1
+        };
+
+        static constexpr size_t RequestSize = 9;
+        static constexpr size_t ResponseSize = 25;
+
+        static webrtc::DataBuffer encodeRequest(int64_t originateTimeUs);
+        static webrtc::DataBuffer
+            encodeResponse(int64_t originateTimeUs, int64_t receiveTimeUs, int64_t transmitTimeUs);
+        static bool decode(
+            const webrtc::DataBuffer& frame,
+            Type& type,
+            int64_t& originateTimeUs,
+            int64_t& receiveTimeUs,
+            int64_t& transmitTimeUs);
+    };
+}
+
+#endif
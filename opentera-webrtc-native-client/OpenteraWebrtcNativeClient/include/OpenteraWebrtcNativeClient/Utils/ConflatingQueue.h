@@ -0,0 +1,71 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_CONFLATING_QUEUE_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_CONFLATING_QUEUE_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <api/data_channel_interface.h>
+
+#include <list>
+#include <string>
+#include <unordered_map>
+
+namespace opentera
+{
+    /**
+     * @brief Bounded queue that keeps only the latest message of each key.
+     *
+     * A message replaces the queued message that has the same key and takes its place in the queue, so a key that is
+     * updated often is not delayed by the other keys. When the queue is full, the oldest message is dropped.
+     */
+    class ConflatingQueue
+    {
+        struct Entry
+        {
+            std::string key;
+            webrtc::DataBuffer buffer;
+        };
+
+        size_t m_maxSize;
+        std::list<Entry> m_entries;
+        std::unordered_map<std::string, std::list<Entry>::iterator> m_entriesByKey;
+
+    public:
+        static constexpr size_t DefaultMaxSize = 1024;
+
+        explicit ConflatingQueue(size_t maxSize = DefaultMaxSize);
+        virtual ~ConflatingQueue() = default;
+
+        DECLARE_NOT_COPYABLE(ConflatingQueue);
+        DECLARE_NOT_MOVABLE(ConflatingQueue);
+
+        size_t push(std::string key, const webrtc::DataBuffer& buffer);
+        webrtc::DataBuffer pop();
+
+        bool empty() const;
+        size_t size() const;
+        void clear();
+    };
+
+    /**
+     * @brief Indicates if there is no queued message.
+     * @return true if there is no queued message
+     */
+    inline bool ConflatingQueue::empty() const { return m_entries.empty(); }
+
+    /**
+     * @brief Returns the number of queued messages.
+     * @return The number of queued messages
+     */
+    inline size_t ConflatingQueue::size() const { return m_entries.size(); }
+
+    /**
+     * @brief Drops all queued messages.
+     */
+    inline void ConflatingQueue::clear()
+    {
+        m_entries.clear();
+        m_entriesByKey.clear();
+    }
+}
+
+#endif
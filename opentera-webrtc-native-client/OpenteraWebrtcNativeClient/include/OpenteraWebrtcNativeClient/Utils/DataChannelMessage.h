@@ -0,0 +1,86 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_DATA_CHANNEL_MESSAGE_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_DATA_CHANNEL_MESSAGE_H
+
+#include <rtc_base/copy_on_write_buffer.h>
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace opentera
+{
+    /**
+     * @brief Represents a received data channel message.
+     *
+     * The message shares the buffer it was received in. Copying a message is cheap and keeps the data alive without
+     * copying them, so a message can be kept after the callback returns.
+     */
+    class DataChannelMessage
+    {
+        rtc::CopyOnWriteBuffer m_buffer;
+        bool m_isBinary;
+
+    public:
+        DataChannelMessage(rtc::CopyOnWriteBuffer buffer, bool isBinary);
+        DataChannelMessage(const DataChannelMessage& other) = default;
+        DataChannelMessage(DataChannelMessage&& other) = default;
+        virtual ~DataChannelMessage() = default;
+
+        const uint8_t* data() const;
+        size_t size() const;
+        bool isBinary() const;
+
+        std::string_view view() const;
+        const rtc::CopyOnWriteBuffer& buffer() const;
+
+        DataChannelMessage& operator=(const DataChannelMessage& other) = default;
+        DataChannelMessage& operator=(DataChannelMessage&& other) = default;
+    };
+
+    /**
+     * @brief Creates a message that shares the specified buffer.
+     *
+     * @param buffer The message data
+     * @param isBinary Indicates if the message is binary data or a string message
+     */
+    inline DataChannelMessage::DataChannelMessage(rtc::CopyOnWriteBuffer buffer, bool isBinary)
+        : m_buffer(std::move(buffer)),
+          m_isBinary(isBinary)
+    {
+    }
+
+    /**
+     * @brief Returns the message data.
+     * @return The message data
+     */
+    inline const uint8_t* DataChannelMessage::data() const { return m_buffer.data<uint8_t>(); }
+
+    /**
+     * @brief Returns the message size.
+     * @return The message size (bytes)
+     */
+    inline size_t DataChannelMessage::size() const { return m_buffer.size(); }
+
+    /**
+     * @brief Indicates if the message is binary data or a string message.
+     * @return true if the message is binary data
+     */
+    inline bool DataChannelMessage::isBinary() const { return m_isBinary; }
+
+    /**
+     * @brief Returns a view over the message data, which is valid as long as the message exists.
+     * @return A view over the message data
+     */
+    inline std::string_view DataChannelMessage::view() const
+    {
+        return std::string_view(m_buffer.data<char>(), m_buffer.size());
+    }
+
+    /**
+     * @brief Returns the buffer that holds the message data.
+     * @return The buffer that holds the message data
+     */
+    inline const rtc::CopyOnWriteBuffer& DataChannelMessage::buffer() const { return m_buffer; }
+}
+
+#endif
@@ -0,0 +1,114 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_DATA_CHANNEL_MESSAGE_BATCH_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_DATA_CHANNEL_MESSAGE_BATCH_H
+
+#include <api/data_channel_interface.h>
+
+#include <string>
+#include <vector>
+
+namespace opentera
+{
+    class DataChannelClient;
+
+    /**
+     * @brief Represents messages that are sent to data channels in a single internal client thread hop.
+     *
+     * Each message has its own recipients.
+     */
+    class DataChannelMessageBatch
+    {
+        struct Message
+        {
+            webrtc::DataBuffer buffer;
+            std::vector<std::string> ids;
+            bool isToAll;
+        };
+
+        std::vector<Message> m_messages;
+
+    public:
+        DataChannelMessageBatch() = default;
+        explicit DataChannelMessageBatch(size_t capacity);
+
+        void addTo(const uint8_t* data, size_t size, std::vector<std::string> ids);
+        void addTo(const std::string& message, std::vector<std::string> ids);
+        void addToAll(const uint8_t* data, size_t size);
+        void addToAll(const std::string& message);
+
+        size_t size() const;
+        bool empty() const;
+        void clear();
+
+        friend DataChannelClient;
+    };
+
+    /**
+     * @brief Creates an empty batch that can hold the specified number of messages without reallocation.
+     *
+     * @param capacity The number of messages to reserve
+     */
+    inline DataChannelMessageBatch::DataChannelMessageBatch(size_t capacity) { m_messages.reserve(capacity); }
+
+    /**
+     * @brief Adds binary data for the specified clients.
+     *
+     * @param data The binary data
+     * @param size The binary data size
+     * @param ids The client ids
+     */
+    inline void DataChannelMessageBatch::addTo(const uint8_t* data, size_t size, std::vector<std::string> ids)
+    {
+        m_messages.push_back({webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true), std::move(ids), false});
+    }
+
+    /**
+     * @brief Adds a string message for the specified clients.
+     *
+     * @param message The string message
+     * @param ids The client ids
+     */
+    inline void DataChannelMessageBatch::addTo(const std::string& message, std::vector<std::string> ids)
+    {
+        m_messages.push_back({webrtc::DataBuffer(message), std::move(ids), false});
+    }
+
+    /**
+     * @brief Adds binary data for all clients.
+     *
+     * @param data The binary data
+     * @param size The binary data size
+     */
+    inline void DataChannelMessageBatch::addToAll(const uint8_t* data, size_t size)
+    {
+        m_messages.push_back({webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, size), true), {}, true});
+    }
+
+    /**
+     * @brief Adds a string message for all clients.
+     *
+     * @param message The string message
+     */
+    inline void DataChannelMessageBatch::addToAll(const std::string& message)
+    {
+        m_messages.push_back({webrtc::DataBuffer(message), {}, true});
+    }
+
+    /**
+     * @brief Returns the number of messages in the batch.
+     * @return The number of messages in the batch
+     */
+    inline size_t DataChannelMessageBatch::size() const { return m_messages.size(); }
+
+    /**
+     * @brief Indicates if the batch is empty.
+     * @return true if the batch is empty
+     */
+    inline bool DataChannelMessageBatch::empty() const { return m_messages.empty(); }
+
+    /**
+     * @brief Removes all messages from the batch.
+     */
+    inline void DataChannelMessageBatch::clear() { m_messages.clear(); }
+}
+
+#endif
@@ -0,0 +1,63 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_FILE_TRANSFER_FRAME_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_FILE_TRANSFER_FRAME_H
+
+#include <api/data_channel_interface.h>
+
+#include <cstdint>
+#include <string>
+
+namespace opentera
+{
+    /**
+     * @brief Encodes and decodes the frames of the data channel that uses the file transfer protocol.
+     *
+     * Each frame is binary data made of a header and a payload. The header has the following fields:
+     * - type (uint8): the frame type
+     * - transfer id (uint32, little endian): the id of the transfer, unique per sender
+     * - value (uint64, little endian): the file size for an offer, otherwise an offset in the file
+     * - checksum (uint32, little endian): the CRC-32 of the payload for a chunk, otherwise 0
+     *
+     * The payload of an offer is a random nonce (uint64, little endian) followed by the file name. The transfer ids
+     * start again at 0 when the sender restarts, so the nonce prevents the receiver from resuming another transfer.
+     * The payload is the file data for a chunk and empty for the other frames.
+     */
+    class FileTransferFrame
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            // Sent by the sender to propose a file.
+            Offer = 0,
+            // Sent by the receiver to request the file data from an offset.
+            Accept = 1,
+            // Sent by the sender with the file data at an offset.
+            Chunk = 2,
+            // Sent by the receiver when the file data before an offset are written.
+            Ack = 3,
+            // Sent by the receiver to refuse or abort a transfer.
+            Reject = 4,
+            // Sent by the sender to abort a transfer.
+            Cancel = 5
+        };
+
+        static constexpr size_t HeaderSize = 17;
+        static constexpr size_t OfferNonceSize = 8;
+
+        static webrtc::DataBuffer encode(Type type, uint32_t transferId, uint64_t value);
+        static webrtc::DataBuffer
+            encodeOffer(uint32_t transferId, uint64_t fileSize, uint64_t nonce, const std::string& name);
+        static webrtc::DataBuffer encodeChunk(uint32_t transferId, uint64_t offset, const uint8_t* data, size_t size);
+        static bool decode(
+            const webrtc::DataBuffer& frame,
+            Type& type,
+            uint32_t& transferId,
+            uint64_t& value,
+            uint32_t& checksum,
+            rtc::CopyOnWriteBuffer& payload);
+        static bool decodeOffer(const rtc::CopyOnWriteBuffer& payload, uint64_t& nonce, std::string& name);
+
+        static uint32_t checksum(const uint8_t* data, size_t size);
+    };
+}
+
+#endif
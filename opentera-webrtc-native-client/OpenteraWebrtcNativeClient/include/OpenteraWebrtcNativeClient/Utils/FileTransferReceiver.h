@@ -0,0 +1,66 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_FILE_TRANSFER_RECEIVER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_FILE_TRANSFER_RECEIVER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+#include <OpenteraWebrtcNativeClient/Utils/PreallocatedFile.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace opentera
+{
+    /**
+     * @brief Verifies the received chunks and writes them in order to a preallocated file.
+     *
+     * The written offset is kept after the connection closes, so the sender can resume the transfer from it. The
+     * file is closed when it is complete.
+     */
+    class FileTransferReceiver
+    {
+        std::string m_name;
+        uint64_t m_size;
+        std::unique_ptr<PreallocatedFile> m_file;
+        uint64_t m_writtenOffset;
+
+    public:
+        FileTransferReceiver(std::string name, const std::string& path, uint64_t size);
+        virtual ~FileTransferReceiver() = default;
+
+        DECLARE_NOT_COPYABLE(FileTransferReceiver);
+        DECLARE_NOT_MOVABLE(FileTransferReceiver);
+
+        bool write(uint64_t offset, uint32_t checksum, const uint8_t* data, size_t size);
+
+        const std::string& name() const;
+        uint64_t size() const;
+        uint64_t writtenOffset() const;
+        bool isComplete() const;
+    };
+
+    /**
+     * @brief Returns the file name sent by the sender.
+     * @return The file name
+     */
+    inline const std::string& FileTransferReceiver::name() const { return m_name; }
+
+    /**
+     * @brief Returns the file size.
+     * @return The file size (bytes)
+     */
+    inline uint64_t FileTransferReceiver::size() const { return m_size; }
+
+    /**
+     * @brief Returns the number of bytes written from the start of the file.
+     * @return The number of bytes written
+     */
+    inline uint64_t FileTransferReceiver::writtenOffset() const { return m_writtenOffset; }
+
+    /**
+     * @brief Indicates if the whole file is written.
+     * @return true if the transfer is complete
+     */
+    inline bool FileTransferReceiver::isComplete() const { return m_writtenOffset == m_size; }
+}
+
+#endif
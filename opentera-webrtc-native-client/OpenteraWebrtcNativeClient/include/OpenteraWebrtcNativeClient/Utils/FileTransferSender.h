@@ -0,0 +1,104 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_FILE_TRANSFER_SENDER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_FILE_TRANSFER_SENDER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+#include <OpenteraWebrtcNativeClient/Utils/MemoryMappedFile.h>
+
+#include <api/data_channel_interface.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace opentera
+{
+    /**
+     * @brief Splits a memory-mapped file into chunk frames and limits the data that are not acknowledged by the
+     * receiver.
+     *
+     * The chunks are only read from the mapping when they are sent, so the file is never loaded in memory. The
+     * transfer starts, or resumes, from the offset requested by the receiver.
+     */
+    class FileTransferSender
+    {
+        uint32_t m_id;
+        uint64_t m_nonce;
+        std::string m_name;
+        std::unique_ptr<MemoryMappedFile> m_file;
+        size_t m_chunkSize;
+        uint64_t m_windowSize;
+
+        bool m_isStarted;
+        uint64_t m_nextOffset;
+        uint64_t m_acknowledgedOffset;
+
+    public:
+        static constexpr size_t DefaultChunkSize = 64 * 1024;
+        static constexpr uint64_t DefaultWindowSize = 1024 * 1024;
+
+        FileTransferSender(
+            uint32_t id,
+            uint64_t nonce,
+            std::string name,
+            std::unique_ptr<MemoryMappedFile> file,
+            size_t chunkSize = DefaultChunkSize,
+            uint64_t windowSize = DefaultWindowSize);
+        virtual ~FileTransferSender() = default;
+
+        DECLARE_NOT_COPYABLE(FileTransferSender);
+        DECLARE_NOT_MOVABLE(FileTransferSender);
+
+        webrtc::DataBuffer offer() const;
+        void start(uint64_t offset);
+        void stop();
+
+        bool hasChunkToSend() const;
+        webrtc::DataBuffer popChunk();
+        void acknowledge(uint64_t offset);
+
+        uint32_t id() const;
+        const std::string& name() const;
+        uint64_t size() const;
+        uint64_t acknowledgedOffset() const;
+        bool isStarted() const;
+        bool isComplete() const;
+    };
+
+    /**
+     * @brief Returns the transfer id.
+     * @return The transfer id
+     */
+    inline uint32_t FileTransferSender::id() const { return m_id; }
+
+    /**
+     * @brief Returns the file name sent to the receiver.
+     * @return The file name
+     */
+    inline const std::string& FileTransferSender::name() const { return m_name; }
+
+    /**
+     * @brief Returns the file size.
+     * @return The file size (bytes)
+     */
+    inline uint64_t FileTransferSender::size() const { return m_file->size(); }
+
+    /**
+     * @brief Returns the number of bytes written by the receiver.
+     * @return The number of bytes written by the receiver
+     */
+    inline uint64_t FileTransferSender::acknowledgedOffset() const { return m_acknowledgedOffset; }
+
+    /**
+     * @brief Indicates if the receiver accepted the transfer on the current connection.
+     * @return true if the chunks can be sent
+     */
+    inline bool FileTransferSender::isStarted() const { return m_isStarted; }
+
+    /**
+     * @brief Indicates if the receiver wrote the whole file.
+     * @return true if the transfer is complete
+     */
+    inline bool FileTransferSender::isComplete() const { return m_isStarted && m_acknowledgedOffset == size(); }
+}
+
+#endif
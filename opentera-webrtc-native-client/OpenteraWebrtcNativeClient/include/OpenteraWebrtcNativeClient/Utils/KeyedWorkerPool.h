@@ -0,0 +1,44 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_KEYED_WORKER_POOL_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_KEYED_WORKER_POOL_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+#include <OpenteraWebrtcNativeClient/Utils/WorkerPool.h>
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace opentera
+{
+    /**
+     * @brief Runs tasks on a fixed number of threads, each with its own queue selected by the key of the task.
+     *
+     * The tasks that have the same key run on the same thread, in the order they are posted. The tasks that have
+     * different keys can run in parallel. This class is thread-safe.
+     */
+    class KeyedWorkerPool
+    {
+        std::vector<std::unique_ptr<WorkerPool>> m_workers;
+
+    public:
+        explicit KeyedWorkerPool(size_t threadCount);
+        virtual ~KeyedWorkerPool() = default;
+
+        DECLARE_NOT_COPYABLE(KeyedWorkerPool);
+        DECLARE_NOT_MOVABLE(KeyedWorkerPool);
+
+        void post(const std::string& key, std::function<void()> task);
+        size_t threadCount() const;
+        std::vector<size_t> queueDepths() const;
+    };
+
+    /**
+     * @brief Returns the number of threads.
+     * @return The number of threads
+     */
+    inline size_t KeyedWorkerPool::threadCount() const { return m_workers.size(); }
+}
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_LZ4_CODEC_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_LZ4_CODEC_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace opentera
+{
+    /**
+     * @brief Compresses and decompresses data in the LZ4 block format.
+     *
+     * The compressor is a greedy single pass compressor tuned for speed, so its output can be decoded by any LZ4
+     * implementation.
+     */
+    class Lz4Codec
+    {
+    public:
+        static size_t maxCompressedSize(size_t size);
+        static size_t compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity);
+        static bool decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize);
+    };
+
+    /**
+     * @brief Returns the size of the largest block that the compression of the specified size can produce.
+     *
+     * @param size The uncompressed size (bytes)
+     * @return The maximum compressed size (bytes)
+     */
+    inline size_t Lz4Codec::maxCompressedSize(size_t size) { return size + size / 255 + 16; }
+}
+
+#endif
@@ -0,0 +1,103 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MEDIA_SYNCHRONIZER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MEDIA_SYNCHRONIZER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <opencv2/core.hpp>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+namespace opentera
+{
+    using SynchronizedAudioCallback = std::function<void(
+        const void* audioData,
+        int bitsPerSample,
+        int sampleRate,
+        size_t numberOfChannels,
+        size_t numberOfFrames,
+        uint64_t timestampUs)>;
+    using SynchronizedVideoCallback = std::function<void(const cv::Mat& bgrImg, uint64_t timestampUs)>;
+
+    /**
+     * @brief Delivers the audio frames and the video frames of a peer in timestamp order.
+     *
+     * A frame is delivered once the other stream has reached its timestamp, so each video frame is preceded by the
+     * audio frames that come before it. The frames are not delayed until the other stream has started. If the other
+     * stream stops, the frames are delivered after maxDelayUs of their own stream. The frames are copied into buffers
+     * that are reused.
+     *
+     * The callbacks are called without the internal lock held, so a slow callback does not block the other stream.
+     * They are called one at a time and in timestamp order, from one of the threads that push the frames.
+     */
+    class MediaSynchronizer
+    {
+        struct AudioFrame
+        {
+            std::vector<uint8_t> data;
+            int bitsPerSample;
+            int sampleRate;
+            size_t numberOfChannels;
+            size_t numberOfFrames;
+            uint64_t timestampUs;
+        };
+
+        struct VideoFrame
+        {
+            cv::Mat bgrImg;
+            uint64_t timestampUs;
+        };
+
+        SynchronizedAudioCallback m_onAudioFrame;
+        SynchronizedVideoCallback m_onVideoFrame;
+        uint64_t m_maxDelayUs;
+
+        std::mutex m_mutex;
+        std::deque<AudioFrame> m_audioFrames;
+        std::deque<VideoFrame> m_videoFrames;
+        std::vector<AudioFrame> m_freeAudioFrames;
+        std::vector<VideoFrame> m_freeVideoFrames;
+        std::deque<AudioFrame> m_readyAudioFrames;
+        std::deque<VideoFrame> m_readyVideoFrames;
+        std::deque<bool> m_isReadyFrameAudio;
+        bool m_hasAudio;
+        bool m_hasVideo;
+        uint64_t m_lastAudioTimestampUs;
+        uint64_t m_lastVideoTimestampUs;
+        bool m_isDelivering;
+
+    public:
+        static constexpr uint64_t DefaultMaxDelayUs = 500000;
+
+        MediaSynchronizer(
+            SynchronizedAudioCallback onAudioFrame,
+            SynchronizedVideoCallback onVideoFrame,
+            uint64_t maxDelayUs = DefaultMaxDelayUs);
+        virtual ~MediaSynchronizer() = default;
+
+        DECLARE_NOT_COPYABLE(MediaSynchronizer);
+        DECLARE_NOT_MOVABLE(MediaSynchronizer);
+
+        void pushAudio(
+            const void* audioData,
+            int bitsPerSample,
+            int sampleRate,
+            size_t numberOfChannels,
+            size_t numberOfFrames,
+            uint64_t timestampUs);
+        void pushVideo(const cv::Mat& bgrImg, uint64_t timestampUs);
+
+    private:
+        void moveReadyFrames();
+        bool isAudioFrameReady(const AudioFrame& frame) const;
+        bool isVideoFrameReady(const VideoFrame& frame) const;
+        void deliverReadyFrames(std::unique_lock<std::mutex>& lock);
+        void deliverAudioFrame(const AudioFrame& frame);
+        void deliverVideoFrame(const VideoFrame& frame);
+    };
+}
+
+#endif
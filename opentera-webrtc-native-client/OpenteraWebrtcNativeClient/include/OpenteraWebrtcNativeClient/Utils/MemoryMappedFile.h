@@ -0,0 +1,52 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MEMORY_MAPPED_FILE_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MEMORY_MAPPED_FILE_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace opentera
+{
+    /**
+     * @brief Maps a file in memory in read-only mode.
+     *
+     * The pages are loaded by the operating system when they are accessed, so large files can be read without
+     * copying them.
+     */
+    class MemoryMappedFile
+    {
+        const uint8_t* m_data;
+        size_t m_size;
+
+#if defined(_WIN32)
+        void* m_fileHandle;
+        void* m_mappingHandle;
+#endif
+
+    public:
+        explicit MemoryMappedFile(const std::string& path);
+        virtual ~MemoryMappedFile();
+
+        DECLARE_NOT_COPYABLE(MemoryMappedFile);
+        DECLARE_NOT_MOVABLE(MemoryMappedFile);
+
+        const uint8_t* data() const;
+        size_t size() const;
+    };
+
+    /**
+     * @brief Returns the file content.
+     * @return The file content
+     */
+    inline const uint8_t* MemoryMappedFile::data() const { return m_data; }
+
+    /**
+     * @brief Returns the file size.
+     * @return The file size in bytes
+     */
+    inline size_t MemoryMappedFile::size() const { return m_size; }
+}
+
+#endif
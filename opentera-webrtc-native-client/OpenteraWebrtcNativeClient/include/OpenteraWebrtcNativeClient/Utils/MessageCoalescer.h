@@ -0,0 +1,81 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MESSAGE_COALESCER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MESSAGE_COALESCER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <api/data_channel_interface.h>
+
+#include <cstdint>
+#include <deque>
+#include <functional>
+
+namespace opentera
+{
+    /**
+     * @brief Packs small data channel messages into batches, so many small messages are sent as one SCTP message.
+     *
+     * Each batch is a binary message made of records. Each record is a header followed by a message:
+     * - message size and type (uint32, little endian): bits 0 to 30 are the message size, bit 31 is set if the
+     *   message is binary
+     *
+     * A batch is ready when the next message does not fit in it or when it is flushed. A message larger than the
+     * maximum batch size is sent alone in its batch.
+     */
+    class MessageCoalescer
+    {
+        struct Batch
+        {
+            rtc::CopyOnWriteBuffer data;
+            size_t messageCount;
+        };
+
+        size_t m_maxBatchSize;
+        Batch m_currentBatch;
+        std::deque<Batch> m_readyBatches;
+
+    public:
+        static constexpr size_t HeaderSize = 4;
+        static constexpr uint32_t BinaryFlag = 0x80000000;
+        static constexpr size_t MaxMessageSize = 0x7FFFFFFF;
+        static constexpr size_t DefaultMaxBatchSize = 16 * 1024;
+
+        explicit MessageCoalescer(size_t maxBatchSize = DefaultMaxBatchSize);
+        virtual ~MessageCoalescer() = default;
+
+        DECLARE_NOT_COPYABLE(MessageCoalescer);
+        DECLARE_NOT_MOVABLE(MessageCoalescer);
+
+        void push(const webrtc::DataBuffer& buffer);
+        void flush();
+        webrtc::DataBuffer popBatch(size_t& messageCount);
+        bool hasReadyBatch() const;
+        bool empty() const;
+        void clear();
+
+        static bool
+            unpack(const rtc::CopyOnWriteBuffer& batch, const std::function<void(webrtc::DataBuffer)>& onMessage);
+    };
+
+    /**
+     * @brief Indicates if a batch is ready to be sent.
+     * @return true if a batch is ready to be sent
+     */
+    inline bool MessageCoalescer::hasReadyBatch() const { return !m_readyBatches.empty(); }
+
+    /**
+     * @brief Indicates if there is no pending message.
+     * @return true if there is no pending message
+     */
+    inline bool MessageCoalescer::empty() const { return m_readyBatches.empty() && m_currentBatch.messageCount == 0; }
+
+    /**
+     * @brief Drops all pending messages.
+     */
+    inline void MessageCoalescer::clear()
+    {
+        m_currentBatch = Batch{rtc::CopyOnWriteBuffer(), 0};
+        m_readyBatches.clear();
+    }
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MESSAGE_COMPRESSOR_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MESSAGE_COMPRESSOR_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <api/data_channel_interface.h>
+
+#include <atomic>
+#include <cstdint>
+
+namespace opentera
+{
+    /**
+     * @brief Compresses the messages of the data channels that use the compressed protocol.
+     *
+     * Each message is sent as binary data made of a header and a payload:
+     * - flags (uint8): bit 0 is set if the payload is compressed and bit 1 is set if the message is a string message
+     * - uncompressed size (uint32, little endian), only if the payload is compressed
+     *
+     * The messages smaller than the threshold and the messages that do not shrink are sent uncompressed. This class
+     * is thread-safe, so the messages can be compressed on the threads that send them.
+     */
+    class MessageCompressor
+    {
+        std::atomic<size_t> m_threshold;
+        std::atomic<uint64_t> m_uncompressedSize;
+        std::atomic<uint64_t> m_compressedSize;
+
+    public:
+        static constexpr uint8_t CompressedFlag = 0x01;
+        static constexpr uint8_t StringFlag = 0x02;
+        static constexpr size_t DefaultThreshold = 256;
+
+        MessageCompressor();
+        virtual ~MessageCompressor() = default;
+
+        DECLARE_NOT_COPYABLE(MessageCompressor);
+        DECLARE_NOT_MOVABLE(MessageCompressor);
+
+        void setThreshold(size_t threshold);
+        size_t threshold() const;
+
+        webrtc::DataBuffer compress(const webrtc::DataBuffer& message);
+        static bool decompress(const webrtc::DataBuffer& frame, rtc::CopyOnWriteBuffer& message, bool& isBinary);
+
+        uint64_t uncompressedSize() const;
+        uint64_t compressedSize() const;
+        double compressionRatio() const;
+    };
+
+    /**
+     * @brief Sets the size under which the messages are sent uncompressed.
+     * @param threshold The threshold (bytes)
+     */
+    inline void MessageCompressor::setThreshold(size_t threshold) { m_threshold = threshold; }
+
+    /**
+     * @brief Returns the size under which the messages are sent uncompressed.
+     * @return The threshold (bytes)
+     */
+    inline size_t MessageCompressor::threshold() const { return m_threshold; }
+
+    /**
+     * @brief Returns the total size of the messages passed to compress.
+     * @return The total uncompressed size (bytes)
+     */
+    inline uint64_t MessageCompressor::uncompressedSize() const { return m_uncompressedSize; }
+
+    /**
+     * @brief Returns the total size of the messages returned by compress, headers included.
+     * @return The total compressed size (bytes)
+     */
+    inline uint64_t MessageCompressor::compressedSize() const { return m_compressedSize; }
+}
+
+#endif
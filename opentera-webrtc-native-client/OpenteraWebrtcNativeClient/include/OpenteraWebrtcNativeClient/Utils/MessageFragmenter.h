@@ -0,0 +1,68 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MESSAGE_FRAGMENTER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MESSAGE_FRAGMENTER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <api/data_channel_interface.h>
+
+#include <cstdint>
+#include <deque>
+
+namespace opentera
+{
+    /**
+     * @brief Splits data channel messages into frames that are interleaved fairly.
+     *
+     * Each frame is a binary message made of a header and a chunk of the message:
+     * - flags (uint8): bit 0 is set if the message is binary
+     * - reserved (3 bytes)
+     * - message id (uint32, little endian)
+     * - message size (uint32, little endian)
+     * - chunk offset (uint32, little endian)
+     *
+     * The frames are taken round-robin from the pending messages, so a small message never waits for more than one
+     * chunk of each large message.
+     */
+    class MessageFragmenter
+    {
+        struct PendingMessage
+        {
+            webrtc::DataBuffer buffer;
+            uint32_t id;
+            size_t offset;
+        };
+
+        size_t m_maxChunkSize;
+        uint32_t m_nextMessageId;
+        std::deque<PendingMessage> m_pendingMessages;
+
+    public:
+        static constexpr size_t HeaderSize = 16;
+        static constexpr uint8_t BinaryFlag = 0x01;
+        static constexpr size_t DefaultMaxFrameSize = 16 * 1024;
+
+        explicit MessageFragmenter(size_t maxFrameSize = DefaultMaxFrameSize);
+        virtual ~MessageFragmenter() = default;
+
+        DECLARE_NOT_COPYABLE(MessageFragmenter);
+        DECLARE_NOT_MOVABLE(MessageFragmenter);
+
+        void push(const webrtc::DataBuffer& buffer);
+        webrtc::DataBuffer popFrame();
+        bool empty() const;
+        void clear();
+    };
+
+    /**
+     * @brief Indicates if there is no frame to send.
+     * @return true if there is no frame to send
+     */
+    inline bool MessageFragmenter::empty() const { return m_pendingMessages.empty(); }
+
+    /**
+     * @brief Drops all pending messages.
+     */
+    inline void MessageFragmenter::clear() { m_pendingMessages.clear(); }
+}
+
+#endif
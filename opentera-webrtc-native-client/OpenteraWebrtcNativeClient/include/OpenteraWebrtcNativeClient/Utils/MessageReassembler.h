@@ -0,0 +1,87 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MESSAGE_REASSEMBLER_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_MESSAGE_REASSEMBLER_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <rtc_base/copy_on_write_buffer.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <set>
+
+namespace opentera
+{
+    using ReassembledMessageCallback = std::function<void(rtc::CopyOnWriteBuffer message, bool isBinary)>;
+    using MessageChunkCallback = std::function<
+        void(uint32_t messageId, const uint8_t* data, size_t size, size_t offset, size_t messageSize, bool isBinary)>;
+
+    /**
+     * @brief Reassembles the messages split by a MessageFragmenter.
+     *
+     * The messages that fit in one frame are delivered as slices of their frame, without copy, and the larger messages
+     * are copied once into their reassembly buffer. If a chunk callback is specified, the chunks of
+     * the larger messages are passed to it instead of being reassembled, so the whole message is never held in memory.
+     * The frames of a message must arrive in order, like on an ordered and reliable data channel.
+     *
+     * The sizes of the messages being reassembled are bounded by maxPartialSize, because each reassembly buffer is
+     * allocated from the size announced by the peer. A message that would exceed it is dropped.
+     */
+    class MessageReassembler
+    {
+        struct PartialMessage
+        {
+            rtc::CopyOnWriteBuffer data;
+            size_t receivedSize;
+        };
+
+        ReassembledMessageCallback m_onMessage;
+        MessageChunkCallback m_onChunk;
+
+        size_t m_maxPartialSize;
+        size_t m_partialSize;
+        std::map<uint32_t, PartialMessage> m_partialMessagesById;
+        std::set<uint32_t> m_droppedMessageIds;
+
+    public:
+        static constexpr size_t DefaultMaxPartialSize = 64 * 1024 * 1024;
+
+        explicit MessageReassembler(
+            ReassembledMessageCallback onMessage,
+            MessageChunkCallback onChunk = nullptr,
+            size_t maxPartialSize = DefaultMaxPartialSize);
+        virtual ~MessageReassembler() = default;
+
+        DECLARE_NOT_COPYABLE(MessageReassembler);
+        DECLARE_NOT_MOVABLE(MessageReassembler);
+
+        bool push(const rtc::CopyOnWriteBuffer& frame);
+        size_t partialMessageCount() const;
+        size_t partialSize() const;
+        void clear();
+    };
+
+    /**
+     * @brief Returns the number of messages that are not completely received.
+     * @return The number of messages that are not completely received
+     */
+    inline size_t MessageReassembler::partialMessageCount() const { return m_partialMessagesById.size(); }
+
+    /**
+     * @brief Returns the total size of the messages that are not completely received.
+     * @return The total size of the messages that are not completely received (bytes)
+     */
+    inline size_t MessageReassembler::partialSize() const { return m_partialSize; }
+
+    /**
+     * @brief Drops the messages that are not completely received.
+     */
+    inline void MessageReassembler::clear()
+    {
+        m_partialMessagesById.clear();
+        m_droppedMessageIds.clear();
+        m_partialSize = 0;
+    }
+}
+
+#endif
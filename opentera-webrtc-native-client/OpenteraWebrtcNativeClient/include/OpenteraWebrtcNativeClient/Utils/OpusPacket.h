@@ -0,0 +1,19 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_OPUS_PACKET_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_OPUS_PACKET_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace opentera
+{
+    class OpusPacket
+    {
+    public:
+        static constexpr int SampleRate = 48000;
+        static constexpr size_t MaxNumberOfFrames = SampleRate * 120 / 1000;
+
+        static size_t numberOfFrames(const uint8_t* data, size_t dataSize);
+    };
+}
+
+#endif
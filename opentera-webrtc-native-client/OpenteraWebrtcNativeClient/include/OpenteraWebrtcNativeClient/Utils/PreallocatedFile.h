@@ -0,0 +1,44 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_PREALLOCATED_FILE_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_PREALLOCATED_FILE_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace opentera
+{
+    /**
+     * @brief Opens a file in write-only mode with its final size allocated, so its data can be written at any
+     * offset as they arrive.
+     */
+    class PreallocatedFile
+    {
+        uint64_t m_size;
+
+#if defined(_WIN32)
+        void* m_fileHandle;
+#else
+        int m_fileDescriptor;
+#endif
+
+    public:
+        PreallocatedFile(const std::string& path, uint64_t size);
+        virtual ~PreallocatedFile();
+
+        DECLARE_NOT_COPYABLE(PreallocatedFile);
+        DECLARE_NOT_MOVABLE(PreallocatedFile);
+
+        void write(uint64_t offset, const uint8_t* data, size_t size);
+        uint64_t size() const;
+    };
+
+    /**
+     * @brief Returns the file size.
+     * @return The file size in bytes
+     */
+    inline uint64_t PreallocatedFile::size() const { return m_size; }
+}
+
+#endif
@@ -0,0 +1,44 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_PUB_SUB_FRAME_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_PUB_SUB_FRAME_H
+
+#include <api/data_channel_interface.h>
+
+#include <cstdint>
+
+namespace opentera
+{
+    /**
+     * @brief Encodes and decodes the frames of the data channel that uses the pub/sub protocol.
+     *
+     * Each frame is binary data made of a header and a payload:
+     * - type (uint8): 0 for a published message, 1 for a subscription and 2 for an unsubscription, bit 7 is set if
+     *   the published message is a string message
+     * - topic (uint16, little endian)
+     *
+     * Only the published messages have a payload.
+     */
+    class PubSubFrame
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            Publish = 0,
+            Subscribe = 1,
+            Unsubscribe = 2
+        };
+
+        static constexpr size_t HeaderSize = 3;
+        static constexpr uint8_t StringFlag = 0x80;
+
+        static webrtc::DataBuffer encode(Type type, uint16_t topic);
+        static webrtc::DataBuffer encode(uint16_t topic, const webrtc::DataBuffer& message);
+        static bool decode(
+            const webrtc::DataBuffer& frame,
+            Type& type,
+            uint16_t& topic,
+            rtc::CopyOnWriteBuffer& message,
+            bool& isBinary);
+    };
+}
+
+#endif
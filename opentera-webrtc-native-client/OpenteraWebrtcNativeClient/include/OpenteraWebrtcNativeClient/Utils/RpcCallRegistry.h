@@ -0,0 +1,58 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_RPC_CALL_REGISTRY_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_RPC_CALL_REGISTRY_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+#include <OpenteraWebrtcNativeClient/Utils/DataChannelMessage.h>
+
+#include <absl/types/optional.h>
+
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <string>
+
+namespace opentera
+{
+    /**
+     * @brief Keeps the callbacks of the remote procedure calls waiting for their response, so the responses can
+     * arrive in any order.
+     *
+     * Each callback is called once, with the response or with an error message. This class is not thread-safe.
+     */
+    class RpcCallRegistry
+    {
+    public:
+        using Callback = std::function<void(const absl::optional<DataChannelMessage>&, const std::string&)>;
+
+    private:
+        struct PendingCall
+        {
+            std::string peerId;
+            Callback callback;
+        };
+
+        std::map<uint32_t, PendingCall> m_pendingCallsById;
+
+    public:
+        RpcCallRegistry() = default;
+        virtual ~RpcCallRegistry() = default;
+
+        DECLARE_NOT_COPYABLE(RpcCallRegistry);
+        DECLARE_NOT_MOVABLE(RpcCallRegistry);
+
+        void add(uint32_t callId, std::string peerId, Callback callback);
+        bool complete(uint32_t callId, const std::string& peerId, const DataChannelMessage& response);
+        bool fail(uint32_t callId, const std::string& peerId, const std::string& error);
+        void failPeer(const std::string& peerId, const std::string& error);
+
+        size_t size() const;
+    };
+
+    /**
+     * @brief Returns the number of calls waiting for their response.
+     * @return The number of calls waiting for their response
+     */
+    inline size_t RpcCallRegistry::size() const { return m_pendingCallsById.size(); }
+}
+
+#endif
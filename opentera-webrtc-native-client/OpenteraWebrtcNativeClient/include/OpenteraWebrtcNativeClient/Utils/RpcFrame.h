@@ -0,0 +1,49 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_RPC_FRAME_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_RPC_FRAME_H
+
+#include <api/data_channel_interface.h>
+
+#include <cstdint>
+#include <string>
+
+namespace opentera
+{
+    /**
+     * @brief Encodes and decodes the frames of the data channel that uses the RPC protocol.
+     *
+     * Each frame is binary data made of a header, a method name and a payload. The header has the following fields:
+     * - type (uint8): 0 for a request, 1 for a response and 2 for an error, bit 7 is set if the payload is a string
+     * - call id (uint32, little endian): the id of the call, unique per caller
+     * - method name size (uint8): the size of the method name, which is only present in the requests
+     *
+     * The payload is the request or response message, or the error message.
+     */
+    class RpcFrame
+    {
+    public:
+        enum class Type : uint8_t
+        {
+            Request = 0,
+            Response = 1,
+            Error = 2
+        };
+
+        static constexpr size_t HeaderSize = 6;
+        static constexpr size_t MaxMethodSize = 255;
+        static constexpr uint8_t StringFlag = 0x80;
+
+        static webrtc::DataBuffer
+            encodeRequest(uint32_t callId, const std::string& method, const webrtc::DataBuffer& request);
+        static webrtc::DataBuffer encodeResponse(uint32_t callId, const webrtc::DataBuffer& response);
+        static webrtc::DataBuffer encodeError(uint32_t callId, const std::string& error);
+        static bool decode(
+            const webrtc::DataBuffer& frame,
+            Type& type,
+            uint32_t& callId,
+            std::string& method,
+            rtc::CopyOnWriteBuffer& payload,
+            bool& isBinary);
+    };
+}
+
+#endif
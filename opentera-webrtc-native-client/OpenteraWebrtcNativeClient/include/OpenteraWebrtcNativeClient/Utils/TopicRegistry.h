@@ -0,0 +1,50 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_TOPIC_REGISTRY_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_TOPIC_REGISTRY_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+#include <OpenteraWebrtcNativeClient/Utils/TopicStatistics.h>
+
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace opentera
+{
+    /**
+     * @brief Indexes the peers subscribed to each topic and counts the messages of each topic.
+     *
+     * This class is thread-safe, so the subscribers can be looked up on the threads that publish the messages.
+     */
+    class TopicRegistry
+    {
+        struct TopicState
+        {
+            std::set<std::string> subscriberIds;
+            TopicStatistics statistics;
+        };
+
+        mutable std::mutex m_mutex;
+        std::unordered_map<uint16_t, TopicState> m_topicStatesByTopic;
+
+    public:
+        TopicRegistry() = default;
+        virtual ~TopicRegistry() = default;
+
+        DECLARE_NOT_COPYABLE(TopicRegistry);
+        DECLARE_NOT_MOVABLE(TopicRegistry);
+
+        void addSubscriber(uint16_t topic, const std::string& id);
+        void removeSubscriber(uint16_t topic, const std::string& id);
+        void removePeer(const std::string& id);
+        std::vector<std::string> subscriberIds(uint16_t topic) const;
+
+        void addSentMessages(uint16_t topic, size_t size, size_t subscriberCount);
+        void addReceivedMessage(uint16_t topic, size_t size);
+        TopicStatistics statistics(uint16_t topic) const;
+    };
+}
+
+#endif
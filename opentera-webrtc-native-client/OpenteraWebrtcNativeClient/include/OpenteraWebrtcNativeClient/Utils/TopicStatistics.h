@@ -0,0 +1,91 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_TOPIC_STATISTICS_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_TOPIC_STATISTICS_H
+
+#include <cstdint>
+
+namespace opentera
+{
+    /**
+     * @brief Represents the message and byte counters of a topic.
+     *
+     * A message published to several subscribers is counted once per subscriber. The byte counters do not include
+     * the frame headers.
+     */
+    class TopicStatistics
+    {
+        uint64_t m_sentMessageCount;
+        uint64_t m_sentByteCount;
+        uint64_t m_receivedMessageCount;
+        uint64_t m_receivedByteCount;
+
+    public:
+        TopicStatistics();
+        TopicStatistics(
+            uint64_t sentMessageCount,
+            uint64_t sentByteCount,
+            uint64_t receivedMessageCount,
+            uint64_t receivedByteCount);
+        TopicStatistics(const TopicStatistics& other) = default;
+        TopicStatistics(TopicStatistics&& other) = default;
+        virtual ~TopicStatistics() = default;
+
+        uint64_t sentMessageCount() const;
+        uint64_t sentByteCount() const;
+        uint64_t receivedMessageCount() const;
+        uint64_t receivedByteCount() const;
+
+        TopicStatistics& operator=(const TopicStatistics& other) = default;
+        TopicStatistics& operator=(TopicStatistics&& other) = default;
+    };
+
+    /**
+     * @brief Creates topic statistics with all counters set to zero.
+     */
+    inline TopicStatistics::TopicStatistics() : TopicStatistics(0, 0, 0, 0) {}
+
+    /**
+     * @brief Creates topic statistics with the specified values.
+     *
+     * @param sentMessageCount The number of messages sent to the subscribers
+     * @param sentByteCount The number of bytes sent to the subscribers
+     * @param receivedMessageCount The number of received messages
+     * @param receivedByteCount The number of received bytes
+     */
+    inline TopicStatistics::TopicStatistics(
+        uint64_t sentMessageCount,
+        uint64_t sentByteCount,
+        uint64_t receivedMessageCount,
+        uint64_t receivedByteCount)
+        : m_sentMessageCount(sentMessageCount),
+          m_sentByteCount(sentByteCount),
+          m_receivedMessageCount(receivedMessageCount),
+          m_receivedByteCount(receivedByteCount)
+    {
+    }
+
+    /**
+     * @brief Returns the number of messages sent to the subscribers.
+     * @return The number of messages sent to the subscribers
+     */
+    inline uint64_t TopicStatistics::sentMessageCount() const { return m_sentMessageCount; }
+
+    /**
+     * @brief Returns the number of bytes sent to the subscribers.
+     * @return The number of bytes sent to the subscribers
+     */
+    inline uint64_t TopicStatistics::sentByteCount() const { return m_sentByteCount; }
+
+    /**
+     * @brief Returns the number of received messages.
+     * @return The number of received messages
+     */
+    inline uint64_t TopicStatistics::receivedMessageCount() const { return m_receivedMessageCount; }
+
+    /**
+     * @brief Returns the number of received bytes.
+     * @return The number of received bytes
+     */
+    inline uint64_t TopicStatistics::receivedByteCount() const { return m_receivedByteCount; }
+}
+
+#endif
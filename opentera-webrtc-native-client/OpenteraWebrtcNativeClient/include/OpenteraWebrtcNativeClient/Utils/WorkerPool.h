@@ -0,0 +1,51 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_WORKER_POOL_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_UTILS_WORKER_POOL_H
+
+#include <OpenteraWebrtcNativeClient/Utils/ClassMacro.h>
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace opentera
+{
+    /**
+     * @brief Runs tasks on a fixed number of threads, so slow tasks do not block the thread that posts them.
+     *
+     * The tasks are started in the order they are posted. This class is thread-safe.
+     */
+    class WorkerPool
+    {
+        mutable std::mutex m_mutex;
+        std::condition_variable m_taskCondition;
+        std::deque<std::function<void()>> m_tasks;
+        bool m_isStopped;
+        std::vector<std::thread> m_threads;
+
+    public:
+        explicit WorkerPool(size_t threadCount);
+        virtual ~WorkerPool();
+
+        DECLARE_NOT_COPYABLE(WorkerPool);
+        DECLARE_NOT_MOVABLE(WorkerPool);
+
+        void post(std::function<void()> task);
+        size_t threadCount() const;
+        size_t pendingTaskCount() const;
+
+    private:
+        void run();
+    };
+
+    /**
+     * @brief Returns the number of threads.
+     * @return The number of threads
+     */
+    inline size_t WorkerPool::threadCount() const { return m_threads.size(); }
+}
+
+#endif
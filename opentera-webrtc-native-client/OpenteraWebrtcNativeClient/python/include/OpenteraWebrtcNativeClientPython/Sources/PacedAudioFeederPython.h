@@ -0,0 +1,11 @@
+#ifndef OPENTERA_WEBRTC_NATIVE_CLIENT_PYTHON_SOURCES_PACED_AUDIO_FEEDER_PYTHON_H
+#define OPENTERA_WEBRTC_NATIVE_CLIENT_PYTHON_SOURCES_PACED_AUDIO_FEEDER_PYTHON_H
+
+#include <pybind11/pybind11.h>
+
+namespace opentera
+{
+    PYBIND11_EXPORT void initPacedAudioFeederPython(pybind11::module& m);
+}
+
+#endif
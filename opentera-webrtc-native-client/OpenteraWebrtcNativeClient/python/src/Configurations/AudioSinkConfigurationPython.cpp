@@ -0,0 +1,71 @@
+#include <OpenteraWebrtcNativeClientPython/Configurations/AudioSinkConfigurationPython.h>
+#include <OpenteraWebrtcNativeClientPython/PyBindAbslOptional.h>
+
+#include <OpenteraWebrtcNativeClient/Configurations/AudioSinkConfiguration.h>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+void opentera::initAudioSinkConfigurationPython(py::module& m)
+{
+    py::class_<AudioSinkConfiguration>(
+        m,
+        "AudioSinkConfiguration",
+        "Represents the format of the audio frames given to an audio frame "
+        "callback.\n"
+        "\n"
+        "The unset values keep the values of the decoded audio.")
+        .def_static(
+            "create",
+            py::overload_cast<>(&AudioSinkConfiguration::create),
+            "Creates an audio sink configuration that keeps the format of the "
+            "decoded audio.\n"
+            ":return: An audio sink configuration with default values")
+        .def_static(
+            "create",
+            py::overload_cast<
+                absl::optional<int>,
+                absl::optional<int>,
+                absl::optional<size_t>,
+                absl::optional<size_t>>(&AudioSinkConfiguration::create),
+            "Creates an audio sink configuration with the specified values.\n"
+            "\n"
+            ":param bits_per_sample: The sample size (8, 16 or 32 bits)\n"
+            ":param sample_rate: The sample rate (a multiple of 100 Hz)\n"
+            ":param number_of_channels: The channel count\n"
+            ":param number_of_frames_per_chunk: The number of frames of each "
+            "callback call (None to use 10 ms frames)\n"
+            ":return: An audio sink configuration with the specified values",
+            py::arg("bits_per_sample"),
+            py::arg("sample_rate"),
+            py::arg("number_of_channels"),
+            py::arg("number_of_frames_per_chunk"))
+
+        .def_property_readonly(
+            "bits_per_sample",
+            &AudioSinkConfiguration::bitsPerSample,
+            "Returns the sample size.\n"
+            ":return: The sample size")
+        .def_property_readonly(
+            "sample_rate",
+            &AudioSinkConfiguration::sampleRate,
+            "Returns the sample rate.\n"
+            ":return: The sample rate")
+        .def_property_readonly(
+            "number_of_channels",
+            &AudioSinkConfiguration::numberOfChannels,
+            "Returns the channel count.\n"
+            ":return: The channel count")
+        .def_property_readonly(
+            "number_of_frames_per_chunk",
+            &AudioSinkConfiguration::numberOfFramesPerChunk,
+            "Returns the number of frames of each callback call.\n"
+            ":return: The number of frames of each callback call")
+        .def_property_readonly(
+            "is_conversion_enabled",
+            &AudioSinkConfiguration::isConversionEnabled,
+            "Indicates if the decoded audio is converted before it is given to "
+            "the callback.\n"
+            ":return: True if a value is set");
+}
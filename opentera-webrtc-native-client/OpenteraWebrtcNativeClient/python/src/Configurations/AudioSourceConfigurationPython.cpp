@@ -51,6 +51,17 @@ void opentera::initAudioSourceConfigurationPython(py::module& m)
             py::arg("highpass_filter"),
             py::arg("stereo_swapping"),
             py::arg("transient_suppression"))
+        .def_static(
+            "create_pass_through",
+            &AudioSourceConfiguration::createPassThrough,
+            "Creates an audio source configuration that bypasses the audio "
+            "processing.\n"
+            "\n"
+            "The frames are sent as they are, so this is intended for audio that "
+            "is already processed.\n"
+            "\n"
+            ":return: An audio source configuration that bypasses the audio "
+            "processing")
 
         .def_property_readonly(
             "sound_card_total_delay_ms",
@@ -86,5 +97,10 @@ void opentera::initAudioSourceConfigurationPython(py::module& m)
             "transient_suppression",
             &AudioSourceConfiguration::transientSuppression,
             "Indicates if the transient suppression is enabled.\n"
-            ":return: True if the transient suppression is enabled");
+            ":return: True if the transient suppression is enabled")
+        .def_property_readonly(
+            "is_pass_through",
+            &AudioSourceConfiguration::isPassThrough,
+            "Indicates if the audio processing is bypassed.\n"
+            ":return: True if the audio processing is bypassed");
 }
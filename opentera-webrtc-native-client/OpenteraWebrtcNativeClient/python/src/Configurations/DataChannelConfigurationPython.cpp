@@ -9,7 +9,48 @@ namespace py = pybind11;
 
 void opentera::initDataChannelConfigurationPython(py::module& m)
 {
+    py::enum_<DataChannelPriority>(m, "DataChannelPriority")
+        .value("VERY_LOW", DataChannelPriority::VeryLow)
+        .value("LOW", DataChannelPriority::Low)
+        .value("MEDIUM", DataChannelPriority::Medium)
+        .value("HIGH", DataChannelPriority::High);
+
     py::class_<DataChannelConfiguration>(m, "DataChannelConfiguration", "Represents a data channel configuration")
+        .def_property_readonly_static(
+            "COMPRESSED_PROTOCOL",
+            [](const py::object&) { return DataChannelConfiguration::CompressedProtocol; },
+            "The protocol of the data channels whose messages are compressed.")
+        .def_property_readonly_static(
+            "COALESCED_PROTOCOL",
+            [](const py::object&) { return DataChannelConfiguration::CoalescedProtocol; },
+            "The protocol of the data channels whose small messages are "
+            "packed together.")
+        .def_property_readonly_static(
+            "FRAGMENTED_PROTOCOL_SUFFIX",
+            [](const py::object&) { return DataChannelConfiguration::FragmentedProtocolSuffix; },
+            "The suffix of the protocol of the data channels whose messages are "
+            "split into frames.")
+        .def_property_readonly_static(
+            "PUB_SUB_PROTOCOL",
+            [](const py::object&) { return DataChannelConfiguration::PubSubProtocol; },
+            "The protocol of the data channel that carries the published "
+            "topics.")
+        .def_property_readonly_static(
+            "CLOCK_SYNC_PROTOCOL",
+            [](const py::object&) { return DataChannelConfiguration::ClockSyncProtocol; },
+            "The protocol of the data channel that carries the clock "
+            "synchronization exchanges.")
+        .def_property_readonly_static(
+            "FILE_TRANSFER_PROTOCOL",
+            [](const py::object&) { return DataChannelConfiguration::FileTransferProtocol; },
+            "The protocol of the data channel that carries the file "
+            "transfers.")
+        .def_property_readonly_static(
+            "RPC_PROTOCOL",
+            [](const py::object&) { return DataChannelConfiguration::RpcProtocol; },
+            "The protocol of the data channel that carries the remote "
+            "procedure calls.")
+
         .def_static(
             "create",
             py::overload_cast<>(&DataChannelConfiguration::create),
@@ -151,5 +192,67 @@ void opentera::initDataChannelConfigurationPython(py::module& m)
             "protocol",
             &DataChannelConfiguration::protocol,
             "Returns the data channel protocol.\n"
-            ":return: The data channel protocol");
+            ":return: The data channel protocol")
+        .def_property_readonly(
+            "priority",
+            &DataChannelConfiguration::priority,
+            "Returns the data channel priority.\n"
+            ":return: The data channel priority, or None if the default "
+            "priority of WebRTC is used")
+        .def(
+            "with_priority",
+            &DataChannelConfiguration::withPriority,
+            "Returns a copy of this configuration with the specified "
+            "priority.\n"
+            "\n"
+            "The priority is announced to the peer when the data channel "
+            "opens, but the SCTP implementation of the WebRTC version used by "
+            "this library does not use it to schedule the messages. It does "
+            "not share the bandwidth between the data channels; use the "
+            "message fragmentation to keep a bulk transfer from blocking the "
+            "small messages.\n"
+            "\n"
+            ":param priority: The data channel priority\n"
+            ":return: A data channel configuration with the specified priority",
+            py::arg("priority"))
+        .def_property_readonly(
+            "is_reliable",
+            &DataChannelConfiguration::isReliable,
+            "Indicates if the messages of the data channel are retransmitted "
+            "until they are received.\n"
+            ":return: True if neither the maximum packet life time nor the "
+            "maximum number of retransmits is set")
+        .def_property_readonly(
+            "is_compressed",
+            &DataChannelConfiguration::isCompressed,
+            "Indicates if the messages of the data channel are compressed.\n"
+            ":return: True if the protocol is COMPRESSED_PROTOCOL")
+        .def_property_readonly(
+            "is_coalesced",
+            &DataChannelConfiguration::isCoalesced,
+            "Indicates if the small messages of the data channel are packed "
+            "together.\n"
+            ":return: True if the protocol is COALESCED_PROTOCOL")
+        .def_property_readonly(
+            "is_pub_sub",
+            &DataChannelConfiguration::isPubSub,
+            "Indicates if the data channel carries the published topics.\n"
+            ":return: True if the protocol is PUB_SUB_PROTOCOL")
+        .def_property_readonly(
+            "is_clock_sync",
+            &DataChannelConfiguration::isClockSync,
+            "Indicates if the data channel carries the clock synchronization "
+            "exchanges.\n"
+            ":return: True if the protocol is CLOCK_SYNC_PROTOCOL")
+        .def_property_readonly(
+            "is_file_transfer",
+            &DataChannelConfiguration::isFileTransfer,
+            "Indicates if the data channel carries the file transfers.\n"
+            ":return: True if the protocol is FILE_TRANSFER_PROTOCOL")
+        .def_property_readonly(
+            "is_rpc",
+            &DataChannelConfiguration::isRpc,
+            "Indicates if the data channel carries the remote procedure "
+            "calls.\n"
+            ":return: True if the protocol is RPC_PROTOCOL");
 }
@@ -0,0 +1,75 @@
+#include <OpenteraWebrtcNativeClientPython/Configurations/OpusEncoderConfigurationPython.h>
+#include <OpenteraWebrtcNativeClientPython/PyBindAbslOptional.h>
+
+#include <OpenteraWebrtcNativeClient/Configurations/OpusEncoderConfiguration.h>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+void opentera::initOpusEncoderConfigurationPython(py::module& m)
+{
+    py::class_<OpusEncoderConfiguration>(
+        m,
+        "OpusEncoderConfiguration",
+        "Represents the Opus encoder settings of the audio sent by a "
+        "StreamClient.\n"
+        "\n"
+        "The unset values keep the values negotiated in the SDP.")
+        .def_static(
+            "create",
+            py::overload_cast<>(&OpusEncoderConfiguration::create),
+            "Creates an Opus encoder configuration that keeps the negotiated "
+            "values.\n"
+            ":return: An Opus encoder configuration with default values")
+        .def_static(
+            "create",
+            py::overload_cast<
+                absl::optional<int>,
+                absl::optional<int>,
+                absl::optional<int>,
+                absl::optional<bool>,
+                absl::optional<bool>>(&OpusEncoderConfiguration::create),
+            "Creates an Opus encoder configuration with the specified values.\n"
+            "\n"
+            ":param bitrate_bps: The target bitrate (6000 to 510000 bps)\n"
+            ":param complexity: The encoder complexity (0 to 10, lower values "
+            "use less CPU)\n"
+            ":param frame_size_ms: The packet time (10, 20, 40, 60, 80, 100 or "
+            "120 ms)\n"
+            ":param dtx: Enable or disable the discontinuous transmission\n"
+            ":param inband_fec: Enable or disable the in-band forward error "
+            "correction\n"
+            ":return: An Opus encoder configuration with the specified values",
+            py::arg("bitrate_bps"),
+            py::arg("complexity"),
+            py::arg("frame_size_ms"),
+            py::arg("dtx"),
+            py::arg("inband_fec"))
+
+        .def_property_readonly(
+            "bitrate_bps",
+            &OpusEncoderConfiguration::bitrateBps,
+            "Returns the target bitrate.\n"
+            ":return: The target bitrate (bps)")
+        .def_property_readonly(
+            "complexity",
+            &OpusEncoderConfiguration::complexity,
+            "Returns the encoder complexity.\n"
+            ":return: The encoder complexity")
+        .def_property_readonly(
+            "frame_size_ms",
+            &OpusEncoderConfiguration::frameSizeMs,
+            "Returns the packet time.\n"
+            ":return: The packet time (ms)")
+        .def_property_readonly(
+            "dtx",
+            &OpusEncoderConfiguration::dtx,
+            "Indicates if the discontinuous transmission is enabled.\n"
+            ":return: True if the discontinuous transmission is enabled")
+        .def_property_readonly(
+            "inband_fec",
+            &OpusEncoderConfiguration::inbandFec,
+            "Indicates if the in-band forward error correction is enabled.\n"
+            ":return: True if the in-band forward error correction is enabled");
+}
@@ -1,4 +1,5 @@
 #include <OpenteraWebrtcNativeClientPython/DataChannelClientPython.h>
+#include <OpenteraWebrtcNativeClientPython/PyBindAbslOptional.h>
 #include <OpenteraWebrtcNativeClientPython/PyBindUtils.h>
 
 #include <OpenteraWebrtcNativeClient/DataChannelClient.h>
@@ -23,6 +24,193 @@ void setOnDataChannelMessageBinary(
     self.setOnDataChannelMessageBinary(callback);
 }
 
+void setOnNamedDataChannelMessageBinary(
+    DataChannelClient& self,
+    const string& channel,
+    const function<void(const Client&, const py::bytes&)>& pythonCallback)
+{
+    auto callback = [=](const Client& client, const uint8_t* data, size_t dataSize)
+    {
+        py::gil_scoped_acquire acquire;
+        pythonCallback(client, py::bytes(reinterpret_cast<const char*>(data), dataSize));
+    };
+
+    self.setOnDataChannelMessageBinary(channel, callback);
+}
+
+void setOnDataChannelMessage(
+    DataChannelClient& self,
+    const function<void(const Client&, DataChannelMessage)>& pythonCallback)
+{
+    auto callback = [=](const Client& client, const DataChannelMessage& message)
+    {
+        py::gil_scoped_acquire acquire;
+        pythonCallback(client, message);
+    };
+
+    self.setOnDataChannelMessage(callback);
+}
+
+void setOnNamedDataChannelMessage(
+    DataChannelClient& self,
+    const string& channel,
+    const function<void(const Client&, DataChannelMessage)>& pythonCallback)
+{
+    auto callback = [=](const Client& client, const DataChannelMessage& message)
+    {
+        py::gil_scoped_acquire acquire;
+        pythonCallback(client, message);
+    };
+
+    self.setOnDataChannelMessage(channel, callback);
+}
+
+void setOnTopicMessage(
+    DataChannelClient& self,
+    const function<void(const Client&, uint16_t, DataChannelMessage)>& pythonCallback)
+{
+    auto callback = [=](const Client& client, uint16_t topic, const DataChannelMessage& message)
+    {
+        py::gil_scoped_acquire acquire;
+        pythonCallback(client, topic, message);
+    };
+
+    self.setOnTopicMessage(callback);
+}
+
+void setOnFileTransferRequested(
+    DataChannelClient& self,
+    const function<py::object(const Client&, const string&, uint64_t)>& pythonCallback)
+{
+    auto callback = [=](const Client& client, const string& name, uint64_t size)
+    {
+        py::gil_scoped_acquire acquire;
+        py::object path = pythonCallback(client, name, size);
+        return path.is_none() ? string() : path.cast<string>();
+    };
+
+    self.setOnFileTransferRequested(callback);
+}
+
+void setOnFileTransferProgress(
+    DataChannelClient& self,
+    const function<void(const Client&, const string&, bool, uint64_t, uint64_t)>& pythonCallback)
+{
+    auto callback =
+        [=](const Client& client, const string& name, bool isIncoming, uint64_t transferredSize, uint64_t size)
+    {
+        py::gil_scoped_acquire acquire;
+        pythonCallback(client, name, isIncoming, transferredSize, size);
+    };
+
+    self.setOnFileTransferProgress(callback);
+}
+
+static function<void(const absl::optional<DataChannelMessage>&, const string&)>
+    createRpcCallback(const shared_ptr<py::object>& future)
+{
+    return [future](const absl::optional<DataChannelMessage>& response, const string& error)
+    {
+        py::gil_scoped_acquire acquire;
+        // The future is not completed if it was cancelled.
+        if (!future->attr("set_running_or_notify_cancel")().cast<bool>())
+        {
+            return;
+        }
+
+        if (response.has_value())
+        {
+            future->attr("set_result")(*response);
+        }
+        else
+        {
+            future->attr("set_exception")(py::reinterpret_borrow<py::object>(PyExc_RuntimeError)(error));
+        }
+    };
+}
+
+static shared_ptr<py::object> createFuture()
+{
+    // The future is released on the internal client thread, so the GIL must be held to release it.
+    return shared_ptr<py::object>(
+        new py::object(py::module::import("concurrent.futures").attr("Future")()),
+        [](py::object* future)
+        {
+            py::gil_scoped_acquire acquire;
+            delete future;
+        });
+}
+
+py::object callBinary(DataChannelClient& self, const string& id, const string& method, const py::bytes& bytes)
+{
+    auto data = bytes.cast<string>();
+    shared_ptr<py::object> future = createFuture();
+    self.call(id, method, reinterpret_cast<const uint8_t*>(data.data()), data.size(), createRpcCallback(future));
+    return *future;
+}
+
+py::object callString(DataChannelClient& self, const string& id, const string& method, const string& message)
+{
+    shared_ptr<py::object> future = createFuture();
+    self.call(id, method, message, createRpcCallback(future));
+    return *future;
+}
+
+void setRpcHandler(
+    DataChannelClient& self,
+    const string& method,
+    const function<py::object(const Client&, DataChannelMessage)>& pythonHandler)
+{
+    if (!pythonHandler)
+    {
+        self.setRpcHandler(method, nullptr);
+        return;
+    }
+
+    auto handler = [=](const Client& client, const DataChannelMessage& request)
+    {
+        py::gil_scoped_acquire acquire;
+        try
+        {
+            py::object response = pythonHandler(client, request);
+            bool isBinary = py::isinstance<py::bytes>(response);
+            return DataChannelMessage(rtc::CopyOnWriteBuffer(response.cast<string>()), isBinary);
+        }
+        catch (const py::error_already_set& e)
+        {
+            // The Python exception is converted while the GIL is held, so it can be released on any thread.
+            throw runtime_error(e.what());
+        }
+    };
+
+    self.setRpcHandler(method, handler);
+}
+
+void setOnDataChannelMessageChunk(
+    DataChannelClient& self,
+    const function<void(const Client&, uint32_t, const py::bytes&, size_t, size_t, bool)>& pythonCallback)
+{
+    auto callback = [=](const Client& client,
+                        uint32_t messageId,
+                        const uint8_t* data,
+                        size_t dataSize,
+                        size_t offset,
+                        size_t messageSize,
+                        bool isBinary)
+    {
+        py::gil_scoped_acquire acquire;
+        pythonCallback(
+            client,
+            messageId,
+            py::bytes(reinterpret_cast<const char*>(data), dataSize),
+            offset,
+            messageSize,
+            isBinary);
+    };
+
+    self.setOnDataChannelMessageChunk(callback);
+}
+
 void opentera::initDataChannelClientPython(pybind11::module& m)
 {
     py::class_<DataChannelClient, SignalingClient>(
@@ -40,18 +228,47 @@ void opentera::initDataChannelClientPython(pybind11::module& m)
             py::arg("signaling_server_configuration"),
             py::arg("webrtc_configuration"),
             py::arg("data_channel_configuration"))
+        .def(
+            py::init<
+                SignalingServerConfiguration,
+                WebrtcConfiguration,
+                DataChannelConfiguration,
+                map<string, DataChannelConfiguration>>(),
+            "Creates a data channel client with the specified configurations "
+            "and named data channels.\n"
+            "\n"
+            "A named data channel is opened with each peer for each entry of "
+            "named_data_channel_configurations, in addition to the default data "
+            "channel. Each named data channel has its own configuration, so "
+            "lossy messages on one channel never block reliable messages on "
+            "another one. The open and close callbacks are only called for the "
+            "default data channel.\n"
+            "\n"
+            ":param signaling_server_configuration: The signaling server "
+            "configuration\n"
+            ":param webrtc_configuration: The WebRTC configuration\n"
+            ":param data_channel_configuration: The default data channel "
+            "configuration\n"
+            ":param named_data_channel_configurations: The configuration of "
+            "each named data channel (dict)",
+            py::arg("signaling_server_configuration"),
+            py::arg("webrtc_configuration"),
+            py::arg("data_channel_configuration"),
+            py::arg("named_data_channel_configurations"))
 
         .def(
             "send_to",
             [](DataChannelClient& self, const py::bytes& bytes, const vector<string>& ids)
             {
                 auto data = bytes.cast<string>();
-                self.sendTo(reinterpret_cast<const uint8_t*>(data.data()), data.size(), ids);
+                return self.sendTo(reinterpret_cast<const uint8_t*>(data.data()), data.size(), ids);
             },
             "Sends binary data to the specified clients.\n"
             "\n"
             ":param bytes: The binary data\n"
-            ":param ids: The client ids",
+            ":param ids: The client ids\n"
+            ":return: False if the data are not sent because the send queue of "
+            "a client is full",
             py::arg("bytes"),
             py::arg("ids"))
         .def(
@@ -60,7 +277,9 @@ void opentera::initDataChannelClientPython(pybind11::module& m)
             "Sends a string message to the specified clients.\n"
             "\n"
             ":param message: The string message\n"
-            ":param ids: The client ids",
+            ":param ids: The client ids\n"
+            ":return: False if the message is not sent because the send queue "
+            "of a client is full",
             py::arg("message"),
             py::arg("ids"))
         .def(
@@ -68,24 +287,573 @@ void opentera::initDataChannelClientPython(pybind11::module& m)
             [](DataChannelClient& self, const py::bytes& bytes)
             {
                 auto data = bytes.cast<string>();
-                self.sendToAll(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+                return self.sendToAll(reinterpret_cast<const uint8_t*>(data.data()), data.size());
             },
             "Sends binary data to all clients.\n"
             "\n"
-            ":param bytes: The binary data (bytes)\n",
+            ":param bytes: The binary data (bytes)\n"
+            ":return: False if the data are not sent because the send queue of "
+            "a client is full",
             py::arg("bytes"))
         .def(
             "send_to_all",
             py::overload_cast<const string&>(&DataChannelClient::sendToAll),
             "Sends a string message to all clients.\n"
             "\n"
+            ":param message: The string message\n"
+            ":return: False if the message is not sent because the send queue "
+            "of a client is full",
+            py::arg("message"))
+        .def(
+            "send_to",
+            [](DataChannelClient& self, const string& channel, const py::bytes& bytes, const vector<string>& ids)
+            {
+                auto data = bytes.cast<string>();
+                return self.sendTo(channel, reinterpret_cast<const uint8_t*>(data.data()), data.size(), ids);
+            },
+            "Sends binary data to the specified clients on a named data "
+            "channel.\n"
+            "\n"
+            ":param channel: The data channel name\n"
+            ":param bytes: The binary data\n"
+            ":param ids: The client ids\n"
+            ":return: False if the data are not sent because the send queue of "
+            "a client is full",
+            py::arg("channel"),
+            py::arg("bytes"),
+            py::arg("ids"))
+        .def(
+            "send_to",
+            py::overload_cast<const string&, const string&, const vector<string>&>(&DataChannelClient::sendTo),
+            "Sends a string message to the specified clients on a named data "
+            "channel.\n"
+            "\n"
+            ":param channel: The data channel name\n"
+            ":param message: The string message\n"
+            ":param ids: The client ids\n"
+            ":return: False if the message is not sent because the send queue "
+            "of a client is full",
+            py::arg("channel"),
+            py::arg("message"),
+            py::arg("ids"))
+        .def(
+            "send_to_all",
+            [](DataChannelClient& self, const string& channel, const py::bytes& bytes)
+            {
+                auto data = bytes.cast<string>();
+                return self.sendToAll(channel, reinterpret_cast<const uint8_t*>(data.data()), data.size());
+            },
+            "Sends binary data to all clients on a named data channel.\n"
+            "\n"
+            ":param channel: The data channel name\n"
+            ":param bytes: The binary data\n"
+            ":return: False if the data are not sent because the send queue of "
+            "a client is full",
+            py::arg("channel"),
+            py::arg("bytes"))
+        .def(
+            "send_to_all",
+            py::overload_cast<const string&, const string&>(&DataChannelClient::sendToAll),
+            "Sends a string message to all clients on a named data channel.\n"
+            "\n"
+            ":param channel: The data channel name\n"
+            ":param message: The string message\n"
+            ":return: False if the message is not sent because the send queue "
+            "of a client is full",
+            py::arg("channel"),
+            py::arg("message"))
+        .def(
+            "send_batch",
+            &DataChannelClient::sendBatch,
+            "Sends all messages of a batch to their recipients.\n"
+            "\n"
+            "The batch is submitted to the internal client thread in a single "
+            "task, so this is more efficient than calling send_to or "
+            "send_to_all for each message.\n"
+            "\n"
+            ":param batch: The messages to send\n"
+            ":return: False if no message is sent because the send queue of a "
+            "client is full",
+            py::arg("batch"))
+        .def(
+            "send_latest_to",
+            [](DataChannelClient& self, const string& key, const py::bytes& bytes, const vector<string>& ids)
+            {
+                auto data = bytes.cast<string>();
+                self.sendLatestTo(key, reinterpret_cast<const uint8_t*>(data.data()), data.size(), ids);
+            },
+            "Sends binary data to the specified clients, replacing the unsent "
+            "data that have the same key.\n"
+            "\n"
+            "The data are never refused by the send queue watermarks. When the "
+            "link is congested, only the latest data of each key are kept in a "
+            "bounded queue, so the clients receive fresh values instead of "
+            "stale ones. The data are sent on the default data channel.\n"
+            "\n"
+            ":param key: The data key (for example, the name of the value)\n"
+            ":param bytes: The binary data\n"
+            ":param ids: The client ids",
+            py::arg("key"),
+            py::arg("bytes"),
+            py::arg("ids"))
+        .def(
+            "send_latest_to",
+            py::overload_cast<const string&, const string&, const vector<string>&>(&DataChannelClient::sendLatestTo),
+            "Sends a string message to the specified clients, replacing the "
+            "unsent message that has the same key.\n"
+            "\n"
+            ":param key: The message key (for example, the name of the value)\n"
+            ":param message: The string message\n"
+            ":param ids: The client ids",
+            py::arg("key"),
+            py::arg("message"),
+            py::arg("ids"))
+        .def(
+            "send_latest_to_all",
+            [](DataChannelClient& self, const string& key, const py::bytes& bytes)
+            {
+                auto data = bytes.cast<string>();
+                self.sendLatestToAll(key, reinterpret_cast<const uint8_t*>(data.data()), data.size());
+            },
+            "Sends binary data to all clients, replacing the unsent data that "
+            "have the same key.\n"
+            "\n"
+            ":param key: The data key (for example, the name of the value)\n"
+            ":param bytes: The binary data",
+            py::arg("key"),
+            py::arg("bytes"))
+        .def(
+            "send_latest_to_all",
+            py::overload_cast<const string&, const string&>(&DataChannelClient::sendLatestToAll),
+            "Sends a string message to all clients, replacing the unsent "
+            "message that has the same key.\n"
+            "\n"
+            ":param key: The message key (for example, the name of the value)\n"
             ":param message: The string message",
+            py::arg("key"),
             py::arg("message"))
+        .def(
+            "subscribe",
+            &DataChannelClient::subscribe,
+            "Subscribes to a topic, so the messages published to this topic by "
+            "the other clients are received.\n"
+            "\n"
+            "The subscription is announced to the connected clients and to the "
+            "clients that connect later.\n"
+            "\n"
+            ":param topic: The topic (int from 0 to 65535)",
+            py::arg("topic"))
+        .def(
+            "unsubscribe",
+            &DataChannelClient::unsubscribe,
+            "Unsubscribes from a topic.\n"
+            "\n"
+            ":param topic: The topic (int from 0 to 65535)",
+            py::arg("topic"))
+        .def(
+            "publish",
+            [](DataChannelClient& self, uint16_t topic, const py::bytes& bytes)
+            {
+                auto data = bytes.cast<string>();
+                return self.publish(topic, reinterpret_cast<const uint8_t*>(data.data()), data.size());
+            },
+            "Publishes binary data to the clients subscribed to a topic.\n"
+            "\n"
+            "The data are only sent to the clients that subscribed to the "
+            "topic, on the data channel whose protocol is "
+            "DataChannelConfiguration.PUB_SUB_PROTOCOL.\n"
+            "\n"
+            ":param topic: The topic (int from 0 to 65535)\n"
+            ":param bytes: The binary data\n"
+            ":return: False if the data are not sent because the send queue of "
+            "a subscriber is full",
+            py::arg("topic"),
+            py::arg("bytes"))
+        .def(
+            "publish",
+            py::overload_cast<uint16_t, const string&>(&DataChannelClient::publish),
+            "Publishes a string message to the clients subscribed to a topic.\n"
+            "\n"
+            ":param topic: The topic (int from 0 to 65535)\n"
+            ":param message: The string message\n"
+            ":return: False if the message is not sent because the send queue "
+            "of a subscriber is full",
+            py::arg("topic"),
+            py::arg("message"))
+        .def(
+            "topic_statistics",
+            &DataChannelClient::topicStatistics,
+            "Returns the message and byte counters of a topic.\n"
+            "\n"
+            ":param topic: The topic (int from 0 to 65535)\n"
+            ":return: The counters of the topic (TopicStatistics)",
+            py::arg("topic"))
+        .def(
+            "peer_clock_offset",
+            &DataChannelClient::peerClockOffset,
+            py::call_guard<py::gil_scoped_release>(),
+            "Returns the estimated offset of the clock of a client, which is "
+            "the client time minus the local time.\n"
+            "\n"
+            ":param id: The client id\n"
+            ":return: The clock offset (us), or None if no clock "
+            "synchronization exchange was completed with the client",
+            py::arg("id"))
+        .def(
+            "peer_round_trip_time",
+            &DataChannelClient::peerRoundTripTime,
+            py::call_guard<py::gil_scoped_release>(),
+            "Returns the smoothed round-trip time of the clock synchronization "
+            "exchanges with a client.\n"
+            "\n"
+            ":param id: The client id\n"
+            ":return: The round-trip time (us), or None if no exchange was "
+            "completed with the client",
+            py::arg("id"))
+        .def(
+            "to_peer_time",
+            &DataChannelClient::toPeerTime,
+            py::call_guard<py::gil_scoped_release>(),
+            "Converts a local time to the clock of a client.\n"
+            "\n"
+            ":param id: The client id\n"
+            ":param local_time_us: The local time (us), in the clock of "
+            "local_time\n"
+            ":return: The time in the clock of the client (us), or None if its "
+            "clock offset is unknown",
+            py::arg("id"),
+            py::arg("local_time_us"))
+        .def(
+            "from_peer_time",
+            &DataChannelClient::fromPeerTime,
+            py::call_guard<py::gil_scoped_release>(),
+            "Converts a time of the clock of a client to the local clock.\n"
+            "\n"
+            "The one-way latency of a message is local_time() minus the "
+            "conversion of the time the client put in the message.\n"
+            "\n"
+            ":param id: The client id\n"
+            ":param peer_time_us: The time in the clock of the client (us)\n"
+            ":return: The local time (us), or None if the clock offset of the "
+            "client is unknown",
+            py::arg("id"),
+            py::arg("peer_time_us"))
+        .def(
+            "send_file",
+            &DataChannelClient::sendFile,
+            py::call_guard<py::gil_scoped_release>(),
+            "Sends a file to a client.\n"
+            "\n"
+            "The file is sent on the data channel whose protocol is "
+            "DataChannelConfiguration.FILE_TRANSFER_PROTOCOL. It is "
+            "memory-mapped and sent in chunks of 64 KiB, each with a CRC-32 "
+            "checksum, so it is never loaded in memory. At most 1 MiB is sent "
+            "ahead of the data written by the receiver. If the connection "
+            "closes, the transfer resumes from the data written by the receiver "
+            "when a client with the same name connects again. The file must not "
+            "be modified during the transfer.\n"
+            "\n"
+            ":param id: The client id\n"
+            ":param path: The path of the file to send\n"
+            ":param name: The file name sent to the client\n"
+            ":return: The transfer id",
+            py::arg("id"),
+            py::arg("path"),
+            py::arg("name"))
+        .def(
+            "cancel_file_transfer",
+            &DataChannelClient::cancelFileTransfer,
+            py::call_guard<py::gil_scoped_release>(),
+            "Cancels a file transfer started with send_file.\n"
+            "\n"
+            "The part of the file written by the receiver is kept.\n"
+            "\n"
+            ":param transfer_id: The transfer id",
+            py::arg("transfer_id"))
+        .def(
+            "call",
+            &callBinary,
+            "Calls a method of a client with binary data as request.\n"
+            "\n"
+            "The request is sent on the data channel whose protocol is "
+            "DataChannelConfiguration.RPC_PROTOCOL. Many calls can wait for "
+            "their response at the same time, since each response carries the "
+            "id of its call.\n"
+            "\n"
+            ":param id: The client id\n"
+            ":param method: The method name\n"
+            ":param bytes: The request binary data\n"
+            ":return: The future response (concurrent.futures.Future of "
+            "DataChannelMessage), which raises RuntimeError if the call fails or "
+            "times out",
+            py::arg("id"),
+            py::arg("method"),
+            py::arg("bytes"))
+        .def(
+            "call",
+            &callString,
+            "Calls a method of a client with a string message as request.\n"
+            "\n"
+            ":param id: The client id\n"
+            ":param method: The method name\n"
+            ":param message: The request string message\n"
+            ":return: The future response (concurrent.futures.Future of "
+            "DataChannelMessage), which raises RuntimeError if the call fails or "
+            "times out",
+            py::arg("id"),
+            py::arg("method"),
+            py::arg("message"))
+        .def(
+            "set_rpc_handler",
+            GilScopedRelease<DataChannelClient>::guard(&setRpcHandler),
+            "Sets the handler that answers the calls of a method.\n"
+            "\n"
+            "The handler returns the response (bytes or str). If it raises an "
+            "exception, the caller receives its message as error. The calls of "
+            "a method without handler fail. By default, the handlers are called "
+            "from the internal client thread, so they should not block; "
+            "rpc_worker_count moves them to a worker pool.\n"
+            "\n"
+            "Handler parameters:\n"
+            " - client: The calling client\n"
+            " - request: The request (DataChannelMessage)\n"
+            "\n"
+            ":param method: The method name\n"
+            ":param handler: The handler, or None to remove it",
+            py::arg("method"),
+            py::arg("handler"))
+        .def_static(
+            "local_time",
+            &DataChannelClient::localTime,
+            "Returns the local time used by the clock synchronization.\n"
+            "\n"
+            ":return: The local time (us)")
+
+        .def(
+            "set_send_queue_watermarks",
+            &DataChannelClient::setSendQueueWatermarks,
+            "Bounds the send queue of each client.\n"
+            "\n"
+            "A send call returns False without sending anything when it would "
+            "make the number of bytes queued for a client exceed the high "
+            "watermark. The buffered amount low callback is then called when "
+            "the queue of this client falls to the low watermark. By default, "
+            "the send queues are unbounded.\n"
+            "\n"
+            ":param low_watermark: The number of queued bytes at or under which "
+            "the buffered amount low callback is called\n"
+            ":param high_watermark: The maximum number of queued bytes for a "
+            "client",
+            py::arg("low_watermark"),
+            py::arg("high_watermark"))
+        .def(
+            "buffered_amount",
+            &DataChannelClient::bufferedAmount,
+            "Returns the number of bytes that are queued for a client and not "
+            "sent yet.\n"
+            "\n"
+            ":param id: The client id\n"
+            ":return: The number of bytes that are queued for the client",
+            py::arg("id"))
+
+        .def_property(
+            "is_message_fragmentation_enabled",
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::isMessageFragmentationEnabled),
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::setMessageFragmentationEnabled),
+            "Indicates if the messages are split into frames.\n"
+            "\n"
+            "When it is enabled, the messages are split into frames of 16 KiB "
+            "(see max_frame_size), which are interleaved fairly and "
+            "reassembled by the receiver, so large messages do not block the "
+            "small ones. It is proposed to the peers by appending "
+            "DataChannelConfiguration.FRAGMENTED_PROTOCOL_SUFFIX to the "
+            "protocol of the ordered and reliable data channels created by the "
+            "calls of this client. Both peers split the messages of these data "
+            "channels into frames, and the other data channels carry plain "
+            "messages. The peers must use this library if it is enabled. It "
+            "must be set before the calls are made.")
+        .def_property(
+            "max_frame_size",
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::maxFrameSize),
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::setMaxFrameSize),
+            "The maximum size of the frames created by the message "
+            "fragmentation and of the batches created by the coalescing "
+            "(bytes). By default, it is 16 KiB.\n"
+            "\n"
+            "Larger frames reduce the per-message overhead of bulk transfers, "
+            "but a small message can wait for a whole frame of each large "
+            "message. The messages sent without fragmentation and coalescing "
+            "keep their size. It only sizes the framing of this library: the "
+            "SCTP maximum message size of WebRTC, which is 256 KiB, cannot be "
+            "changed. It must be between 1 KiB and 256 KiB and it must be set "
+            "before the calls are made.")
+        .def_property(
+            "frame_send_buffer_size",
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::frameSendBufferSize),
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::setFrameSendBufferSize),
+            "The number of frame bytes that can wait in the buffer of a data "
+            "channel (bytes). By default, it is 256 KiB.\n"
+            "\n"
+            "When the message fragmentation is enabled, the frames are passed "
+            "to the data channel only while its buffer is under this size, so "
+            "the frames of the messages sent later can be interleaved with the "
+            "pending ones. A larger buffer keeps more data in flight on links "
+            "with a large bandwidth-delay product, but it delays the "
+            "interleaved messages. It only limits the frames waiting in the "
+            "data channel: the SCTP send and receive buffers of WebRTC cannot "
+            "be changed, and the messages sent without fragmentation are not "
+            "limited by it. It must be between 1 byte and 16 MiB and it must be "
+            "set before the calls are made.")
+        .def_property(
+            "compression_threshold",
+            &DataChannelClient::compressionThreshold,
+            &DataChannelClient::setCompressionThreshold,
+            "The size under which the messages of the compressed data channels "
+            "are sent uncompressed (bytes).\n"
+            "\n"
+            "The data channels whose protocol is "
+            "DataChannelConfiguration.COMPRESSED_PROTOCOL are compressed. The "
+            "protocol is proposed by the caller, so the compression follows "
+            "the configuration of the peer that makes the call. The messages "
+            "are compressed on the thread that sends them, unless the protocol "
+            "negotiated with a peer differs from the local one.")
+        .def_property(
+            "rpc_timeout_ms",
+            &DataChannelClient::rpcTimeout,
+            &DataChannelClient::setRpcTimeout,
+            "The time after which the calls without response fail (ms). By "
+            "default, it is 10 s.\n"
+            "\n"
+            "The timeout of a call is the one set when the call is made.")
+        .def_property(
+            "rpc_worker_count",
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::rpcWorkerCount),
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::setRpcWorkerCount),
+            "The number of threads that run the RPC handlers.\n"
+            "\n"
+            "When it is 0, the handlers are called from the internal client "
+            "thread, so a slow handler delays the other messages. Otherwise, "
+            "the handlers run on a worker pool, so several calls are handled at "
+            "the same time and their responses are sent as soon as they are "
+            "ready. By default, it is 0. The calls that wait for a thread of "
+            "the previous pool are discarded, so it should be set before the "
+            "calls are received.")
+        .def_property_readonly(
+            "compression_ratio",
+            &DataChannelClient::compressionRatio,
+            "Returns the ratio between the sizes of the messages sent on the "
+            "compressed data channels and the sizes of the sent data.\n"
+            "\n"
+            ":return: The compression ratio, or 1 if no message was sent on a "
+            "compressed data channel")
+        .def_property(
+            "message_dispatch_worker_count",
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::messageDispatchWorkerCount),
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::setMessageDispatchWorkerCount),
+            "The number of threads that call the message callbacks.\n"
+            "\n"
+            "When it is 0, the message and topic message callbacks are called "
+            "from the internal client thread, so the messages of all clients "
+            "are handled one at a time. Otherwise, each client is assigned to a "
+            "thread of a worker pool, so the messages of a client are handled "
+            "in order and the messages of different clients are handled in "
+            "parallel. The callbacks can then be called from several threads "
+            "at the same time. By default, it is 0. The messages that wait for "
+            "a thread of the previous pool are discarded, so it should be set "
+            "before the messages are received.")
+        .def_property_readonly(
+            "message_dispatch_queue_depths",
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::messageDispatchQueueDepths),
+            "Returns the number of received messages that wait for each thread "
+            "that calls the message callbacks.\n"
+            "\n"
+            ":return: The number of waiting messages for each thread, or an "
+            "empty list if the callbacks are called from the internal client "
+            "thread")
+
+        .def(
+            "set_on_data_channel_message_binary",
+            GilScopedRelease<DataChannelClient>::guard(&setOnNamedDataChannelMessageBinary),
+            "Sets the callback that is called when binary data are received on "
+            "a named data channel.\n"
+            "\n"
+            "The callback is called from the internal client thread. The "
+            "callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client the binary data are from\n"
+            " - bytes: The binary data\n"
+            "\n"
+            ":param channel: The data channel name\n"
+            ":param callback: The callback",
+            py::arg("channel"),
+            py::arg("callback"))
+        .def(
+            "set_on_data_channel_message_string",
+            GilScopedRelease<DataChannelClient>::guard(
+                py::overload_cast<const string&, const function<void(const Client&, const string&)>&>(
+                    &DataChannelClient::setOnDataChannelMessageString)),
+            "Sets the callback that is called when a string message is "
+            "received on a named data channel.\n"
+            "\n"
+            "The callback is called from the internal client thread. The "
+            "callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client the string message is from\n"
+            " - message: The string message\n"
+            "\n"
+            ":param channel: The data channel name\n"
+            ":param callback: The callback",
+            py::arg("channel"),
+            py::arg("callback"))
+        .def(
+            "set_on_data_channel_message",
+            GilScopedRelease<DataChannelClient>::guard(&setOnNamedDataChannelMessage),
+            "Sets the callback that is called when a message is received on a "
+            "named data channel, without copying it.\n"
+            "\n"
+            "The callback is called from the internal client thread. The "
+            "callback should not block. It is called in addition to the binary "
+            "or string message callback of the channel.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client the message is from\n"
+            " - message: The message (DataChannelMessage)\n"
+            "\n"
+            ":param channel: The data channel name\n"
+            ":param callback: The callback",
+            py::arg("channel"),
+            py::arg("callback"))
+
+        .def(
+            "set_on_data_channel_opened",
+            GilScopedRelease<DataChannelClient>::guard(
+                py::overload_cast<const string&, const function<void(const Client&)>&>(
+                    &DataChannelClient::setOnDataChannelOpened)),
+            "Sets the callback that is called when a named data channel "
+            "opens.\n"
+            "\n"
+            "The named data channels open after the default one, and the "
+            "messages sent on a named data channel before it opens are "
+            "dropped.\n"
+            "\n"
+            "The callback is called from the internal client thread. The "
+            "callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client of the data channel that opens\n"
+            "\n"
+            ":param channel: The data channel name\n"
+            ":param callback: The callback",
+            py::arg("channel"),
+            py::arg("callback"))
 
         .def_property(
             "on_data_channel_opened",
             nullptr,
-            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::setOnDataChannelOpened),
+            GilScopedRelease<DataChannelClient>::guard(
+                py::overload_cast<const function<void(const Client&)>&>(&DataChannelClient::setOnDataChannelOpened)),
             "Sets the callback that is called when a data channel opens.\n"
             "\n"
             "The callback is called from the internal client thread. The "
@@ -139,7 +907,9 @@ void opentera::initDataChannelClientPython(pybind11::module& m)
         .def_property(
             "on_data_channel_message_string",
             nullptr,
-            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::setOnDataChannelMessageString),
+            GilScopedRelease<DataChannelClient>::guard(
+                py::overload_cast<const function<void(const Client&, const string&)>&>(
+                    &DataChannelClient::setOnDataChannelMessageString)),
             "Sets the callback that is called when a string message is "
             "received.\n"
             "\n"
@@ -150,5 +920,123 @@ void opentera::initDataChannelClientPython(pybind11::module& m)
             " - client: The client the binary data is from\n"
             " - message: The string message\n"
             "\n"
+            ":param callback: The callback")
+        .def_property(
+            "on_data_channel_message",
+            nullptr,
+            GilScopedRelease<DataChannelClient>::guard(&setOnDataChannelMessage),
+            "Sets the callback that is called when a message is received, "
+            "without copying it.\n"
+            "\n"
+            "The callback is called from the internal client thread. "
+            "The callback should not block. It is called in addition to the "
+            "binary or string message callback. The message shares the "
+            "received buffer, so memoryview(message) does not copy the data.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client the message is from\n"
+            " - message: The message (DataChannelMessage)\n"
+            "\n"
+            ":param callback: The callback")
+        .def_property(
+            "on_data_channel_buffered_amount_low",
+            nullptr,
+            GilScopedRelease<DataChannelClient>::guard(&DataChannelClient::setOnDataChannelBufferedAmountLow),
+            "Sets the callback that is called when the send queue of a client "
+            "falls to the low watermark after a send call was refused.\n"
+            "\n"
+            "The callback is called from the internal client thread. "
+            "The callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client that can receive data again\n"
+            "\n"
+            ":param callback: The callback")
+        .def_property(
+            "on_data_channel_message_chunk",
+            nullptr,
+            GilScopedRelease<DataChannelClient>::guard(&setOnDataChannelMessageChunk),
+            "Sets the callback that is called when a chunk of a fragmented "
+            "message is received.\n"
+            "\n"
+            "When it is set, the messages larger than one frame are not "
+            "reassembled, so they are never held in memory. These messages are "
+            "passed chunk by chunk to this callback instead of the message "
+            "callbacks. The messages that fit in one frame are still passed to "
+            "the message callbacks. It is only used when the default data "
+            "channel is fragmented and it must be set before the calls are "
+            "made.\n"
+            "\n"
+            "The callback is called from the internal client thread. "
+            "The callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client the chunk is from\n"
+            " - message_id: The id of the message, unique per sender\n"
+            " - bytes: The chunk data\n"
+            " - offset: The chunk offset in the message\n"
+            " - message_size: The message size\n"
+            " - is_binary: Indicates if the message is binary data or a string "
+            "message\n"
+            "\n"
+            ":param callback: The callback")
+        .def_property(
+            "on_topic_message",
+            nullptr,
+            GilScopedRelease<DataChannelClient>::guard(&setOnTopicMessage),
+            "Sets the callback that is called when a message is received on a "
+            "subscribed topic.\n"
+            "\n"
+            "The callback is called from the internal client thread. "
+            "The callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client the message is from\n"
+            " - topic: The topic\n"
+            " - message: The message (DataChannelMessage)\n"
+            "\n"
+            ":param callback: The callback")
+        .def_property(
+            "on_file_transfer_requested",
+            nullptr,
+            GilScopedRelease<DataChannelClient>::guard(&setOnFileTransferRequested),
+            "Sets the callback that is called when a client offers a file.\n"
+            "\n"
+            "The callback returns the path of the destination file, which is "
+            "created with the file size before the data are received, or None "
+            "to refuse the file. The offers are refused when the callback is "
+            "not set. When the sender reconnects, the interrupted transfers are "
+            "resumed without calling the callback again.\n"
+            "\n"
+            "The callback is called from the internal client thread. "
+            "The callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client that offers the file\n"
+            " - name: The file name\n"
+            " - size: The file size (bytes)\n"
+            "\n"
+            ":param callback: The callback")
+        .def_property(
+            "on_file_transfer_progress",
+            nullptr,
+            GilScopedRelease<DataChannelClient>::guard(&setOnFileTransferProgress),
+            "Sets the callback that is called when the receiver writes file "
+            "data.\n"
+            "\n"
+            "The transfer is complete when the transferred size is equal to the "
+            "file size. For an incoming file, the destination file is closed "
+            "before the last call.\n"
+            "\n"
+            "The callback is called from the internal client thread. "
+            "The callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client that sends or receives the file\n"
+            " - name: The file name\n"
+            " - is_incoming: Indicates if the file is received\n"
+            " - transferred_size: The number of bytes written by the receiver\n"
+            " - size: The file size (bytes)\n"
+            "\n"
             ":param callback: The callback");
 }
@@ -0,0 +1,122 @@
+#include <OpenteraWebrtcNativeClientPython/Sinks/AudioRecorderPython.h>
+
+#include <OpenteraWebrtcNativeClient/Sinks/AudioRecorder.h>
+
+#include <pybind11/numpy.h>
+
+#include <string_view>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+template<class T>
+void writeFrame(AudioRecorder& self, const py::array_t<T>& frame, int sampleRate, size_t numberOfChannels)
+{
+    if (frame.ndim() != 1)
+    {
+        throw py::value_error("The frame must have 1 dimension.");
+    }
+    if (numberOfChannels == 0 || frame.shape(0) % numberOfChannels != 0)
+    {
+        throw py::value_error("The frame size must be a multiple of number_of_channels.");
+    }
+
+    self.write(frame.data(), 8 * sizeof(T), sampleRate, numberOfChannels, frame.shape(0) / numberOfChannels);
+}
+
+void writeEncoded(AudioRecorder& self, const py::bytes& packet, size_t numberOfChannels)
+{
+    string_view data(packet);
+    py::gil_scoped_release release;
+    self.writeEncoded(reinterpret_cast<const uint8_t*>(data.data()), data.size(), numberOfChannels);
+}
+
+void opentera::initAudioRecorderPython(pybind11::module& m)
+{
+    py::enum_<AudioRecordingFormat>(m, "AudioRecordingFormat")
+        .value("WAV", AudioRecordingFormat::Wav)
+        .value("OGG_OPUS", AudioRecordingFormat::OggOpus);
+
+    py::class_<AudioRecorder, shared_ptr<AudioRecorder>>(
+        m,
+        "AudioRecorder",
+        "Records an audio stream to a file.\n"
+        "\n"
+        "The encoding and the file writes are done by a background thread. "
+        "The WAV file keeps the format of the first frame. The Ogg/Opus file is "
+        "encoded at 48000 Hz with at most 2 channels. Frames that cannot be "
+        "recorded are dropped and counted.")
+        .def(
+            py::init<const string&, AudioRecordingFormat, size_t>(),
+            "Creates an audio recorder and starts its writing thread.\n"
+            "\n"
+            ":param path: The file path\n"
+            ":param format: The file format\n"
+            ":param buffer_size: The size in bytes of the buffer filled between "
+            "two writes",
+            py::arg("path"),
+            py::arg("format"),
+            py::arg("buffer_size") = AudioRecorder::DefaultBufferSize)
+        .def(
+            "write",
+            &writeFrame<int8_t>,
+            py::call_guard<py::gil_scoped_release>(),
+            "Queues an audio frame to be written.\n"
+            "\n"
+            ":param frame: The audio frame\n"
+            ":param sample_rate: The audio stream sample rate\n"
+            ":param number_of_channels: The audio stream channel count",
+            py::arg("frame"),
+            py::arg("sample_rate"),
+            py::arg("number_of_channels"))
+        .def(
+            "write",
+            &writeFrame<int16_t>,
+            py::call_guard<py::gil_scoped_release>(),
+            "Queues an audio frame to be written.\n"
+            "\n"
+            ":param frame: The audio frame\n"
+            ":param sample_rate: The audio stream sample rate\n"
+            ":param number_of_channels: The audio stream channel count",
+            py::arg("frame"),
+            py::arg("sample_rate"),
+            py::arg("number_of_channels"))
+        .def(
+            "write",
+            &writeFrame<int32_t>,
+            py::call_guard<py::gil_scoped_release>(),
+            "Queues an audio frame to be written.\n"
+            "\n"
+            ":param frame: The audio frame\n"
+            ":param sample_rate: The audio stream sample rate\n"
+            ":param number_of_channels: The audio stream channel count",
+            py::arg("frame"),
+            py::arg("sample_rate"),
+            py::arg("number_of_channels"))
+        .def(
+            "write_encoded",
+            &writeEncoded,
+            "Queues an Opus packet to be written as it is.\n"
+            "\n"
+            "The packets can only be recorded in an Ogg/Opus file that does not "
+            "contain PCM frames.\n"
+            "\n"
+            ":param packet: The Opus packet (bytes)\n"
+            ":param number_of_channels: The channel count of the Opus stream (1 "
+            "or 2)",
+            py::arg("packet"),
+            py::arg("number_of_channels"))
+        .def(
+            "close",
+            &AudioRecorder::close,
+            py::call_guard<py::gil_scoped_release>(),
+            "Writes the queued audio data, finalizes the file and stops the "
+            "writing thread.")
+        .def_property_readonly(
+            "dropped_frame_count",
+            &AudioRecorder::droppedFrameCount,
+            "Returns the number of frames that were not recorded.\n"
+            "\n"
+            ":return: The number of frames that were not recorded");
+}
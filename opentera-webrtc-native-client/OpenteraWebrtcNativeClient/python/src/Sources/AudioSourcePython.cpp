@@ -3,6 +3,7 @@
 #include <OpenteraWebrtcNativeClient/Sources/AudioSource.h>
 
 #include <pybind11/numpy.h>
+#include <pybind11/stl.h>
 
 using namespace opentera;
 using namespace std;
@@ -66,6 +67,28 @@ void opentera::initAudioSourcePython(pybind11::module& m)
             py::arg("bits_per_sample"),
             py::arg("sample_rate"),
             py::arg("number_of_channels"))
+        .def(
+            py::init<AudioSourceConfiguration, int, int, size_t, vector<size_t>>(),
+            "Creates an AudioSource that only sends some channels of the audio "
+            "stream\n"
+            "\n"
+            ":param configuration: the configuration applied to the audio "
+            "stream by the audio transport layer\n"
+            ":param bits_per_sample: The audio stream sample size (8, 16 or 32 "
+            "bits)\n"
+            ":param sample_rate: The audio stream sample rate\n"
+            ":param number_of_channels: The audio stream channel count\n"
+            ":param selected_channels: The indexes of the channels to send, in "
+            "order (empty to send all channels)",
+            py::arg("configuration"),
+            py::arg("bits_per_sample"),
+            py::arg("sample_rate"),
+            py::arg("number_of_channels"),
+            py::arg("selected_channels"))
+        .def_property_readonly(
+            "selected_channels",
+            &AudioSource::selectedChannels,
+            "Returns the channels that are sent (empty if all channels are sent)")
         .def(
             "send_frame",
             &sendFrame<int8_t>,
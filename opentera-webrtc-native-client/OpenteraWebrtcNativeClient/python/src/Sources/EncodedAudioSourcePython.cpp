@@ -0,0 +1,45 @@
+#include <OpenteraWebrtcNativeClientPython/Sources/EncodedAudioSourcePython.h>
+
+#include <OpenteraWebrtcNativeClient/Sources/EncodedAudioSource.h>
+
+#include <string_view>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+bool sendEncodedFrame(const shared_ptr<EncodedAudioSource>& self, const py::bytes& frame)
+{
+    string_view data(frame);
+    py::gil_scoped_release release;
+    return self->sendEncodedFrame(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+}
+
+void opentera::initEncodedAudioSourcePython(pybind11::module& m)
+{
+    py::class_<EncodedAudioSource, AudioSource, shared_ptr<EncodedAudioSource>>(
+        m,
+        "EncodedAudioSource",
+        "Represents an audio source that sends Opus packets without "
+        "transcoding them.\n"
+        "\n"
+        "Pass an instance of this to the StreamClient and call "
+        "send_encoded_frame for each Opus packet. The packets must last a "
+        "multiple of 10 ms.")
+        .def(
+            py::init<size_t>(),
+            "Creates an EncodedAudioSource\n"
+            "\n"
+            ":param number_of_channels: The channel count of the Opus packets "
+            "(1 or 2)",
+            py::arg("number_of_channels") = 1)
+        .def(
+            "send_encoded_frame",
+            &sendEncodedFrame,
+            "Sends an Opus packet to every peer.\n"
+            "\n"
+            ":param frame: The Opus packet (bytes)\n"
+            ":return: False if the packet is invalid or if its duration is not "
+            "a multiple of 10 ms",
+            py::arg("frame"));
+}
@@ -0,0 +1,155 @@
+#include <OpenteraWebrtcNativeClientPython/Sources/PacedAudioFeederPython.h>
+
+#include <OpenteraWebrtcNativeClient/Sources/PacedAudioFeeder.h>
+
+#include <pybind11/functional.h>
+#include <pybind11/numpy.h>
+#include <pybind11/stl.h>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+template<class T>
+void enqueue(PacedAudioFeeder& self, const py::array_t<T>& frames)
+{
+    const auto& audioSource = self.audioSource();
+    if (audioSource->bytesPerSample() != sizeof(T))
+    {
+        throw py::value_error("Invalid frame data type.");
+    }
+    if (frames.ndim() != 1)
+    {
+        throw py::value_error("The frames must have 1 dimension.");
+    }
+
+    size_t byteSize = sizeof(T) * frames.shape(0);
+    if (byteSize % audioSource->bytesPerFrame() != 0)
+    {
+        throw py::value_error("The frames size must be a multiple of "
+                              "(bytes_per_sample * number_of_channels).");
+    }
+    self.enqueue(frames.data(), byteSize / audioSource->bytesPerFrame());
+}
+
+void setOnUnderrun(PacedAudioFeeder& self, const function<void()>& pythonCallback)
+{
+    self.setOnUnderrun(
+        [=]()
+        {
+            py::gil_scoped_acquire acquire;
+            pythonCallback();
+        });
+}
+
+void opentera::initPacedAudioFeederPython(pybind11::module& m)
+{
+    py::class_<PacedAudioFeeder>(
+        m,
+        "PacedAudioFeeder",
+        "Feeds an audio source in real time from queued buffers and WAV "
+        "files.\n"
+        "\n"
+        "A timer thread sends exactly one 10 ms frame per period, so buffers "
+        "can be queued faster than real time without flooding the transport. "
+        "Silence is sent when the queue is empty. An underrun is reported once "
+        "each time the queue runs out of audio.")
+        .def(
+            py::init<shared_ptr<AudioSource>, shared_ptr<AudioClock>>(),
+            "Creates a paced audio feeder. The timer thread is not started.\n"
+            "\n"
+            ":param audio_source: The audio source to feed\n"
+            ":param clock: The clock that paces the frames",
+            py::arg("audio_source"),
+            py::arg("clock") = make_shared<RealTimeAudioClock>())
+
+        .def_property_readonly(
+            "audio_source",
+            &PacedAudioFeeder::audioSource,
+            "Returns the fed audio source.\n"
+            "\n"
+            ":return: The fed audio source")
+        .def(
+            "start",
+            &PacedAudioFeeder::start,
+            py::call_guard<py::gil_scoped_release>(),
+            "Starts the timer thread if it is not started.")
+        .def(
+            "stop",
+            &PacedAudioFeeder::stop,
+            py::call_guard<py::gil_scoped_release>(),
+            "Stops the timer thread if it is started. The queued audio is "
+            "kept.")
+        .def_property_readonly(
+            "is_started",
+            &PacedAudioFeeder::isStarted,
+            "Indicates if the timer thread is started.\n"
+            "\n"
+            ":return: True if the timer thread is started")
+
+        .def(
+            "enqueue",
+            &enqueue<int8_t>,
+            py::call_guard<py::gil_scoped_release>(),
+            "Copies audio frames at the end of the queue.\n"
+            "\n"
+            ":param frames: The audio frames",
+            py::arg("frames"))
+        .def(
+            "enqueue",
+            &enqueue<int16_t>,
+            py::call_guard<py::gil_scoped_release>(),
+            "Copies audio frames at the end of the queue.\n"
+            "\n"
+            ":param frames: The audio frames",
+            py::arg("frames"))
+        .def(
+            "enqueue",
+            &enqueue<int32_t>,
+            py::call_guard<py::gil_scoped_release>(),
+            "Copies audio frames at the end of the queue.\n"
+            "\n"
+            ":param frames: The audio frames",
+            py::arg("frames"))
+        .def(
+            "enqueue_wav_file",
+            &PacedAudioFeeder::enqueueWavFile,
+            py::call_guard<py::gil_scoped_release>(),
+            "Maps a WAV file in memory and adds its audio at the end of the "
+            "queue.\n"
+            "\n"
+            "The file is not copied, so it must not be modified while it is "
+            "queued.\n"
+            "\n"
+            ":param path: The WAV file path (PCM, the audio source format)",
+            py::arg("path"))
+        .def(
+            "clear",
+            &PacedAudioFeeder::clear,
+            py::call_guard<py::gil_scoped_release>(),
+            "Removes the queued audio.")
+
+        .def_property_readonly(
+            "queued_number_of_frames",
+            &PacedAudioFeeder::queuedNumberOfFrames,
+            "Returns the number of queued frames.\n"
+            "\n"
+            ":return: The number of queued frames")
+        .def_property_readonly(
+            "underrun_count",
+            &PacedAudioFeeder::underrunCount,
+            "Returns the number of underruns since the feeder was created.\n"
+            "\n"
+            ":return: The number of underruns")
+        .def_property(
+            "on_underrun",
+            nullptr,
+            &setOnUnderrun,
+            "Sets the callback that is called when the queue runs out of "
+            "audio.\n"
+            "\n"
+            "The callback is called from the timer thread. The callback should "
+            "not block.\n"
+            "\n"
+            ":param callback: The callback");
+}
@@ -5,6 +5,7 @@
 
 #include <pybind11/functional.h>
 #include <pybind11/numpy.h>
+#include <pybind11/stl.h>
 
 using namespace opentera;
 using namespace std;
@@ -109,23 +110,73 @@ void setOnEncodedVideoFrameReceived(
     self.setOnEncodedVideoFrameReceived(callback);
 }
 
+AudioFrameReceivedCallback createAudioFrameReceivedCallback(
+    const function<void(const Client&, const py::array&, int, size_t, size_t)>& pythonCallback)
+{
+    return [=](const Client& client,
+               const void* audioData,
+               int bitsPerSample,
+               int sampleRate,
+               size_t numberOfChannels,
+               size_t numberOfFrames)
+    {
+        py::buffer_info bufferInfo = getAudioBufferInfo(audioData, bitsPerSample, numberOfChannels, numberOfFrames);
+        py::gil_scoped_acquire acquire;
+        pythonCallback(client, py::array(bufferInfo), sampleRate, numberOfChannels, numberOfFrames);
+    };
+}
+
 void setOnAudioFrameReceived(
     StreamClient& self,
     const function<void(const Client&, const py::array&, int, size_t, size_t)>& pythonCallback)
+{
+    self.setOnAudioFrameReceived(createAudioFrameReceivedCallback(pythonCallback));
+}
+
+void setOnAudioFrameReceivedWithConfiguration(
+    StreamClient& self,
+    const function<void(const Client&, const py::array&, int, size_t, size_t)>& pythonCallback,
+    const AudioSinkConfiguration& configuration)
+{
+    self.setOnAudioFrameReceived(createAudioFrameReceivedCallback(pythonCallback), configuration);
+}
+
+void setOnTimestampedAudioFrameReceived(
+    StreamClient& self,
+    const function<void(const Client&, const py::array&, int, size_t, size_t, uint64_t)>& pythonCallback)
 {
     auto callback = [=](const Client& client,
                         const void* audioData,
                         int bitsPerSample,
                         int sampleRate,
                         size_t numberOfChannels,
-                        size_t numberOfFrames)
+                        size_t numberOfFrames,
+                        uint64_t timestampUs)
     {
         py::buffer_info bufferInfo = getAudioBufferInfo(audioData, bitsPerSample, numberOfChannels, numberOfFrames);
         py::gil_scoped_acquire acquire;
-        pythonCallback(client, py::array(bufferInfo), sampleRate, numberOfChannels, numberOfFrames);
+        pythonCallback(client, py::array(bufferInfo), sampleRate, numberOfChannels, numberOfFrames, timestampUs);
     };
 
-    self.setOnAudioFrameReceived(callback);
+    self.setOnTimestampedAudioFrameReceived(callback);
+}
+
+void setOnEncodedAudioFrameReceived(
+    StreamClient& self,
+    const function<void(const Client&, const py::bytes&, size_t, uint32_t)>& pythonCallback)
+{
+    auto callback = [=](const Client& client,
+                        const uint8_t* data,
+                        size_t dataSize,
+                        size_t numberOfFrames,
+                        uint32_t rtpTimestamp)
+    {
+        py::gil_scoped_acquire acquire;
+        py::bytes dataBytes(reinterpret_cast<const char*>(data), dataSize);
+        pythonCallback(client, dataBytes, numberOfFrames, rtpTimestamp);
+    };
+
+    self.setOnEncodedAudioFrameReceived(callback);
 }
 
 void setOnMixedAudioFrameReceived(
@@ -258,6 +309,93 @@ void opentera::initStreamClientPython(pybind11::module& m)
             &StreamClient::unmuteLocalVideo,
             py::call_guard<py::gil_scoped_release>(),
             "Unmutes the local video.")
+        .def(
+            "set_remote_audio_gain",
+            &StreamClient::setRemoteAudioGain,
+            py::call_guard<py::gil_scoped_release>(),
+            "Sets the gain applied to the audio received from a peer before it is mixed.\n"
+            "\n"
+            "A gain of 0 silences the peer, so the audio mixer skips it.\n"
+            "\n"
+            ":param id: The peer id\n"
+            ":param gain: The linear gain (clamped between 0 and 10, 1 by default)",
+            py::arg("id"),
+            py::arg("gain"))
+        .def(
+            "set_remote_audio_recorder",
+            &StreamClient::setRemoteAudioRecorder,
+            py::call_guard<py::gil_scoped_release>(),
+            "Records the audio received from a peer.\n"
+            "\n"
+            ":param id: The peer id\n"
+            ":param audio_recorder: The audio recorder (None to stop the recording)",
+            py::arg("id"),
+            py::arg("audio_recorder"))
+        .def(
+            "set_mixed_audio_recorder",
+            &StreamClient::setMixedAudioRecorder,
+            py::call_guard<py::gil_scoped_release>(),
+            "Records the mixed audio of all peers.\n"
+            "\n"
+            ":param audio_recorder: The audio recorder (None to stop the recording)",
+            py::arg("audio_recorder"))
+        .def(
+            "set_audio_clock",
+            &StreamClient::setAudioClock,
+            py::call_guard<py::gil_scoped_release>(),
+            "Sets the clock that paces the mixed remote audio playout.\n"
+            "\n"
+            "A VirtualAudioClock makes the playout run faster than real time.\n"
+            "\n"
+            ":param clock: The clock (None to use the wall clock)",
+            py::arg("clock"))
+        .def_property(
+            "opus_encoder_configuration",
+            GilScopedRelease<StreamClient>::guard(&StreamClient::opusEncoderConfiguration),
+            GilScopedRelease<StreamClient>::guard(&StreamClient::setOpusEncoderConfiguration),
+            "The Opus encoder settings of the local audio. They are applied to "
+            "the current calls at the next packet boundary without "
+            "renegotiation.")
+
+        .def_property(
+            "is_stereo_audio_enabled",
+            GilScopedRelease<StreamClient>::guard(&StreamClient::isStereoAudioEnabled),
+            GilScopedRelease<StreamClient>::guard(&StreamClient::setStereoAudioEnabled),
+            "Indicates if stereo Opus is negotiated (stereo=1 and sprop-stereo=1 "
+            "in the SDP).\n"
+            "\n"
+            "The local audio is sent in stereo only if the audio source has 2 "
+            "channels (or 2 selected channels) and the peer accepts stereo. It "
+            "must be set before the calls are made.")
+        .def_property(
+            "is_audio_video_synchronization_enabled",
+            GilScopedRelease<StreamClient>::guard(&StreamClient::isAudioVideoSynchronizationEnabled),
+            GilScopedRelease<StreamClient>::guard(&StreamClient::setAudioVideoSynchronizationEnabled),
+            "Indicates if the timestamped audio frames and the video frames "
+            "are delivered in timestamp order.\n"
+            "\n"
+            "When it is enabled and both callbacks are set, the frames of each "
+            "peer are buffered and delivered in timestamp order. It must be set "
+            "before the calls are made.")
+        .def_property(
+            "is_audio_level_metering_enabled",
+            GilScopedRelease<StreamClient>::guard(&StreamClient::isAudioLevelMeteringEnabled),
+            GilScopedRelease<StreamClient>::guard(&StreamClient::setAudioLevelMeteringEnabled),
+            "Indicates if the audio level of the remote streams is computed.\n"
+            "\n"
+            "The remote audio streams are received even if there is no audio "
+            "frame callback when it is enabled. It must be set before the calls "
+            "are made.")
+        .def(
+            "get_remote_audio_levels",
+            &StreamClient::getRemoteAudioLevels,
+            py::call_guard<py::gil_scoped_release>(),
+            "Returns the last audio level of each connected peer.\n"
+            "\n"
+            "The levels are only computed if the audio level metering is enabled "
+            "or if an audio level callback is set.\n"
+            "\n"
+            ":return: The audio levels by peer id")
 
         .def_property(
             "on_add_remote_stream",
@@ -340,6 +478,71 @@ void opentera::initStreamClientPython(pybind11::module& m)
             " - number_of_frames: The number of frames\n"
             "\n"
             ":param callback: The callback")
+        .def(
+            "set_on_audio_frame_received",
+            GilScopedRelease<StreamClient>::guard(&setOnAudioFrameReceivedWithConfiguration),
+            "Sets the callback that is called when an audio stream frame is "
+            "received and the format of the frames.\n"
+            "\n"
+            "The decoded audio is converted to the specified format for each "
+            "peer before it is given to the callback. The conversion does not "
+            "change the audio level and the recorded audio. The configuration "
+            "only applies to the peers that connect after this call.\n"
+            "\n"
+            "The callback is called from a WebRTC processing thread. The "
+            "callback should not block.\n"
+            "\n"
+            ":param callback: The callback (see on_audio_frame_received)\n"
+            ":param configuration: The format of the frames given to the "
+            "callback",
+            py::arg("callback"),
+            py::arg("configuration"))
+        .def_property(
+            "on_timestamped_audio_frame_received",
+            nullptr,
+            GilScopedRelease<StreamClient>::guard(&setOnTimestampedAudioFrameReceived),
+            "Sets the callback that is called when an audio stream frame is "
+            "received, with its timestamp.\n"
+            "\n"
+            "The timestamp is the playout time of the frame in microseconds. It "
+            "can be compared with the timestamp of the video frame callback, "
+            "which is the render time in the same clock.\n"
+            "\n"
+            "The callback is called from a WebRTC processing thread. The "
+            "callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client of the stream frame\n"
+            " - audio_data: The audio data (numpy.array[int8], "
+            "numpy.array[int16] or numpy.array[int32])\n"
+            " - sample_rate: The audio stream sample rate\n"
+            " - number_of_channels: The audio stream channel count\n"
+            " - number_of_frames: The number of frames\n"
+            " - timestamp_us: The timestamp of the first frame in microseconds\n"
+            "\n"
+            ":param callback: The callback")
+        .def_property(
+            "on_encoded_audio_frame_received",
+            nullptr,
+            GilScopedRelease<StreamClient>::guard(&setOnEncodedAudioFrameReceived),
+            "Sets the callback that is called when an encoded audio packet is "
+            "received.\n"
+            "\n"
+            "The packets are given before they are decoded. They are only "
+            "decoded if an audio frame callback, an audio level callback, a "
+            "mixed audio frame callback or the audio level metering is set.\n"
+            "\n"
+            "The callback is called from a WebRTC processing thread. The "
+            "callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client of the stream packet\n"
+            " - data: The Opus packet (bytes)\n"
+            " - number_of_frames: The number of frames of the packet at 48000 "
+            "Hz\n"
+            " - rtp_timestamp: The RTP timestamp of the packet\n"
+            "\n"
+            ":param callback: The callback")
         .def_property(
             "on_mixed_audio_frame_received",
             nullptr,
@@ -357,5 +560,21 @@ void opentera::initStreamClientPython(pybind11::module& m)
             " - number_of_channels: The audio stream channel count\n"
             " - number_of_frames: The number of frames\n"
             "\n"
+            ":param callback: The callback")
+        .def_property(
+            "on_audio_level_changed",
+            nullptr,
+            GilScopedRelease<StreamClient>::guard(&StreamClient::setOnAudioLevelChanged),
+            "Sets the callback that is called when the audio level of a remote "
+            "stream is updated (every 100 ms).\n"
+            "\n"
+            "The audio level is computed even if no audio frame callback is set. "
+            "The callback is called from a WebRTC processing thread. The "
+            "callback should not block.\n"
+            "\n"
+            "Callback parameters:\n"
+            " - client: The client of the stream\n"
+            " - level: The audio level of the last 100 ms and the voice activity\n"
+            "\n"
             ":param callback: The callback");
 }
@@ -0,0 +1,61 @@
+#include <OpenteraWebrtcNativeClientPython/Utils/AudioClockPython.h>
+
+#include <OpenteraWebrtcNativeClient/Utils/AudioClock.h>
+
+#include <pybind11/chrono.h>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+void opentera::initAudioClockPython(pybind11::module& m)
+{
+    py::class_<AudioClock, shared_ptr<AudioClock>>(
+        m,
+        "AudioClock",
+        "Represents the clock that paces the audio device module playout.")
+        .def(
+            "now",
+            &AudioClock::now,
+            py::call_guard<py::gil_scoped_release>(),
+            "Returns the current time.\n"
+            "\n"
+            ":return: The current time since the clock epoch");
+
+    py::class_<RealTimeAudioClock, AudioClock, shared_ptr<RealTimeAudioClock>>(
+        m,
+        "RealTimeAudioClock",
+        "An audio clock that follows the wall clock.")
+        .def(py::init<>(), "Creates a real-time audio clock");
+
+    py::class_<VirtualAudioClock, AudioClock, shared_ptr<VirtualAudioClock>>(
+        m,
+        "VirtualAudioClock",
+        "An audio clock that does not follow the wall clock.\n"
+        "\n"
+        "In free-running mode, the playout advances as fast as the consumer "
+        "handles the audio frames. Otherwise, the time only advances when "
+        "advance is called, so the playout can be stepped deterministically.")
+        .def(
+            py::init<bool>(),
+            "Creates a virtual audio clock starting at 0.\n"
+            "\n"
+            ":param is_free_running: Indicates if the clock jumps to the requested "
+            "time instead of waiting for advance",
+            py::arg("is_free_running") = true)
+
+        .def_property_readonly(
+            "is_free_running",
+            &VirtualAudioClock::isFreeRunning,
+            "Indicates if the clock is free-running.\n"
+            "\n"
+            ":return: True if the clock is free-running")
+        .def(
+            "advance",
+            &VirtualAudioClock::advance,
+            py::call_guard<py::gil_scoped_release>(),
+            "Advances the time.\n"
+            "\n"
+            ":param duration: The duration to add to the current time",
+            py::arg("duration"));
+}
@@ -0,0 +1,32 @@
+#include <OpenteraWebrtcNativeClientPython/Utils/AudioLevelPython.h>
+
+#include <OpenteraWebrtcNativeClient/Utils/AudioLevelMeter.h>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+void opentera::initAudioLevelPython(pybind11::module& m)
+{
+    py::class_<AudioLevel>(m, "AudioLevel", "Represents the audio level of a stream.")
+        .def(py::init<>(), "Creates an audio level with default values")
+        .def(
+            py::init<float, bool>(),
+            "Creates an audio level with the specified values.\n"
+            "\n"
+            ":param level_dbfs: The RMS level (dBFS)\n"
+            ":param is_voice_active: Indicates if voice activity is detected",
+            py::arg("level_dbfs"),
+            py::arg("is_voice_active"))
+
+        .def_property_readonly(
+            "level_dbfs",
+            &AudioLevel::levelDbfs,
+            "Returns the RMS level.\n"
+            ":return: The RMS level (dBFS, between -127 and 0)")
+        .def_property_readonly(
+            "is_voice_active",
+            &AudioLevel::isVoiceActive,
+            "Indicates if voice activity is detected.\n"
+            ":return: True if voice activity is detected");
+}
@@ -0,0 +1,78 @@
+#include <OpenteraWebrtcNativeClientPython/Utils/DataChannelMessageBatchPython.h>
+
+#include <OpenteraWebrtcNativeClient/Utils/DataChannelMessageBatch.h>
+
+#include <pybind11/stl.h>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+void opentera::initDataChannelMessageBatchPython(pybind11::module& m)
+{
+    py::class_<DataChannelMessageBatch>(
+        m,
+        "DataChannelMessageBatch",
+        "Represents messages that are sent to data channels in a single "
+        "internal client thread hop.\n"
+        "\n"
+        "Each message has its own recipients.")
+        .def(py::init<>(), "Creates an empty batch.")
+        .def(
+            py::init<size_t>(),
+            "Creates an empty batch that can hold the specified number of "
+            "messages without reallocation.\n"
+            "\n"
+            ":param capacity: The number of messages to reserve",
+            py::arg("capacity"))
+
+        .def(
+            "add_to",
+            [](DataChannelMessageBatch& self, const py::bytes& bytes, vector<string> ids)
+            {
+                auto data = bytes.cast<string>();
+                self.addTo(reinterpret_cast<const uint8_t*>(data.data()), data.size(), move(ids));
+            },
+            "Adds binary data for the specified clients.\n"
+            "\n"
+            ":param bytes: The binary data\n"
+            ":param ids: The client ids",
+            py::arg("bytes"),
+            py::arg("ids"))
+        .def(
+            "add_to",
+            py::overload_cast<const string&, vector<string>>(&DataChannelMessageBatch::addTo),
+            "Adds a string message for the specified clients.\n"
+            "\n"
+            ":param message: The string message\n"
+            ":param ids: The client ids",
+            py::arg("message"),
+            py::arg("ids"))
+        .def(
+            "add_to_all",
+            [](DataChannelMessageBatch& self, const py::bytes& bytes)
+            {
+                auto data = bytes.cast<string>();
+                self.addToAll(reinterpret_cast<const uint8_t*>(data.data()), data.size());
+            },
+            "Adds binary data for all clients.\n"
+            "\n"
+            ":param bytes: The binary data",
+            py::arg("bytes"))
+        .def(
+            "add_to_all",
+            py::overload_cast<const string&>(&DataChannelMessageBatch::addToAll),
+            "Adds a string message for all clients.\n"
+            "\n"
+            ":param message: The string message",
+            py::arg("message"))
+
+        .def("__len__", &DataChannelMessageBatch::size)
+        .def_property_readonly(
+            "empty",
+            &DataChannelMessageBatch::empty,
+            "Indicates if the batch is empty.\n"
+            "\n"
+            ":return: True if the batch is empty")
+        .def("clear", &DataChannelMessageBatch::clear, "Removes all messages from the batch.");
+}
@@ -0,0 +1,54 @@
+#include <OpenteraWebrtcNativeClientPython/Utils/DataChannelMessagePython.h>
+
+#include <OpenteraWebrtcNativeClient/Utils/DataChannelMessage.h>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+void opentera::initDataChannelMessagePython(pybind11::module& m)
+{
+    py::class_<DataChannelMessage>(
+        m,
+        "DataChannelMessage",
+        py::buffer_protocol(),
+        "Represents a received data channel message.\n"
+        "\n"
+        "The message shares the buffer it was received in and supports the "
+        "buffer protocol, so memoryview(message) gives a read-only view over "
+        "the data without copying them.")
+        .def_buffer(
+            [](DataChannelMessage& self)
+            {
+                return py::buffer_info(
+                    const_cast<uint8_t*>(self.data()),
+                    sizeof(uint8_t),
+                    py::format_descriptor<uint8_t>::format(),
+                    1,
+                    {self.size()},
+                    {sizeof(uint8_t)},
+                    true);
+            })
+
+        .def_property_readonly(
+            "is_binary",
+            &DataChannelMessage::isBinary,
+            "Indicates if the message is binary data or a string message.\n"
+            "\n"
+            ":return: True if the message is binary data")
+        .def(
+            "to_bytes",
+            [](const DataChannelMessage& self)
+            { return py::bytes(reinterpret_cast<const char*>(self.data()), self.size()); },
+            "Copies the message data.\n"
+            "\n"
+            ":return: The message data (bytes)")
+        .def(
+            "to_string",
+            [](const DataChannelMessage& self) { return string(self.view()); },
+            "Copies the message data as a string.\n"
+            "\n"
+            ":return: The message data (str)")
+
+        .def("__len__", &DataChannelMessage::size);
+}
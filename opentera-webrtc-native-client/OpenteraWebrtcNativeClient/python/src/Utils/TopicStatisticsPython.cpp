@@ -0,0 +1,57 @@
+#include <OpenteraWebrtcNativeClientPython/Utils/TopicStatisticsPython.h>
+
+#include <OpenteraWebrtcNativeClient/Utils/TopicStatistics.h>
+
+using namespace opentera;
+using namespace std;
+namespace py = pybind11;
+
+void opentera::initTopicStatisticsPython(pybind11::module& m)
+{
+    py::class_<TopicStatistics>(
+        m,
+        "TopicStatistics",
+        "Represents the message and byte counters of a topic.\n"
+        "\n"
+        "A message published to several subscribers is counted once per "
+        "subscriber. The byte counters do not include the frame headers.")
+        .def(
+            py::init<uint64_t, uint64_t, uint64_t, uint64_t>(),
+            "Creates topic statistics with the specified values.\n"
+            "\n"
+            ":param sent_message_count: The number of messages sent to the "
+            "subscribers\n"
+            ":param sent_byte_count: The number of bytes sent to the "
+            "subscribers\n"
+            ":param received_message_count: The number of received messages\n"
+            ":param received_byte_count: The number of received bytes",
+            py::arg("sent_message_count"),
+            py::arg("sent_byte_count"),
+            py::arg("received_message_count"),
+            py::arg("received_byte_count"))
+
+        .def_property_readonly(
+            "sent_message_count",
+            &TopicStatistics::sentMessageCount,
+            "Returns the number of messages sent to the subscribers.\n"
+            "\n"
+            ":return: The number of messages sent to the subscribers")
+        .def_property_readonly(
+            "sent_byte_count",
+            &TopicStatistics::sentByteCount,
+            "Returns the number of bytes sent to the subscribers.\n"
+            "\n"
+            ":return: The number of bytes sent to the subscribers")
+        .def_property_readonly(
+            "received_message_count",
+            &TopicStatistics::receivedMessageCount,
+            "Returns the number of received messages.\n"
+            "\n"
+            ":return: The number of received messages")
+        .def_property_readonly(
+            "received_byte_count",
+            &TopicStatistics::receivedByteCount,
+            "Returns the number of received bytes.\n"
+            "\n"
+            ":return: The number of received bytes");
+}
@@ -1,15 +1,26 @@
+#include <OpenteraWebrtcNativeClientPython/Configurations/AudioSinkConfigurationPython.h>
 #include <OpenteraWebrtcNativeClientPython/Configurations/AudioSourceConfigurationPython.h>
 #include <OpenteraWebrtcNativeClientPython/Configurations/DataChannelConfigurationPython.h>
+#include <OpenteraWebrtcNativeClientPython/Configurations/OpusEncoderConfigurationPython.h>
 #include <OpenteraWebrtcNativeClientPython/Configurations/SignalingServerConfigurationPython.h>
 #include <OpenteraWebrtcNativeClientPython/Configurations/VideoSourceConfigurationPython.h>
 #include <OpenteraWebrtcNativeClientPython/Configurations/WebrtcConfigurationPython.h>
 
+#include <OpenteraWebrtcNativeClientPython/Utils/AudioClockPython.h>
+#include <OpenteraWebrtcNativeClientPython/Utils/AudioLevelPython.h>
 #include <OpenteraWebrtcNativeClientPython/Utils/ClientPython.h>
+#include <OpenteraWebrtcNativeClientPython/Utils/DataChannelMessageBatchPython.h>
+#include <OpenteraWebrtcNativeClientPython/Utils/DataChannelMessagePython.h>
 #include <OpenteraWebrtcNativeClientPython/Utils/IceServerPython.h>
+#include <OpenteraWebrtcNativeClientPython/Utils/TopicStatisticsPython.h>
 
 #include <OpenteraWebrtcNativeClientPython/Sources/AudioSourcePython.h>
+#include <OpenteraWebrtcNativeClientPython/Sources/EncodedAudioSourcePython.h>
+#include <OpenteraWebrtcNativeClientPython/Sources/PacedAudioFeederPython.h>
 #include <OpenteraWebrtcNativeClientPython/Sources/VideoSourcePython.h>
 
+#include <OpenteraWebrtcNativeClientPython/Sinks/AudioRecorderPython.h>
+
 #include <OpenteraWebrtcNativeClientPython/DataChannelClientPython.h>
 #include <OpenteraWebrtcNativeClientPython/SignalingClientPython.h>
 #include <OpenteraWebrtcNativeClientPython/StreamClientPython.h>
@@ -19,18 +30,29 @@ namespace py = pybind11;
 
 PYBIND11_MODULE(_opentera_webrtc_native_client, m)
 {
+    initAudioSinkConfigurationPython(m);
     initAudioSourceConfigurationPython(m);
     initDataChannelConfigurationPython(m);
+    initOpusEncoderConfigurationPython(m);
     initSignalingServerConfigurationPython(m);
     initVideoSourceConfigurationPython(m);
     initWebrtcConfigurationPython(m);
 
+    initAudioClockPython(m);
+    initAudioLevelPython(m);
     initClientPython(m);
+    initDataChannelMessageBatchPython(m);
+    initDataChannelMessagePython(m);
     initIceServerPython(m);
+    initTopicStatisticsPython(m);
 
     initAudioSourcePython(m);
+    initEncodedAudioSourcePython(m);
+    initPacedAudioFeederPython(m);
     initVideoSourcePython(m);
 
+    initAudioRecorderPython(m);
+
     initSignalingClientPython(m);
     initDataChannelClientPython(m);
     initStreamClientPython(m);
@@ -0,0 +1,32 @@
+import unittest
+
+import opentera_webrtc.native_client as webrtc
+
+
+class AudioSinkConfigurationTestCase(unittest.TestCase):
+    def test_create__should_set_none(self):
+        testee = webrtc.AudioSinkConfiguration.create()
+
+        self.assertEqual(testee.bits_per_sample, None)
+        self.assertEqual(testee.sample_rate, None)
+        self.assertEqual(testee.number_of_channels, None)
+        self.assertEqual(testee.number_of_frames_per_chunk, None)
+        self.assertEqual(testee.is_conversion_enabled, False)
+
+    def test_create__all_values__should_set_the_attributes(self):
+        testee = webrtc.AudioSinkConfiguration.create(32, 16000, 1, 320)
+
+        self.assertEqual(testee.bits_per_sample, 32)
+        self.assertEqual(testee.sample_rate, 16000)
+        self.assertEqual(testee.number_of_channels, 1)
+        self.assertEqual(testee.number_of_frames_per_chunk, 320)
+        self.assertEqual(testee.is_conversion_enabled, True)
+
+    def test_create__sample_rate__should_enable_the_conversion(self):
+        testee = webrtc.AudioSinkConfiguration.create(None, 16000, None, None)
+
+        self.assertEqual(testee.bits_per_sample, None)
+        self.assertEqual(testee.sample_rate, 16000)
+        self.assertEqual(testee.number_of_channels, None)
+        self.assertEqual(testee.number_of_frames_per_chunk, None)
+        self.assertEqual(testee.is_conversion_enabled, True)
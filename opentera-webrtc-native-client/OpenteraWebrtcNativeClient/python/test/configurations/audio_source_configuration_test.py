@@ -14,6 +14,7 @@ class AudioSourceConfigurationTestCase(unittest.TestCase):
         self.assertEqual(testee.highpass_filter, None)
         self.assertEqual(testee.stereo_swapping, None)
         self.assertEqual(testee.transient_suppression, None)
+        self.assertEqual(testee.is_pass_through, False)
 
     def test_create__echo_cancellation_auto_gain_control__should_set_the_attributes(self):
         testee = webrtc.AudioSourceConfiguration.create(10, True, False, None, None, None, None)
@@ -58,3 +59,15 @@ class AudioSourceConfigurationTestCase(unittest.TestCase):
         self.assertEqual(testee.highpass_filter, None)
         self.assertEqual(testee.stereo_swapping, None)
         self.assertEqual(testee.transient_suppression, False)
+
+    def test_create_pass_through__should_disable_the_audio_processing(self):
+        testee = webrtc.AudioSourceConfiguration.create_pass_through()
+
+        self.assertEqual(testee.sound_card_total_delay_ms, 0)
+        self.assertEqual(testee.echo_cancellation, False)
+        self.assertEqual(testee.auto_gain_control, False)
+        self.assertEqual(testee.noise_suppression, False)
+        self.assertEqual(testee.highpass_filter, False)
+        self.assertEqual(testee.stereo_swapping, False)
+        self.assertEqual(testee.transient_suppression, False)
+        self.assertEqual(testee.is_pass_through, True)
@@ -99,3 +99,58 @@ class DataChannelConfigurationTestCase(unittest.TestCase):
         self.assertEqual(testee.max_packet_life_time, None)
         self.assertEqual(testee.max_retransmits, 10)
         self.assertEqual(testee.protocol, 'a')
+
+    def test_with_priority__should_only_set_the_priority(self):
+        configuration = webrtc.DataChannelConfiguration.create_max_retransmits(False, 10, 'a')
+        testee = configuration.with_priority(webrtc.DataChannelPriority.LOW)
+
+        self.assertEqual(configuration.priority, None)
+        self.assertEqual(testee.ordered, False)
+        self.assertEqual(testee.max_packet_life_time, None)
+        self.assertEqual(testee.max_retransmits, 10)
+        self.assertEqual(testee.protocol, 'a')
+        self.assertEqual(testee.priority, webrtc.DataChannelPriority.LOW)
+
+    def test_is_reliable__should_return_false_if_a_retransmission_limit_is_set(self):
+        self.assertEqual(webrtc.DataChannelConfiguration.create().is_reliable, True)
+        self.assertEqual(webrtc.DataChannelConfiguration.create(False).is_reliable, True)
+        self.assertEqual(webrtc.DataChannelConfiguration.create_max_packet_life_time(10).is_reliable, False)
+        self.assertEqual(webrtc.DataChannelConfiguration.create_max_retransmits(0).is_reliable, False)
+
+    def test_is_compressed__should_return_true_only_for_the_compressed_protocol(self):
+        self.assertEqual(webrtc.DataChannelConfiguration.create().is_compressed, False)
+        self.assertEqual(webrtc.DataChannelConfiguration.create_protocol('a').is_compressed, False)
+
+        testee = webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.COMPRESSED_PROTOCOL)
+        self.assertEqual(testee.is_compressed, True)
+
+    def test_is_coalesced__should_return_true_only_for_the_coalesced_protocol(self):
+        self.assertEqual(webrtc.DataChannelConfiguration.create().is_coalesced, False)
+
+        testee = webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.COALESCED_PROTOCOL)
+        self.assertEqual(testee.is_coalesced, True)
+
+    def test_is_pub_sub__should_return_true_only_for_the_pub_sub_protocol(self):
+        self.assertEqual(webrtc.DataChannelConfiguration.create().is_pub_sub, False)
+
+        testee = webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.PUB_SUB_PROTOCOL)
+        self.assertEqual(testee.is_pub_sub, True)
+
+    def test_is_clock_sync__should_return_true_only_for_the_clock_sync_protocol(self):
+        self.assertEqual(webrtc.DataChannelConfiguration.create().is_clock_sync, False)
+
+        testee = webrtc.DataChannelConfiguration.create_max_retransmits(
+            False, 0, webrtc.DataChannelConfiguration.CLOCK_SYNC_PROTOCOL)
+        self.assertEqual(testee.is_clock_sync, True)
+
+    def test_is_file_transfer__should_return_true_only_for_the_file_transfer_protocol(self):
+        self.assertEqual(webrtc.DataChannelConfiguration.create().is_file_transfer, False)
+
+        testee = webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.FILE_TRANSFER_PROTOCOL)
+        self.assertEqual(testee.is_file_transfer, True)
+
+    def test_is_rpc__should_return_true_only_for_the_rpc_protocol(self):
+        self.assertEqual(webrtc.DataChannelConfiguration.create().is_rpc, False)
+
+        testee = webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.RPC_PROTOCOL)
+        self.assertEqual(testee.is_rpc, True)
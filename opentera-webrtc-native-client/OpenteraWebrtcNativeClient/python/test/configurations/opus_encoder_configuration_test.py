@@ -0,0 +1,32 @@
+import unittest
+
+import opentera_webrtc.native_client as webrtc
+
+
+class OpusEncoderConfigurationTestCase(unittest.TestCase):
+    def test_create__should_set_none(self):
+        testee = webrtc.OpusEncoderConfiguration.create()
+
+        self.assertEqual(testee.bitrate_bps, None)
+        self.assertEqual(testee.complexity, None)
+        self.assertEqual(testee.frame_size_ms, None)
+        self.assertEqual(testee.dtx, None)
+        self.assertEqual(testee.inband_fec, None)
+
+    def test_create__all__should_set_the_attributes(self):
+        testee = webrtc.OpusEncoderConfiguration.create(24000, 3, 40, True, False)
+
+        self.assertEqual(testee.bitrate_bps, 24000)
+        self.assertEqual(testee.complexity, 3)
+        self.assertEqual(testee.frame_size_ms, 40)
+        self.assertEqual(testee.dtx, True)
+        self.assertEqual(testee.inband_fec, False)
+
+    def test_create__bitrate_only__should_set_the_bitrate(self):
+        testee = webrtc.OpusEncoderConfiguration.create(16000, None, None, None, None)
+
+        self.assertEqual(testee.bitrate_bps, 16000)
+        self.assertEqual(testee.complexity, None)
+        self.assertEqual(testee.frame_size_ms, None)
+        self.assertEqual(testee.dtx, None)
+        self.assertEqual(testee.inband_fec, None)
@@ -1,3 +1,5 @@
+import os
+import tempfile
 import time
 
 import opentera_webrtc.native_client as webrtc
@@ -7,6 +9,15 @@ from failure_test_case import FailureTestCase
 from signaling_server_runner import SignalingServerRunner
 
 DEFAULT_WEBRTC_CONFIGURATION = webrtc.WebrtcConfiguration.create([webrtc.IceServer('stun:stun.l.google.com:19302')])
+NAMED_DATA_CHANNEL_CONFIGURATIONS = {
+    'telemetry': webrtc.DataChannelConfiguration.create(False),
+    'compressed': webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.COMPRESSED_PROTOCOL),
+    'coalesced': webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.COALESCED_PROTOCOL),
+    'pubsub': webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.PUB_SUB_PROTOCOL),
+    'clock': webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.CLOCK_SYNC_PROTOCOL),
+    'file': webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.FILE_TRANSFER_PROTOCOL),
+    'rpc': webrtc.DataChannelConfiguration.create_protocol(webrtc.DataChannelConfiguration.RPC_PROTOCOL)
+}
 
 
 class DisconnectedDataChannelClientTestCase(FailureTestCase):
@@ -36,6 +47,67 @@ class DisconnectedDataChannelClientTestCase(FailureTestCase):
     def test_room_clients__should_return_an_empty_list(self):
         self.assertEqual(self._client1.room_clients, [])
 
+    def test_is_message_fragmentation_enabled__should_return_false(self):
+        self.assertEqual(self._client1.is_message_fragmentation_enabled, False)
+
+    def test_compression__should_have_default_values(self):
+        self.assertEqual(self._client1.compression_threshold, 256)
+        self.assertEqual(self._client1.compression_ratio, 1.0)
+
+    def test_message_dispatch_worker_count__should_set_the_number_of_queues(self):
+        self.assertEqual(self._client1.message_dispatch_worker_count, 0)
+        self.assertEqual(self._client1.message_dispatch_queue_depths, [])
+
+        self._client1.message_dispatch_worker_count = 3
+        self.assertEqual(self._client1.message_dispatch_worker_count, 3)
+        self.assertEqual(self._client1.message_dispatch_queue_depths, [0, 0, 0])
+
+        self._client1.message_dispatch_worker_count = 0
+        self.assertEqual(self._client1.message_dispatch_worker_count, 0)
+
+    def test_max_frame_size_and_frame_send_buffer_size__should_validate_the_sizes(self):
+        self.assertEqual(self._client1.max_frame_size, 16384)
+        self.assertEqual(self._client1.frame_send_buffer_size, 262144)
+
+        self._client1.max_frame_size = 65536
+        self._client1.frame_send_buffer_size = 1048576
+        self.assertEqual(self._client1.max_frame_size, 65536)
+        self.assertEqual(self._client1.frame_send_buffer_size, 1048576)
+
+        with self.assertRaises(RuntimeError):
+            self._client1.max_frame_size = 1023
+        with self.assertRaises(RuntimeError):
+            self._client1.frame_send_buffer_size = 0
+
+    def test_buffered_amount__should_return_0(self):
+        self.assertEqual(self._client1.buffered_amount('id'), 0)
+
+    def test_set_send_queue_watermarks__invalid__should_raise_runtime_error(self):
+        with self.assertRaises(RuntimeError):
+            self._client1.set_send_queue_watermarks(10, 5)
+
+    def test_constructor__invalid_data_channel_name__should_raise_runtime_error(self):
+        signaling_server_configuration = \
+            webrtc.SignalingServerConfiguration.create('http://localhost:8080', 'c2', 'cd2', 'chat', '')
+        with self.assertRaises(RuntimeError):
+            webrtc.DataChannelClient(signaling_server_configuration, DEFAULT_WEBRTC_CONFIGURATION,
+                                     webrtc.DataChannelConfiguration.create(),
+                                     {'chat': webrtc.DataChannelConfiguration.create()})
+
+    def test_publish__no_pub_sub_data_channel__should_raise_runtime_error(self):
+        with self.assertRaises(RuntimeError):
+            self._client1.subscribe(1)
+        with self.assertRaises(RuntimeError):
+            self._client1.publish(1, 'abc')
+
+    def test_send_file__no_file_transfer_data_channel__should_raise_runtime_error(self):
+        with self.assertRaises(RuntimeError):
+            self._client1.send_file('id', os.path.join(tempfile.gettempdir(), 'file.bin'), 'file.bin')
+
+    def test_call__no_rpc_data_channel__should_raise_runtime_error(self):
+        with self.assertRaises(RuntimeError):
+            self._client1.call('id', 'method', 'abc')
+
 
 class WrongPasswordDataChannelClientTestCase(FailureTestCase):
     @classmethod
@@ -154,17 +226,20 @@ class RightPasswordDataChannelClientTestCase(FailureTestCase):
         self._client1 = webrtc.DataChannelClient(
             webrtc.SignalingServerConfiguration.create('http://localhost:8080', 'c1', 'cd1', 'chat', 'abc'),
             DEFAULT_WEBRTC_CONFIGURATION,
-            webrtc.DataChannelConfiguration.create())
+            webrtc.DataChannelConfiguration.create(),
+            NAMED_DATA_CHANNEL_CONFIGURATIONS)
 
         self._client2 = webrtc.DataChannelClient(
             webrtc.SignalingServerConfiguration.create('http://localhost:8080', 'c2', 'cd2', 'chat', 'abc'),
             DEFAULT_WEBRTC_CONFIGURATION,
-            webrtc.DataChannelConfiguration.create())
+            webrtc.DataChannelConfiguration.create(),
+            NAMED_DATA_CHANNEL_CONFIGURATIONS)
 
         self._client3 = webrtc.DataChannelClient(
             webrtc.SignalingServerConfiguration.create('http://localhost:8080', 'c3', 'cd3', 'chat', 'abc'),
             DEFAULT_WEBRTC_CONFIGURATION,
-            webrtc.DataChannelConfiguration.create())
+            webrtc.DataChannelConfiguration.create(),
+            NAMED_DATA_CHANNEL_CONFIGURATIONS)
 
         self._client1.on_signaling_connection_opened = on_signaling_connection_opened
         self._client2.on_signaling_connection_opened = on_signaling_connection_opened
@@ -626,3 +701,365 @@ class RightPasswordDataChannelClientTestCase(FailureTestCase):
         self._client1.call_all()
         on_data_channel_opened_awaiter.wait()
         on_data_channel_message_awaiter.wait()
+
+    def test_send_batch__should_send_the_messages_to_their_recipients(self):
+        on_data_channel_opened_awaiter = CallbackAwaiter(6, 60)
+        on_data_channel_message_awaiter = CallbackAwaiter(3, 60)
+
+        def on_data_channel_opened(client):
+            if on_data_channel_opened_awaiter.done():
+                batch = webrtc.DataChannelMessageBatch()
+                batch.add_to('a', [self._clientId2])
+                batch.add_to_all(b'b')
+                self._client1.send_batch(batch)
+
+        def on_data_channel_message_string2(client, data):
+            self.add_failure_assert_equal(client.id, self._clientId1)
+            self.add_failure_assert_equal(data, 'a')
+            on_data_channel_message_awaiter.done()
+
+        def on_data_channel_message_binary(client, data):
+            self.add_failure_assert_equal(client.id, self._clientId1)
+            self.add_failure_assert_equal(data, b'b')
+            on_data_channel_message_awaiter.done()
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client2.on_data_channel_opened = on_data_channel_opened
+        self._client3.on_data_channel_opened = on_data_channel_opened
+
+        self._client2.on_data_channel_message_string = on_data_channel_message_string2
+        self._client2.on_data_channel_message_binary = on_data_channel_message_binary
+        self._client3.on_data_channel_message_binary = on_data_channel_message_binary
+
+        self._client1.call_all()
+        on_data_channel_opened_awaiter.wait()
+        on_data_channel_message_awaiter.wait()
+
+    def test_send_to__full_send_queue__should_return_false_and_call_on_data_channel_buffered_amount_low(self):
+        on_data_channel_buffered_amount_low_awaiter = CallbackAwaiter(1, 60)
+        on_data_channel_message_awaiter = CallbackAwaiter(1, 60)
+
+        def on_data_channel_opened(client):
+            if client.id == self._clientId2:
+                self.add_failure_assert_true(self._client1.send_to('a', [self._clientId2]))
+                self.add_failure_assert_false(self._client1.send_to('b', [self._clientId2]))
+
+        def on_data_channel_buffered_amount_low(client):
+            self.add_failure_assert_equal(client.id, self._clientId2)
+            on_data_channel_buffered_amount_low_awaiter.done()
+
+        def on_data_channel_message_string(client, data):
+            self.add_failure_assert_equal(data, 'a')
+            on_data_channel_message_awaiter.done()
+
+        self._client1.set_send_queue_watermarks(0, 1)
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client1.on_data_channel_buffered_amount_low = on_data_channel_buffered_amount_low
+        self._client2.on_data_channel_message_string = on_data_channel_message_string
+
+        self._client1.call_all()
+        on_data_channel_buffered_amount_low_awaiter.wait()
+        on_data_channel_message_awaiter.wait()
+
+    def test_send_to__fragmentation__should_reassemble_large_messages(self):
+        on_data_channel_message_awaiter = CallbackAwaiter(1, 60)
+        large_message = bytes(i % 256 for i in range(100 * 1024))
+
+        def on_data_channel_opened(client):
+            if client.id == self._clientId2:
+                self._client1.send_to(large_message, [self._clientId2])
+
+        def on_data_channel_message_binary(client, data):
+            self.add_failure_assert_equal(data, large_message)
+            on_data_channel_message_awaiter.done()
+
+        self._client1.is_message_fragmentation_enabled = True
+        self._client2.is_message_fragmentation_enabled = True
+        self._client3.is_message_fragmentation_enabled = True
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client2.on_data_channel_message_binary = on_data_channel_message_binary
+
+        self._client1.call_all()
+        on_data_channel_message_awaiter.wait()
+
+    def test_send_to__named_data_channel__should_send_the_messages_on_the_specified_channel(self):
+        on_data_channel_opened_awaiter = CallbackAwaiter(1, 15)
+        on_data_channel_message_awaiter = CallbackAwaiter(2, 15)
+
+        def on_data_channel_opened(client):
+            if client.id == self._clientId2:
+                on_data_channel_opened_awaiter.done()
+
+        def on_default_data_channel_message(client, data):
+            self.add_failure('on_default_data_channel_message')
+
+        def on_telemetry_message_string(client, data):
+            self.add_failure_assert_equal(client.id, self._clientId1)
+            self.add_failure_assert_equal(data, 'position')
+            on_data_channel_message_awaiter.done()
+
+        def on_telemetry_message_binary(client, data):
+            self.add_failure_assert_equal(client.id, self._clientId1)
+            self.add_failure_assert_equal(data, b'\x0a\x14')
+            on_data_channel_message_awaiter.done()
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client2.on_data_channel_message_string = on_default_data_channel_message
+        self._client2.on_data_channel_message_binary = on_default_data_channel_message
+        self._client2.set_on_data_channel_message_string('telemetry', on_telemetry_message_string)
+        self._client2.set_on_data_channel_message_binary('telemetry', on_telemetry_message_binary)
+
+        self._client1.call_all()
+        on_data_channel_opened_awaiter.wait()
+        # The named data channels are opened after the default one.
+        time.sleep(0.5)
+
+        self.assertTrue(self._client1.send_to('telemetry', 'position', [self._clientId2]))
+        self.assertTrue(self._client1.send_to('telemetry', b'\x0a\x14', [self._clientId2]))
+        on_data_channel_message_awaiter.wait()
+
+    def test_send_to__on_data_channel_message__should_pass_the_messages_without_copy(self):
+        on_data_channel_message_awaiter = CallbackAwaiter(2, 15)
+        messages = []
+
+        def on_data_channel_opened(client):
+            if client.id == self._clientId2:
+                self._client1.send_to('abc', [self._clientId2])
+                self._client1.send_to(b'\x01\x02\x03', [self._clientId2])
+
+        def on_data_channel_message(client, message):
+            self.add_failure_assert_equal(client.id, self._clientId1)
+            messages.append(message)
+            on_data_channel_message_awaiter.done()
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client2.on_data_channel_message = on_data_channel_message
+
+        self._client1.call_all()
+        on_data_channel_message_awaiter.wait()
+
+        self.assertEqual(len(messages), 2)
+        self.assertFalse(messages[0].is_binary)
+        self.assertEqual(messages[0].to_string(), 'abc')
+        self.assertTrue(messages[1].is_binary)
+        self.assertEqual(bytes(memoryview(messages[1])), b'\x01\x02\x03')
+
+    def test_send_to__compressed_data_channel__should_send_the_messages_compressed(self):
+        on_data_channel_opened_awaiter = CallbackAwaiter(1, 15)
+        on_data_channel_message_awaiter = CallbackAwaiter(1, 15)
+        json = '{"x": 1.0, "y": 2.0, "status": "ok"},' * 100
+
+        def on_data_channel_opened(client):
+            if client.id == self._clientId2:
+                on_data_channel_opened_awaiter.done()
+
+        def on_compressed_message_string(client, data):
+            self.add_failure_assert_equal(client.id, self._clientId1)
+            self.add_failure_assert_equal(data, json)
+            on_data_channel_message_awaiter.done()
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client2.set_on_data_channel_message_string('compressed', on_compressed_message_string)
+
+        self._client1.call_all()
+        on_data_channel_opened_awaiter.wait()
+        # The named data channels are opened after the default one.
+        time.sleep(0.5)
+
+        self.assertTrue(self._client1.send_to('compressed', json, [self._clientId2]))
+        on_data_channel_message_awaiter.wait()
+
+        self.assertGreater(self._client1.compression_ratio, 5.0)
+
+    def test_send_to__coalesced_data_channel__should_keep_the_message_boundaries_and_order(self):
+        message_count = 1000
+        on_data_channel_opened_awaiter = CallbackAwaiter(1, 15)
+        on_data_channel_message_awaiter = CallbackAwaiter(message_count, 15)
+        expected_messages = [str(i) if i % 7 != 0 else '' for i in range(message_count)]
+        received_messages = []
+
+        def on_data_channel_opened(client):
+            if client.id == self._clientId2:
+                on_data_channel_opened_awaiter.done()
+
+        def on_coalesced_message_string(client, data):
+            received_messages.append(data)
+            on_data_channel_message_awaiter.done()
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client2.set_on_data_channel_message_string('coalesced', on_coalesced_message_string)
+
+        self._client1.call_all()
+        on_data_channel_opened_awaiter.wait()
+        # The named data channels are opened after the default one.
+        time.sleep(0.5)
+
+        for message in expected_messages:
+            self.assertTrue(self._client1.send_to('coalesced', message, [self._clientId2]))
+        on_data_channel_message_awaiter.wait()
+
+        self.assertEqual(received_messages, expected_messages)
+
+    def test_send_latest_to__should_send_the_latest_values(self):
+        on_data_channel_opened_awaiter = CallbackAwaiter(1, 15)
+        on_data_channel_message_awaiter = CallbackAwaiter(1, 15)
+        message_count = 1000
+        values = []
+
+        def on_data_channel_opened(client):
+            if client.id == self._clientId2:
+                on_data_channel_opened_awaiter.done()
+
+        def on_data_channel_message_binary(client, data):
+            self.add_failure_assert_equal(client.id, self._clientId1)
+            values.append(int.from_bytes(data[:4], 'little'))
+            if values[-1] == message_count - 1:
+                on_data_channel_message_awaiter.done()
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client2.on_data_channel_message_binary = on_data_channel_message_binary
+
+        self._client1.call_all()
+        on_data_channel_opened_awaiter.wait()
+
+        for i in range(message_count):
+            data = i.to_bytes(4, 'little') + bytes(4092)
+            self._client1.send_latest_to('pose', data, [self._clientId2])
+        on_data_channel_message_awaiter.wait()
+
+        self.assertEqual(values[-1], message_count - 1)
+        self.assertEqual(values, sorted(values))
+        self.assertLessEqual(len(values), message_count)
+
+    def test_publish__should_send_the_messages_only_to_the_subscribers(self):
+        on_data_channel_opened_awaiter = CallbackAwaiter(2, 15)
+        on_topic_message_awaiter = CallbackAwaiter(1, 15)
+        topic = 1000
+
+        def on_data_channel_opened(client):
+            on_data_channel_opened_awaiter.done()
+
+        def on_topic_message2(client, message_topic, message):
+            self.add_failure_assert_equal(client.id, self._clientId1)
+            self.add_failure_assert_equal(message_topic, topic)
+            self.add_failure_assert_equal(message.to_string(), 'abc')
+            on_topic_message_awaiter.done()
+
+        def on_topic_message3(client, message_topic, message):
+            self.add_failure('on_topic_message3 must not be called')
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client2.on_topic_message = on_topic_message2
+        self._client3.on_topic_message = on_topic_message3
+
+        self._client2.subscribe(topic)
+        self._client1.call_all()
+        on_data_channel_opened_awaiter.wait()
+        # The named data channels are opened after the default one, then the subscriptions are announced.
+        time.sleep(0.5)
+
+        self.assertTrue(self._client1.publish(topic, 'abc'))
+        on_topic_message_awaiter.wait()
+
+        self.assertEqual(self._client1.topic_statistics(topic).sent_message_count, 1)
+        self.assertEqual(self._client1.topic_statistics(topic).sent_byte_count, 3)
+        self.assertEqual(self._client2.topic_statistics(topic).received_message_count, 1)
+        self.assertEqual(self._client3.topic_statistics(topic).received_message_count, 0)
+
+    def test_peer_clock_offset__should_estimate_the_clock_offset(self):
+        on_data_channel_opened_awaiter = CallbackAwaiter(2, 15)
+
+        def on_data_channel_opened(client):
+            on_data_channel_opened_awaiter.done()
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+
+        self._client1.call_all()
+        on_data_channel_opened_awaiter.wait()
+        # The named data channels are opened after the default one, then several exchanges are made.
+        time.sleep(3)
+
+        # The clients are in the same process, so they share the same clock.
+        offset = self._client1.peer_clock_offset(self._clientId2)
+        self.assertIsNotNone(offset)
+        self.assertLess(abs(offset), 10000)
+        self.assertGreaterEqual(self._client1.peer_round_trip_time(self._clientId2), 0)
+
+        local_time = webrtc.DataChannelClient.local_time()
+        self.assertEqual(self._client1.to_peer_time(self._clientId2, local_time), local_time + offset)
+        self.assertEqual(self._client1.from_peer_time(self._clientId2, local_time), local_time - offset)
+        self.assertIsNone(self._client1.peer_clock_offset('unknown'))
+
+    def test_send_file__should_write_the_file_to_the_destination(self):
+        on_data_channel_opened_awaiter = CallbackAwaiter(2, 15)
+        on_file_transfer_completed_awaiter = CallbackAwaiter(2, 30)
+        content = bytes(i % 251 for i in range(1024 * 1024 + 17))
+
+        with tempfile.TemporaryDirectory() as directory:
+            source_path = os.path.join(directory, 'source.bin')
+            destination_path = os.path.join(directory, 'destination.bin')
+            with open(source_path, 'wb') as file:
+                file.write(content)
+
+            def on_data_channel_opened(client):
+                on_data_channel_opened_awaiter.done()
+
+            def on_file_transfer_requested(client, name, size):
+                self.add_failure_assert_equal(client.id, self._clientId1)
+                self.add_failure_assert_equal(name, 'log.bin')
+                self.add_failure_assert_equal(size, len(content))
+                return destination_path
+
+            def on_file_transfer_progress(client, name, is_incoming, transferred_size, size):
+                if transferred_size == size:
+                    on_file_transfer_completed_awaiter.done()
+
+            self._client1.on_data_channel_opened = on_data_channel_opened
+            self._client1.on_file_transfer_progress = on_file_transfer_progress
+            self._client2.on_file_transfer_requested = on_file_transfer_requested
+            self._client2.on_file_transfer_progress = on_file_transfer_progress
+
+            self._client1.call_all()
+            on_data_channel_opened_awaiter.wait()
+            self._client1.send_file(self._clientId2, source_path, 'log.bin')
+            on_file_transfer_completed_awaiter.wait()
+
+            with open(destination_path, 'rb') as file:
+                self.assertEqual(file.read(), content)
+
+    def test_call__should_return_the_responses_of_the_handlers(self):
+        on_data_channel_opened_awaiter = CallbackAwaiter(2, 15)
+
+        def on_data_channel_opened(client):
+            on_data_channel_opened_awaiter.done()
+
+        def echo(client, request):
+            return request.to_bytes() if request.is_binary else request.to_string()
+
+        def fail(client, request):
+            raise ValueError('handler error')
+
+        self._client1.on_data_channel_opened = on_data_channel_opened
+        self._client2.rpc_worker_count = 2
+        self._client2.set_rpc_handler('echo', echo)
+        self._client2.set_rpc_handler('fail', fail)
+
+        self._client1.call_all()
+        on_data_channel_opened_awaiter.wait()
+        # The named data channels are opened after the default one.
+        time.sleep(0.5)
+
+        responses = [self._client1.call(self._clientId2, 'echo', str(i)) for i in range(10)]
+        binary_response = self._client1.call(self._clientId2, 'echo', b'\x01\x02\x03')
+        failed_response = self._client1.call(self._clientId2, 'fail', 'abc')
+
+        for i, response in enumerate(responses):
+            self.assertEqual(response.result(timeout=15).to_string(), str(i))
+        self.assertEqual(binary_response.result(timeout=15).to_bytes(), b'\x01\x02\x03')
+        with self.assertRaises(RuntimeError):
+            failed_response.result(timeout=15)
+
+        self._client2.set_rpc_handler('echo', None)
+        self._client2.set_rpc_handler('fail', None)
+        self._client2.rpc_worker_count = 0
@@ -0,0 +1,49 @@
+import os
+import tempfile
+import unittest
+
+import numpy as np
+
+import opentera_webrtc.native_client as webrtc
+
+
+class AudioRecorderTestCase(unittest.TestCase):
+    def test_write__wav__should_write_a_valid_file(self):
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, 'recording.wav')
+            testee = webrtc.AudioRecorder(path, webrtc.AudioRecordingFormat.WAV)
+
+            testee.write(np.array([1, 2, 3, 4], dtype=np.int16), 16000, 2)
+            testee.close()
+
+            with open(path, 'rb') as file:
+                data = file.read()
+
+            self.assertEqual(len(data), 44 + 8)
+            self.assertEqual(data[:4], b'RIFF')
+            self.assertEqual(data[8:12], b'WAVE')
+            self.assertEqual(testee.dropped_frame_count, 0)
+
+    def test_write__invalid_frame__should_raise_value_error(self):
+        with tempfile.TemporaryDirectory() as directory:
+            testee = webrtc.AudioRecorder(os.path.join(directory, 'recording.opus'),
+                                          webrtc.AudioRecordingFormat.OGG_OPUS)
+
+            with self.assertRaises(ValueError):
+                testee.write(np.array([1, 2, 3], dtype=np.int16), 48000, 2)
+            testee.close()
+
+    def test_write_encoded__ogg_opus__should_write_the_packets(self):
+        with tempfile.TemporaryDirectory() as directory:
+            path = os.path.join(directory, 'recording.opus')
+            testee = webrtc.AudioRecorder(path, webrtc.AudioRecordingFormat.OGG_OPUS)
+
+            packet = bytes([0xf8, 0x12, 0x34, 0x56])
+            testee.write_encoded(packet, 1)
+            testee.close()
+
+            with open(path, 'rb') as file:
+                data = file.read()
+
+            self.assertTrue(data.endswith(packet))
+            self.assertEqual(testee.dropped_frame_count, 0)
@@ -13,6 +13,15 @@ class AudioSourceTestCase(unittest.TestCase):
         with self.assertRaises(RuntimeError):
             webrtc.AudioSource(webrtc.AudioSourceConfiguration.create(10), 7, 48000, 1)
 
+    def test_constructor__selected_channels__should_validate_the_channels(self):
+        testee = webrtc.AudioSource(webrtc.AudioSourceConfiguration.create(10), 16, 48000, 8, [0, 7])
+        self.assertEqual(testee.selected_channels, [0, 7])
+
+        testee.send_frame(np.zeros(8 * 480, dtype=np.int16))
+
+        with self.assertRaises(RuntimeError):
+            webrtc.AudioSource(webrtc.AudioSourceConfiguration.create(10), 16, 48000, 8, [8])
+
     def test_send_frame__should_only_support_valid_frame(self):
         testee = webrtc.AudioSource(webrtc.AudioSourceConfiguration.create(10), 8, 48000, 2)
 
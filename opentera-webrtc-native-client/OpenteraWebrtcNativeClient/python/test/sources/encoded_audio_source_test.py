@@ -0,0 +1,19 @@
+import unittest
+
+import opentera_webrtc.native_client as webrtc
+
+
+class EncodedAudioSourceTestCase(unittest.TestCase):
+    def test_constructor__should_only_support_mono_and_stereo(self):
+        webrtc.EncodedAudioSource()
+        webrtc.EncodedAudioSource(2)
+
+        with self.assertRaises(RuntimeError):
+            webrtc.EncodedAudioSource(3)
+
+    def test_send_encoded_frame__should_validate_the_packet_duration(self):
+        testee = webrtc.EncodedAudioSource()
+
+        self.assertTrue(testee.send_encoded_frame(bytes([31 << 3, 1, 2, 3])))
+        self.assertFalse(testee.send_encoded_frame(bytes([17 << 3, 1, 2, 3])))
+        self.assertFalse(testee.send_encoded_frame(bytes()))
@@ -0,0 +1,39 @@
+import unittest
+
+import numpy as np
+import opentera_webrtc.native_client as webrtc
+
+
+class PacedAudioFeederTestCase(unittest.TestCase):
+    def test_enqueue__should_queue_the_frames(self):
+        audio_source = webrtc.AudioSource(webrtc.AudioSourceConfiguration.create_pass_through(), 16, 48000, 2)
+        testee = webrtc.PacedAudioFeeder(audio_source)
+
+        testee.enqueue(np.zeros(2 * 1000, dtype=np.int16))
+
+        self.assertFalse(testee.is_started)
+        self.assertEqual(testee.queued_number_of_frames, 1000)
+        self.assertEqual(testee.underrun_count, 0)
+
+        testee.clear()
+        self.assertEqual(testee.queued_number_of_frames, 0)
+
+    def test_enqueue__should_only_support_valid_frames(self):
+        audio_source = webrtc.AudioSource(webrtc.AudioSourceConfiguration.create_pass_through(), 16, 48000, 2)
+        testee = webrtc.PacedAudioFeeder(audio_source)
+
+        with self.assertRaises(ValueError) as cm:
+            testee.enqueue(np.zeros(10, dtype=np.int8))
+        self.assertEqual(str(cm.exception), 'Invalid frame data type.')
+
+        with self.assertRaises(ValueError) as cm:
+            testee.enqueue(np.zeros(11, dtype=np.int16))
+        self.assertEqual(str(cm.exception), 'The frames size must be a multiple of '
+                                            '(bytes_per_sample * number_of_channels).')
+
+    def test_enqueue_wav_file__missing_file__should_raise_runtime_error(self):
+        audio_source = webrtc.AudioSource(webrtc.AudioSourceConfiguration.create_pass_through(), 16, 48000, 1)
+        testee = webrtc.PacedAudioFeeder(audio_source)
+
+        with self.assertRaises(RuntimeError):
+            testee.enqueue_wav_file('missing_file.wav')
@@ -0,0 +1,20 @@
+import datetime
+import unittest
+
+import opentera_webrtc.native_client as webrtc
+
+
+class AudioClockTestCase(unittest.TestCase):
+    def test_constructor__default__should_be_free_running(self):
+        testee = webrtc.VirtualAudioClock()
+
+        self.assertEqual(testee.is_free_running, True)
+        self.assertEqual(testee.now(), datetime.timedelta(0))
+
+    def test_advance__should_advance_the_time(self):
+        testee = webrtc.VirtualAudioClock(is_free_running=False)
+
+        testee.advance(datetime.timedelta(milliseconds=10))
+
+        self.assertEqual(testee.is_free_running, False)
+        self.assertEqual(testee.now(), datetime.timedelta(milliseconds=10))
@@ -0,0 +1,17 @@
+import unittest
+
+import opentera_webrtc.native_client as webrtc
+
+
+class AudioLevelTestCase(unittest.TestCase):
+    def test_constructor__default__should_set_the_attributes(self):
+        testee = webrtc.AudioLevel()
+
+        self.assertEqual(testee.level_dbfs, -127)
+        self.assertEqual(testee.is_voice_active, False)
+
+    def test_constructor__values__should_set_the_attributes(self):
+        testee = webrtc.AudioLevel(-20, True)
+
+        self.assertEqual(testee.level_dbfs, -20)
+        self.assertEqual(testee.is_voice_active, True)
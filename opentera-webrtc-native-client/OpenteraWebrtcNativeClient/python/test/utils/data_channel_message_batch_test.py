@@ -0,0 +1,31 @@
+import unittest
+
+import opentera_webrtc.native_client as webrtc
+
+
+class DataChannelMessageBatchTestCase(unittest.TestCase):
+    def test_constructor__should_create_an_empty_batch(self):
+        testee = webrtc.DataChannelMessageBatch()
+
+        self.assertEqual(len(testee), 0)
+        self.assertTrue(testee.empty)
+
+    def test_add__should_append_the_messages(self):
+        testee = webrtc.DataChannelMessageBatch(4)
+
+        testee.add_to(b'\x01\x02', ['id1'])
+        testee.add_to('message', ['id1', 'id2'])
+        testee.add_to_all(b'\x03')
+        testee.add_to_all('message')
+
+        self.assertEqual(len(testee), 4)
+        self.assertFalse(testee.empty)
+
+    def test_clear__should_remove_all_messages(self):
+        testee = webrtc.DataChannelMessageBatch()
+        testee.add_to_all('message')
+
+        testee.clear()
+
+        self.assertEqual(len(testee), 0)
+        self.assertTrue(testee.empty)
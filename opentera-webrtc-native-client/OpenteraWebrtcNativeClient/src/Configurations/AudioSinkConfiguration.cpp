@@ -0,0 +1,16 @@
+#include <OpenteraWebrtcNativeClient/Configurations/AudioSinkConfiguration.h>
+
+using namespace opentera;
+using namespace std;
+
+AudioSinkConfiguration::AudioSinkConfiguration(
+    absl::optional<int> bitsPerSample,
+    absl::optional<int> sampleRate,
+    absl::optional<size_t> numberOfChannels,
+    absl::optional<size_t> numberOfFramesPerChunk)
+    : m_bitsPerSample(bitsPerSample),
+      m_sampleRate(sampleRate),
+      m_numberOfChannels(numberOfChannels),
+      m_numberOfFramesPerChunk(numberOfFramesPerChunk)
+{
+}
@@ -10,14 +10,16 @@ AudioSourceConfiguration::AudioSourceConfiguration(
     absl::optional<bool> noiseSuppression,
     absl::optional<bool> highpassFilter,
     absl::optional<bool> stereoSwapping,
-    absl::optional<bool> transientSuppression)
+    absl::optional<bool> transientSuppression,
+    bool isPassThrough)
     : m_soundCardTotalDelayMs(soundCardTotalDelayMs),
       m_echoCancellation(echoCancellation),
       m_autoGainControl(autoGainControl),
       m_noiseSuppression(noiseSuppression),
       m_highpassFilter(highpassFilter),
       m_stereoSwapping(stereoSwapping),
-      m_transientSuppression(transientSuppression)
+      m_transientSuppression(transientSuppression),
+      m_isPassThrough(isPassThrough)
 {
 }
 
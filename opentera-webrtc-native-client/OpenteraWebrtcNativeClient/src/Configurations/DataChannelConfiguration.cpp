@@ -11,7 +11,8 @@ DataChannelConfiguration::DataChannelConfiguration(
     : m_ordered(ordered),
       m_maxPacketLifeTime(maxPacketLifeTime),
       m_maxRetransmits(maxRetransmits),
-      m_protocol(move(protocol))
+      m_protocol(move(protocol)),
+      m_priority(absl::nullopt)
 {
 }
 
@@ -32,6 +33,24 @@ DataChannelConfiguration::operator webrtc::DataChannelInit() const
         configuration.maxRetransmits = m_maxRetransmits.value();
     }
     configuration.protocol = m_protocol;
+    if (m_priority)
+    {
+        switch (m_priority.value())
+        {
+            case DataChannelPriority::VeryLow:
+                configuration.priority = webrtc::Priority::kVeryLow;
+                break;
+            case DataChannelPriority::Low:
+                configuration.priority = webrtc::Priority::kLow;
+                break;
+            case DataChannelPriority::Medium:
+                configuration.priority = webrtc::Priority::kMedium;
+                break;
+            case DataChannelPriority::High:
+                configuration.priority = webrtc::Priority::kHigh;
+                break;
+        }
+    }
 
     return configuration;
 }
@@ -0,0 +1,64 @@
+#include <OpenteraWebrtcNativeClient/Configurations/OpusEncoderConfiguration.h>
+
+#include <algorithm>
+
+using namespace opentera;
+using namespace std;
+
+OpusEncoderConfiguration::OpusEncoderConfiguration(
+    absl::optional<int> bitrateBps,
+    absl::optional<int> complexity,
+    absl::optional<int> frameSizeMs,
+    absl::optional<bool> dtx,
+    absl::optional<bool> inbandFec)
+    : m_bitrateBps(bitrateBps),
+      m_complexity(complexity),
+      m_frameSizeMs(frameSizeMs),
+      m_dtx(dtx),
+      m_inbandFec(inbandFec)
+{
+}
+
+/**
+ * @brief Overrides the values of a negotiated Opus encoder configuration.
+ *
+ * The bitrate and the complexity are clamped to their valid ranges. An invalid
+ * packet time is ignored.
+ *
+ * @param config The negotiated configuration
+ * @return The configuration with the values of this object
+ */
+webrtc::AudioEncoderOpusConfig OpusEncoderConfiguration::apply(webrtc::AudioEncoderOpusConfig config) const
+{
+    if (m_bitrateBps.has_value())
+    {
+        config.bitrate_bps = clamp(
+            m_bitrateBps.value(),
+            webrtc::AudioEncoderOpusConfig::kMinBitrateBps,
+            webrtc::AudioEncoderOpusConfig::kMaxBitrateBps);
+    }
+    if (m_complexity.has_value())
+    {
+        config.complexity = clamp(m_complexity.value(), 0, 10);
+        config.low_rate_complexity = config.complexity;
+    }
+    if (m_frameSizeMs.has_value())
+    {
+        int frameSizeMs = config.frame_size_ms;
+        config.frame_size_ms = m_frameSizeMs.value();
+        if (!config.IsOk())
+        {
+            config.frame_size_ms = frameSizeMs;
+        }
+    }
+    if (m_dtx.has_value())
+    {
+        config.dtx_enabled = m_dtx.value();
+    }
+    if (m_inbandFec.has_value())
+    {
+        config.fec_enabled = m_inbandFec.value();
+    }
+
+    return config;
+}
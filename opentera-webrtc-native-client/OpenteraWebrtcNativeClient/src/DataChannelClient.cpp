@@ -1,9 +1,74 @@
 #include <OpenteraWebrtcNativeClient/DataChannelClient.h>
 #include <OpenteraWebrtcNativeClient/Handlers/DataChannelPeerConnectionHandler.h>
+#include <OpenteraWebrtcNativeClient/Utils/ClockSyncFrame.h>
+#include <OpenteraWebrtcNativeClient/Utils/PubSubFrame.h>
+#include <OpenteraWebrtcNativeClient/Utils/RpcFrame.h>
+
+#include <api/units/time_delta.h>
+#include <rtc_base/helpers.h>
+#include <rtc_base/time_utils.h>
+
+#include <stdexcept>
 
 using namespace opentera;
 using namespace std;
 
+constexpr int64_t ClockSyncIntervalMs = 1000;
+constexpr int64_t DefaultRpcTimeoutMs = 10000;
+
+constexpr size_t MinFrameSize = 1024;
+// WebRTC announces this maximum SCTP message size in the SDP, so the peers do not accept larger frames.
+constexpr size_t MaxFrameSize = 256 * 1024;
+constexpr uint64_t DefaultFrameSendBufferSize = 256 * 1024;
+// WebRTC closes the data channels whose buffered amount exceeds this size.
+constexpr uint64_t MaxFrameSendBufferSize = 16 * 1024 * 1024;
+
+template<class F>
+static const F& findCallback(const map<string, F>& callbacksByChannel, const string& channel)
+{
+    static const F NullCallback;
+    auto it = callbacksByChannel.find(channel);
+    return it == callbacksByChannel.end() ? NullCallback : it->second;
+}
+
+static void dispatchDataChannelMessage(
+    const Client& client,
+    const webrtc::DataBuffer& buffer,
+    const function<void(const Client&, const DataChannelMessage&)>& onMessage,
+    const function<void(const Client&, const uint8_t*, size_t)>& onMessageBinary,
+    const function<void(const Client&, const string&)>& onMessageString)
+{
+    if (onMessage)
+    {
+        onMessage(client, DataChannelMessage(buffer.data, buffer.binary));
+    }
+    if (buffer.binary && onMessageBinary)
+    {
+        onMessageBinary(client, buffer.data.data<uint8_t>(), buffer.size());
+    }
+    else if (!buffer.binary && onMessageString)
+    {
+        onMessageString(client, string(buffer.data.data<char>(), buffer.size()));
+    }
+}
+
+static webrtc::DataBuffer answerRpcRequest(
+    const function<DataChannelMessage(const Client&, const DataChannelMessage&)>& handler,
+    const Client& client,
+    uint32_t callId,
+    const DataChannelMessage& request)
+{
+    try
+    {
+        DataChannelMessage response = handler(client, request);
+        return RpcFrame::encodeResponse(callId, webrtc::DataBuffer(response.buffer(), response.isBinary()));
+    }
+    catch (const exception& e)
+    {
+        return RpcFrame::encodeError(callId, e.what());
+    }
+}
+
 /**
  * @brief Creates a data channel client with the specified configurations.
  *
@@ -15,65 +80,1418 @@ DataChannelClient::DataChannelClient(
     SignalingServerConfiguration signalingServerConfiguration,
     WebrtcConfiguration webrtcConfiguration,
     DataChannelConfiguration dataChannelConfiguration)
+    : DataChannelClient(
+          move(signalingServerConfiguration),
+          move(webrtcConfiguration),
+          move(dataChannelConfiguration),
+          {})
+{
+}
+
+/**
+ * @brief Creates a data channel client with the specified configurations and named data channels.
+ *
+ * A named data channel is opened with each peer for each entry of namedDataChannelConfigurations, in addition to the
+ * default data channel. Each named data channel has its own configuration, so lossy messages on one channel never
+ * block reliable messages on another one. The open and close callbacks are only called for the default data channel.
+ * The named data channel whose protocol is DataChannelConfiguration::PubSubProtocol carries the published topics.
+ * The named data channel whose protocol is DataChannelConfiguration::ClockSyncProtocol carries the clock
+ * synchronization exchanges, which are made with each client every second. The named data channel whose protocol is
+ * DataChannelConfiguration::FileTransferProtocol carries the files sent with sendFile. The named data channel whose
+ * protocol is DataChannelConfiguration::RpcProtocol carries the remote procedure calls.
+ *
+ * @param signalingServerConfiguration The signaling server configuration
+ * @param webrtcConfiguration The WebRTC configuration
+ * @param dataChannelConfiguration The default data channel configuration
+ * @param namedDataChannelConfigurations The configuration of each named data channel
+ * @throw runtime_error if a name is empty or equal to the room name, if several data channels use the pub/sub
+ * protocol, the clock synchronization protocol, the file transfer protocol or the RPC protocol, or if the file
+ * transfer data channel is not ordered and reliable
+ */
+DataChannelClient::DataChannelClient(
+    SignalingServerConfiguration signalingServerConfiguration,
+    WebrtcConfiguration webrtcConfiguration,
+    DataChannelConfiguration dataChannelConfiguration,
+    map<string, DataChannelConfiguration> namedDataChannelConfigurations)
     : SignalingClient(move(signalingServerConfiguration), move(webrtcConfiguration)),
-      m_dataChannelConfiguration(move(dataChannelConfiguration))
+      m_dataChannelConfiguration(move(dataChannelConfiguration)),
+      m_namedDataChannelConfigurations(move(namedDataChannelConfigurations)),
+      m_isMessageFragmentationEnabled(false),
+      m_maxFrameSize(MessageFragmenter::DefaultMaxFrameSize),
+      m_frameSendBufferSize(DefaultFrameSendBufferSize),
+      m_nextFileTransferId(0),
+      m_nextRpcCallId(0),
+      m_rpcTimeoutMs(DefaultRpcTimeoutMs)
+{
+    for (const auto& pair : m_namedDataChannelConfigurations)
+    {
+        if (pair.first.empty() || pair.first == m_signalingServerConfiguration.room())
+        {
+            throw runtime_error("A data channel name must not be empty or equal to the room name.");
+        }
+        if (pair.second.isPubSub())
+        {
+            if (!m_pubSubChannel.empty())
+            {
+                throw runtime_error("Only one data channel can use the pub/sub protocol.");
+            }
+            m_pubSubChannel = pair.first;
+        }
+        if (pair.second.isClockSync())
+        {
+            if (!m_clockSyncChannel.empty())
+            {
+                throw runtime_error("Only one data channel can use the clock synchronization protocol.");
+            }
+            m_clockSyncChannel = pair.first;
+        }
+        if (pair.second.isFileTransfer())
+        {
+            if (!m_fileTransferChannel.empty())
+            {
+                throw runtime_error("Only one data channel can use the file transfer protocol.");
+            }
+            if (!pair.second.ordered() || pair.second.maxPacketLifeTime().has_value() ||
+                pair.second.maxRetransmits().has_value())
+            {
+                throw runtime_error(
+                    "The data channel that uses the file transfer protocol must be ordered and reliable.");
+            }
+            m_fileTransferChannel = pair.first;
+        }
+        if (pair.second.isRpc())
+        {
+            if (!m_rpcChannel.empty())
+            {
+                throw runtime_error("Only one data channel can use the RPC protocol.");
+            }
+            m_rpcChannel = pair.first;
+        }
+    }
+
+    callSync(
+        getInternalClientThread(),
+        [this]()
+        {
+            m_taskSafetyFlag = webrtc::PendingTaskSafetyFlag::Create();
+            if (!m_clockSyncChannel.empty())
+            {
+                sendClockSyncRequests();
+            }
+        });
+}
+
+DataChannelClient::~DataChannelClient()
 {
+    // The delayed tasks must not use the client after it is destroyed. The worker pools wait for the running
+    // handlers and callbacks on this thread, so the internal client thread is not blocked.
+    unique_ptr<WorkerPool> rpcWorkerPool;
+    callSync(
+        getInternalClientThread(),
+        [this, &rpcWorkerPool]()
+        {
+            m_taskSafetyFlag->SetNotAlive();
+            rpcWorkerPool = move(m_rpcWorkerPool);
+        });
+
+    unique_ptr<KeyedWorkerPool> messageDispatchPool;
+    {
+        lock_guard<mutex> lock(m_messageDispatchMutex);
+        messageDispatchPool = move(m_messageDispatchPool);
+    }
 }
 
-void DataChannelClient::sendTo(const webrtc::DataBuffer& buffer, const vector<string>& ids)
+bool DataChannelClient::sendTo(const string& channel, const webrtc::DataBuffer& message, const vector<string>& ids)
 {
+    EncodedMessage encodedMessage = encodeMessage(channel, message);
+    if (!m_bufferedAmountTracker.tryReserve(ids, encodedMessage.buffer.size()))
+    {
+        return false;
+    }
+
     callAsync(
         getInternalClientThread(),
-        [this, buffer, ids]()
+        [this, channel, encodedMessage, ids]()
         {
+            absl::optional<webrtc::DataBuffer> otherBuffer;
             for (const auto& id : ids)
             {
-                auto it = m_peerConnectionHandlersById.find(id);
-                if (it != m_peerConnectionHandlersById.end())
+                sendEncodedMessage(id, findDataChannelHandler(id), channel, encodedMessage, otherBuffer);
+            }
+        });
+    return true;
+}
+
+bool DataChannelClient::sendToAll(const string& channel, const webrtc::DataBuffer& message)
+{
+    EncodedMessage encodedMessage = encodeMessage(channel, message);
+    if (!m_bufferedAmountTracker.tryReserveAll(encodedMessage.buffer.size()))
+    {
+        return false;
+    }
+
+    callAsync(
+        getInternalClientThread(),
+        [this, channel, encodedMessage]()
+        {
+            absl::optional<webrtc::DataBuffer> otherBuffer;
+            for (auto& pair : m_peerConnectionHandlersById)
+            {
+                sendEncodedMessage(
+                    pair.first,
+                    dynamic_cast<DataChannelPeerConnectionHandler*>(pair.second.get()),
+                    channel,
+                    encodedMessage,
+                    otherBuffer);
+            }
+        });
+    return true;
+}
+
+void DataChannelClient::sendLatestTo(const string& key, const webrtc::DataBuffer& message, const vector<string>& ids)
+{
+    EncodedMessage encodedMessage = encodeMessage("", message);
+    // The latest messages replace the queued ones instead of accumulating, so they are never refused.
+    m_bufferedAmountTracker.reserve(ids, encodedMessage.buffer.size());
+
+    callAsync(
+        getInternalClientThread(),
+        [this, key, encodedMessage, ids]()
+        {
+            absl::optional<webrtc::DataBuffer> otherBuffer;
+            for (const auto& id : ids)
+            {
+                DataChannelPeerConnectionHandler* handler = findDataChannelHandler(id);
+                if (handler == nullptr)
                 {
-                    dynamic_cast<DataChannelPeerConnectionHandler*>(it->second.get())->send(buffer);
+                    m_bufferedAmountTracker.release(id, encodedMessage.buffer.size());
+                    continue;
                 }
+
+                const webrtc::DataBuffer& buffer = negotiateMessage(id, *handler, "", encodedMessage, otherBuffer);
+                if (!handler->sendLatest("", key, buffer))
+                {
+                    m_bufferedAmountTracker.release(id, buffer.size());
+                }
+            }
+        });
+}
+
+void DataChannelClient::sendLatestToAll(const string& key, const webrtc::DataBuffer& message)
+{
+    EncodedMessage encodedMessage = encodeMessage("", message);
+    m_bufferedAmountTracker.reserveAll(encodedMessage.buffer.size());
+
+    callAsync(
+        getInternalClientThread(),
+        [this, key, encodedMessage]()
+        {
+            absl::optional<webrtc::DataBuffer> otherBuffer;
+            for (auto& pair : m_peerConnectionHandlersById)
+            {
+                auto handler = dynamic_cast<DataChannelPeerConnectionHandler*>(pair.second.get());
+                const webrtc::DataBuffer& buffer =
+                    negotiateMessage(pair.first, *handler, "", encodedMessage, otherBuffer);
+                if (!handler->sendLatest("", key, buffer))
+                {
+                    m_bufferedAmountTracker.release(pair.first, buffer.size());
+                }
+            }
+        });
+}
+
+/**
+ * @brief Subscribes to a topic, so the messages published to this topic by the other clients are received.
+ *
+ * The subscription is announced to the connected clients and to the clients that connect later.
+ *
+ * @param topic The topic
+ * @throw runtime_error if no data channel uses the pub/sub protocol
+ */
+void DataChannelClient::subscribe(uint16_t topic)
+{
+    checkPubSubChannel();
+    callAsync(
+        getInternalClientThread(),
+        [this, topic]()
+        {
+            if (!m_subscribedTopics.insert(topic).second)
+            {
+                return;
+            }
+
+            webrtc::DataBuffer frame = PubSubFrame::encode(PubSubFrame::Type::Subscribe, topic);
+            for (auto& pair : m_peerConnectionHandlersById)
+            {
+                sendInternalFrame(m_pubSubChannel, pair.first, frame);
+            }
+        });
+}
+
+/**
+ * @brief Unsubscribes from a topic.
+ *
+ * @param topic The topic
+ * @throw runtime_error if no data channel uses the pub/sub protocol
+ */
+void DataChannelClient::unsubscribe(uint16_t topic)
+{
+    checkPubSubChannel();
+    callAsync(
+        getInternalClientThread(),
+        [this, topic]()
+        {
+            if (m_subscribedTopics.erase(topic) == 0)
+            {
+                return;
+            }
+
+            webrtc::DataBuffer frame = PubSubFrame::encode(PubSubFrame::Type::Unsubscribe, topic);
+            for (auto& pair : m_peerConnectionHandlersById)
+            {
+                sendInternalFrame(m_pubSubChannel, pair.first, frame);
+            }
+        });
+}
+
+bool DataChannelClient::publish(uint16_t topic, const webrtc::DataBuffer& message)
+{
+    checkPubSubChannel();
+
+    // The subscribers are looked up on the calling thread, so the message is only framed once for all of them.
+    vector<string> ids = m_topicRegistry.subscriberIds(topic);
+    if (ids.empty())
+    {
+        return true;
+    }
+    if (!sendTo(m_pubSubChannel, PubSubFrame::encode(topic, message), ids))
+    {
+        return false;
+    }
+
+    m_topicRegistry.addSentMessages(topic, message.size(), ids.size());
+    return true;
+}
+
+/**
+ * @brief Returns the estimated offset of the clock of a client, which is the client time minus the local time.
+ *
+ * The offset is estimated from the clock synchronization exchanges, as in NTP. It is accurate to half the
+ * round-trip time, or better if the network delays are symmetric.
+ *
+ * @param id The client id
+ * @return The clock offset (us), or nothing if no exchange was completed with the client
+ */
+absl::optional<int64_t> DataChannelClient::peerClockOffset(const string& id)
+{
+    return callSync(
+        getInternalClientThread(),
+        [this, &id]() -> absl::optional<int64_t>
+        {
+            auto it = m_clockOffsetEstimatorsById.find(id);
+            if (it == m_clockOffsetEstimatorsById.end() || !it->second.hasEstimate())
+            {
+                return absl::nullopt;
+            }
+            return it->second.offsetUs();
+        });
+}
+
+/**
+ * @brief Returns the smoothed round-trip time of the clock synchronization exchanges with a client.
+ *
+ * @param id The client id
+ * @return The round-trip time (us), or nothing if no exchange was completed with the client
+ */
+absl::optional<int64_t> DataChannelClient::peerRoundTripTime(const string& id)
+{
+    return callSync(
+        getInternalClientThread(),
+        [this, &id]() -> absl::optional<int64_t>
+        {
+            auto it = m_clockOffsetEstimatorsById.find(id);
+            if (it == m_clockOffsetEstimatorsById.end() || !it->second.hasEstimate())
+            {
+                return absl::nullopt;
             }
+            return it->second.smoothedRoundTripTimeUs();
         });
 }
 
-void DataChannelClient::sendToAll(const webrtc::DataBuffer& buffer)
+/**
+ * @brief Converts a local time to the clock of a client.
+ *
+ * @param id The client id
+ * @param localTimeUs The local time (us), in the clock of localTime
+ * @return The time in the clock of the client (us), or nothing if its clock offset is unknown
+ */
+absl::optional<int64_t> DataChannelClient::toPeerTime(const string& id, int64_t localTimeUs)
+{
+    absl::optional<int64_t> offsetUs = peerClockOffset(id);
+    if (!offsetUs.has_value())
+    {
+        return absl::nullopt;
+    }
+    return localTimeUs + *offsetUs;
+}
+
+/**
+ * @brief Converts a time of the clock of a client to the local clock.
+ *
+ * The one-way latency of a message is localTime() minus the conversion of the time the client put in the message.
+ *
+ * @param id The client id
+ * @param peerTimeUs The time in the clock of the client (us)
+ * @return The local time (us), or nothing if the clock offset of the client is unknown
+ */
+absl::optional<int64_t> DataChannelClient::fromPeerTime(const string& id, int64_t peerTimeUs)
+{
+    absl::optional<int64_t> offsetUs = peerClockOffset(id);
+    if (!offsetUs.has_value())
+    {
+        return absl::nullopt;
+    }
+    return peerTimeUs - *offsetUs;
+}
+
+/**
+ * @brief Returns the local time used by the clock synchronization.
+ *
+ * It is the clock of the frame timestamps (rtc::TimeMicros), so the timestamps of the frames can be converted to the
+ * clock of a client.
+ *
+ * @return The local time (us)
+ */
+int64_t DataChannelClient::localTime()
+{
+    return rtc::TimeMicros();
+}
+
+/**
+ * @brief Sends a file to a client.
+ *
+ * The file is sent on the data channel whose protocol is DataChannelConfiguration::FileTransferProtocol. It is
+ * memory-mapped and sent in chunks of 64 KiB, each with a CRC-32 checksum, so it is never loaded in memory. At most
+ * 1 MiB is sent ahead of the data written by the receiver, so the transfer follows the speed of the link and of the
+ * receiver disk. If the connection closes, the transfer resumes from the data written by the receiver when a client
+ * with the same name connects again. The file must not be modified during the transfer.
+ *
+ * @param id The client id
+ * @param path The path of the file to send
+ * @param name The file name sent to the client
+ * @return The transfer id
+ * @throw runtime_error if no data channel uses the file transfer protocol, if the file cannot be mapped or if the
+ * client is not connected
+ */
+uint32_t DataChannelClient::sendFile(const string& id, const string& path, const string& name)
+{
+    checkFileTransferChannel();
+    // The ids start again at 0 when the client is recreated, so the random nonce identifies the transfer.
+    auto sender = make_unique<FileTransferSender>(
+        m_nextFileTransferId++,
+        rtc::CreateRandomId64(),
+        name,
+        make_unique<MemoryMappedFile>(path));
+    uint32_t transferId = sender->id();
+
+    bool isConnected = callSync(
+        getInternalClientThread(),
+        [this, &id, &sender]()
+        {
+            auto it = m_peerConnectionHandlersById.find(id);
+            if (it == m_peerConnectionHandlersById.end())
+            {
+                return false;
+            }
+
+            OutgoingFileTransfer& transfer = m_outgoingFileTransfersById[sender->id()];
+            transfer.client = it->second->peerClient();
+            transfer.sender = move(sender);
+            // If the data channel is not open yet, the file is offered when it opens.
+            sendInternalFrame(m_fileTransferChannel, id, transfer.sender->offer());
+            return true;
+        });
+    if (!isConnected)
+    {
+        throw runtime_error("The client is not connected.");
+    }
+    return transferId;
+}
+
+/**
+ * @brief Cancels a file transfer started with sendFile.
+ *
+ * The part of the file written by the receiver is kept.
+ *
+ * @param transferId The transfer id
+ */
+void DataChannelClient::cancelFileTransfer(uint32_t transferId)
+{
+    callSync(
+        getInternalClientThread(),
+        [this, transferId]()
+        {
+            auto it = m_outgoingFileTransfersById.find(transferId);
+            if (it == m_outgoingFileTransfersById.end())
+            {
+                return;
+            }
+
+            sendInternalFrame(
+                m_fileTransferChannel,
+                it->second.client.id(),
+                FileTransferFrame::encode(FileTransferFrame::Type::Cancel, transferId, 0));
+            m_outgoingFileTransfersById.erase(it);
+        });
+}
+
+future<DataChannelMessage>
+    DataChannelClient::call(const string& id, const string& method, const webrtc::DataBuffer& request)
+{
+    auto responsePromise = make_shared<promise<DataChannelMessage>>();
+    future<DataChannelMessage> responseFuture = responsePromise->get_future();
+    call(
+        id,
+        method,
+        request,
+        [responsePromise](const absl::optional<DataChannelMessage>& response, const string& error)
+        {
+            if (response.has_value())
+            {
+                responsePromise->set_value(*response);
+            }
+            else
+            {
+                responsePromise->set_exception(make_exception_ptr(runtime_error(error)));
+            }
+        });
+    return responseFuture;
+}
+
+void DataChannelClient::call(
+    const string& id,
+    const string& method,
+    const webrtc::DataBuffer& request,
+    const function<void(const absl::optional<DataChannelMessage>&, const string&)>& callback)
+{
+    checkRpcChannel();
+    // The request is framed on the calling thread, so the internal client thread only sends it.
+    uint32_t callId = m_nextRpcCallId++;
+    webrtc::DataBuffer frame = RpcFrame::encodeRequest(callId, method, request);
+    int64_t timeoutMs = m_rpcTimeoutMs;
+
+    callAsync(
+        getInternalClientThread(),
+        [this, id, callId, frame, callback, timeoutMs]()
+        {
+            if (!sendInternalFrame(m_rpcChannel, id, frame))
+            {
+                callback(absl::nullopt, "The client is not connected or its RPC data channel is not open.");
+                return;
+            }
+
+            m_rpcCallRegistry.add(callId, id, callback);
+            getInternalClientThread()->PostDelayedTask(
+                [this, safetyFlag = m_taskSafetyFlag, id, callId]()
+                {
+                    if (safetyFlag->alive())
+                    {
+                        m_rpcCallRegistry.fail(callId, id, "The RPC call timed out.");
+                    }
+                },
+                webrtc::TimeDelta::Millis(timeoutMs));
+        });
+}
+
+/**
+ * @brief Sets the time after which the calls without response fail. By default, it is 10 s.
+ *
+ * The timeout of a call is the one set when the call is made.
+ *
+ * @param timeoutMs The timeout (ms)
+ * @throw runtime_error if the timeout is not greater than 0
+ */
+void DataChannelClient::setRpcTimeout(int64_t timeoutMs)
+{
+    if (timeoutMs <= 0)
+    {
+        throw runtime_error("The RPC timeout must be greater than 0.");
+    }
+    m_rpcTimeoutMs = timeoutMs;
+}
+
+/**
+ * @brief Sets the number of threads that run the RPC handlers.
+ *
+ * When it is 0, the handlers are called from the internal client thread, so a slow handler delays the other messages.
+ * Otherwise, the handlers run on a worker pool, so several calls are handled at the same time and their responses are
+ * sent as soon as they are ready. By default, it is 0. The calls that wait for a thread of the previous pool are
+ * discarded, so it should be set before the calls are received.
+ *
+ * @param count The number of threads
+ */
+void DataChannelClient::setRpcWorkerCount(size_t count)
+{
+    unique_ptr<WorkerPool> rpcWorkerPool = count > 0 ? make_unique<WorkerPool>(count) : nullptr;
+    callSync(getInternalClientThread(), [this, &rpcWorkerPool]() { swap(m_rpcWorkerPool, rpcWorkerPool); });
+    // The previous pool waits for its running handlers on this thread, so the internal client thread is not blocked.
+}
+
+/**
+ * @brief Sets the maximum size of the frames created by the message fragmentation and of the batches created by the
+ * coalescing. By default, it is 16 KiB.
+ *
+ * Larger frames reduce the per-message overhead of bulk transfers, but a small message can wait for a whole frame of
+ * each large message. The messages sent without fragmentation and coalescing keep their size. It only sizes the
+ * framing of this library: the SCTP maximum message size of WebRTC, which is 256 KiB, cannot be changed. It must be
+ * set before the calls are made.
+ *
+ * @param size The maximum size (bytes)
+ * @throw runtime_error if the size is smaller than 1 KiB or larger than 256 KiB
+ */
+void DataChannelClient::setMaxFrameSize(size_t size)
+{
+    if (size < MinFrameSize || size > MaxFrameSize)
+    {
+        throw runtime_error("The maximum frame size must be between 1 KiB and 256 KiB.");
+    }
+    callSync(getInternalClientThread(), [this, size]() { m_maxFrameSize = size; });
+}
+
+/**
+ * @brief Sets the number of frame bytes that can wait in the buffer of a data channel. By default, it is 256 KiB.
+ *
+ * When the message fragmentation is enabled, the frames are passed to the data channel only while its buffer is
+ * under this size, so the frames of the messages sent later can be interleaved with the pending ones. A larger buffer
+ * keeps more data in flight on links with a large bandwidth-delay product, but it delays the interleaved messages.
+ * It only limits the frames waiting in the data channel: the SCTP send and receive buffers of WebRTC cannot be
+ * changed, and the messages sent without fragmentation are not limited by it. It must be set before the calls are
+ * made.
+ *
+ * @param size The frame send buffer size (bytes)
+ * @throw runtime_error if the size is 0 or larger than 16 MiB
+ */
+void DataChannelClient::setFrameSendBufferSize(uint64_t size)
+{
+    if (size == 0 || size > MaxFrameSendBufferSize)
+    {
+        throw runtime_error("The frame send buffer size must be between 1 byte and 16 MiB.");
+    }
+    callSync(getInternalClientThread(), [this, size]() { m_frameSendBufferSize = size; });
+}
+
+/**
+ * @brief Sets the number of threads that call the message callbacks.
+ *
+ * When it is 0, the message and topic message callbacks are called from the internal client thread, so the messages
+ * of all clients are handled one at a time. Otherwise, each client is assigned to a thread of a worker pool, so the
+ * messages of a client are handled in order and the messages of different clients are handled in parallel. The data
+ * channel messages are posted to the workers as soon as they are received, without waiting for the internal client
+ * thread. The callbacks can then be called from several threads at the same time. By default, it is 0. The messages
+ * that wait for a thread of the previous pool are discarded, so it should be set before the messages are received.
+ *
+ * @param count The number of threads
+ */
+void DataChannelClient::setMessageDispatchWorkerCount(size_t count)
+{
+    unique_ptr<KeyedWorkerPool> messageDispatchPool = count > 0 ? make_unique<KeyedWorkerPool>(count) : nullptr;
+    {
+        lock_guard<mutex> lock(m_messageDispatchMutex);
+        swap(m_messageDispatchPool, messageDispatchPool);
+    }
+    // The previous pool waits for its running callbacks outside the lock, so the received messages are not blocked.
+}
+
+/**
+ * @brief Sends all messages of a batch to their recipients.
+ *
+ * The batch is submitted to the internal client thread in a single task, so this is more efficient than calling sendTo
+ * or sendToAll for each message.
+ *
+ * @param batch The messages to send
+ * @return false if no message is sent because the send queue of a client is full
+ */
+bool DataChannelClient::sendBatch(DataChannelMessageBatch batch)
 {
+    if (batch.empty())
+    {
+        return true;
+    }
+
+    map<string, uint64_t> sizesById;
+    vector<EncodedMessage> encodedMessages;
+    encodedMessages.reserve(batch.m_messages.size());
+    const vector<string> allIds = m_bufferedAmountTracker.peerIds();
+    for (const auto& message : batch.m_messages)
+    {
+        encodedMessages.push_back(encodeMessage("", message.buffer));
+        for (const auto& id : message.isToAll ? allIds : message.ids)
+        {
+            sizesById[id] += encodedMessages.back().buffer.size();
+        }
+    }
+    if (!m_bufferedAmountTracker.tryReserve(sizesById))
+    {
+        return false;
+    }
+
     callAsync(
         getInternalClientThread(),
-        [this, buffer]()
+        [this, batch = move(batch), encodedMessages = move(encodedMessages)]()
         {
+            // The handlers of the broadcast messages are resolved once per batch instead of once per message.
+            vector<pair<const string*, DataChannelPeerConnectionHandler*>> allHandlers;
+            allHandlers.reserve(m_peerConnectionHandlersById.size());
             for (auto& pair : m_peerConnectionHandlersById)
             {
-                dynamic_cast<DataChannelPeerConnectionHandler*>(pair.second.get())->send(buffer);
+                allHandlers.emplace_back(
+                    &pair.first,
+                    dynamic_cast<DataChannelPeerConnectionHandler*>(pair.second.get()));
+            }
+
+            for (size_t i = 0; i < batch.m_messages.size(); i++)
+            {
+                const auto& message = batch.m_messages[i];
+                absl::optional<webrtc::DataBuffer> otherBuffer;
+                if (message.isToAll)
+                {
+                    for (auto& handler : allHandlers)
+                    {
+                        sendEncodedMessage(*handler.first, handler.second, "", encodedMessages[i], otherBuffer);
+                    }
+                    continue;
+                }
+
+                for (const auto& id : message.ids)
+                {
+                    sendEncodedMessage(id, findDataChannelHandler(id), "", encodedMessages[i], otherBuffer);
+                }
+            }
+        });
+    return true;
+}
+
+bool DataChannelClient::isDataChannelCompressed(const string& channel) const
+{
+    if (channel.empty())
+    {
+        return m_dataChannelConfiguration.isCompressed();
+    }
+
+    auto it = m_namedDataChannelConfigurations.find(channel);
+    return it != m_namedDataChannelConfigurations.end() && it->second.isCompressed();
+}
+
+DataChannelClient::EncodedMessage
+    DataChannelClient::encodeMessage(const string& channel, const webrtc::DataBuffer& message)
+{
+    // The messages are compressed on the calling thread, so the internal client thread is not slowed down when the
+    // peers negotiated the local protocol.
+    bool isCompressed = isDataChannelCompressed(channel);
+    return {message, isCompressed ? m_messageCompressor.compress(message) : message, isCompressed};
+}
+
+const webrtc::DataBuffer& DataChannelClient::negotiateMessage(
+    const string& id,
+    const DataChannelPeerConnectionHandler& handler,
+    const string& channel,
+    const EncodedMessage& message,
+    absl::optional<webrtc::DataBuffer>& otherBuffer)
+{
+    // The peer decodes the messages according to the protocol of the open data channel, which is proposed by the
+    // caller, so the local configuration is not enough to decide the compression.
+    absl::optional<bool> isCompressed = handler.isDataChannelCompressed(channel);
+    if (!isCompressed.has_value() || *isCompressed == message.isCompressed)
+    {
+        return message.buffer;
+    }
+
+    // The other encoding is made once for all the peers that need it.
+    if (!otherBuffer.has_value())
+    {
+        otherBuffer = message.isCompressed ? message.message : m_messageCompressor.compress(message.message);
+    }
+    m_bufferedAmountTracker.reserve({id}, otherBuffer->size());
+    m_bufferedAmountTracker.release(id, message.buffer.size());
+    return *otherBuffer;
+}
+
+void DataChannelClient::sendEncodedMessage(
+    const string& id,
+    DataChannelPeerConnectionHandler* handler,
+    const string& channel,
+    const EncodedMessage& message,
+    absl::optional<webrtc::DataBuffer>& otherBuffer)
+{
+    if (handler == nullptr)
+    {
+        m_bufferedAmountTracker.release(id, message.buffer.size());
+        return;
+    }
+
+    const webrtc::DataBuffer& buffer = negotiateMessage(id, *handler, channel, message, otherBuffer);
+    if (!handler->send(channel, buffer))
+    {
+        m_bufferedAmountTracker.release(id, buffer.size());
+    }
+}
+
+DataChannelPeerConnectionHandler* DataChannelClient::findDataChannelHandler(const string& id)
+{
+    auto it = m_peerConnectionHandlersById.find(id);
+    if (it == m_peerConnectionHandlersById.end())
+    {
+        return nullptr;
+    }
+    return dynamic_cast<DataChannelPeerConnectionHandler*>(it->second.get());
+}
+
+bool DataChannelClient::sendInternalFrame(const string& channel, const string& id, const webrtc::DataBuffer& frame)
+{
+    auto it = m_peerConnectionHandlersById.find(id);
+    if (it == m_peerConnectionHandlersById.end())
+    {
+        return false;
+    }
+
+    // The sent frames are reported by the buffered amount callback, so they are tracked like the other messages.
+    m_bufferedAmountTracker.reserve({id}, frame.size());
+    if (!dynamic_cast<DataChannelPeerConnectionHandler*>(it->second.get())->send(channel, frame))
+    {
+        m_bufferedAmountTracker.release(id, frame.size());
+        return false;
+    }
+    return true;
+}
+
+void DataChannelClient::dispatchReceivedMessage(const Client& client, function<void()> callback)
+{
+    {
+        lock_guard<mutex> lock(m_messageDispatchMutex);
+        if (m_messageDispatchPool)
+        {
+            m_messageDispatchPool->post(client.id(), move(callback));
+            return;
+        }
+    }
+    // The callback is called outside the lock, so it can change the message callbacks.
+    callback();
+}
+
+bool DataChannelClient::tryDispatchDataChannelMessage(
+    const Client& client,
+    const string& channel,
+    const webrtc::DataBuffer& buffer)
+{
+    lock_guard<mutex> lock(m_messageDispatchMutex);
+    if (!m_messageDispatchPool)
+    {
+        return false;
+    }
+
+    // The callbacks are copied under the lock, so they can be changed while a worker uses them.
+    auto onMessage =
+        channel.empty() ? m_onDataChannelMessage : findCallback(m_onNamedDataChannelMessageByChannel, channel);
+    auto onMessageBinary = channel.empty() ? m_onDataChannelMessageBinary
+                                           : findCallback(m_onNamedDataChannelMessageBinaryByChannel, channel);
+    auto onMessageString = channel.empty() ? m_onDataChannelMessageString
+                                           : findCallback(m_onNamedDataChannelMessageStringByChannel, channel);
+    m_messageDispatchPool->post(
+        client.id(),
+        [client, buffer, onMessage, onMessageBinary, onMessageString]()
+        { dispatchDataChannelMessage(client, buffer, onMessage, onMessageBinary, onMessageString); });
+    return true;
+}
+
+void DataChannelClient::checkPubSubChannel() const
+{
+    if (m_pubSubChannel.empty())
+    {
+        throw runtime_error("No data channel uses the pub/sub protocol.");
+    }
+}
+
+void DataChannelClient::onPubSubFrame(const Client& client, const webrtc::DataBuffer& frame)
+{
+    PubSubFrame::Type type;
+    uint16_t topic;
+    rtc::CopyOnWriteBuffer message;
+    bool isBinary;
+    if (!PubSubFrame::decode(frame, type, topic, message, isBinary))
+    {
+        invokeIfCallable(m_onDataChannelError, client, string("Invalid pub/sub frame"));
+        return;
+    }
+
+    switch (type)
+    {
+        case PubSubFrame::Type::Publish:
+        {
+            m_topicRegistry.addReceivedMessage(topic, message.size());
+            function<void()> callback = [this, client, topic, message, isBinary]()
+            {
+                // A message published before an unsubscription is received can still arrive, so it is filtered here.
+                if (m_onTopicMessage && m_subscribedTopics.find(topic) != m_subscribedTopics.end())
+                {
+                    dispatchReceivedMessage(
+                        client,
+                        [client, topic, message, isBinary, onTopicMessage = m_onTopicMessage]()
+                        { onTopicMessage(client, topic, DataChannelMessage(message, isBinary)); });
+                }
+            };
+            invokeIfCallable(callback);
+            break;
+        }
+        case PubSubFrame::Type::Subscribe:
+            m_topicRegistry.addSubscriber(topic, client.id());
+            break;
+        case PubSubFrame::Type::Unsubscribe:
+            m_topicRegistry.removeSubscriber(topic, client.id());
+            break;
+    }
+}
+
+void DataChannelClient::sendClockSyncRequests()
+{
+    for (auto& pair : m_peerConnectionHandlersById)
+    {
+        sendInternalFrame(m_clockSyncChannel, pair.first, ClockSyncFrame::encodeRequest(rtc::TimeMicros()));
+    }
+
+    getInternalClientThread()->PostDelayedTask(
+        [this, safetyFlag = m_taskSafetyFlag]()
+        {
+            if (safetyFlag->alive())
+            {
+                sendClockSyncRequests();
+            }
+        },
+        webrtc::TimeDelta::Millis(ClockSyncIntervalMs));
+}
+
+void DataChannelClient::onClockSyncFrame(const Client& client, const webrtc::DataBuffer& frame)
+{
+    // The arrival time is taken before the frame waits in the queue of the internal client thread.
+    int64_t arrivalTimeUs = rtc::TimeMicros();
+
+    ClockSyncFrame::Type type;
+    int64_t originateTimeUs;
+    int64_t receiveTimeUs;
+    int64_t transmitTimeUs;
+    if (!ClockSyncFrame::decode(frame, type, originateTimeUs, receiveTimeUs, transmitTimeUs))
+    {
+        invokeIfCallable(m_onDataChannelError, client, string("Invalid clock synchronization frame"));
+        return;
+    }
+
+    callAsync(
+        getInternalClientThread(),
+        [this, id = client.id(), type, originateTimeUs, receiveTimeUs, transmitTimeUs, arrivalTimeUs]()
+        {
+            if (m_peerConnectionHandlersById.find(id) == m_peerConnectionHandlersById.end())
+            {
+                return;
+            }
+
+            if (type == ClockSyncFrame::Type::Request)
+            {
+                sendInternalFrame(
+                    m_clockSyncChannel,
+                    id,
+                    ClockSyncFrame::encodeResponse(originateTimeUs, arrivalTimeUs, rtc::TimeMicros()));
+            }
+            else
+            {
+                m_clockOffsetEstimatorsById[id].addSample(
+                    originateTimeUs,
+                    receiveTimeUs,
+                    transmitTimeUs,
+                    arrivalTimeUs);
             }
         });
 }
 
+void DataChannelClient::checkFileTransferChannel() const
+{
+    if (m_fileTransferChannel.empty())
+    {
+        throw runtime_error("No data channel uses the file transfer protocol.");
+    }
+}
+
+void DataChannelClient::sendFileChunks(OutgoingFileTransfer& transfer)
+{
+    while (transfer.sender->hasChunkToSend())
+    {
+        if (!sendInternalFrame(m_fileTransferChannel, transfer.client.id(), transfer.sender->popChunk()))
+        {
+            // The data channel is closed, so the transfer is resumed when the client connects again.
+            transfer.sender->stop();
+            break;
+        }
+    }
+}
+
+void DataChannelClient::onFileTransferFrame(const Client& client, const webrtc::DataBuffer& frame)
+{
+    FileTransferFrame::Type type;
+    uint32_t transferId;
+    uint64_t value;
+    uint32_t checksum;
+    rtc::CopyOnWriteBuffer payload;
+    if (!FileTransferFrame::decode(frame, type, transferId, value, checksum, payload))
+    {
+        invokeIfCallable(m_onDataChannelError, client, string("Invalid file transfer frame"));
+        return;
+    }
+
+    callAsync(
+        getInternalClientThread(),
+        [this, client, type, transferId, value, checksum, payload]()
+        {
+            switch (type)
+            {
+                case FileTransferFrame::Type::Offer:
+                {
+                    uint64_t nonce;
+                    string name;
+                    if (FileTransferFrame::decodeOffer(payload, nonce, name))
+                    {
+                        onFileTransferOffer(client, transferId, value, nonce, name);
+                    }
+                    else
+                    {
+                        invokeIfCallable(m_onDataChannelError, client, string("Invalid file transfer frame"));
+                    }
+                    break;
+                }
+                case FileTransferFrame::Type::Chunk:
+                    onFileTransferChunk(client, transferId, value, checksum, payload);
+                    break;
+                case FileTransferFrame::Type::Cancel:
+                    m_incomingFileTransfers.erase(make_pair(client.name(), transferId));
+                    break;
+                case FileTransferFrame::Type::Accept:
+                case FileTransferFrame::Type::Ack:
+                case FileTransferFrame::Type::Reject:
+                    onFileTransferAnswer(client, type, transferId, value);
+                    break;
+            }
+        });
+}
+
+void DataChannelClient::onFileTransferOffer(
+    const Client& client,
+    uint32_t transferId,
+    uint64_t size,
+    uint64_t nonce,
+    const string& name)
+{
+    auto key = make_pair(client.name(), transferId);
+    auto it = m_incomingFileTransfers.find(key);
+    bool isResumed = it != m_incomingFileTransfers.end() && it->second.nonce == nonce &&
+                     it->second.receiver->name() == name && it->second.receiver->size() == size;
+    if (!isResumed)
+    {
+        string path = m_onFileTransferRequested ? m_onFileTransferRequested(client, name, size) : "";
+        if (path.empty())
+        {
+            m_incomingFileTransfers.erase(key);
+            sendInternalFrame(
+                m_fileTransferChannel,
+                client.id(),
+                FileTransferFrame::encode(FileTransferFrame::Type::Reject, transferId, 0));
+            return;
+        }
+
+        try
+        {
+            auto receiver = make_unique<FileTransferReceiver>(name, path, size);
+            it = m_incomingFileTransfers.insert_or_assign(key, IncomingFileTransfer{nonce, move(receiver)}).first;
+        }
+        catch (const runtime_error& e)
+        {
+            m_incomingFileTransfers.erase(key);
+            invokeIfCallable(m_onDataChannelError, client, string(e.what()));
+            sendInternalFrame(
+                m_fileTransferChannel,
+                client.id(),
+                FileTransferFrame::encode(FileTransferFrame::Type::Reject, transferId, 0));
+            return;
+        }
+    }
+
+    FileTransferReceiver& receiver = *it->second.receiver;
+    sendInternalFrame(
+        m_fileTransferChannel,
+        client.id(),
+        FileTransferFrame::encode(FileTransferFrame::Type::Accept, transferId, receiver.writtenOffset()));
+    if (!receiver.isComplete())
+    {
+        return;
+    }
+
+    // An empty file is complete as soon as it is accepted.
+    if (m_onFileTransferProgress)
+    {
+        m_onFileTransferProgress(client, name, true, receiver.writtenOffset(), receiver.size());
+    }
+    m_incomingFileTransfers.erase(it);
+}
+
+void DataChannelClient::onFileTransferChunk(
+    const Client& client,
+    uint32_t transferId,
+    uint64_t offset,
+    uint32_t checksum,
+    const rtc::CopyOnWriteBuffer& data)
+{
+    auto it = m_incomingFileTransfers.find(make_pair(client.name(), transferId));
+    if (it == m_incomingFileTransfers.end())
+    {
+        return;
+    }
+
+    FileTransferReceiver& receiver = *it->second.receiver;
+    uint64_t writtenOffset = receiver.writtenOffset();
+    try
+    {
+        if (!receiver.write(offset, checksum, data.data<uint8_t>(), data.size()))
+        {
+            invokeIfCallable(m_onDataChannelError, client, string("Invalid file transfer chunk"));
+            // The sender sends the data again from the written offset.
+            sendInternalFrame(
+                m_fileTransferChannel,
+                client.id(),
+                FileTransferFrame::encode(FileTransferFrame::Type::Accept, transferId, writtenOffset));
+            return;
+        }
+    }
+    catch (const runtime_error& e)
+    {
+        m_incomingFileTransfers.erase(it);
+        invokeIfCallable(m_onDataChannelError, client, string(e.what()));
+        sendInternalFrame(
+            m_fileTransferChannel,
+            client.id(),
+            FileTransferFrame::encode(FileTransferFrame::Type::Reject, transferId, 0));
+        return;
+    }
+
+    if (receiver.writtenOffset() == writtenOffset)
+    {
+        return;
+    }
+    sendInternalFrame(
+        m_fileTransferChannel,
+        client.id(),
+        FileTransferFrame::encode(FileTransferFrame::Type::Ack, transferId, receiver.writtenOffset()));
+    if (m_onFileTransferProgress)
+    {
+        m_onFileTransferProgress(client, receiver.name(), true, receiver.writtenOffset(), receiver.size());
+    }
+    if (receiver.isComplete())
+    {
+        m_incomingFileTransfers.erase(it);
+    }
+}
+
+void DataChannelClient::onFileTransferAnswer(
+    const Client& client,
+    FileTransferFrame::Type type,
+    uint32_t transferId,
+    uint64_t offset)
+{
+    auto it = m_outgoingFileTransfersById.find(transferId);
+    if (it == m_outgoingFileTransfersById.end() || it->second.client.id() != client.id())
+    {
+        return;
+    }
+
+    OutgoingFileTransfer& transfer = it->second;
+    if (type == FileTransferFrame::Type::Reject)
+    {
+        invokeIfCallable(
+            m_onDataChannelError,
+            client,
+            "The file transfer was refused or aborted (" + transfer.sender->name() + ")");
+        m_outgoingFileTransfersById.erase(it);
+        return;
+    }
+
+    if (type == FileTransferFrame::Type::Accept)
+    {
+        transfer.sender->start(offset);
+    }
+    else
+    {
+        transfer.sender->acknowledge(offset);
+    }
+    if (m_onFileTransferProgress)
+    {
+        m_onFileTransferProgress(
+            client,
+            transfer.sender->name(),
+            false,
+            transfer.sender->acknowledgedOffset(),
+            transfer.sender->size());
+    }
+
+    if (transfer.sender->isComplete())
+    {
+        m_outgoingFileTransfersById.erase(it);
+    }
+    else
+    {
+        sendFileChunks(transfer);
+    }
+}
+
+void DataChannelClient::checkRpcChannel() const
+{
+    if (m_rpcChannel.empty())
+    {
+        throw runtime_error("No data channel uses the RPC protocol.");
+    }
+}
+
+void DataChannelClient::onRpcFrame(const Client& client, const webrtc::DataBuffer& frame)
+{
+    RpcFrame::Type type;
+    uint32_t callId;
+    string method;
+    rtc::CopyOnWriteBuffer payload;
+    bool isBinary;
+    if (!RpcFrame::decode(frame, type, callId, method, payload, isBinary))
+    {
+        invokeIfCallable(m_onDataChannelError, client, string("Invalid RPC frame"));
+        return;
+    }
+
+    callAsync(
+        getInternalClientThread(),
+        [this, client, type, callId, method, message = DataChannelMessage(payload, isBinary)]()
+        {
+            switch (type)
+            {
+                case RpcFrame::Type::Request:
+                    onRpcRequest(client, callId, method, message);
+                    break;
+                case RpcFrame::Type::Response:
+                    m_rpcCallRegistry.complete(callId, client.id(), message);
+                    break;
+                case RpcFrame::Type::Error:
+                    m_rpcCallRegistry.fail(callId, client.id(), string(message.view()));
+                    break;
+            }
+        });
+}
+
+void DataChannelClient::onRpcRequest(
+    const Client& client,
+    uint32_t callId,
+    const string& method,
+    const DataChannelMessage& request)
+{
+    auto it = m_rpcHandlersByMethod.find(method);
+    if (it == m_rpcHandlersByMethod.end() || !it->second)
+    {
+        sendInternalFrame(
+            m_rpcChannel,
+            client.id(),
+            RpcFrame::encodeError(callId, "Unknown RPC method (" + method + ")"));
+        return;
+    }
+    if (!m_rpcWorkerPool)
+    {
+        sendInternalFrame(m_rpcChannel, client.id(), answerRpcRequest(it->second, client, callId, request));
+        return;
+    }
+
+    m_rpcWorkerPool->post(
+        [this, safetyFlag = m_taskSafetyFlag, handler = it->second, client, callId, request]()
+        {
+            webrtc::DataBuffer response = answerRpcRequest(handler, client, callId, request);
+            callAsync(
+                getInternalClientThread(),
+                [this, safetyFlag, id = client.id(), response]()
+                {
+                    if (safetyFlag->alive())
+                    {
+                        sendInternalFrame(m_rpcChannel, id, response);
+                    }
+                });
+        });
+}
+
 unique_ptr<PeerConnectionHandler>
     DataChannelClient::createPeerConnectionHandler(const string& id, const Client& peerClient, bool isCaller)
 {
-    auto onDataChannelOpen = [this](const Client& client) { invokeIfCallable(m_onDataChannelOpened, client); };
+    auto onDataChannelOpen = [this](const Client& client)
+    {
+        m_bufferedAmountTracker.addPeer(client.id());
+        invokeIfCallable(m_onDataChannelOpened, client);
+    };
+    auto onNamedDataChannelOpen = [this](const Client& client, const string& channel)
+    {
+        // The callback is posted after the internal frames below, so they are sent before the messages of the callback.
+        function<void()> callback = [this, client, channel]()
+        {
+            const auto& onOpened = findCallback(m_onNamedDataChannelOpenedByChannel, channel);
+            if (onOpened)
+            {
+                onOpened(client);
+            }
+        };
+
+        if (channel == m_pubSubChannel)
+        {
+            // The subscriptions are announced to the client as soon as it can receive them.
+            callAsync(
+                getInternalClientThread(),
+                [this, id = client.id()]()
+                {
+                    for (uint16_t topic : m_subscribedTopics)
+                    {
+                        webrtc::DataBuffer frame = PubSubFrame::encode(PubSubFrame::Type::Subscribe, topic);
+                        sendInternalFrame(m_pubSubChannel, id, frame);
+                    }
+                });
+        }
+        else if (channel == m_clockSyncChannel)
+        {
+            // The first exchange is made right away, so the clock offset is known before the next periodic exchange.
+            callAsync(
+                getInternalClientThread(),
+                [this, id = client.id()]()
+                { sendInternalFrame(m_clockSyncChannel, id, ClockSyncFrame::encodeRequest(rtc::TimeMicros())); });
+        }
+        else if (channel == m_fileTransferChannel)
+        {
+            // The files offered before the data channel opened, or interrupted by a disconnection of a client with
+            // the same name, are offered again. The receiver answers with the offset to resume from.
+            callAsync(
+                getInternalClientThread(),
+                [this, client]()
+                {
+                    for (auto& pair : m_outgoingFileTransfersById)
+                    {
+                        OutgoingFileTransfer& transfer = pair.second;
+                        if (!transfer.sender->isStarted() && transfer.client.name() == client.name())
+                        {
+                            transfer.client = client;
+                            sendInternalFrame(m_fileTransferChannel, client.id(), transfer.sender->offer());
+                        }
+                    }
+                });
+        }
+        invokeIfCallable(callback);
+    };
     auto onDataChannelClosed = [this](const Client& client)
     {
+        m_bufferedAmountTracker.removePeer(client.id());
+        m_topicRegistry.removePeer(client.id());
+        callAsync(
+            getInternalClientThread(),
+            [this, id = client.id()]()
+            {
+                m_clockOffsetEstimatorsById.erase(id);
+                m_rpcCallRegistry.failPeer(id, "The client disconnected.");
+                for (auto& pair : m_outgoingFileTransfersById)
+                {
+                    if (pair.second.client.id() == id)
+                    {
+                        pair.second.sender->stop();
+                    }
+                }
+            });
         invokeIfCallable(m_onDataChannelClosed, client);
         getOnClientDisconnectedFunction()(client);
     };
     auto onDataChannelError = [this](const Client& client, const string& error)
     { invokeIfCallable(m_onDataChannelError, client, error); };
-    auto onDataChannelMessageBinary = [this](const Client& client, const webrtc::DataBuffer& buffer)
+    auto onDataChannelMessage = [this](const Client& client, const string& channel, const webrtc::DataBuffer& buffer)
     {
-        function<void()> callback = [this, client, buffer]()
+        if (!channel.empty() && channel == m_pubSubChannel)
         {
-            if (m_onDataChannelMessageBinary)
-            {
-                m_onDataChannelMessageBinary(client, buffer.data.data<uint8_t>(), buffer.size());
-            }
+            onPubSubFrame(client, buffer);
+            return;
+        }
+        if (!channel.empty() && channel == m_clockSyncChannel)
+        {
+            onClockSyncFrame(client, buffer);
+            return;
+        }
+        if (!channel.empty() && channel == m_fileTransferChannel)
+        {
+            onFileTransferFrame(client, buffer);
+            return;
+        }
+        if (!channel.empty() && channel == m_rpcChannel)
+        {
+            onRpcFrame(client, buffer);
+            return;
+        }
+
+        // With a dispatch pool, the message is posted to the worker of its client from this thread, so the messages do
+        // not wait for the internal client thread.
+        if (tryDispatchDataChannelMessage(client, channel, buffer))
+        {
+            return;
+        }
+
+        // The buffer is shared with the callback, so a string message is only copied if a string callback needs it.
+        function<void()> callback = [this, client, channel, buffer]()
+        {
+            const auto& onMessage =
+                channel.empty() ? m_onDataChannelMessage : findCallback(m_onNamedDataChannelMessageByChannel, channel);
+            const auto& onMessageBinary = channel.empty()
+                                              ? m_onDataChannelMessageBinary
+                                              : findCallback(m_onNamedDataChannelMessageBinaryByChannel, channel);
+            const auto& onMessageString = channel.empty()
+                                              ? m_onDataChannelMessageString
+                                              : findCallback(m_onNamedDataChannelMessageStringByChannel, channel);
+            dispatchDataChannelMessage(client, buffer, onMessage, onMessageBinary, onMessageString);
         };
         invokeIfCallable(callback);
     };
-    auto onDataChannelMessageString = [this](const Client& client, const string& message)
-    { invokeIfCallable(m_onDataChannelMessageString, client, message); };
+    DataChannelMessageChunkCallback onDataChannelMessageChunk;
+    if (m_onDataChannelMessageChunk)
+    {
+        onDataChannelMessageChunk = [this](
+                                        const Client& client,
+                                        uint32_t messageId,
+                                        const uint8_t* data,
+                                        size_t size,
+                                        size_t offset,
+                                        size_t messageSize,
+                                        bool isBinary)
+        {
+            function<void()> callback = [this, client, messageId, chunk = rtc::CopyOnWriteBuffer(data, size), offset,
+                                         messageSize, isBinary]()
+            {
+                if (m_onDataChannelMessageChunk)
+                {
+                    m_onDataChannelMessageChunk(
+                        client,
+                        messageId,
+                        chunk.data<uint8_t>(),
+                        chunk.size(),
+                        offset,
+                        messageSize,
+                        isBinary);
+                }
+            };
+            invokeIfCallable(callback);
+        };
+    }
+    auto onDataChannelBufferedAmountChange = [this](const Client& client, uint64_t sentDataSize)
+    {
+        if (m_bufferedAmountTracker.release(client.id(), sentDataSize))
+        {
+            invokeIfCallable(m_onDataChannelBufferedAmountLow, client);
+        }
+    };
 
     return make_unique<DataChannelPeerConnectionHandler>(
         id,
@@ -83,11 +1501,18 @@ unique_ptr<PeerConnectionHandler>
         getOnErrorFunction(),
         getOnClientConnectedFunction(),
         getOnClientDisconnectedFunction(),
+        getInternalClientThread(),
         m_signalingServerConfiguration.room(),
         m_dataChannelConfiguration,
+        m_namedDataChannelConfigurations,
         onDataChannelOpen,
+        onNamedDataChannelOpen,
         onDataChannelClosed,
         onDataChannelError,
-        onDataChannelMessageBinary,
-        onDataChannelMessageString);
+        onDataChannelMessage,
+        onDataChannelBufferedAmountChange,
+        m_isMessageFragmentationEnabled,
+        m_maxFrameSize,
+        m_frameSendBufferSize,
+        onDataChannelMessageChunk);
 }
@@ -1,8 +1,388 @@
 #include <OpenteraWebrtcNativeClient/Handlers/DataChannelPeerConnectionHandler.h>
+#include <OpenteraWebrtcNativeClient/Utils/FunctionTask.h>
+
+#include <absl/strings/match.h>
+
+#include <algorithm>
+#include <cstring>
 
 using namespace opentera;
 using namespace std;
 
+// The latest messages are passed to the data channel only while its buffer is under this size, so they are replaced
+// in the conflating queue instead of waiting in the data channel buffer when the link is congested.
+constexpr uint64_t MaxLatestMessageBufferedAmount = 16 * 1024;
+
+static bool isFragmented(webrtc::DataChannelInterface& dataChannel)
+{
+    // The frames of a message must all arrive in order, so the other data channels are never fragmented.
+    return absl::EndsWith(dataChannel.protocol(), DataChannelConfiguration::FragmentedProtocolSuffix) &&
+           dataChannel.ordered() && !dataChannel.maxRetransmitsOpt().has_value() &&
+           !dataChannel.maxPacketLifeTime().has_value();
+}
+
+static string removeFragmentedProtocolSuffix(string protocol)
+{
+    if (absl::EndsWith(protocol, DataChannelConfiguration::FragmentedProtocolSuffix))
+    {
+        protocol.resize(protocol.size() - strlen(DataChannelConfiguration::FragmentedProtocolSuffix));
+    }
+    return protocol;
+}
+
+DataChannelPeerConnectionHandler::Channel::Channel(
+    DataChannelPeerConnectionHandler& handler,
+    string name,
+    rtc::scoped_refptr<webrtc::DataChannelInterface> dataChannel)
+    : m_handler(handler),
+      m_name(move(name)),
+      m_dataChannel(move(dataChannel)),
+      m_isCompressed(
+          removeFragmentedProtocolSuffix(m_dataChannel->protocol()) == DataChannelConfiguration::CompressedProtocol),
+      m_isCoalesced(
+          removeFragmentedProtocolSuffix(m_dataChannel->protocol()) == DataChannelConfiguration::CoalescedProtocol),
+      m_unreportedRecordHeaderSize(0),
+      m_isFlushScheduled(false),
+      m_pendingSize(0),
+      m_safetyFlag(webrtc::PendingTaskSafetyFlag::CreateDetached())
+{
+    // The fragmentation is negotiated with the protocol proposed by the caller, so the peers that do not propose it
+    // exchange plain messages.
+    bool isFragmentationEnabled = isFragmented(*m_dataChannel);
+    if (m_isCoalesced)
+    {
+        // The batches are split into frames when the fragmentation is enabled, so they leave room for the frame header.
+        m_messageCoalescer = make_unique<MessageCoalescer>(
+            isFragmentationEnabled ? m_handler.m_maxFrameSize - MessageFragmenter::HeaderSize
+                                   : m_handler.m_maxFrameSize);
+    }
+
+    if (isFragmentationEnabled)
+    {
+        m_messageFragmenter = make_unique<MessageFragmenter>(m_handler.m_maxFrameSize);
+
+        auto onMessage = [this](rtc::CopyOnWriteBuffer message, bool isBinary)
+        { deliverMessage(webrtc::DataBuffer(move(message), isBinary)); };
+        // Only the messages of the default channel are streamed because the chunk callback has no channel. The chunks
+        // of compressed messages and batches cannot be used without the whole message, so they are not streamed.
+        MessageChunkCallback onChunk;
+        if (m_name.empty() && !m_isCompressed && !m_isCoalesced && m_handler.m_onDataChannelMessageChunk)
+        {
+            onChunk = [this](
+                          uint32_t messageId,
+                          const uint8_t* data,
+                          size_t size,
+                          size_t offset,
+                          size_t messageSize,
+                          bool isBinary)
+            {
+                m_handler.m_onDataChannelMessageChunk(
+                    m_handler.m_peerClient,
+                    messageId,
+                    data,
+                    size,
+                    offset,
+                    messageSize,
+                    isBinary);
+            };
+        }
+        m_messageReassembler = make_unique<MessageReassembler>(onMessage, onChunk);
+    }
+
+    m_dataChannel->RegisterObserver(this);
+}
+
+DataChannelPeerConnectionHandler::Channel::~Channel()
+{
+    m_safetyFlag->SetNotAlive();
+    m_dataChannel->UnregisterObserver();
+    m_dataChannel->Close();
+}
+
+bool DataChannelPeerConnectionHandler::Channel::isCompressed() const
+{
+    return m_isCompressed;
+}
+
+bool DataChannelPeerConnectionHandler::Channel::send(const webrtc::DataBuffer& buffer)
+{
+    m_pendingSize += buffer.size();
+    if (!sendMessage(buffer))
+    {
+        m_pendingSize -= buffer.size();
+        return false;
+    }
+    return true;
+}
+
+bool DataChannelPeerConnectionHandler::Channel::sendMessage(const webrtc::DataBuffer& buffer)
+{
+    if (!m_messageCoalescer)
+    {
+        return sendUncoalesced(buffer);
+    }
+    if (m_dataChannel->state() != webrtc::DataChannelInterface::kOpen)
+    {
+        return false;
+    }
+
+    m_messageCoalescer->push(buffer);
+    sendBatches();
+    if (!m_messageCoalescer->empty() && !m_isFlushScheduled)
+    {
+        scheduleFlush();
+    }
+    return true;
+}
+
+bool DataChannelPeerConnectionHandler::Channel::sendUncoalesced(const webrtc::DataBuffer& buffer)
+{
+    if (!m_messageFragmenter)
+    {
+        return m_dataChannel->Send(buffer);
+    }
+    if (m_dataChannel->state() != webrtc::DataChannelInterface::kOpen)
+    {
+        return false;
+    }
+
+    m_messageFragmenter->push(buffer);
+    sendFrames();
+    return true;
+}
+
+bool DataChannelPeerConnectionHandler::Channel::sendLatest(string key, const webrtc::DataBuffer& buffer)
+{
+    if (m_dataChannel->state() != webrtc::DataChannelInterface::kOpen)
+    {
+        return false;
+    }
+
+    m_pendingSize += buffer.size();
+    size_t droppedSize = m_latestMessages.push(move(key), buffer);
+    if (droppedSize > 0)
+    {
+        reportSent(droppedSize);
+    }
+    sendLatestMessages();
+    return true;
+}
+
+void DataChannelPeerConnectionHandler::Channel::OnStateChange()
+{
+    switch (m_dataChannel->state())
+    {
+        case webrtc::DataChannelInterface::kOpen:
+            if (m_name.empty())
+            {
+                m_handler.m_onDataChannelOpen(m_handler.m_peerClient);
+                m_handler.m_onDataChannelClosedCalled = false;
+            }
+            else
+            {
+                m_handler.m_onNamedDataChannelOpen(m_handler.m_peerClient, m_name);
+            }
+            break;
+        case webrtc::DataChannelInterface::kClosed:
+            if (!m_dataChannel->error().ok())
+            {
+                m_handler.m_onDataChannelError(m_handler.m_peerClient, m_dataChannel->error().message());
+            }
+            if (m_name.empty())
+            {
+                m_handler.m_onDataChannelClosed(m_handler.m_peerClient);
+                m_handler.m_onDataChannelClosedCalled = true;
+            }
+            if (m_messageReassembler)
+            {
+                // The messages being reassembled will never be completed.
+                m_messageReassembler->clear();
+            }
+            callAsync(
+                m_handler.m_internalClientThread,
+                [this, safetyFlag = m_safetyFlag]()
+                {
+                    if (safetyFlag->alive())
+                    {
+                        releasePendingData();
+                    }
+                });
+            break;
+        default:
+            break;
+    }
+}
+
+void DataChannelPeerConnectionHandler::Channel::OnMessage(const webrtc::DataBuffer& buffer)
+{
+    if (m_messageReassembler)
+    {
+        if (!buffer.binary || !m_messageReassembler->push(buffer.data))
+        {
+            m_handler.m_onDataChannelError(m_handler.m_peerClient, "Invalid data channel frame");
+        }
+    }
+    else
+    {
+        deliverMessage(buffer);
+    }
+}
+
+void DataChannelPeerConnectionHandler::Channel::OnBufferedAmountChange(uint64_t sentDataSize)
+{
+    // This callback is called from the signaling thread, while the queues are filled on the internal client thread.
+    callAsync(
+        m_handler.m_internalClientThread,
+        [this, safetyFlag = m_safetyFlag, sentDataSize]()
+        {
+            if (safetyFlag->alive())
+            {
+                onDataSent(sentDataSize);
+            }
+        });
+}
+
+void DataChannelPeerConnectionHandler::Channel::onDataSent(uint64_t sentDataSize)
+{
+    // Only the message bytes are reported, so the reported amounts match the sizes of the sent messages.
+    uint64_t sentMessageSize = m_messageFragmenter ? sentDataSize - MessageFragmenter::HeaderSize : sentDataSize;
+    if (m_messageCoalescer)
+    {
+        // A batch can be split into many frames, so its record headers are subtracted from the first reported amounts.
+        uint64_t recordHeaderSize = min(m_unreportedRecordHeaderSize, sentMessageSize);
+        m_unreportedRecordHeaderSize -= recordHeaderSize;
+        sentMessageSize -= recordHeaderSize;
+    }
+    reportSent(sentMessageSize);
+
+    if (m_messageFragmenter)
+    {
+        sendFrames();
+    }
+    sendLatestMessages();
+}
+
+void DataChannelPeerConnectionHandler::Channel::scheduleFlush()
+{
+    // The batch is flushed once the internal client thread has run the tasks already posted, so the messages sent by
+    // consecutive tasks are packed together without waiting for a timer, whose resolution is 1 ms.
+    m_isFlushScheduled = true;
+    callAsync(
+        m_handler.m_internalClientThread,
+        [this, safetyFlag = m_safetyFlag]()
+        {
+            if (safetyFlag->alive())
+            {
+                m_isFlushScheduled = false;
+                m_messageCoalescer->flush();
+                sendBatches();
+            }
+        });
+}
+
+void DataChannelPeerConnectionHandler::Channel::sendBatches()
+{
+    while (m_messageCoalescer->hasReadyBatch())
+    {
+        size_t messageCount;
+        webrtc::DataBuffer batch = m_messageCoalescer->popBatch(messageCount);
+        uint64_t recordHeaderSize = messageCount * MessageCoalescer::HeaderSize;
+
+        m_unreportedRecordHeaderSize += recordHeaderSize;
+        if (!sendUncoalesced(batch))
+        {
+            // The messages of the batch are reported as sent, so they do not remain in the buffered amount forever.
+            m_unreportedRecordHeaderSize -= recordHeaderSize;
+            reportSent(batch.size() - recordHeaderSize);
+        }
+    }
+}
+
+void DataChannelPeerConnectionHandler::Channel::sendFrames()
+{
+    // The frames are passed to the data channel only while its buffer is under the send buffer size, so the frames of
+    // the messages sent later can be interleaved with the pending ones.
+    while (!m_messageFragmenter->empty() && m_dataChannel->buffered_amount() < m_handler.m_frameSendBufferSize)
+    {
+        if (!m_dataChannel->Send(m_messageFragmenter->popFrame()))
+        {
+            m_messageFragmenter->clear();
+            break;
+        }
+    }
+}
+
+void DataChannelPeerConnectionHandler::Channel::sendLatestMessages()
+{
+    while (!m_latestMessages.empty() && m_dataChannel->buffered_amount() < MaxLatestMessageBufferedAmount &&
+           (!m_messageFragmenter || m_messageFragmenter->empty()))
+    {
+        webrtc::DataBuffer buffer = m_latestMessages.pop();
+        if (!sendMessage(buffer))
+        {
+            reportSent(buffer.size());
+        }
+    }
+}
+
+void DataChannelPeerConnectionHandler::Channel::reportSent(uint64_t sentMessageSize)
+{
+    sentMessageSize = min(sentMessageSize, m_pendingSize);
+    m_pendingSize -= sentMessageSize;
+    m_handler.m_onDataChannelBufferedAmountChange(m_handler.m_peerClient, sentMessageSize);
+}
+
+void DataChannelPeerConnectionHandler::Channel::releasePendingData()
+{
+    // The messages queued or buffered when the channel closes are never sent, so they are reported as sent. Otherwise,
+    // they would remain in the buffered amount of the client as long as it is connected.
+    if (m_messageCoalescer)
+    {
+        m_messageCoalescer->clear();
+    }
+    if (m_messageFragmenter)
+    {
+        m_messageFragmenter->clear();
+    }
+    m_latestMessages.clear();
+    m_unreportedRecordHeaderSize = 0;
+    reportSent(m_pendingSize);
+}
+
+void DataChannelPeerConnectionHandler::Channel::deliverMessage(const webrtc::DataBuffer& buffer)
+{
+    if (m_isCoalesced)
+    {
+        bool isValid = MessageCoalescer::unpack(
+            buffer.data,
+            [this](webrtc::DataBuffer message)
+            { m_handler.m_onDataChannelMessage(m_handler.m_peerClient, m_name, message); });
+        if (!isValid)
+        {
+            m_handler.m_onDataChannelError(m_handler.m_peerClient, "Invalid coalesced data channel message");
+        }
+        return;
+    }
+
+    if (!m_isCompressed)
+    {
+        // The buffer is shared, not copied, so the messages are copied at most once before reaching the user.
+        m_handler.m_onDataChannelMessage(m_handler.m_peerClient, m_name, buffer);
+        return;
+    }
+
+    rtc::CopyOnWriteBuffer message;
+    bool isBinary;
+    if (MessageCompressor::decompress(buffer, message, isBinary))
+    {
+        m_handler.m_onDataChannelMessage(m_handler.m_peerClient, m_name, webrtc::DataBuffer(message, isBinary));
+    }
+    else
+    {
+        m_handler.m_onDataChannelError(m_handler.m_peerClient, "Invalid compressed data channel message");
+    }
+}
+
 DataChannelPeerConnectionHandler::DataChannelPeerConnectionHandler(
     string id,
     Client peerClient,
@@ -11,13 +391,20 @@ DataChannelPeerConnectionHandler::DataChannelPeerConnectionHandler(
     function<void(const string&)> onError,
     function<void(const Client&)> onClientConnected,
     function<void(const Client&)> onClientDisconnected,
+    rtc::Thread* internalClientThread,
     string room,
     DataChannelConfiguration dataChannelConfiguration,
+    map<string, DataChannelConfiguration> namedDataChannelConfigurations,
     function<void(const Client&)> onDataChannelOpen,
+    function<void(const Client&, const string&)> onNamedDataChannelOpen,
     function<void(const Client&)> onDataChannelClosed,
     function<void(const Client&, const string&)> onDataChannelError,
-    function<void(const Client&, const webrtc::DataBuffer& buffer)> onDataChannelMessageBinary,
-    function<void(const Client&, const string&)> onDataChannelMessageString)
+    function<void(const Client&, const string&, const webrtc::DataBuffer& buffer)> onDataChannelMessage,
+    function<void(const Client&, uint64_t)> onDataChannelBufferedAmountChange,
+    bool isMessageFragmentationEnabled,
+    size_t maxFrameSize,
+    uint64_t frameSendBufferSize,
+    DataChannelMessageChunkCallback onDataChannelMessageChunk)
     : PeerConnectionHandler(
           move(id),
           move(peerClient),
@@ -26,29 +413,33 @@ DataChannelPeerConnectionHandler::DataChannelPeerConnectionHandler(
           move(onError),
           move(onClientConnected),
           move(onClientDisconnected)),
+      m_internalClientThread(internalClientThread),
       m_room(move(room)),
       m_dataChannelConfiguration(move(dataChannelConfiguration)),
+      m_namedDataChannelConfigurations(move(namedDataChannelConfigurations)),
       m_onDataChannelOpen(move(onDataChannelOpen)),
+      m_onNamedDataChannelOpen(move(onNamedDataChannelOpen)),
       m_onDataChannelClosed(move(onDataChannelClosed)),
       m_onDataChannelError(move(onDataChannelError)),
-      m_onDataChannelMessageBinary(move(onDataChannelMessageBinary)),
-      m_onDataChannelMessageString(move(onDataChannelMessageString)),
+      m_onDataChannelMessage(move(onDataChannelMessage)),
+      m_onDataChannelBufferedAmountChange(move(onDataChannelBufferedAmountChange)),
+      m_isMessageFragmentationEnabled(isMessageFragmentationEnabled),
+      m_maxFrameSize(maxFrameSize),
+      m_frameSendBufferSize(frameSendBufferSize),
+      m_onDataChannelMessageChunk(move(onDataChannelMessageChunk)),
       m_onDataChannelClosedCalled(true)
 {
 }
 
 DataChannelPeerConnectionHandler::~DataChannelPeerConnectionHandler()
 {
-    if (m_dataChannel)
-    {
-        m_dataChannel->UnregisterObserver();
-        m_dataChannel->Close();
+    bool hasDefaultChannel = m_channelsByName.find("") != m_channelsByName.end();
+    m_channelsByName.clear();
 
-        if (!m_onDataChannelClosedCalled)
-        {
-            m_onDataChannelClosedCalled = true;
-            m_onDataChannelClosed(m_peerClient);
-        }
+    if (hasDefaultChannel && !m_onDataChannelClosedCalled)
+    {
+        m_onDataChannelClosedCalled = true;
+        m_onDataChannelClosed(m_peerClient);
     }
 }
 
@@ -58,70 +449,43 @@ void DataChannelPeerConnectionHandler::setPeerConnection(
     PeerConnectionHandler::setPeerConnection(peerConnection);
     if (m_isCaller)
     {
-        auto configuration = static_cast<webrtc::DataChannelInit>(m_dataChannelConfiguration);
-        auto dataChannelOrError = m_peerConnection->CreateDataChannelOrError(m_room, &configuration);
-        if (dataChannelOrError.ok())
-        {
-            m_dataChannel = dataChannelOrError.MoveValue();
-            m_dataChannel->RegisterObserver(this);
-        }
-        else
+        createDataChannel("", m_dataChannelConfiguration);
+        for (const auto& pair : m_namedDataChannelConfigurations)
         {
-            m_onError(std::string("CreateDataChannel failed: ") + dataChannelOrError.error().message());
+            createDataChannel(pair.first, pair.second);
         }
     }
 }
 
-void DataChannelPeerConnectionHandler::send(const webrtc::DataBuffer& buffer)
+absl::optional<bool> DataChannelPeerConnectionHandler::isDataChannelCompressed(const string& channel) const
 {
-    if (m_dataChannel)
+    // The compression is decided by the protocol proposed by the caller, which may differ from the local one.
+    auto it = m_channelsByName.find(channel);
+    if (it == m_channelsByName.end())
     {
-        m_dataChannel->Send(buffer);
+        return absl::nullopt;
     }
+    return it->second->isCompressed();
 }
 
-void DataChannelPeerConnectionHandler::OnDataChannel(rtc::scoped_refptr<webrtc::DataChannelInterface> dataChannel)
+bool DataChannelPeerConnectionHandler::send(const string& channel, const webrtc::DataBuffer& buffer)
 {
-    if (!m_isCaller)
-    {
-        m_dataChannel = dataChannel;
-        m_dataChannel->RegisterObserver(this);
-    }
+    auto it = m_channelsByName.find(channel);
+    return it != m_channelsByName.end() && it->second->send(buffer);
 }
 
-void DataChannelPeerConnectionHandler::OnStateChange()
+bool DataChannelPeerConnectionHandler::sendLatest(const string& channel, string key, const webrtc::DataBuffer& buffer)
 {
-    if (m_dataChannel)
-    {
-        switch (m_dataChannel->state())
-        {
-            case webrtc::DataChannelInterface::kOpen:
-                m_onDataChannelOpen(m_peerClient);
-                m_onDataChannelClosedCalled = false;
-                break;
-            case webrtc::DataChannelInterface::kClosed:
-                if (!m_dataChannel->error().ok())
-                {
-                    m_onDataChannelError(m_peerClient, m_dataChannel->error().message());
-                }
-                m_onDataChannelClosed(m_peerClient);
-                m_onDataChannelClosedCalled = true;
-                break;
-            default:
-                break;
-        }
-    }
+    auto it = m_channelsByName.find(channel);
+    return it != m_channelsByName.end() && it->second->sendLatest(move(key), buffer);
 }
 
-void DataChannelPeerConnectionHandler::OnMessage(const webrtc::DataBuffer& buffer)
+void DataChannelPeerConnectionHandler::OnDataChannel(rtc::scoped_refptr<webrtc::DataChannelInterface> dataChannel)
 {
-    if (buffer.binary)
-    {
-        m_onDataChannelMessageBinary(m_peerClient, buffer);
-    }
-    else if (!buffer.binary)
+    if (!m_isCaller)
     {
-        m_onDataChannelMessageString(m_peerClient, string(buffer.data.data<char>(), buffer.size()));
+        string name = dataChannel->label() == m_room ? "" : dataChannel->label();
+        m_channelsByName[name] = make_unique<Channel>(*this, name, dataChannel);
     }
 }
 
@@ -139,3 +503,23 @@ void DataChannelPeerConnectionHandler::createAnswer()
 
     PeerConnectionHandler::createAnswer();
 }
+
+void DataChannelPeerConnectionHandler::createDataChannel(
+    const string& name,
+    const DataChannelConfiguration& configuration)
+{
+    auto init = static_cast<webrtc::DataChannelInit>(configuration);
+    if (m_isMessageFragmentationEnabled && configuration.ordered() && configuration.isReliable())
+    {
+        init.protocol += DataChannelConfiguration::FragmentedProtocolSuffix;
+    }
+    auto dataChannelOrError = m_peerConnection->CreateDataChannelOrError(name.empty() ? m_room : name, &init);
+    if (dataChannelOrError.ok())
+    {
+        m_channelsByName[name] = make_unique<Channel>(*this, name, dataChannelOrError.MoveValue());
+    }
+    else
+    {
+        m_onError(std::string("CreateDataChannel failed: ") + dataChannelOrError.error().message());
+    }
+}
@@ -1,5 +1,8 @@
 #include <OpenteraWebrtcNativeClient/Handlers/StreamPeerConnectionHandler.h>
 
+#include <absl/strings/match.h>
+#include <media/base/media_constants.h>
+
 #include <functional>
 #include <memory>
 #include <utility>
@@ -12,6 +15,30 @@ using namespace std;
 static constexpr bool OfferToReceiveVideo = true;
 static constexpr bool OfferToReceiveAudio = true;
 
+static void enableOpusStereo(cricket::SessionDescription* description)
+{
+    for (auto& content : description->contents())
+    {
+        auto mediaDescription = content.media_description();
+        auto audioDescription = mediaDescription != nullptr ? mediaDescription->as_audio() : nullptr;
+        if (audioDescription == nullptr)
+        {
+            continue;
+        }
+
+        auto codecs = audioDescription->codecs();
+        for (auto& codec : codecs)
+        {
+            if (absl::EqualsIgnoreCase(codec.name, cricket::kOpusCodecName))
+            {
+                codec.SetParam(cricket::kCodecParamStereo, cricket::kParamValueTrue);
+                codec.SetParam(cricket::kCodecParamSPropStereo, cricket::kParamValueTrue);
+            }
+        }
+        audioDescription->set_codecs(codecs);
+    }
+}
+
 StreamPeerConnectionHandler::StreamPeerConnectionHandler(
     string id,
     Client peerClient,
@@ -27,7 +54,13 @@ StreamPeerConnectionHandler::StreamPeerConnectionHandler(
     function<void(const Client&)> onRemoveRemoteStream,
     const VideoFrameReceivedCallback& onVideoFrameReceived,
     const EncodedVideoFrameReceivedCallback& onEncodedVideoFrameReceived,
-    const AudioFrameReceivedCallback& onAudioFrameReceived)
+    const AudioFrameReceivedCallback& onAudioFrameReceived,
+    const TimestampedAudioFrameReceivedCallback& onTimestampedAudioFrameReceived,
+    const AudioSinkConfiguration& audioSinkConfiguration,
+    const EncodedAudioFrameReceivedCallback& onEncodedAudioFrameReceived,
+    bool isAudioLevelMeteringEnabled,
+    const AudioLevelChangedCallback& onAudioLevelChanged,
+    bool isAudioVideoSynchronizationEnabled)
     : PeerConnectionHandler(
           move(id),
           move(peerClient),
@@ -36,14 +69,46 @@ StreamPeerConnectionHandler::StreamPeerConnectionHandler(
           move(onError),
           move(onClientConnected),
           move(onClientDisconnected)),
-      m_offerToReceiveAudio(hasOnMixedAudioFrameReceivedCallback || onAudioFrameReceived),
+      m_offerToReceiveAudio(
+          hasOnMixedAudioFrameReceivedCallback || onAudioFrameReceived || onTimestampedAudioFrameReceived ||
+          onEncodedAudioFrameReceived || isAudioLevelMeteringEnabled || onAudioLevelChanged),
       m_offerToReceiveVideo(static_cast<bool>(onVideoFrameReceived)),
+      m_remoteAudioGain(1.0),
+      m_isStereoAudioEnabled(false),
       m_videoTrack(move(videoTrack)),
       m_audioTrack(move(audioTrack)),
       m_onAddRemoteStream(move(onAddRemoteStream)),
       m_onRemoveRemoteStream(move(onRemoveRemoteStream))
 {
-    if (onVideoFrameReceived)
+    if (isAudioVideoSynchronizationEnabled && onVideoFrameReceived && onTimestampedAudioFrameReceived)
+    {
+        m_mediaSynchronizer = make_unique<MediaSynchronizer>(
+            [=](const void* audioData,
+                int bitsPerSample,
+                int sampleRate,
+                size_t numberOfChannels,
+                size_t numberOfFrames,
+                uint64_t timestampUs)
+            {
+                onTimestampedAudioFrameReceived(
+                    m_peerClient,
+                    audioData,
+                    bitsPerSample,
+                    sampleRate,
+                    numberOfChannels,
+                    numberOfFrames,
+                    timestampUs);
+            },
+            [=](const cv::Mat& bgrImg, uint64_t timestampUs)
+            { onVideoFrameReceived(m_peerClient, bgrImg, timestampUs); });
+    }
+
+    if (m_mediaSynchronizer != nullptr)
+    {
+        m_videoSink = make_unique<VideoSink>([this](const cv::Mat& bgrImg, uint64_t timestampUs)
+                                             { m_mediaSynchronizer->pushVideo(bgrImg, timestampUs); });
+    }
+    else if (onVideoFrameReceived)
     {
         m_videoSink = make_unique<VideoSink>([=](const cv::Mat& bgrImg, uint64_t timestampUs)
                                              { onVideoFrameReceived(m_peerClient, bgrImg, timestampUs); });
@@ -71,14 +136,28 @@ StreamPeerConnectionHandler::StreamPeerConnectionHandler(
             });
     }
 
-    if (onAudioFrameReceived)
+    bool isDecodedAudioNeeded = hasOnMixedAudioFrameReceivedCallback || onAudioFrameReceived ||
+                                onTimestampedAudioFrameReceived || isAudioLevelMeteringEnabled || onAudioLevelChanged;
+    if (onEncodedAudioFrameReceived)
     {
-        m_audioSink = make_unique<AudioSink>(
-            [=](const void* audioData,
-                int bitsPerSample,
-                int sampleRate,
-                size_t numberOfChannels,
-                size_t numberOfFrames) {
+        m_encodedAudioSink = rtc::scoped_refptr<EncodedAudioSink>(new rtc::RefCountedObject<EncodedAudioSink>(
+            [=](const uint8_t* data, size_t dataSize, size_t numberOfFrames, uint32_t rtpTimestamp)
+            { onEncodedAudioFrameReceived(m_peerClient, data, dataSize, numberOfFrames, rtpTimestamp); },
+            isDecodedAudioNeeded));
+    }
+
+    TimestampedAudioSinkCallback audioSinkCallback;
+    if (onAudioFrameReceived || onTimestampedAudioFrameReceived)
+    {
+        audioSinkCallback = [=](const void* audioData,
+                                int bitsPerSample,
+                                int sampleRate,
+                                size_t numberOfChannels,
+                                size_t numberOfFrames,
+                                uint64_t timestampUs)
+        {
+            if (onAudioFrameReceived)
+            {
                 onAudioFrameReceived(
                     m_peerClient,
                     audioData,
@@ -86,7 +165,43 @@ StreamPeerConnectionHandler::StreamPeerConnectionHandler(
                     sampleRate,
                     numberOfChannels,
                     numberOfFrames);
-            });
+            }
+
+            if (m_mediaSynchronizer != nullptr)
+            {
+                m_mediaSynchronizer
+                    ->pushAudio(audioData, bitsPerSample, sampleRate, numberOfChannels, numberOfFrames, timestampUs);
+            }
+            else if (onTimestampedAudioFrameReceived)
+            {
+                onTimestampedAudioFrameReceived(
+                    m_peerClient,
+                    audioData,
+                    bitsPerSample,
+                    sampleRate,
+                    numberOfChannels,
+                    numberOfFrames,
+                    timestampUs);
+            }
+        };
+    }
+
+    if (isAudioLevelMeteringEnabled || onAudioLevelChanged)
+    {
+        AudioLevelSinkCallback audioLevelSinkCallback;
+        if (onAudioLevelChanged)
+        {
+            audioLevelSinkCallback = [=](const AudioLevel& level) { onAudioLevelChanged(m_peerClient, level); };
+        }
+        m_audioSink = make_unique<AudioSink>(
+            move(audioSinkCallback),
+            move(audioLevelSinkCallback),
+            audioSinkConfiguration);
+    }
+    else if (isDecodedAudioNeeded)
+    {
+        // The sink is also used to record the audio.
+        m_audioSink = make_unique<AudioSink>(move(audioSinkCallback), audioSinkConfiguration);
     }
 }
 
@@ -134,6 +249,37 @@ void StreamPeerConnectionHandler::setAllVideoTracksEnabled(bool enabled)
     setAllLocalTracksEnabled(MediaStreamTrackInterface::kVideoKind, enabled);
 }
 
+void StreamPeerConnectionHandler::setRemoteAudioGain(double gain)
+{
+    m_remoteAudioGain = gain;
+    for (auto& track : m_tracks)
+    {
+        auto audioTrack = dynamic_cast<AudioTrackInterface*>(track.get());
+        if (audioTrack != nullptr && audioTrack->GetSource() != nullptr)
+        {
+            audioTrack->GetSource()->SetVolume(m_remoteAudioGain);
+        }
+    }
+}
+
+void StreamPeerConnectionHandler::setStereoAudioEnabled(bool enabled)
+{
+    m_isStereoAudioEnabled = enabled;
+}
+
+AudioLevel StreamPeerConnectionHandler::audioLevel() const
+{
+    return m_audioSink != nullptr ? m_audioSink->audioLevel() : AudioLevel();
+}
+
+void StreamPeerConnectionHandler::setAudioRecorder(shared_ptr<AudioRecorder> audioRecorder)
+{
+    if (m_audioSink != nullptr)
+    {
+        m_audioSink->setAudioRecorder(move(audioRecorder));
+    }
+}
+
 void StreamPeerConnectionHandler::OnTrack(rtc::scoped_refptr<webrtc::RtpTransceiverInterface> transceiver)
 {
     if (m_tracks.empty())
@@ -157,6 +303,14 @@ void StreamPeerConnectionHandler::OnTrack(rtc::scoped_refptr<webrtc::RtpTranscei
     {
         audioTrack->AddSink(m_audioSink.get());
     }
+    if (audioTrack != nullptr && m_encodedAudioSink != nullptr)
+    {
+        transceiver->receiver()->SetDepacketizerToDecoderFrameTransformer(m_encodedAudioSink);
+    }
+    if (audioTrack != nullptr && audioTrack->GetSource() != nullptr)
+    {
+        audioTrack->GetSource()->SetVolume(m_remoteAudioGain);
+    }
 }
 
 void StreamPeerConnectionHandler::OnRemoveTrack(rtc::scoped_refptr<webrtc::RtpReceiverInterface> receiver)
@@ -184,6 +338,15 @@ void StreamPeerConnectionHandler::OnRemoveTrack(rtc::scoped_refptr<webrtc::RtpRe
     }
 }
 
+void StreamPeerConnectionHandler::OnCreateSessionDescriptionObserverSuccess(SessionDescriptionInterface* desc)
+{
+    if (m_isStereoAudioEnabled)
+    {
+        enableOpusStereo(desc->description());
+    }
+    PeerConnectionHandler::OnCreateSessionDescriptionObserverSuccess(desc);
+}
+
 void StreamPeerConnectionHandler::createAnswer()
 {
     updateTransceiver(cricket::MEDIA_TYPE_VIDEO, m_videoTrack, m_offerToReceiveVideo);
@@ -5,7 +5,8 @@ using namespace opentera;
 using namespace std;
 
 OpenteraAudioDeviceModule::OpenteraAudioDeviceModule()
-    : m_isPlayoutInitialized(false),
+    : m_clock(make_shared<RealTimeAudioClock>()),
+      m_isPlayoutInitialized(false),
       m_isRecordingInitialized(false),
       m_isSpeakerInitialized(false),
       m_isMicrophoneInitialized(false),
@@ -36,6 +37,45 @@ void OpenteraAudioDeviceModule::setOnMixedAudioFrameReceived(const AudioSinkCall
     }
 }
 
+void OpenteraAudioDeviceModule::setMixedAudioRecorder(shared_ptr<AudioRecorder> mixedAudioRecorder)
+{
+    lock_guard<mutex> lock(m_setCallbackMutex);
+    if (m_playoutThreadStopped.load())
+    {
+        m_mixedAudioRecorder = move(mixedAudioRecorder);
+    }
+    else
+    {
+        stopPlayoutThreadIfStarted();
+        m_mixedAudioRecorder = move(mixedAudioRecorder);
+        startPlayoutThreadIfStoppedAndTransportValid();
+    }
+}
+
+/**
+ * @brief Sets the clock that paces the playout (nullptr to use the wall clock).
+ * @param clock The clock
+ */
+void OpenteraAudioDeviceModule::setClock(shared_ptr<AudioClock> clock)
+{
+    if (clock == nullptr)
+    {
+        clock = make_shared<RealTimeAudioClock>();
+    }
+
+    lock_guard<mutex> lock(m_setCallbackMutex);
+    if (m_playoutThreadStopped.load())
+    {
+        m_clock = move(clock);
+    }
+    else
+    {
+        stopPlayoutThreadIfStarted();
+        m_clock = move(clock);
+        startPlayoutThreadIfStoppedAndTransportValid();
+    }
+}
+
 void OpenteraAudioDeviceModule::sendFrame(
     const void* audioData,
     int bitsPerSample,
@@ -428,6 +468,7 @@ void OpenteraAudioDeviceModule::stopPlayoutThreadIfStarted()
     if (!m_playoutThreadStopped.load() && m_thread != nullptr)
     {
         m_playoutThreadStopped.store(true);
+        m_clock->wakeUp();
         m_thread->join();
         m_thread = nullptr;
     }
@@ -458,7 +499,7 @@ void OpenteraAudioDeviceModule::run()
     int64_t lastElapsedTime = -1;
 
     vector<uint8_t> data(NSamples * NBytesPerSample * NChannels, 0);
-    auto start = chrono::steady_clock::now();
+    auto start = m_clock->now();
     while (!m_playoutThreadStopped.load())
     {
         int32_t result = m_audioTransport->NeedMorePlayData(
@@ -473,7 +514,7 @@ void OpenteraAudioDeviceModule::run()
 
         if (elapsedTimeMs > -1 && lastElapsedTime == -1)
         {
-            start = chrono::steady_clock::now();
+            start = m_clock->now();
             counter = 0;
         }
         ++counter;
@@ -483,15 +524,19 @@ void OpenteraAudioDeviceModule::run()
         {
             m_onMixedAudioFrameReceived(data.data(), 8 * NBytesPerSample, SamplesPerSec, NChannels, nSamplesOut);
         }
+        if (result == 0 && elapsedTimeMs != -1 && m_mixedAudioRecorder)
+        {
+            m_mixedAudioRecorder->write(data.data(), 8 * NBytesPerSample, SamplesPerSec, NChannels, nSamplesOut);
+        }
 
         if (elapsedTimeMs == -1)
         {
-            this_thread::sleep_for(FrameDuration);
+            m_clock->sleepUntil(m_clock->now() + FrameDuration);
         }
         else
         {
             auto sleep_duration = chrono::duration_cast<chrono::milliseconds>(counter * FrameDuration);
-            this_thread::sleep_until(start + sleep_duration);
+            m_clock->sleepUntil(start + sleep_duration);
         }
     }
 }
@@ -0,0 +1,464 @@
+#include <OpenteraWebrtcNativeClient/OpenteraAudioEncoderFactory.h>
+#include <OpenteraWebrtcNativeClient/Utils/OpusPacket.h>
+
+#include <absl/strings/match.h>
+#include <api/audio_codecs/builtin_audio_encoder_factory.h>
+#include <api/audio_codecs/opus/audio_encoder_opus.h>
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+
+using namespace opentera;
+using namespace std;
+
+namespace opentera
+{
+    class OpusEncoderConfigurationState
+    {
+        mutable mutex m_mutex;
+        OpusEncoderConfiguration m_configuration;
+        atomic<uint64_t> m_version;
+
+    public:
+        OpusEncoderConfigurationState() : m_configuration(OpusEncoderConfiguration::create()), m_version(0) {}
+
+        OpusEncoderConfiguration configuration() const
+        {
+            lock_guard<mutex> lock(m_mutex);
+            return m_configuration;
+        }
+
+        void setConfiguration(const OpusEncoderConfiguration& configuration)
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_configuration = configuration;
+            m_version.fetch_add(1);
+        }
+
+        uint64_t version() const { return m_version.load(); }
+    };
+}
+
+/**
+ * @brief Opus encoder that is recreated with the current OpusEncoderConfiguration when it changes.
+ *
+ * The encoder is only replaced at a packet boundary, so no buffered audio is lost. The values set by the call
+ * (bandwidth targets, network statistics, overhead, frame length range, FEC, DTX, application, maximum playback
+ * rate and audio network adaptor) are applied again to the new encoder, except the FEC and DTX values that the
+ * configuration sets. The bitrate targets of the bandwidth estimation are capped to the configured bitrate.
+ */
+class ConfigurableOpusEncoder : public webrtc::AudioEncoder
+{
+    shared_ptr<OpusEncoderConfigurationState> m_configurationState;
+    int m_payloadType;
+    webrtc::AudioEncoderOpusConfig m_negotiatedConfig;
+    absl::optional<webrtc::AudioCodecPairId> m_codecPairId;
+
+    uint64_t m_configurationVersion;
+    unique_ptr<webrtc::AudioEncoder> m_encoder;
+    size_t m_bufferedFrameCount;
+
+    absl::optional<int> m_configuredBitrateBps;
+    absl::optional<bool> m_isConfiguredFecEnabled;
+    absl::optional<bool> m_isConfiguredDtxEnabled;
+
+    absl::optional<int> m_targetAudioBitrateBps;
+    absl::optional<pair<int, absl::optional<int64_t>>> m_uplinkBandwidth;
+    absl::optional<webrtc::BitrateAllocationUpdate> m_uplinkAllocation;
+    absl::optional<float> m_uplinkPacketLossFraction;
+    absl::optional<int> m_rttMs;
+    absl::optional<size_t> m_overheadBytesPerPacket;
+    absl::optional<pair<int, int>> m_receiverFrameLengthRangeMs;
+    absl::optional<bool> m_isFecEnabled;
+    absl::optional<bool> m_isDtxEnabled;
+    absl::optional<Application> m_application;
+    absl::optional<int> m_maxPlaybackRateHz;
+    absl::optional<pair<string, webrtc::RtcEventLog*>> m_audioNetworkAdaptor;
+
+public:
+    ConfigurableOpusEncoder(
+        shared_ptr<OpusEncoderConfigurationState> configurationState,
+        int payloadType,
+        const webrtc::AudioEncoderOpusConfig& negotiatedConfig,
+        absl::optional<webrtc::AudioCodecPairId> codecPairId)
+        : m_configurationState(move(configurationState)),
+          m_payloadType(payloadType),
+          m_negotiatedConfig(negotiatedConfig),
+          m_codecPairId(codecPairId),
+          m_configurationVersion(m_configurationState->version()),
+          m_bufferedFrameCount(0)
+    {
+        m_encoder = makeEncoder();
+    }
+
+    int SampleRateHz() const override { return m_encoder->SampleRateHz(); }
+    size_t NumChannels() const override { return m_encoder->NumChannels(); }
+    int RtpTimestampRateHz() const override { return m_encoder->RtpTimestampRateHz(); }
+    size_t Num10MsFramesInNextPacket() const override { return m_encoder->Num10MsFramesInNextPacket(); }
+    size_t Max10MsFramesInAPacket() const override { return m_encoder->Max10MsFramesInAPacket(); }
+    int GetTargetBitrate() const override { return m_encoder->GetTargetBitrate(); }
+
+    void Reset() override
+    {
+        m_encoder->Reset();
+        m_bufferedFrameCount = 0;
+    }
+
+    bool SetFec(bool enable) override
+    {
+        m_isFecEnabled = enable;
+        return m_encoder->SetFec(enable);
+    }
+    bool SetDtx(bool enable) override
+    {
+        m_isDtxEnabled = enable;
+        return m_encoder->SetDtx(enable);
+    }
+    bool GetDtx() const override { return m_encoder->GetDtx(); }
+    bool SetApplication(Application application) override
+    {
+        m_application = application;
+        return m_encoder->SetApplication(application);
+    }
+    void SetMaxPlaybackRate(int frequencyHz) override
+    {
+        m_maxPlaybackRateHz = frequencyHz;
+        m_encoder->SetMaxPlaybackRate(frequencyHz);
+    }
+
+    bool EnableAudioNetworkAdaptor(const string& configString, webrtc::RtcEventLog* eventLog) override
+    {
+        bool isEnabled = m_encoder->EnableAudioNetworkAdaptor(configString, eventLog);
+        if (isEnabled)
+        {
+            m_audioNetworkAdaptor = make_pair(configString, eventLog);
+        }
+        return isEnabled;
+    }
+    void DisableAudioNetworkAdaptor() override
+    {
+        m_audioNetworkAdaptor = absl::nullopt;
+        m_encoder->DisableAudioNetworkAdaptor();
+    }
+
+    void OnReceivedUplinkPacketLossFraction(float uplinkPacketLossFraction) override
+    {
+        m_uplinkPacketLossFraction = uplinkPacketLossFraction;
+        m_encoder->OnReceivedUplinkPacketLossFraction(uplinkPacketLossFraction);
+    }
+    void OnReceivedTargetAudioBitrate(int targetBps) override
+    {
+        m_targetAudioBitrateBps = targetBps;
+        m_encoder->OnReceivedTargetAudioBitrate(capBitrate(targetBps));
+    }
+    void OnReceivedUplinkBandwidth(int targetAudioBitrateBps, absl::optional<int64_t> bwePeriodMs) override
+    {
+        m_uplinkBandwidth = make_pair(targetAudioBitrateBps, bwePeriodMs);
+        m_encoder->OnReceivedUplinkBandwidth(capBitrate(targetAudioBitrateBps), bwePeriodMs);
+    }
+    void OnReceivedUplinkAllocation(webrtc::BitrateAllocationUpdate update) override
+    {
+        m_uplinkAllocation = update;
+        m_encoder->OnReceivedUplinkAllocation(capBitrate(update));
+    }
+    void OnReceivedRtt(int rttMs) override
+    {
+        m_rttMs = rttMs;
+        m_encoder->OnReceivedRtt(rttMs);
+    }
+    void OnReceivedOverhead(size_t overheadBytesPerPacket) override
+    {
+        m_overheadBytesPerPacket = overheadBytesPerPacket;
+        m_encoder->OnReceivedOverhead(overheadBytesPerPacket);
+    }
+    void SetReceiverFrameLengthRange(int minFrameLengthMs, int maxFrameLengthMs) override
+    {
+        m_receiverFrameLengthRangeMs = make_pair(minFrameLengthMs, maxFrameLengthMs);
+        m_encoder->SetReceiverFrameLengthRange(minFrameLengthMs, maxFrameLengthMs);
+    }
+
+    webrtc::ANAStats GetANAStats() const override { return m_encoder->GetANAStats(); }
+    absl::optional<pair<webrtc::TimeDelta, webrtc::TimeDelta>> GetFrameLengthRange() const override
+    {
+        return m_encoder->GetFrameLengthRange();
+    }
+
+protected:
+    EncodedInfo EncodeImpl(uint32_t rtpTimestamp, rtc::ArrayView<const int16_t> audio, rtc::Buffer* encoded) override
+    {
+        if (m_bufferedFrameCount == 0 && m_configurationVersion != m_configurationState->version())
+        {
+            m_configurationVersion = m_configurationState->version();
+            auto encoder = makeEncoder();
+            if (encoder != nullptr)
+            {
+                m_encoder = move(encoder);
+            }
+        }
+
+        size_t frameCountInPacket = m_encoder->Num10MsFramesInNextPacket();
+        EncodedInfo info = m_encoder->Encode(rtpTimestamp, audio, encoded);
+
+        m_bufferedFrameCount++;
+        if (m_bufferedFrameCount >= frameCountInPacket)
+        {
+            m_bufferedFrameCount = 0;
+        }
+        return info;
+    }
+
+private:
+    unique_ptr<webrtc::AudioEncoder> makeEncoder()
+    {
+        auto configuration = m_configurationState->configuration();
+        auto config = configuration.apply(m_negotiatedConfig);
+        auto encoder = webrtc::AudioEncoderOpus::MakeAudioEncoder(config, m_payloadType, m_codecPairId);
+        if (encoder == nullptr)
+        {
+            return nullptr;
+        }
+
+        m_configuredBitrateBps = absl::nullopt;
+        if (configuration.bitrateBps().has_value())
+        {
+            m_configuredBitrateBps = config.bitrate_bps;
+        }
+        m_isConfiguredFecEnabled = configuration.inbandFec();
+        m_isConfiguredDtxEnabled = configuration.dtx();
+        applyCallState(*encoder);
+        return encoder;
+    }
+
+    void applyCallState(webrtc::AudioEncoder& encoder) const
+    {
+        if (m_application.has_value())
+        {
+            encoder.SetApplication(m_application.value());
+        }
+        if (m_isFecEnabled.has_value() && !m_isConfiguredFecEnabled.has_value())
+        {
+            encoder.SetFec(m_isFecEnabled.value());
+        }
+        if (m_isDtxEnabled.has_value() && !m_isConfiguredDtxEnabled.has_value())
+        {
+            encoder.SetDtx(m_isDtxEnabled.value());
+        }
+        if (m_maxPlaybackRateHz.has_value())
+        {
+            encoder.SetMaxPlaybackRate(m_maxPlaybackRateHz.value());
+        }
+        if (m_receiverFrameLengthRangeMs.has_value())
+        {
+            encoder.SetReceiverFrameLengthRange(
+                m_receiverFrameLengthRangeMs.value().first,
+                m_receiverFrameLengthRangeMs.value().second);
+        }
+        if (m_audioNetworkAdaptor.has_value())
+        {
+            encoder.EnableAudioNetworkAdaptor(
+                m_audioNetworkAdaptor.value().first,
+                m_audioNetworkAdaptor.value().second);
+        }
+        if (m_overheadBytesPerPacket.has_value())
+        {
+            encoder.OnReceivedOverhead(m_overheadBytesPerPacket.value());
+        }
+        if (m_rttMs.has_value())
+        {
+            encoder.OnReceivedRtt(m_rttMs.value());
+        }
+        if (m_uplinkPacketLossFraction.has_value())
+        {
+            encoder.OnReceivedUplinkPacketLossFraction(m_uplinkPacketLossFraction.value());
+        }
+        if (m_targetAudioBitrateBps.has_value())
+        {
+            encoder.OnReceivedTargetAudioBitrate(capBitrate(m_targetAudioBitrateBps.value()));
+        }
+        if (m_uplinkBandwidth.has_value())
+        {
+            encoder.OnReceivedUplinkBandwidth(
+                capBitrate(m_uplinkBandwidth.value().first),
+                m_uplinkBandwidth.value().second);
+        }
+        if (m_uplinkAllocation.has_value())
+        {
+            encoder.OnReceivedUplinkAllocation(capBitrate(m_uplinkAllocation.value()));
+        }
+    }
+
+    int capBitrate(int bitrateBps) const
+    {
+        return m_configuredBitrateBps.has_value() ? min(bitrateBps, m_configuredBitrateBps.value()) : bitrateBps;
+    }
+
+    webrtc::BitrateAllocationUpdate capBitrate(webrtc::BitrateAllocationUpdate update) const
+    {
+        if (m_configuredBitrateBps.has_value())
+        {
+            auto configuredBitrate = webrtc::DataRate::BitsPerSec(m_configuredBitrateBps.value());
+            update.target_bitrate = min(update.target_bitrate, configuredBitrate);
+            update.stable_target_bitrate = min(update.stable_target_bitrate, configuredBitrate);
+        }
+        return update;
+    }
+};
+
+/**
+ * @brief Opus encoder that sends the packets of an EncodedAudioSource instead of encoding the audio.
+ *
+ * The audio frames only pace the packets: a packet is sent once the audio frames covering its duration are
+ * received. No packet is sent while the source queue is empty, like with the discontinuous transmission.
+ */
+class PassThroughOpusEncoder : public webrtc::AudioEncoder
+{
+    static constexpr int DefaultBitrateBps = 32000;
+    static constexpr size_t FrameCountPer10Ms = OpusPacket::SampleRate / 100;
+    static constexpr size_t DefaultNumberOf10MsFrames = 2;
+
+    shared_ptr<EncodedAudioSource> m_encodedAudioSource;
+    EncodedAudioFrameQueue m_queue;
+    int m_payloadType;
+    size_t m_numberOfChannels;
+    int m_targetBitrateBps;
+
+    vector<uint8_t> m_frame;
+    uint32_t m_frameRtpTimestamp;
+    size_t m_frameNumberOf10MsFrames;
+    size_t m_remainingNumberOf10MsFrames;
+
+public:
+    PassThroughOpusEncoder(
+        shared_ptr<EncodedAudioSource> encodedAudioSource,
+        int payloadType,
+        const webrtc::AudioEncoderOpusConfig& negotiatedConfig)
+        : m_encodedAudioSource(move(encodedAudioSource)),
+          m_payloadType(payloadType),
+          m_numberOfChannels(negotiatedConfig.num_channels),
+          m_targetBitrateBps(negotiatedConfig.bitrate_bps.value_or(DefaultBitrateBps)),
+          m_frameRtpTimestamp(0),
+          m_frameNumberOf10MsFrames(DefaultNumberOf10MsFrames),
+          m_remainingNumberOf10MsFrames(0)
+    {
+        m_encodedAudioSource->addEncodedAudioFrameQueue(&m_queue);
+    }
+
+    ~PassThroughOpusEncoder() override { m_encodedAudioSource->removeEncodedAudioFrameQueue(&m_queue); }
+
+    int SampleRateHz() const override { return OpusPacket::SampleRate; }
+    size_t NumChannels() const override { return m_numberOfChannels; }
+    size_t Num10MsFramesInNextPacket() const override { return m_frameNumberOf10MsFrames; }
+    size_t Max10MsFramesInAPacket() const override { return OpusPacket::MaxNumberOfFrames / FrameCountPer10Ms; }
+    int GetTargetBitrate() const override { return m_targetBitrateBps; }
+
+    void Reset() override { m_remainingNumberOf10MsFrames = 0; }
+
+    absl::optional<pair<webrtc::TimeDelta, webrtc::TimeDelta>> GetFrameLengthRange() const override
+    {
+        return make_pair(
+            webrtc::TimeDelta::Millis(10),
+            webrtc::TimeDelta::Millis(OpusPacket::MaxNumberOfFrames * 1000 / OpusPacket::SampleRate));
+    }
+
+protected:
+    EncodedInfo EncodeImpl(uint32_t rtpTimestamp, rtc::ArrayView<const int16_t> audio, rtc::Buffer* encoded) override
+    {
+        if (m_remainingNumberOf10MsFrames == 0)
+        {
+            if (!m_queue.pop(m_frame))
+            {
+                return EncodedInfo();
+            }
+            m_frameRtpTimestamp = rtpTimestamp;
+            m_frameNumberOf10MsFrames = OpusPacket::numberOfFrames(m_frame.data(), m_frame.size()) / FrameCountPer10Ms;
+            m_remainingNumberOf10MsFrames = m_frameNumberOf10MsFrames;
+        }
+
+        m_remainingNumberOf10MsFrames--;
+        if (m_remainingNumberOf10MsFrames > 0)
+        {
+            return EncodedInfo();
+        }
+
+        encoded->AppendData(m_frame.data(), m_frame.size());
+
+        EncodedInfo info;
+        info.encoded_bytes = m_frame.size();
+        info.encoded_timestamp = m_frameRtpTimestamp;
+        info.payload_type = m_payloadType;
+        info.send_even_if_empty = true;
+        info.speech = true;
+        info.encoder_type = CodecType::kOpus;
+        return info;
+    }
+};
+
+OpenteraAudioEncoderFactory::OpenteraAudioEncoderFactory()
+    : m_builtinAudioEncoderFactory(webrtc::CreateBuiltinAudioEncoderFactory()),
+      m_opusEncoderConfigurationState(make_shared<OpusEncoderConfigurationState>())
+{
+}
+
+/**
+ * @brief Returns the configuration applied to the Opus encoders.
+ * @return The configuration applied to the Opus encoders
+ */
+OpusEncoderConfiguration OpenteraAudioEncoderFactory::opusEncoderConfiguration() const
+{
+    return m_opusEncoderConfigurationState->configuration();
+}
+
+/**
+ * @brief Sets the configuration applied to the current and future Opus encoders.
+ * @param configuration The configuration
+ */
+void OpenteraAudioEncoderFactory::setOpusEncoderConfiguration(const OpusEncoderConfiguration& configuration)
+{
+    m_opusEncoderConfigurationState->setConfiguration(configuration);
+}
+
+/**
+ * @brief Sets the source of the Opus packets sent by the future Opus encoders (nullptr to encode the audio).
+ * @param encodedAudioSource The encoded audio source
+ */
+void OpenteraAudioEncoderFactory::setEncodedAudioSource(shared_ptr<EncodedAudioSource> encodedAudioSource)
+{
+    m_encodedAudioSource = move(encodedAudioSource);
+}
+
+vector<webrtc::AudioCodecSpec> OpenteraAudioEncoderFactory::GetSupportedEncoders()
+{
+    return m_builtinAudioEncoderFactory->GetSupportedEncoders();
+}
+
+absl::optional<webrtc::AudioCodecInfo>
+    OpenteraAudioEncoderFactory::QueryAudioEncoder(const webrtc::SdpAudioFormat& format)
+{
+    return m_builtinAudioEncoderFactory->QueryAudioEncoder(format);
+}
+
+unique_ptr<webrtc::AudioEncoder> OpenteraAudioEncoderFactory::MakeAudioEncoder(
+    int payloadType,
+    const webrtc::SdpAudioFormat& format,
+    absl::optional<webrtc::AudioCodecPairId> codecPairId)
+{
+    if (absl::EqualsIgnoreCase(format.name, "opus"))
+    {
+        auto config = webrtc::AudioEncoderOpus::SdpToConfig(format);
+        if (config.has_value() && m_encodedAudioSource != nullptr)
+        {
+            return make_unique<PassThroughOpusEncoder>(m_encodedAudioSource, payloadType, config.value());
+        }
+        else if (config.has_value())
+        {
+            return make_unique<ConfigurableOpusEncoder>(
+                m_opusEncoderConfigurationState,
+                payloadType,
+                config.value(),
+                codecPairId);
+        }
+    }
+
+    return m_builtinAudioEncoderFactory->MakeAudioEncoder(payloadType, format, codecPairId);
+}
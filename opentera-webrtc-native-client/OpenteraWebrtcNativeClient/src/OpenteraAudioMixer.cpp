@@ -0,0 +1,196 @@
+#include <OpenteraWebrtcNativeClient/OpenteraAudioMixer.h>
+
+#include <modules/audio_mixer/audio_frame_manipulator.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+using namespace opentera;
+using namespace std;
+
+constexpr int FrameDurationMs = 10;
+constexpr int DefaultOutputSampleRate = 48000;
+constexpr int NativeSampleRates[] = {8000, 16000, 32000, 48000};
+
+static double meanSquare(const webrtc::AudioFrame& frame)
+{
+    size_t sampleCount = frame.samples_per_channel_ * frame.num_channels_;
+    if (sampleCount == 0)
+    {
+        return 0.0;
+    }
+
+    const int16_t* data = frame.data();
+    int64_t energy = 0;
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        energy += static_cast<int32_t>(data[i]) * static_cast<int32_t>(data[i]);
+    }
+    return static_cast<double>(energy) / static_cast<double>(sampleCount);
+}
+
+static double dbfsToMeanSquare(float dbfs)
+{
+    double rms = numeric_limits<int16_t>::max() * pow(10.0, dbfs / 20.0);
+    return rms * rms;
+}
+
+OpenteraAudioMixer::OpenteraAudioMixer(size_t maxMixedSourceCount, float silenceThresholdDbfs)
+    : m_maxMixedSourceCount(maxMixedSourceCount),
+      m_silenceThresholdDbfs(silenceThresholdDbfs),
+      m_mixingBuffer{}
+{
+}
+
+bool OpenteraAudioMixer::AddSource(Source* source)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = find_if(
+        m_sourceStates.begin(),
+        m_sourceStates.end(),
+        [source](const unique_ptr<SourceState>& state) { return state->source == source; });
+    if (it != m_sourceStates.end())
+    {
+        return false;
+    }
+
+    auto state = make_unique<SourceState>();
+    state->source = source;
+    state->energy = 0.0;
+    m_sourceStates.emplace_back(move(state));
+    m_activeSourceStates.reserve(m_sourceStates.size());
+    return true;
+}
+
+void OpenteraAudioMixer::RemoveSource(Source* source)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_sourceStates.erase(
+        remove_if(
+            m_sourceStates.begin(),
+            m_sourceStates.end(),
+            [source](const unique_ptr<SourceState>& state) { return state->source == source; }),
+        m_sourceStates.end());
+}
+
+void OpenteraAudioMixer::Mix(size_t numberOfChannels, webrtc::AudioFrame* audioFrameForMixing)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    int sampleRate = calculateOutputSampleRate();
+    size_t samplesPerChannel = static_cast<size_t>(sampleRate * FrameDurationMs / 1000);
+    double silenceThreshold = dbfsToMeanSquare(m_silenceThresholdDbfs.load());
+
+    m_activeSourceStates.clear();
+    const webrtc::AudioFrame* timingFrame = nullptr;
+    for (auto& state : m_sourceStates)
+    {
+        auto info = state->source->GetAudioFrameWithInfo(sampleRate, &state->frame);
+        if (info != Source::AudioFrameInfo::kNormal || state->frame.muted() ||
+            state->frame.samples_per_channel_ != samplesPerChannel)
+        {
+            continue;
+        }
+        if (timingFrame == nullptr)
+        {
+            timingFrame = &state->frame;
+        }
+
+        state->energy = meanSquare(state->frame);
+        if (state->energy >= silenceThreshold)
+        {
+            m_activeSourceStates.push_back(state.get());
+        }
+    }
+
+    size_t mixedSourceCount = min(m_maxMixedSourceCount.load(), m_activeSourceStates.size());
+    partial_sort(
+        m_activeSourceStates.begin(),
+        m_activeSourceStates.begin() + mixedSourceCount,
+        m_activeSourceStates.end(),
+        [](const SourceState* a, const SourceState* b) { return a->energy > b->energy; });
+
+    audioFrameForMixing->UpdateFrame(
+        0,
+        nullptr,
+        samplesPerChannel,
+        sampleRate,
+        webrtc::AudioFrame::kNormalSpeech,
+        webrtc::AudioFrame::kVadUnknown,
+        numberOfChannels);
+    mixActiveSources(mixedSourceCount, audioFrameForMixing);
+
+    if (mixedSourceCount > 0)
+    {
+        timingFrame = &m_activeSourceStates.front()->frame;
+    }
+
+    // A silent but unmuted source still keeps the playout timing alive.
+    if (timingFrame == nullptr)
+    {
+        audioFrameForMixing->elapsed_time_ms_ = -1;
+        audioFrameForMixing->ntp_time_ms_ = -1;
+    }
+    else
+    {
+        audioFrameForMixing->timestamp_ = timingFrame->timestamp_;
+        audioFrameForMixing->elapsed_time_ms_ = timingFrame->elapsed_time_ms_;
+        audioFrameForMixing->ntp_time_ms_ = timingFrame->ntp_time_ms_;
+    }
+}
+
+int OpenteraAudioMixer::calculateOutputSampleRate()
+{
+    int preferredSampleRate = 0;
+    for (auto& state : m_sourceStates)
+    {
+        preferredSampleRate = max(preferredSampleRate, state->source->PreferredSampleRate());
+    }
+
+    if (preferredSampleRate == 0)
+    {
+        return DefaultOutputSampleRate;
+    }
+    for (int sampleRate : NativeSampleRates)
+    {
+        if (sampleRate >= preferredSampleRate)
+        {
+            return sampleRate;
+        }
+    }
+    return DefaultOutputSampleRate;
+}
+
+void OpenteraAudioMixer::mixActiveSources(size_t mixedSourceCount, webrtc::AudioFrame* audioFrameForMixing)
+{
+    if (mixedSourceCount == 0)
+    {
+        return;
+    }
+
+    size_t numberOfChannels = audioFrameForMixing->num_channels_;
+    size_t sampleCount = audioFrameForMixing->samples_per_channel_ * numberOfChannels;
+    fill_n(m_mixingBuffer.begin(), sampleCount, 0);
+
+    for (size_t i = 0; i < mixedSourceCount; i++)
+    {
+        webrtc::AudioFrame& frame = m_activeSourceStates[i]->frame;
+        webrtc::RemixFrame(numberOfChannels, &frame);
+
+        const int16_t* data = frame.data();
+        for (size_t j = 0; j < sampleCount; j++)
+        {
+            m_mixingBuffer[j] += data[j];
+        }
+    }
+
+    int16_t* mixedData = audioFrameForMixing->mutable_data();
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        mixedData[i] = static_cast<int16_t>(clamp<int32_t>(
+            m_mixingBuffer[i],
+            numeric_limits<int16_t>::min(),
+            numeric_limits<int16_t>::max()));
+    }
+}
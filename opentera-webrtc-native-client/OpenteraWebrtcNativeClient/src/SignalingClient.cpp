@@ -1,10 +1,14 @@
 #include <OpenteraWebrtcNativeClient/SignalingClient.h>
 
 #include <api/audio_codecs/builtin_audio_decoder_factory.h>
-#include <api/audio_codecs/builtin_audio_encoder_factory.h>
+#include <api/call/call_factory_interface.h>
 #include <api/create_peerconnection_factory.h>
+#include <api/rtc_event_log/rtc_event_log_factory.h>
+#include <api/task_queue/default_task_queue_factory.h>
+#include <api/transport/field_trial_based_config.h>
 #include <api/video_codecs/builtin_video_decoder_factory.h>
 #include <api/video_codecs/builtin_video_encoder_factory.h>
+#include <media/engine/webrtc_media_engine.h>
 
 using namespace opentera;
 using namespace std;
@@ -31,12 +35,50 @@ using namespace std;
 
 constexpr int SignalingProtocolVersion = 1;
 
+// webrtc::CreatePeerConnectionFactory replaces a null audio processing by the default one, so the media engine is
+// created here to allow the audio processing to be bypassed.
+static rtc::scoped_refptr<webrtc::PeerConnectionFactoryInterface> createPeerConnectionFactory(
+    rtc::Thread* networkThread,
+    rtc::Thread* workerThread,
+    rtc::Thread* signalingThread,
+    rtc::scoped_refptr<webrtc::AudioDeviceModule> audioDeviceModule,
+    rtc::scoped_refptr<webrtc::AudioEncoderFactory> audioEncoderFactory,
+    rtc::scoped_refptr<webrtc::AudioMixer> audioMixer,
+    rtc::scoped_refptr<webrtc::AudioProcessing> audioProcessing)
+{
+    webrtc::PeerConnectionFactoryDependencies dependencies;
+    dependencies.network_thread = networkThread;
+    dependencies.worker_thread = workerThread;
+    dependencies.signaling_thread = signalingThread;
+    dependencies.task_queue_factory = webrtc::CreateDefaultTaskQueueFactory();
+    dependencies.call_factory = webrtc::CreateCallFactory();
+    dependencies.event_log_factory = make_unique<webrtc::RtcEventLogFactory>(dependencies.task_queue_factory.get());
+    dependencies.trials = make_unique<webrtc::FieldTrialBasedConfig>();
+
+    cricket::MediaEngineDependencies mediaDependencies;
+    mediaDependencies.task_queue_factory = dependencies.task_queue_factory.get();
+    mediaDependencies.adm = move(audioDeviceModule);
+    mediaDependencies.audio_encoder_factory = move(audioEncoderFactory);
+    mediaDependencies.audio_decoder_factory = webrtc::CreateBuiltinAudioDecoderFactory();
+    mediaDependencies.audio_mixer = move(audioMixer);
+    mediaDependencies.audio_processing = move(audioProcessing);
+    mediaDependencies.video_encoder_factory = webrtc::CreateBuiltinVideoEncoderFactory();
+    mediaDependencies.video_decoder_factory = webrtc::CreateBuiltinVideoDecoderFactory();
+    mediaDependencies.trials = dependencies.trials.get();
+    dependencies.media_engine = cricket::CreateMediaEngine(move(mediaDependencies));
+
+    return webrtc::CreateModularPeerConnectionFactory(move(dependencies));
+}
+
 SignalingClient::SignalingClient(
     SignalingServerConfiguration&& signalingServerConfiguration,
-    WebrtcConfiguration&& webrtcConfiguration)
+    WebrtcConfiguration&& webrtcConfiguration,
+    rtc::scoped_refptr<webrtc::AudioMixer> audioMixer,
+    bool isAudioProcessingEnabled)
     : m_signalingServerConfiguration(move(signalingServerConfiguration)),
       m_webrtcConfiguration(move(webrtcConfiguration)),
-      m_hasClosePending(false)
+      m_hasClosePending(false),
+      m_audioMixer(move(audioMixer))
 {
     constexpr int ReconnectAttempts = 10;
     m_sio.set_reconnect_attempts(ReconnectAttempts);
@@ -57,17 +99,23 @@ SignalingClient::SignalingClient(
 
     m_audioDeviceModule =
         rtc::scoped_refptr<OpenteraAudioDeviceModule>(new rtc::RefCountedObject<OpenteraAudioDeviceModule>);
-    m_audioProcessing = webrtc::AudioProcessingBuilder().Create();
-    m_peerConnectionFactory = webrtc::CreatePeerConnectionFactory(
+    if (!m_audioMixer)
+    {
+        m_audioMixer = rtc::scoped_refptr<OpenteraAudioMixer>(new rtc::RefCountedObject<OpenteraAudioMixer>);
+    }
+    if (isAudioProcessingEnabled)
+    {
+        m_audioProcessing = webrtc::AudioProcessingBuilder().Create();
+    }
+    m_audioEncoderFactory =
+        rtc::scoped_refptr<OpenteraAudioEncoderFactory>(new rtc::RefCountedObject<OpenteraAudioEncoderFactory>);
+    m_peerConnectionFactory = createPeerConnectionFactory(
         m_networkThread.get(),
         m_workerThread.get(),
         m_signalingThread.get(),
         m_audioDeviceModule,
-        webrtc::CreateBuiltinAudioEncoderFactory(),
-        webrtc::CreateBuiltinAudioDecoderFactory(),
-        webrtc::CreateBuiltinVideoEncoderFactory(),
-        webrtc::CreateBuiltinVideoDecoderFactory(),
-        nullptr,  // Audio mixer,
+        m_audioEncoderFactory,
+        m_audioMixer,
         m_audioProcessing);
 
     if (!m_peerConnectionFactory)
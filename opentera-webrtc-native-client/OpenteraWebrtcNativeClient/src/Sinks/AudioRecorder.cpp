@@ -0,0 +1,656 @@
+#include <OpenteraWebrtcNativeClient/Sinks/AudioRecorder.h>
+#include <OpenteraWebrtcNativeClient/Utils/OpusPacket.h>
+
+#include <api/audio_codecs/opus/audio_encoder_opus.h>
+#include <common_audio/resampler/include/push_resampler.h>
+#include <rtc_base/buffer.h>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+constexpr size_t FileBufferSize = 1 << 18;
+constexpr chrono::milliseconds FlushPeriod = 250ms;
+
+struct opentera::AudioChunkHeader
+{
+    int bitsPerSample;
+    int sampleRate;
+    size_t numberOfChannels;
+    size_t numberOfFrames;
+    size_t dataSize;
+    bool isEncoded;
+};
+
+static void appendLittleEndian(vector<uint8_t>& buffer, uint64_t value, size_t byteCount)
+{
+    for (size_t i = 0; i < byteCount; i++)
+    {
+        buffer.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+}
+
+static void appendString(vector<uint8_t>& buffer, const char* value)
+{
+    buffer.insert(buffer.end(), value, value + strlen(value));
+}
+
+class opentera::AudioFileWriter
+{
+    vector<char> m_fileBuffer;
+
+protected:
+    ofstream m_file;
+
+public:
+    explicit AudioFileWriter(const string& path) : m_fileBuffer(FileBufferSize)
+    {
+        m_file.rdbuf()->pubsetbuf(m_fileBuffer.data(), m_fileBuffer.size());
+        m_file.open(path, ios::binary | ios::trunc);
+        if (!m_file.is_open())
+        {
+            throw runtime_error("Unable to open the recording file: " + path);
+        }
+    }
+
+    virtual ~AudioFileWriter() = default;
+
+    DECLARE_NOT_COPYABLE(AudioFileWriter);
+    DECLARE_NOT_MOVABLE(AudioFileWriter);
+
+    virtual bool write(const AudioChunkHeader& header, const uint8_t* data) = 0;
+    virtual void close() = 0;
+
+protected:
+    void writeBuffer(const vector<uint8_t>& buffer)
+    {
+        m_file.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+    }
+};
+
+class WavFileWriter : public AudioFileWriter
+{
+    static constexpr size_t HeaderSize = 44;
+
+    bool m_isHeaderWritten;
+    AudioChunkHeader m_format;
+    uint32_t m_dataSize;
+    vector<uint8_t> m_buffer;
+
+public:
+    explicit WavFileWriter(const string& path)
+        : AudioFileWriter(path),
+          m_isHeaderWritten(false),
+          m_format{},
+          m_dataSize(0)
+    {
+    }
+
+    bool write(const AudioChunkHeader& header, const uint8_t* data) override
+    {
+        if (header.isEncoded)
+        {
+            return false;
+        }
+
+        if (!m_isHeaderWritten)
+        {
+            m_format = header;
+            writeHeader();
+        }
+        else if (
+            header.bitsPerSample != m_format.bitsPerSample || header.sampleRate != m_format.sampleRate ||
+            header.numberOfChannels != m_format.numberOfChannels)
+        {
+            return false;
+        }
+
+        if (header.bitsPerSample == 8)
+        {
+            // 8 bits WAV samples are unsigned.
+            m_buffer.resize(header.dataSize);
+            for (size_t i = 0; i < header.dataSize; i++)
+            {
+                m_buffer[i] = data[i] ^ 0x80;
+            }
+            writeBuffer(m_buffer);
+        }
+        else
+        {
+            m_file.write(reinterpret_cast<const char*>(data), header.dataSize);
+        }
+        m_dataSize += static_cast<uint32_t>(header.dataSize);
+        return true;
+    }
+
+    void close() override
+    {
+        if (!m_isHeaderWritten)
+        {
+            m_format = AudioChunkHeader{16, 48000, 1, 0, 0};
+            writeHeader();
+        }
+
+        m_buffer.clear();
+        appendLittleEndian(m_buffer, HeaderSize - 8 + m_dataSize, 4);
+        m_file.seekp(4);
+        writeBuffer(m_buffer);
+
+        m_buffer.clear();
+        appendLittleEndian(m_buffer, m_dataSize, 4);
+        m_file.seekp(HeaderSize - 4);
+        writeBuffer(m_buffer);
+
+        m_file.close();
+    }
+
+private:
+    void writeHeader()
+    {
+        constexpr uint16_t PcmFormat = 1;
+        uint32_t blockAlign = m_format.bitsPerSample / 8 * m_format.numberOfChannels;
+
+        m_buffer.clear();
+        appendString(m_buffer, "RIFF");
+        appendLittleEndian(m_buffer, HeaderSize - 8, 4);
+        appendString(m_buffer, "WAVE");
+        appendString(m_buffer, "fmt ");
+        appendLittleEndian(m_buffer, 16, 4);
+        appendLittleEndian(m_buffer, PcmFormat, 2);
+        appendLittleEndian(m_buffer, m_format.numberOfChannels, 2);
+        appendLittleEndian(m_buffer, m_format.sampleRate, 4);
+        appendLittleEndian(m_buffer, m_format.sampleRate * blockAlign, 4);
+        appendLittleEndian(m_buffer, blockAlign, 2);
+        appendLittleEndian(m_buffer, m_format.bitsPerSample, 2);
+        appendString(m_buffer, "data");
+        appendLittleEndian(m_buffer, 0, 4);
+        writeBuffer(m_buffer);
+
+        m_isHeaderWritten = true;
+    }
+};
+
+static array<uint32_t, 256> createOggCrcTable()
+{
+    constexpr uint32_t Polynomial = 0x04c11db7;
+
+    array<uint32_t, 256> table{};
+    for (uint32_t i = 0; i < table.size(); i++)
+    {
+        uint32_t value = i << 24;
+        for (int j = 0; j < 8; j++)
+        {
+            value = (value & 0x80000000) != 0 ? (value << 1) ^ Polynomial : value << 1;
+        }
+        table[i] = value;
+    }
+    return table;
+}
+
+static uint32_t oggCrc(const uint8_t* data, size_t size)
+{
+    static const array<uint32_t, 256> Table = createOggCrcTable();
+
+    uint32_t crc = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        crc = (crc << 8) ^ Table[((crc >> 24) ^ data[i]) & 0xff];
+    }
+    return crc;
+}
+
+class OggOpusFileWriter : public AudioFileWriter
+{
+    static constexpr int SampleRate = 48000;
+    static constexpr size_t FrameCount = SampleRate / 100;
+    static constexpr size_t MaxNumberOfChannels = 2;
+    static constexpr uint16_t PreSkip = 312;
+    static constexpr int PayloadType = 111;
+    static constexpr size_t MaxPagePacketCount = 50;
+    static constexpr size_t MaxPageSegmentCount = 255;
+
+    static constexpr uint8_t ContinuedPageFlag = 0x00;
+    static constexpr uint8_t BeginningOfStreamFlag = 0x02;
+    static constexpr uint8_t EndOfStreamFlag = 0x04;
+
+    unique_ptr<webrtc::AudioEncoder> m_encoder;
+    webrtc::PushResampler<int16_t> m_resampler;
+    size_t m_numberOfChannels;
+
+    vector<int16_t> m_channelData;
+    vector<int16_t> m_resampledData;
+    vector<int16_t> m_encoderInput;
+    size_t m_encoderInputFrameCount;
+    rtc::Buffer m_encodedData;
+    uint32_t m_rtpTimestamp;
+    bool m_areHeadersWritten;
+
+    uint32_t m_serialNumber;
+    uint32_t m_pageSequenceNumber;
+    uint64_t m_pageGranulePosition;
+    size_t m_pagePacketCount;
+    vector<uint8_t> m_pageSegmentTable;
+    vector<uint8_t> m_pageData;
+    vector<uint8_t> m_page;
+
+public:
+    explicit OggOpusFileWriter(const string& path)
+        : AudioFileWriter(path),
+          m_numberOfChannels(0),
+          m_encoderInputFrameCount(0),
+          m_rtpTimestamp(0),
+          m_areHeadersWritten(false),
+          m_serialNumber(static_cast<uint32_t>(chrono::steady_clock::now().time_since_epoch().count())),
+          m_pageSequenceNumber(0),
+          m_pageGranulePosition(0),
+          m_pagePacketCount(0)
+    {
+    }
+
+    bool write(const AudioChunkHeader& header, const uint8_t* data) override
+    {
+        if (header.isEncoded)
+        {
+            return writeEncoded(header, data);
+        }
+        if (header.bitsPerSample != 16 || (m_areHeadersWritten && m_encoder == nullptr))
+        {
+            return false;
+        }
+        if (m_encoder == nullptr && !openEncoder(header))
+        {
+            return false;
+        }
+        if (min(header.numberOfChannels, MaxNumberOfChannels) != m_numberOfChannels)
+        {
+            return false;
+        }
+
+        const int16_t* samples = reinterpret_cast<const int16_t*>(data);
+        size_t numberOfFrames = header.numberOfFrames;
+
+        if (header.numberOfChannels != m_numberOfChannels)
+        {
+            m_channelData.resize(numberOfFrames * m_numberOfChannels);
+            for (size_t frame = 0; frame < numberOfFrames; frame++)
+            {
+                for (size_t channel = 0; channel < m_numberOfChannels; channel++)
+                {
+                    m_channelData[frame * m_numberOfChannels + channel] =
+                        samples[frame * header.numberOfChannels + channel];
+                }
+            }
+            samples = m_channelData.data();
+        }
+
+        if (header.sampleRate != SampleRate)
+        {
+            // The resampler only converts 10 ms frames.
+            if (numberOfFrames * 100 != static_cast<size_t>(header.sampleRate) ||
+                m_resampler.InitializeIfNeeded(header.sampleRate, SampleRate, m_numberOfChannels) != 0)
+            {
+                return false;
+            }
+
+            m_resampledData.resize(FrameCount * m_numberOfChannels);
+            if (m_resampler.Resample(
+                    samples,
+                    numberOfFrames * m_numberOfChannels,
+                    m_resampledData.data(),
+                    m_resampledData.size()) < 0)
+            {
+                return false;
+            }
+            samples = m_resampledData.data();
+            numberOfFrames = FrameCount;
+        }
+
+        encode(samples, numberOfFrames);
+        return true;
+    }
+
+    void close() override
+    {
+        if (!m_areHeadersWritten)
+        {
+            openEncoder(AudioChunkHeader{16, SampleRate, 1, 0, 0});
+        }
+        flushPage(EndOfStreamFlag);
+        m_file.close();
+    }
+
+private:
+    bool writeEncoded(const AudioChunkHeader& header, const uint8_t* data)
+    {
+        // The packets of an encoded stream are written as they are, so they cannot be mixed with PCM frames.
+        if (m_encoder != nullptr)
+        {
+            return false;
+        }
+        if (!m_areHeadersWritten)
+        {
+            m_numberOfChannels = min(header.numberOfChannels, MaxNumberOfChannels);
+            if (m_numberOfChannels == 0)
+            {
+                return false;
+            }
+            writeHeaders(SampleRate);
+        }
+
+        m_rtpTimestamp += static_cast<uint32_t>(header.numberOfFrames);
+        m_pageGranulePosition = m_rtpTimestamp;
+        addPacket(data, header.dataSize);
+        return true;
+    }
+
+    bool openEncoder(const AudioChunkHeader& header)
+    {
+        m_numberOfChannels = min(header.numberOfChannels, MaxNumberOfChannels);
+
+        webrtc::AudioEncoderOpusConfig config;
+        config.num_channels = m_numberOfChannels;
+        config.application = m_numberOfChannels == 1 ? webrtc::AudioEncoderOpusConfig::ApplicationMode::kVoip
+                                                      : webrtc::AudioEncoderOpusConfig::ApplicationMode::kAudio;
+        if (!config.IsOk())
+        {
+            return false;
+        }
+        m_encoder = webrtc::AudioEncoderOpus::MakeAudioEncoder(config, PayloadType);
+        if (m_encoder == nullptr)
+        {
+            return false;
+        }
+        m_encoderInput.resize(FrameCount * m_numberOfChannels);
+
+        writeHeaders(header.sampleRate);
+        return true;
+    }
+
+    void writeHeaders(int inputSampleRate)
+    {
+        vector<uint8_t> opusHead;
+        appendString(opusHead, "OpusHead");
+        opusHead.push_back(1);  // Version
+        opusHead.push_back(static_cast<uint8_t>(m_numberOfChannels));
+        appendLittleEndian(opusHead, PreSkip, 2);
+        appendLittleEndian(opusHead, inputSampleRate, 4);
+        appendLittleEndian(opusHead, 0, 2);  // Output gain
+        opusHead.push_back(0);  // Channel mapping family
+        addPacket(opusHead.data(), opusHead.size());
+        flushPage(BeginningOfStreamFlag);
+
+        constexpr const char* Vendor = "opentera-webrtc";
+        vector<uint8_t> opusTags;
+        appendString(opusTags, "OpusTags");
+        appendLittleEndian(opusTags, strlen(Vendor), 4);
+        appendString(opusTags, Vendor);
+        appendLittleEndian(opusTags, 0, 4);  // User comment count
+        addPacket(opusTags.data(), opusTags.size());
+        flushPage(ContinuedPageFlag);
+
+        m_areHeadersWritten = true;
+    }
+
+    void encode(const int16_t* samples, size_t numberOfFrames)
+    {
+        while (numberOfFrames > 0)
+        {
+            size_t frameCount = min(numberOfFrames, FrameCount - m_encoderInputFrameCount);
+            copy(
+                samples,
+                samples + frameCount * m_numberOfChannels,
+                m_encoderInput.begin() + m_encoderInputFrameCount * m_numberOfChannels);
+            m_encoderInputFrameCount += frameCount;
+            samples += frameCount * m_numberOfChannels;
+            numberOfFrames -= frameCount;
+
+            if (m_encoderInputFrameCount == FrameCount)
+            {
+                m_encodedData.Clear();
+                auto info = m_encoder->Encode(
+                    m_rtpTimestamp,
+                    rtc::ArrayView<const int16_t>(m_encoderInput.data(), m_encoderInput.size()),
+                    &m_encodedData);
+                m_rtpTimestamp += FrameCount;
+                m_encoderInputFrameCount = 0;
+
+                if (info.encoded_bytes > 0)
+                {
+                    m_pageGranulePosition = m_rtpTimestamp;
+                    addPacket(m_encodedData.data(), info.encoded_bytes);
+                }
+            }
+        }
+    }
+
+    void addPacket(const uint8_t* data, size_t size)
+    {
+        size_t segmentCount = size / 255 + 1;
+        if (m_pageSegmentTable.size() + segmentCount > MaxPageSegmentCount)
+        {
+            flushPage(ContinuedPageFlag);
+        }
+
+        m_pageSegmentTable.insert(m_pageSegmentTable.end(), size / 255, 255);
+        m_pageSegmentTable.push_back(static_cast<uint8_t>(size % 255));
+        m_pageData.insert(m_pageData.end(), data, data + size);
+
+        m_pagePacketCount++;
+        if (m_pagePacketCount >= MaxPagePacketCount)
+        {
+            flushPage(ContinuedPageFlag);
+        }
+    }
+
+    void flushPage(uint8_t headerType)
+    {
+        if (m_pagePacketCount == 0 && headerType != EndOfStreamFlag)
+        {
+            return;
+        }
+
+        constexpr size_t CrcOffset = 22;
+
+        m_page.clear();
+        appendString(m_page, "OggS");
+        m_page.push_back(0);  // Version
+        m_page.push_back(headerType);
+        appendLittleEndian(m_page, m_pageGranulePosition, 8);
+        appendLittleEndian(m_page, m_serialNumber, 4);
+        appendLittleEndian(m_page, m_pageSequenceNumber, 4);
+        appendLittleEndian(m_page, 0, 4);  // CRC
+        m_page.push_back(static_cast<uint8_t>(m_pageSegmentTable.size()));
+        m_page.insert(m_page.end(), m_pageSegmentTable.begin(), m_pageSegmentTable.end());
+        m_page.insert(m_page.end(), m_pageData.begin(), m_pageData.end());
+
+        uint32_t crc = oggCrc(m_page.data(), m_page.size());
+        for (size_t i = 0; i < 4; i++)
+        {
+            m_page[CrcOffset + i] = static_cast<uint8_t>(crc >> (8 * i));
+        }
+        writeBuffer(m_page);
+
+        m_pageSequenceNumber++;
+        m_pagePacketCount = 0;
+        m_pageSegmentTable.clear();
+        m_pageData.clear();
+    }
+};
+
+static unique_ptr<AudioFileWriter> createAudioFileWriter(const string& path, AudioRecordingFormat format)
+{
+    switch (format)
+    {
+        case AudioRecordingFormat::Wav:
+            return make_unique<WavFileWriter>(path);
+        case AudioRecordingFormat::OggOpus:
+            return make_unique<OggOpusFileWriter>(path);
+        default:
+            throw runtime_error("Invalid audio recording format");
+    }
+}
+
+/**
+ * @brief Creates an audio recorder and starts its writing thread.
+ *
+ * @param path The file path
+ * @param format The file format
+ * @param bufferSize The size in bytes of the buffer filled between two writes
+ * @throw runtime_error if the file cannot be opened
+ */
+AudioRecorder::AudioRecorder(const string& path, AudioRecordingFormat format, size_t bufferSize)
+    : m_fileWriter(createAudioFileWriter(path, format)),
+      m_pendingBuffer(bufferSize),
+      m_pendingSize(0),
+      m_writingBuffer(bufferSize),
+      m_isClosing(false),
+      m_droppedFrameCount(0)
+{
+    m_thread = thread(&AudioRecorder::run, this);
+}
+
+AudioRecorder::~AudioRecorder()
+{
+    close();
+}
+
+/**
+ * @brief Queues audio data to be written. This method does not allocate and does not wait for the file.
+ *
+ * @param audioData The audio data
+ * @param bitsPerSample The audio stream sample size (8, 16 or 32 bits)
+ * @param sampleRate The audio stream sample rate
+ * @param numberOfChannels The audio stream channel count
+ * @param numberOfFrames The number of frames
+ */
+void AudioRecorder::write(
+    const void* audioData,
+    int bitsPerSample,
+    int sampleRate,
+    size_t numberOfChannels,
+    size_t numberOfFrames)
+{
+    if (bitsPerSample != 8 && bitsPerSample != 16 && bitsPerSample != 32)
+    {
+        m_droppedFrameCount.fetch_add(numberOfFrames);
+        return;
+    }
+
+    AudioChunkHeader header{
+        bitsPerSample,
+        sampleRate,
+        numberOfChannels,
+        numberOfFrames,
+        bitsPerSample / 8 * numberOfChannels * numberOfFrames,
+        false};
+    queueChunk(header, audioData);
+}
+
+void AudioRecorder::queueChunk(const AudioChunkHeader& header, const void* data)
+{
+    size_t chunkSize = sizeof(AudioChunkHeader) + header.dataSize;
+
+    lock_guard<mutex> lock(m_mutex);
+    if (m_isClosing || m_pendingSize + chunkSize > m_pendingBuffer.size())
+    {
+        m_droppedFrameCount.fetch_add(header.numberOfFrames);
+        return;
+    }
+
+    memcpy(m_pendingBuffer.data() + m_pendingSize, &header, sizeof(AudioChunkHeader));
+    memcpy(m_pendingBuffer.data() + m_pendingSize + sizeof(AudioChunkHeader), data, header.dataSize);
+    m_pendingSize += chunkSize;
+
+    if (m_pendingSize >= m_pendingBuffer.size() / 2)
+    {
+        m_condition.notify_one();
+    }
+}
+
+/**
+ * @brief Queues an Opus packet to be written as it is. This method does not allocate and does not wait for the file.
+ *
+ * The packets can only be recorded in an Ogg/Opus file that does not contain PCM frames.
+ *
+ * @param data The Opus packet
+ * @param dataSize The Opus packet size
+ * @param numberOfChannels The channel count of the Opus stream (1 or 2)
+ */
+void AudioRecorder::writeEncoded(const uint8_t* data, size_t dataSize, size_t numberOfChannels)
+{
+    size_t numberOfFrames = OpusPacket::numberOfFrames(data, dataSize);
+    if (numberOfFrames == 0)
+    {
+        return;
+    }
+
+    AudioChunkHeader header{0, OpusPacket::SampleRate, numberOfChannels, numberOfFrames, dataSize, true};
+    queueChunk(header, data);
+}
+
+/**
+ * @brief Writes the queued audio data, finalizes the file and stops the writing thread.
+ */
+void AudioRecorder::close()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_isClosing = true;
+    }
+    m_condition.notify_one();
+
+    if (m_thread.joinable())
+    {
+        m_thread.join();
+    }
+}
+
+void AudioRecorder::run()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_condition.wait_for(
+            lock,
+            FlushPeriod,
+            [this]() { return m_isClosing || m_pendingSize >= m_pendingBuffer.size() / 2; });
+
+        swap(m_pendingBuffer, m_writingBuffer);
+        size_t writingSize = m_pendingSize;
+        m_pendingSize = 0;
+        bool isClosing = m_isClosing;
+
+        lock.unlock();
+        writeChunks(writingSize);
+        if (isClosing)
+        {
+            break;
+        }
+        lock.lock();
+    }
+
+    m_fileWriter->close();
+}
+
+void AudioRecorder::writeChunks(size_t size)
+{
+    size_t offset = 0;
+    while (offset < size)
+    {
+        AudioChunkHeader header;
+        memcpy(&header, m_writingBuffer.data() + offset, sizeof(AudioChunkHeader));
+        offset += sizeof(AudioChunkHeader);
+
+        if (!m_fileWriter->write(header, m_writingBuffer.data() + offset))
+        {
+            m_droppedFrameCount.fetch_add(header.numberOfFrames);
+        }
+        offset += header.dataSize;
+    }
+}
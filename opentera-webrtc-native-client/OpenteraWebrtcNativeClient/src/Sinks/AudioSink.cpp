@@ -1,5 +1,7 @@
 #include <OpenteraWebrtcNativeClient/Sinks/AudioSink.h>
 
+#include <rtc_base/time_utils.h>
+
 #include <utility>
 
 using namespace std;
@@ -9,8 +11,38 @@ using namespace opentera;
  * @brief Construct an AudioStream object
  * @param onAudioDataReceived callback function to consume audio data received
  * on the WebRTC transport layer
+ * @param configuration format of the audio data given to onAudioDataReceived
  */
-AudioSink::AudioSink(AudioSinkCallback onAudioDataReceived) : m_onAudioFrameReceived(move(onAudioDataReceived)) {}
+AudioSink::AudioSink(TimestampedAudioSinkCallback onAudioDataReceived, const AudioSinkConfiguration& configuration)
+    : m_onAudioFrameReceived(move(onAudioDataReceived))
+{
+    if (m_onAudioFrameReceived && configuration.isConversionEnabled())
+    {
+        m_audioConverter = make_unique<AudioConverter>(configuration);
+    }
+}
+
+/**
+ * @brief Construct an AudioStream object that computes the audio level
+ * @param onAudioDataReceived callback function to consume audio data received
+ * on the WebRTC transport layer (can be empty)
+ * @param onAudioLevelChanged callback function called at the end of each
+ * level interval (can be empty if the level is only polled)
+ * @param configuration format of the audio data given to onAudioDataReceived
+ */
+AudioSink::AudioSink(
+    TimestampedAudioSinkCallback onAudioDataReceived,
+    AudioLevelSinkCallback onAudioLevelChanged,
+    const AudioSinkConfiguration& configuration)
+    : m_onAudioFrameReceived(move(onAudioDataReceived)),
+      m_onAudioLevelChanged(move(onAudioLevelChanged)),
+      m_audioLevelMeter(make_unique<AudioLevelMeter>())
+{
+    if (m_onAudioFrameReceived && configuration.isConversionEnabled())
+    {
+        m_audioConverter = make_unique<AudioConverter>(configuration);
+    }
+}
 
 /**
  * @brief Called by the WebRTC transport layer when audio data is available
@@ -28,8 +60,35 @@ void AudioSink::OnData(
     size_t numberOfChannels,
     size_t numberOfFrames)
 {
-    if (m_onAudioFrameReceived)
+    // The frames are pulled by the audio device module when they are played out.
+    uint64_t timestampUs = rtc::TimeMicros();
+
+    if (m_audioLevelMeter != nullptr &&
+        m_audioLevelMeter->update(audioData, bitsPerSample, sampleRate, numberOfChannels, numberOfFrames) &&
+        m_onAudioLevelChanged)
+    {
+        m_onAudioLevelChanged(m_audioLevelMeter->level());
+    }
+
+    auto audioRecorder = atomic_load(&m_audioRecorder);
+    if (audioRecorder != nullptr)
+    {
+        audioRecorder->write(audioData, bitsPerSample, sampleRate, numberOfChannels, numberOfFrames);
+    }
+
+    if (m_audioConverter != nullptr)
+    {
+        m_audioConverter->convert(
+            audioData,
+            bitsPerSample,
+            sampleRate,
+            numberOfChannels,
+            numberOfFrames,
+            timestampUs,
+            m_onAudioFrameReceived);
+    }
+    else if (m_onAudioFrameReceived)
     {
-        m_onAudioFrameReceived(audioData, bitsPerSample, sampleRate, numberOfChannels, numberOfFrames);
+        m_onAudioFrameReceived(audioData, bitsPerSample, sampleRate, numberOfChannels, numberOfFrames, timestampUs);
     }
 }
@@ -0,0 +1,63 @@
+#include <OpenteraWebrtcNativeClient/Sinks/EncodedAudioSink.h>
+#include <OpenteraWebrtcNativeClient/Utils/OpusPacket.h>
+
+#include <utility>
+
+using namespace opentera;
+using namespace std;
+
+/**
+ * @brief Construct an EncodedAudioSink
+ *
+ * @param onFrameReceived callback function that gets called whenever a packet is
+ * received
+ * @param isDecodingEnabled indicates if the packets are forwarded to the decoder
+ */
+EncodedAudioSink::EncodedAudioSink(EncodedAudioSinkCallback onFrameReceived, bool isDecodingEnabled)
+    : m_onFrameReceived(move(onFrameReceived)),
+      m_isDecodingEnabled(isDecodingEnabled)
+{
+}
+
+/**
+ * @brief Process incoming packets from webrtc
+ *
+ * This function is called by the webrtc transport layer whenever a packet is
+ * depacketized. It calls the callback function with the encoded data and forwards
+ * the packet to the decoder if decoding is enabled.
+ *
+ * @param frame available webrtc packet
+ */
+void EncodedAudioSink::Transform(unique_ptr<webrtc::TransformableFrameInterface> frame)
+{
+    if (m_onFrameReceived)
+    {
+        auto data = frame->GetData();
+        m_onFrameReceived(
+            data.data(),
+            data.size(),
+            OpusPacket::numberOfFrames(data.data(), data.size()),
+            frame->GetTimestamp());
+    }
+
+    if (m_isDecodingEnabled)
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_transformedFrameCallback != nullptr)
+        {
+            m_transformedFrameCallback->OnTransformedFrame(move(frame));
+        }
+    }
+}
+
+void EncodedAudioSink::RegisterTransformedFrameCallback(rtc::scoped_refptr<webrtc::TransformedFrameCallback> callback)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_transformedFrameCallback = move(callback);
+}
+
+void EncodedAudioSink::UnregisterTransformedFrameCallback()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_transformedFrameCallback = nullptr;
+}
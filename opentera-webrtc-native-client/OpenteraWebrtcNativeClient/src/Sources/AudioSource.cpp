@@ -27,6 +27,50 @@ size_t bytesPerFrame(int bitsPerSample, size_t numberOfChannels)
     }
 }
 
+/**
+ * @brief Copies the selected channels of interleaved frames.
+ *
+ * The mono and stereo outputs have a fixed stride, so the compiler can vectorize their loops.
+ */
+template<class T>
+static void selectChannels(
+    const T* input,
+    T* output,
+    size_t numberOfFrames,
+    size_t inputNumberOfChannels,
+    const vector<size_t>& selectedChannels)
+{
+    if (selectedChannels.size() == 1)
+    {
+        const T* channel0 = input + selectedChannels[0];
+        for (size_t i = 0; i < numberOfFrames; i++)
+        {
+            output[i] = channel0[i * inputNumberOfChannels];
+        }
+    }
+    else if (selectedChannels.size() == 2)
+    {
+        const T* channel0 = input + selectedChannels[0];
+        const T* channel1 = input + selectedChannels[1];
+        for (size_t i = 0; i < numberOfFrames; i++)
+        {
+            output[2 * i] = channel0[i * inputNumberOfChannels];
+            output[2 * i + 1] = channel1[i * inputNumberOfChannels];
+        }
+    }
+    else
+    {
+        size_t outputNumberOfChannels = selectedChannels.size();
+        for (size_t i = 0; i < numberOfFrames; i++)
+        {
+            for (size_t j = 0; j < outputNumberOfChannels; j++)
+            {
+                output[i * outputNumberOfChannels + j] = input[i * inputNumberOfChannels + selectedChannels[j]];
+            }
+        }
+    }
+}
+
 /**
  * @brief Creates an AudioSource
  *
@@ -41,15 +85,49 @@ AudioSource::AudioSource(
     int bitsPerSample,
     int sampleRate,
     size_t numberOfChannels)
+    : AudioSource(move(configuration), bitsPerSample, sampleRate, numberOfChannels, {})
+{
+}
+
+/**
+ * @brief Creates an AudioSource that only sends some channels of the audio stream
+ *
+ * For example, {2, 5} sends the third and sixth channels of a microphone array as a stereo stream.
+ *
+ * @param configuration the configuration applied to the audio stream by the
+ * audio transport layer
+ * @param bitsPerSample The audio stream sample size (8, 16 or 32 bits)
+ * @param sampleRate The audio stream sample rate
+ * @param numberOfChannels The audio stream channel count
+ * @param selectedChannels The indexes of the channels to send, in order (empty to send all channels)
+ *
+ * @throw runtime_error if bitsPerSample or a selected channel is invalid
+ */
+AudioSource::AudioSource(
+    AudioSourceConfiguration configuration,
+    int bitsPerSample,
+    int sampleRate,
+    size_t numberOfChannels,
+    vector<size_t> selectedChannels)
     : m_configuration(move(configuration)),
       m_bitsPerSample(bitsPerSample),
       m_sampleRate(sampleRate),
       m_numberOfChannels(numberOfChannels),
       m_bytesPerFrame(::bytesPerFrame(bitsPerSample, numberOfChannels)),
+      m_selectedChannels(move(selectedChannels)),
+      m_sentNumberOfChannels(m_selectedChannels.empty() ? numberOfChannels : m_selectedChannels.size()),
+      m_sentBytesPerFrame(::bytesPerFrame(bitsPerSample, m_sentNumberOfChannels)),
       m_dataIndex(0),
-      m_data(m_bytesPerFrame * sampleRate / 100, 0),
-      m_dataNumberOfFrames(m_data.size() / m_bytesPerFrame)
+      m_data(m_sentBytesPerFrame * sampleRate / 100, 0),
+      m_dataNumberOfFrames(m_data.size() / m_sentBytesPerFrame)
 {
+    for (size_t channel : m_selectedChannels)
+    {
+        if (channel >= m_numberOfChannels)
+        {
+            throw runtime_error("Invalid selected channel");
+        }
+    }
 }
 
 /**
@@ -104,6 +182,22 @@ size_t AudioSource::bytesPerFrame() const
     return m_bytesPerFrame;
 }
 
+/**
+ * @return The sample rate
+ */
+int AudioSource::sampleRate() const
+{
+    return m_sampleRate;
+}
+
+/**
+ * @return The channel count
+ */
+size_t AudioSource::numberOfChannels() const
+{
+    return m_numberOfChannels;
+}
+
 /**
  * Internal use only.
  * @param audioDeviceModule
@@ -123,11 +217,12 @@ void AudioSource::setAudioDeviceModule(const rtc::scoped_refptr<OpenteraAudioDev
  */
 void AudioSource::sendFrame(const void* audioData, size_t numberOfFrames, bool isTyping)
 {
-    size_t dataSize = m_bytesPerFrame * numberOfFrames;
+    auto data = reinterpret_cast<const uint8_t*>(audioData);
+    size_t dataSize = m_sentBytesPerFrame * numberOfFrames;
     if (m_dataIndex + dataSize >= m_data.size())
     {
-        size_t dataToCopySize = m_data.size() - m_dataIndex;
-        memcpy(m_data.data() + m_dataIndex, audioData, dataToCopySize);
+        size_t numberOfFramesToCopy = (m_data.size() - m_dataIndex) / m_sentBytesPerFrame;
+        copyFrames(data, numberOfFramesToCopy);
         m_dataIndex = 0;
 
         {
@@ -138,22 +233,22 @@ void AudioSource::sendFrame(const void* audioData, size_t numberOfFrames, bool i
                     m_data.data(),
                     m_bitsPerSample,
                     m_sampleRate,
-                    m_numberOfChannels,
+                    m_sentNumberOfChannels,
                     m_dataNumberOfFrames,
                     m_configuration.soundCardTotalDelayMs(),
                     isTyping);
             }
         }
 
-        size_t remainingNumberOfFrames = (dataSize - dataToCopySize) / m_bytesPerFrame;
+        size_t remainingNumberOfFrames = numberOfFrames - numberOfFramesToCopy;
         if (remainingNumberOfFrames > 0)
         {
-            sendFrame(reinterpret_cast<const uint8_t*>(audioData) + dataToCopySize, remainingNumberOfFrames);
+            sendFrame(data + numberOfFramesToCopy * m_bytesPerFrame, remainingNumberOfFrames);
         }
     }
     else
     {
-        memcpy(m_data.data() + m_dataIndex, audioData, m_bytesPerFrame * numberOfFrames);
+        copyFrames(data, numberOfFrames);
         m_dataIndex += dataSize;
     }
 }
@@ -164,3 +259,41 @@ rtc::RefCountReleaseStatus AudioSource::Release() const
 {
     return rtc::RefCountReleaseStatus::kOtherRefsRemained;
 }
+
+void AudioSource::copyFrames(const uint8_t* audioData, size_t numberOfFrames)
+{
+    uint8_t* destination = m_data.data() + m_dataIndex;
+    if (m_selectedChannels.empty())
+    {
+        memcpy(destination, audioData, m_bytesPerFrame * numberOfFrames);
+        return;
+    }
+
+    switch (m_bitsPerSample)
+    {
+        case 8:
+            selectChannels(
+                reinterpret_cast<const int8_t*>(audioData),
+                reinterpret_cast<int8_t*>(destination),
+                numberOfFrames,
+                m_numberOfChannels,
+                m_selectedChannels);
+            break;
+        case 16:
+            selectChannels(
+                reinterpret_cast<const int16_t*>(audioData),
+                reinterpret_cast<int16_t*>(destination),
+                numberOfFrames,
+                m_numberOfChannels,
+                m_selectedChannels);
+            break;
+        case 32:
+            selectChannels(
+                reinterpret_cast<const int32_t*>(audioData),
+                reinterpret_cast<int32_t*>(destination),
+                numberOfFrames,
+                m_numberOfChannels,
+                m_selectedChannels);
+            break;
+    }
+}
@@ -0,0 +1,119 @@
+#include <OpenteraWebrtcNativeClient/Sources/EncodedAudioSource.h>
+#include <OpenteraWebrtcNativeClient/Utils/OpusPacket.h>
+
+using namespace opentera;
+using namespace std;
+
+constexpr size_t FrameCountPer10Ms = OpusPacket::SampleRate / 100;
+
+static size_t validateNumberOfChannels(size_t numberOfChannels)
+{
+    if (numberOfChannels != 1 && numberOfChannels != 2)
+    {
+        throw runtime_error("Invalid numberOfChannels");
+    }
+    return numberOfChannels;
+}
+
+/**
+ * @brief Adds a packet to the queue. The oldest packet is dropped if the queue is full.
+ *
+ * @param data The Opus packet
+ * @param dataSize The Opus packet size
+ */
+void EncodedAudioFrameQueue::push(const uint8_t* data, size_t dataSize)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_frames.size() >= MaxSize)
+    {
+        m_frames.pop_front();
+    }
+    m_frames.emplace_back(data, data + dataSize);
+}
+
+/**
+ * @brief Removes the oldest packet from the queue.
+ *
+ * @param frame The vector that receives the packet
+ * @return true if a packet was removed
+ */
+bool EncodedAudioFrameQueue::pop(vector<uint8_t>& frame)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_frames.empty())
+    {
+        return false;
+    }
+
+    frame = move(m_frames.front());
+    m_frames.pop_front();
+    return true;
+}
+
+/**
+ * @brief Creates an EncodedAudioSource
+ *
+ * The audio processing is bypassed, since the packets are not decoded.
+ *
+ * @param numberOfChannels The channel count of the Opus packets (1 or 2)
+ * @throw runtime_error if the channel count is invalid
+ */
+EncodedAudioSource::EncodedAudioSource(size_t numberOfChannels)
+    : AudioSource(
+          AudioSourceConfiguration::createPassThrough(),
+          16,
+          OpusPacket::SampleRate,
+          validateNumberOfChannels(numberOfChannels)),
+      m_silence(OpusPacket::MaxNumberOfFrames * numberOfChannels, 0)
+{
+}
+
+/**
+ * @brief Sends an Opus packet to every peer.
+ *
+ * Silent 10 ms frames are also sent through the audio device module, so the packets are paced by the WebRTC
+ * audio pipeline like encoded audio.
+ *
+ * @param data The Opus packet
+ * @param dataSize The Opus packet size
+ * @return false if the packet is invalid or if its duration is not a multiple of 10 ms
+ */
+bool EncodedAudioSource::sendEncodedFrame(const uint8_t* data, size_t dataSize)
+{
+    size_t numberOfFrames = OpusPacket::numberOfFrames(data, dataSize);
+    if (numberOfFrames == 0 || numberOfFrames % FrameCountPer10Ms != 0)
+    {
+        return false;
+    }
+
+    {
+        lock_guard<mutex> lock(m_queuesMutex);
+        for (auto queue : m_queues)
+        {
+            queue->push(data, dataSize);
+        }
+    }
+
+    sendFrame(m_silence.data(), numberOfFrames);
+    return true;
+}
+
+/**
+ * Internal use only.
+ * @param queue
+ */
+void EncodedAudioSource::addEncodedAudioFrameQueue(EncodedAudioFrameQueue* queue)
+{
+    lock_guard<mutex> lock(m_queuesMutex);
+    m_queues.insert(queue);
+}
+
+/**
+ * Internal use only.
+ * @param queue
+ */
+void EncodedAudioSource::removeEncodedAudioFrameQueue(EncodedAudioFrameQueue* queue)
+{
+    lock_guard<mutex> lock(m_queuesMutex);
+    m_queues.erase(queue);
+}
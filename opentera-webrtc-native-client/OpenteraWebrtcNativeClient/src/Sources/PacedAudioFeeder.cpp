@@ -0,0 +1,277 @@
+#include <OpenteraWebrtcNativeClient/Sources/PacedAudioFeeder.h>
+#include <OpenteraWebrtcNativeClient/Utils/thread.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+constexpr chrono::nanoseconds ChunkDuration = 10ms;
+
+static uint16_t readUint16(const uint8_t* data) { return static_cast<uint16_t>(data[0] | (data[1] << 8)); }
+
+static uint32_t readUint32(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+/**
+ * @brief Finds the PCM samples of a WAV file and validates its format.
+ */
+static void findWavData(
+    const MemoryMappedFile& file,
+    int bitsPerSample,
+    int sampleRate,
+    size_t numberOfChannels,
+    size_t& dataOffset,
+    size_t& dataSize)
+{
+    constexpr size_t RiffHeaderSize = 12;
+    constexpr size_t ChunkHeaderSize = 8;
+    constexpr size_t FmtChunkSize = 16;
+    constexpr uint16_t PcmFormat = 1;
+
+    const uint8_t* data = file.data();
+    if (file.size() < RiffHeaderSize || memcmp(data, "RIFF", 4) != 0 || memcmp(data + 8, "WAVE", 4) != 0)
+    {
+        throw runtime_error("The file is not a WAV file");
+    }
+
+    bool isFormatValid = false;
+    size_t offset = RiffHeaderSize;
+    while (offset + ChunkHeaderSize <= file.size())
+    {
+        const uint8_t* chunk = data + offset;
+        size_t chunkSize = readUint32(chunk + 4);
+        size_t chunkDataOffset = offset + ChunkHeaderSize;
+
+        if (memcmp(chunk, "fmt ", 4) == 0 && chunkSize >= FmtChunkSize && chunkDataOffset + chunkSize <= file.size())
+        {
+            const uint8_t* fmt = data + chunkDataOffset;
+            isFormatValid = readUint16(fmt) == PcmFormat && readUint16(fmt + 2) == numberOfChannels &&
+                            readUint32(fmt + 4) == static_cast<uint32_t>(sampleRate) &&
+                            readUint16(fmt + 14) == bitsPerSample;
+        }
+        else if (memcmp(chunk, "data", 4) == 0)
+        {
+            if (!isFormatValid)
+            {
+                throw runtime_error("The WAV file format does not match the audio source format");
+            }
+            dataOffset = chunkDataOffset;
+            // The size can be invalid if the writer did not finalize the file.
+            dataSize = min(chunkSize, file.size() - chunkDataOffset);
+            return;
+        }
+
+        // The chunks are padded to an even size.
+        offset = chunkDataOffset + chunkSize + (chunkSize & 1);
+    }
+
+    throw runtime_error("The WAV file does not contain audio data");
+}
+
+/**
+ * @brief Creates a paced audio feeder. The timer thread is not started.
+ *
+ * @param audioSource The audio source to feed
+ * @param clock The clock that paces the frames
+ */
+PacedAudioFeeder::PacedAudioFeeder(shared_ptr<AudioSource> audioSource, shared_ptr<AudioClock> clock)
+    : m_audioSource(move(audioSource)),
+      m_clock(move(clock)),
+      m_numberOfFramesPerChunk(m_audioSource->sampleRate() / 100),
+      m_chunk(m_numberOfFramesPerChunk * m_audioSource->bytesPerFrame(), 0),
+      m_queuedSize(0),
+      m_isUnderrun(true),
+      m_underrunCount(0),
+      m_stopped(true)
+{
+}
+
+PacedAudioFeeder::~PacedAudioFeeder() { stop(); }
+
+/**
+ * @brief Starts the timer thread if it is not started.
+ */
+void PacedAudioFeeder::start()
+{
+    if (m_stopped.load())
+    {
+        m_stopped.store(false);
+        m_thread = make_unique<thread>(&PacedAudioFeeder::run, this);
+        setThreadPriority(*m_thread, ThreadPriority::RealTime);
+    }
+}
+
+/**
+ * @brief Stops the timer thread if it is started. The queued audio is kept.
+ */
+void PacedAudioFeeder::stop()
+{
+    if (!m_stopped.load() && m_thread != nullptr)
+    {
+        m_stopped.store(true);
+        m_clock->wakeUp();
+        m_thread->join();
+        m_thread = nullptr;
+    }
+}
+
+/**
+ * @brief Copies audio frames at the end of the queue.
+ *
+ * @param audioData The audio data (the audio source format)
+ * @param numberOfFrames The number of frames
+ */
+void PacedAudioFeeder::enqueue(const void* audioData, size_t numberOfFrames)
+{
+    size_t size = numberOfFrames * m_audioSource->bytesPerFrame();
+    if (size == 0)
+    {
+        return;
+    }
+
+    auto bytes = reinterpret_cast<const uint8_t*>(audioData);
+    Buffer buffer{nullptr, vector<uint8_t>(bytes, bytes + size), 0, size};
+
+    lock_guard<mutex> lock(m_mutex);
+    m_queuedSize += size;
+    m_buffers.push_back(move(buffer));
+}
+
+/**
+ * @brief Maps a WAV file in memory and adds its audio at the end of the queue.
+ *
+ * The file is not copied, so it must not be modified while it is queued.
+ *
+ * @param path The WAV file path (PCM, the audio source format)
+ * @throw runtime_error if the file cannot be read or if its format does not match the audio source format
+ */
+void PacedAudioFeeder::enqueueWavFile(const string& path)
+{
+    auto file = make_shared<MemoryMappedFile>(path);
+
+    size_t dataOffset;
+    size_t dataSize;
+    findWavData(
+        *file,
+        static_cast<int>(m_audioSource->bytesPerSample() * 8),
+        m_audioSource->sampleRate(),
+        m_audioSource->numberOfChannels(),
+        dataOffset,
+        dataSize);
+
+    dataSize -= dataSize % m_audioSource->bytesPerFrame();
+    if (dataSize == 0)
+    {
+        return;
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    m_queuedSize += dataSize;
+    m_buffers.push_back(Buffer{move(file), vector<uint8_t>(), dataOffset, dataSize});
+}
+
+/**
+ * @brief Removes the queued audio.
+ */
+void PacedAudioFeeder::clear()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_buffers.clear();
+    m_queuedSize = 0;
+}
+
+/**
+ * @brief Returns the number of queued frames.
+ * @return The number of queued frames
+ */
+size_t PacedAudioFeeder::queuedNumberOfFrames()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_queuedSize / m_audioSource->bytesPerFrame();
+}
+
+/**
+ * @brief Sets the callback that is called when the queue runs out of audio.
+ *
+ * The callback is called from the timer thread. The callback should not block.
+ *
+ * @param callback The callback
+ */
+void PacedAudioFeeder::setOnUnderrun(function<void()> callback)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_onUnderrun = move(callback);
+}
+
+void PacedAudioFeeder::run()
+{
+    // The deadlines are computed from the start time, so the sleep jitter does not accumulate.
+    auto start = m_clock->now();
+    size_t counter = 0;
+    while (!m_stopped.load())
+    {
+        sendChunk();
+
+        ++counter;
+        auto deadline = start + counter * ChunkDuration;
+        auto now = m_clock->now();
+        if (now > deadline + 5 * ChunkDuration)
+        {
+            // The thread was suspended, so the frames are not sent in burst to catch up.
+            start = now;
+            counter = 0;
+            deadline = now;
+        }
+        m_clock->sleepUntil(deadline);
+    }
+}
+
+void PacedAudioFeeder::sendChunk()
+{
+    function<void()> onUnderrun;
+    size_t copiedSize = 0;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        while (copiedSize < m_chunk.size() && !m_buffers.empty())
+        {
+            Buffer& buffer = m_buffers.front();
+            const uint8_t* data = buffer.file != nullptr ? buffer.file->data() : buffer.data.data();
+            size_t size = min(m_chunk.size() - copiedSize, buffer.size);
+
+            memcpy(m_chunk.data() + copiedSize, data + buffer.offset, size);
+            copiedSize += size;
+            buffer.offset += size;
+            buffer.size -= size;
+            if (buffer.size == 0)
+            {
+                m_buffers.pop_front();
+            }
+        }
+        m_queuedSize -= copiedSize;
+
+        if (copiedSize == m_chunk.size())
+        {
+            m_isUnderrun = false;
+        }
+        else if (!m_isUnderrun)
+        {
+            m_isUnderrun = true;
+            m_underrunCount++;
+            onUnderrun = m_onUnderrun;
+        }
+    }
+
+    memset(m_chunk.data() + copiedSize, 0, m_chunk.size() - copiedSize);
+    m_audioSource->sendFrame(m_chunk.data(), m_numberOfFramesPerChunk);
+
+    if (onUnderrun)
+    {
+        onUnderrun();
+    }
+}
@@ -1,8 +1,15 @@
 #include <OpenteraWebrtcNativeClient/StreamClient.h>
 
+#include <algorithm>
+
 using namespace opentera;
 using namespace std;
 
+static bool isAudioProcessingEnabled(const shared_ptr<AudioSource>& audioSource)
+{
+    return audioSource == nullptr || !audioSource->configuration().isPassThrough();
+}
+
 /**
  * @brief Creates a stream client
  *
@@ -13,11 +20,7 @@ using namespace std;
 StreamClient::StreamClient(
     SignalingServerConfiguration signalingServerConfiguration,
     WebrtcConfiguration webrtcConfiguration)
-    : SignalingClient(move(signalingServerConfiguration), move(webrtcConfiguration)),
-      m_hasOnMixedAudioFrameReceivedCallback(false),
-      m_isLocalAudioMuted(false),
-      m_isRemoteAudioMuted(false),
-      m_isLocalVideoMuted(false)
+    : StreamClient(move(signalingServerConfiguration), move(webrtcConfiguration), nullptr, nullptr, nullptr)
 {
 }
 
@@ -33,12 +36,7 @@ StreamClient::StreamClient(
     SignalingServerConfiguration signalingServerConfiguration,
     WebrtcConfiguration webrtcConfiguration,
     shared_ptr<VideoSource> videoSource)
-    : SignalingClient(move(signalingServerConfiguration), move(webrtcConfiguration)),
-      m_videoSource(move(videoSource)),
-      m_hasOnMixedAudioFrameReceivedCallback(false),
-      m_isLocalAudioMuted(false),
-      m_isRemoteAudioMuted(false),
-      m_isLocalVideoMuted(false)
+    : StreamClient(move(signalingServerConfiguration), move(webrtcConfiguration), move(videoSource), nullptr, nullptr)
 {
 }
 
@@ -54,18 +52,8 @@ StreamClient::StreamClient(
     SignalingServerConfiguration signalingServerConfiguration,
     WebrtcConfiguration webrtcConfiguration,
     shared_ptr<AudioSource> audioSource)
-    : SignalingClient(move(signalingServerConfiguration), move(webrtcConfiguration)),
-      m_audioSource(move(audioSource)),
-      m_hasOnMixedAudioFrameReceivedCallback(false),
-      m_isLocalAudioMuted(false),
-      m_isRemoteAudioMuted(false),
-      m_isLocalVideoMuted(false)
+    : StreamClient(move(signalingServerConfiguration), move(webrtcConfiguration), nullptr, move(audioSource), nullptr)
 {
-    if (m_audioSource != nullptr)
-    {
-        m_audioProcessing->ApplyConfig(static_cast<webrtc::AudioProcessing::Config>(m_audioSource->configuration()));
-        m_audioSource->setAudioDeviceModule(m_audioDeviceModule);
-    }
 }
 
 /**
@@ -82,18 +70,56 @@ StreamClient::StreamClient(
     WebrtcConfiguration webrtcConfiguration,
     shared_ptr<VideoSource> videoSource,
     shared_ptr<AudioSource> audioSource)
-    : SignalingClient(move(signalingServerConfiguration), move(webrtcConfiguration)),
+    : StreamClient(
+          move(signalingServerConfiguration),
+          move(webrtcConfiguration),
+          move(videoSource),
+          move(audioSource),
+          nullptr)
+{
+}
+
+/**
+ * @brief Creates a stream client
+ *
+ * @param signalingServerConfiguration The configuration to connect to the
+ * signaling server
+ * @param webrtcConfiguration The WebRTC configuration
+ * @param videoSource The video source that this client will add to the call (can be nullptr)
+ * @param audioSource The audio source that this client will add to the call (can be nullptr)
+ * @param audioMixer The audio mixer used to mix the remote audio streams (nullptr to use OpenteraAudioMixer)
+ */
+StreamClient::StreamClient(
+    SignalingServerConfiguration signalingServerConfiguration,
+    WebrtcConfiguration webrtcConfiguration,
+    shared_ptr<VideoSource> videoSource,
+    shared_ptr<AudioSource> audioSource,
+    rtc::scoped_refptr<webrtc::AudioMixer> audioMixer)
+    : SignalingClient(
+          move(signalingServerConfiguration),
+          move(webrtcConfiguration),
+          move(audioMixer),
+          isAudioProcessingEnabled(audioSource)),
       m_videoSource(move(videoSource)),
       m_audioSource(move(audioSource)),
       m_hasOnMixedAudioFrameReceivedCallback(false),
+      m_audioSinkConfiguration(AudioSinkConfiguration::create()),
+      m_isAudioLevelMeteringEnabled(false),
+      m_isStereoAudioEnabled(false),
+      m_isAudioVideoSynchronizationEnabled(false),
       m_isLocalAudioMuted(false),
       m_isRemoteAudioMuted(false),
       m_isLocalVideoMuted(false)
 {
     if (m_audioSource != nullptr)
     {
-        m_audioProcessing->ApplyConfig(static_cast<webrtc::AudioProcessing::Config>(m_audioSource->configuration()));
+        if (m_audioProcessing != nullptr)
+        {
+            m_audioProcessing->ApplyConfig(
+                static_cast<webrtc::AudioProcessing::Config>(m_audioSource->configuration()));
+        }
         m_audioSource->setAudioDeviceModule(m_audioDeviceModule);
+        m_audioEncoderFactory->setEncodedAudioSource(dynamic_pointer_cast<EncodedAudioSource>(m_audioSource));
     }
 }
 
@@ -104,6 +130,8 @@ StreamClient::~StreamClient()
         m_audioSource->setAudioDeviceModule(nullptr);
     }
 
+    m_audioDeviceModule->setMixedAudioRecorder(nullptr);
+
     // The Python callback must be destroyed on the Python thread.
     m_audioDeviceModule->setOnMixedAudioFrameReceived(function<void(const void*, int, int, size_t, size_t)>());
 }
@@ -162,6 +190,87 @@ void StreamClient::setLocalVideoMuted(bool muted)
         });
 }
 
+/**
+ * @brief Sets the gain applied to the audio received from a peer before it is mixed.
+ *
+ * A gain of 0 silences the peer, so the audio mixer skips it.
+ *
+ * @param id The peer id
+ * @param gain The linear gain (clamped between 0 and 10, 1 by default)
+ */
+void StreamClient::setRemoteAudioGain(const string& id, double gain)
+{
+    constexpr double MinGain = 0.0;
+    constexpr double MaxGain = 10.0;
+    gain = clamp(gain, MinGain, MaxGain);
+
+    callSync(
+        getInternalClientThread(),
+        [this, &id, gain]()
+        {
+            m_remoteAudioGainsById[id] = gain;
+            auto it = m_peerConnectionHandlersById.find(id);
+            if (it != m_peerConnectionHandlersById.end())
+            {
+                dynamic_cast<StreamPeerConnectionHandler*>(it->second.get())->setRemoteAudioGain(gain);
+            }
+        });
+}
+
+/**
+ * @brief Returns the last audio level of each connected peer.
+ *
+ * The levels are only computed if the audio level metering is enabled or if an audio level callback is set.
+ *
+ * @return The audio levels by peer id
+ */
+map<string, AudioLevel> StreamClient::getRemoteAudioLevels()
+{
+    return callSync(
+        getInternalClientThread(),
+        [this]()
+        {
+            map<string, AudioLevel> levels;
+            for (auto& pair : m_peerConnectionHandlersById)
+            {
+                levels[pair.first] = dynamic_cast<StreamPeerConnectionHandler*>(pair.second.get())->audioLevel();
+            }
+            return levels;
+        });
+}
+
+/**
+ * @brief Sets the recorder of the audio received from a peer (nullptr to stop recording).
+ *
+ * The recorder is kept if the peer reconnects. The remote audio is only received if an audio frame callback, an
+ * audio level callback, a mixed audio frame callback or the audio level metering is set.
+ *
+ * @param id The peer id
+ * @param audioRecorder The recorder
+ */
+void StreamClient::setRemoteAudioRecorder(const string& id, shared_ptr<AudioRecorder> audioRecorder)
+{
+    callSync(
+        getInternalClientThread(),
+        [this, &id, &audioRecorder]()
+        {
+            if (audioRecorder == nullptr)
+            {
+                m_remoteAudioRecordersById.erase(id);
+            }
+            else
+            {
+                m_remoteAudioRecordersById[id] = audioRecorder;
+            }
+
+            auto it = m_peerConnectionHandlersById.find(id);
+            if (it != m_peerConnectionHandlersById.end())
+            {
+                dynamic_cast<StreamPeerConnectionHandler*>(it->second.get())->setAudioRecorder(audioRecorder);
+            }
+        });
+}
+
 /**
  * @brief Creates the peer connection handler for this client
  *
@@ -191,7 +300,7 @@ unique_ptr<PeerConnectionHandler>
     auto onAddRemoteStream = [this](const Client& client) { invokeIfCallable(m_onAddRemoteStream, client); };
     auto onRemoveRemoteStream = [this](const Client& client) { invokeIfCallable(m_onRemoveRemoteStream, client); };
 
-    return make_unique<StreamPeerConnectionHandler>(
+    auto handler = make_unique<StreamPeerConnectionHandler>(
         id,
         peerClient,
         isCaller,
@@ -206,5 +315,25 @@ unique_ptr<PeerConnectionHandler>
         onRemoveRemoteStream,
         m_onVideoFrameReceived,
         m_onEncodedVideoFrameReceived,
-        m_onAudioFrameReceived);
+        m_onAudioFrameReceived,
+        m_onTimestampedAudioFrameReceived,
+        m_audioSinkConfiguration,
+        m_onEncodedAudioFrameReceived,
+        m_isAudioLevelMeteringEnabled,
+        m_onAudioLevelChanged,
+        m_isAudioVideoSynchronizationEnabled);
+
+    handler->setStereoAudioEnabled(m_isStereoAudioEnabled);
+
+    auto gainIt = m_remoteAudioGainsById.find(peerClient.id());
+    if (gainIt != m_remoteAudioGainsById.end())
+    {
+        handler->setRemoteAudioGain(gainIt->second);
+    }
+    auto recorderIt = m_remoteAudioRecordersById.find(peerClient.id());
+    if (recorderIt != m_remoteAudioRecordersById.end())
+    {
+        handler->setAudioRecorder(recorderIt->second);
+    }
+    return handler;
 }
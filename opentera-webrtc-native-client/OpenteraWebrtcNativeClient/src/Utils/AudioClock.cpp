@@ -0,0 +1,79 @@
+#include <OpenteraWebrtcNativeClient/Utils/AudioClock.h>
+
+#include <thread>
+
+using namespace opentera;
+using namespace std;
+
+chrono::nanoseconds RealTimeAudioClock::now()
+{
+    return chrono::duration_cast<chrono::nanoseconds>(chrono::steady_clock::now().time_since_epoch());
+}
+
+void RealTimeAudioClock::sleepUntil(chrono::nanoseconds time)
+{
+    auto duration = chrono::duration_cast<chrono::steady_clock::duration>(time);
+    this_thread::sleep_until(chrono::steady_clock::time_point(duration));
+}
+
+void RealTimeAudioClock::wakeUp()
+{
+    // The playout sleeps are at most one frame long, so there is no need to interrupt them.
+}
+
+/**
+ * @brief Creates a virtual audio clock starting at 0.
+ * @param isFreeRunning Indicates if sleepUntil jumps to the requested time instead of waiting for advance
+ */
+VirtualAudioClock::VirtualAudioClock(bool isFreeRunning)
+    : m_isFreeRunning(isFreeRunning),
+      m_time(0),
+      m_isWakeUpRequested(false)
+{
+}
+
+/**
+ * @brief Advances the time and wakes up the thread blocked in sleepUntil if the requested time is reached.
+ * @param duration The duration to add to the current time
+ */
+void VirtualAudioClock::advance(chrono::nanoseconds duration)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_time += duration;
+    }
+    m_condition.notify_all();
+}
+
+chrono::nanoseconds VirtualAudioClock::now()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_time;
+}
+
+void VirtualAudioClock::sleepUntil(chrono::nanoseconds time)
+{
+    if (m_isFreeRunning)
+    {
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_time = max(m_time, time);
+        }
+        // Let the other threads feed the audio transport.
+        this_thread::yield();
+        return;
+    }
+
+    unique_lock<mutex> lock(m_mutex);
+    m_condition.wait(lock, [this, time]() { return m_time >= time || m_isWakeUpRequested; });
+    m_isWakeUpRequested = false;
+}
+
+void VirtualAudioClock::wakeUp()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_isWakeUpRequested = true;
+    }
+    m_condition.notify_all();
+}
@@ -0,0 +1,241 @@
+#include <OpenteraWebrtcNativeClient/Utils/AudioConverter.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+template<class T>
+static void resizeIfNeeded(vector<T>& buffer, size_t size)
+{
+    if (buffer.size() < size)
+    {
+        buffer.resize(size);
+    }
+}
+
+static void mixChannels(
+    const int16_t* input,
+    int16_t* output,
+    size_t numberOfFrames,
+    size_t inputNumberOfChannels,
+    size_t outputNumberOfChannels)
+{
+    if (outputNumberOfChannels == 1)
+    {
+        for (size_t i = 0; i < numberOfFrames; i++)
+        {
+            int32_t sum = 0;
+            for (size_t j = 0; j < inputNumberOfChannels; j++)
+            {
+                sum += input[i * inputNumberOfChannels + j];
+            }
+            output[i] = static_cast<int16_t>(sum / static_cast<int32_t>(inputNumberOfChannels));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < numberOfFrames; i++)
+        {
+            for (size_t j = 0; j < outputNumberOfChannels; j++)
+            {
+                output[i * outputNumberOfChannels + j] = input[i * inputNumberOfChannels + j % inputNumberOfChannels];
+            }
+        }
+    }
+}
+
+static void convertSamples(const int16_t* input, uint8_t* output, size_t numberOfSamples, int bitsPerSample)
+{
+    if (bitsPerSample == 8)
+    {
+        auto output8 = reinterpret_cast<int8_t*>(output);
+        for (size_t i = 0; i < numberOfSamples; i++)
+        {
+            output8[i] = static_cast<int8_t>(input[i] / 256);
+        }
+    }
+    else
+    {
+        auto output32 = reinterpret_cast<int32_t*>(output);
+        for (size_t i = 0; i < numberOfSamples; i++)
+        {
+            output32[i] = static_cast<int32_t>(input[i]) * 65536;
+        }
+    }
+}
+
+/**
+ * @brief Creates an audio converter.
+ *
+ * @param configuration The output format
+ * @throw runtime_error if a value of the configuration is invalid
+ */
+AudioConverter::AudioConverter(AudioSinkConfiguration configuration)
+    : m_configuration(move(configuration)),
+      m_chunkFrameCount(0),
+      m_chunkBitsPerSample(0),
+      m_chunkSampleRate(0),
+      m_chunkNumberOfChannels(0),
+      m_chunkTimestampUs(0)
+{
+    auto bitsPerSample = m_configuration.bitsPerSample();
+    if (bitsPerSample.has_value() && bitsPerSample != 8 && bitsPerSample != 16 && bitsPerSample != 32)
+    {
+        throw runtime_error("Invalid bitsPerSample");
+    }
+    auto sampleRate = m_configuration.sampleRate();
+    if (sampleRate.has_value() && (sampleRate.value() <= 0 || sampleRate.value() % 100 != 0))
+    {
+        throw runtime_error("Invalid sampleRate");
+    }
+    if (m_configuration.numberOfChannels() == 0u)
+    {
+        throw runtime_error("Invalid numberOfChannels");
+    }
+    if (m_configuration.numberOfFramesPerChunk() == 0u)
+    {
+        throw runtime_error("Invalid numberOfFramesPerChunk");
+    }
+}
+
+/**
+ * @brief Converts 10 ms of decoded audio and calls the callback for each complete frame or chunk.
+ *
+ * @param audioData The audio data (16 bits)
+ * @param bitsPerSample The audio stream sample size (only 16 bits is supported)
+ * @param sampleRate The audio stream sample rate
+ * @param numberOfChannels The audio stream channel count
+ * @param numberOfFrames The number of frames
+ * @param timestampUs The timestamp of the first frame in microseconds
+ * @param callback The callback that receives the converted audio (the timestamp is the one of the first frame)
+ */
+void AudioConverter::convert(
+    const void* audioData,
+    int bitsPerSample,
+    int sampleRate,
+    size_t numberOfChannels,
+    size_t numberOfFrames,
+    uint64_t timestampUs,
+    const Callback& callback)
+{
+    // The WebRTC decoders always produce 16 bits samples.
+    if (bitsPerSample != 16 || numberOfChannels == 0)
+    {
+        return;
+    }
+
+    const int16_t* samples = reinterpret_cast<const int16_t*>(audioData);
+    int outputBitsPerSample = m_configuration.bitsPerSample().value_or(bitsPerSample);
+    int outputSampleRate = m_configuration.sampleRate().value_or(sampleRate);
+    size_t outputNumberOfChannels = m_configuration.numberOfChannels().value_or(numberOfChannels);
+
+    if (outputNumberOfChannels != numberOfChannels)
+    {
+        resizeIfNeeded(m_mixedData, numberOfFrames * outputNumberOfChannels);
+        mixChannels(samples, m_mixedData.data(), numberOfFrames, numberOfChannels, outputNumberOfChannels);
+        samples = m_mixedData.data();
+    }
+
+    if (outputSampleRate != sampleRate)
+    {
+        // The resampler only converts 10 ms frames.
+        if (numberOfFrames * 100 != static_cast<size_t>(sampleRate) ||
+            m_resampler.InitializeIfNeeded(sampleRate, outputSampleRate, outputNumberOfChannels) != 0)
+        {
+            return;
+        }
+
+        size_t outputNumberOfFrames = outputSampleRate / 100;
+        resizeIfNeeded(m_resampledData, outputNumberOfFrames * outputNumberOfChannels);
+        if (m_resampler.Resample(
+                samples,
+                numberOfFrames * outputNumberOfChannels,
+                m_resampledData.data(),
+                outputNumberOfFrames * outputNumberOfChannels) < 0)
+        {
+            return;
+        }
+        samples = m_resampledData.data();
+        numberOfFrames = outputNumberOfFrames;
+    }
+
+    const void* output = samples;
+    if (outputBitsPerSample != 16)
+    {
+        size_t numberOfSamples = numberOfFrames * outputNumberOfChannels;
+        resizeIfNeeded(m_convertedData, numberOfSamples * outputBitsPerSample / 8);
+        convertSamples(samples, m_convertedData.data(), numberOfSamples, outputBitsPerSample);
+        output = m_convertedData.data();
+    }
+
+    if (m_configuration.numberOfFramesPerChunk().has_value())
+    {
+        addToChunk(
+            reinterpret_cast<const uint8_t*>(output),
+            outputBitsPerSample,
+            outputSampleRate,
+            outputNumberOfChannels,
+            numberOfFrames,
+            timestampUs,
+            callback);
+    }
+    else
+    {
+        callback(output, outputBitsPerSample, outputSampleRate, outputNumberOfChannels, numberOfFrames, timestampUs);
+    }
+}
+
+void AudioConverter::addToChunk(
+    const uint8_t* data,
+    int bitsPerSample,
+    int sampleRate,
+    size_t numberOfChannels,
+    size_t numberOfFrames,
+    uint64_t timestampUs,
+    const Callback& callback)
+{
+    size_t chunkNumberOfFrames = m_configuration.numberOfFramesPerChunk().value();
+    size_t bytesPerFrame = bitsPerSample / 8 * numberOfChannels;
+
+    if (bitsPerSample != m_chunkBitsPerSample || sampleRate != m_chunkSampleRate ||
+        numberOfChannels != m_chunkNumberOfChannels)
+    {
+        m_chunkFrameCount = 0;
+        m_chunkBitsPerSample = bitsPerSample;
+        m_chunkSampleRate = sampleRate;
+        m_chunkNumberOfChannels = numberOfChannels;
+        resizeIfNeeded(m_chunkData, chunkNumberOfFrames * bytesPerFrame);
+    }
+
+    size_t offset = 0;
+    while (offset < numberOfFrames)
+    {
+        if (m_chunkFrameCount == 0)
+        {
+            m_chunkTimestampUs = timestampUs + offset * 1000000 / sampleRate;
+        }
+
+        size_t frameCount = min(numberOfFrames - offset, chunkNumberOfFrames - m_chunkFrameCount);
+        memcpy(
+            m_chunkData.data() + m_chunkFrameCount * bytesPerFrame,
+            data + offset * bytesPerFrame,
+            frameCount * bytesPerFrame);
+        m_chunkFrameCount += frameCount;
+        offset += frameCount;
+
+        if (m_chunkFrameCount == chunkNumberOfFrames)
+        {
+            callback(
+                m_chunkData.data(),
+                bitsPerSample,
+                sampleRate,
+                numberOfChannels,
+                chunkNumberOfFrames,
+                m_chunkTimestampUs);
+            m_chunkFrameCount = 0;
+        }
+    }
+}
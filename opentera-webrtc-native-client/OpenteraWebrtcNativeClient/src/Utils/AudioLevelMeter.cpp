@@ -0,0 +1,173 @@
+#include <OpenteraWebrtcNativeClient/Utils/AudioLevelMeter.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+// The loops are plain reductions over contiguous samples so the compiler vectorizes them.
+template<class T>
+static double normalizedSumOfSquares(const T* data, size_t sampleCount)
+{
+    int64_t sum = 0;
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        int64_t sample = data[i];
+        sum += sample * sample;
+    }
+
+    constexpr double FullScale = static_cast<double>(numeric_limits<T>::max()) + 1.0;
+    return static_cast<double>(sum) / (FullScale * FullScale);
+}
+
+template<>
+double normalizedSumOfSquares(const int32_t* data, size_t sampleCount)
+{
+    constexpr double FullScale = static_cast<double>(numeric_limits<int32_t>::max()) + 1.0;
+    double sum = 0.0;
+    for (size_t i = 0; i < sampleCount; i++)
+    {
+        double sample = static_cast<double>(data[i]) / FullScale;
+        sum += sample * sample;
+    }
+    return sum;
+}
+
+static double normalizedSumOfSquares(const void* audioData, int bitsPerSample, size_t sampleCount)
+{
+    switch (bitsPerSample)
+    {
+        case 8:
+            return normalizedSumOfSquares(reinterpret_cast<const int8_t*>(audioData), sampleCount);
+        case 16:
+            return normalizedSumOfSquares(reinterpret_cast<const int16_t*>(audioData), sampleCount);
+        case 32:
+            return normalizedSumOfSquares(reinterpret_cast<const int32_t*>(audioData), sampleCount);
+        default:
+            throw runtime_error("Invalid bitsPerSample");
+    }
+}
+
+static float meanSquareToDbfs(double meanSquare)
+{
+    if (meanSquare <= 0.0)
+    {
+        return AudioLevelMeter::MinLevelDbfs;
+    }
+    return clamp(static_cast<float>(10.0 * log10(meanSquare)), AudioLevelMeter::MinLevelDbfs, 0.f);
+}
+
+/**
+ * @brief Creates an audio level with default values.
+ */
+AudioLevel::AudioLevel() : m_levelDbfs(AudioLevelMeter::MinLevelDbfs), m_isVoiceActive(false) {}
+
+/**
+ * @brief Creates an audio level with the specified values.
+ *
+ * @param levelDbfs The RMS level (dBFS)
+ * @param isVoiceActive Indicates if voice activity is detected
+ */
+AudioLevel::AudioLevel(float levelDbfs, bool isVoiceActive) : m_levelDbfs(levelDbfs), m_isVoiceActive(isVoiceActive)
+{
+}
+
+/**
+ * @brief Creates an audio level meter with the specified values.
+ *
+ * @param updateIntervalMs The interval over which the RMS level is computed
+ * @param vadThresholdDbfs The level over which a frame contains voice activity
+ * @param vadHangoverMs The duration the voice activity is kept after the last active frame
+ */
+AudioLevelMeter::AudioLevelMeter(size_t updateIntervalMs, float vadThresholdDbfs, size_t vadHangoverMs)
+    : m_updateIntervalMs(updateIntervalMs),
+      m_vadThresholdDbfs(vadThresholdDbfs),
+      m_vadHangoverMs(vadHangoverMs),
+      m_intervalSumOfSquares(0.0),
+      m_intervalSampleCount(0),
+      m_intervalFrameCount(0),
+      m_vadHangoverRemainingFrameCount(0),
+      m_levelDbfs(MinLevelDbfs),
+      m_isVoiceActive(false)
+{
+}
+
+/**
+ * @brief Adds audio data to the meter.
+ *
+ * @param audioData The audio data
+ * @param bitsPerSample The audio stream sample size (8, 16 or 32 bits)
+ * @param sampleRate The audio stream sample rate
+ * @param numberOfChannels The audio stream channel count
+ * @param numberOfFrames The number of frames
+ * @return true if an interval is complete and a new level is available
+ * @throw runtime_error if bitsPerSample is invalid
+ */
+bool AudioLevelMeter::update(
+    const void* audioData,
+    int bitsPerSample,
+    int sampleRate,
+    size_t numberOfChannels,
+    size_t numberOfFrames)
+{
+    size_t sampleCount = numberOfChannels * numberOfFrames;
+    if (sampleCount == 0)
+    {
+        return false;
+    }
+
+    double sumOfSquares = normalizedSumOfSquares(audioData, bitsPerSample, sampleCount);
+
+    bool isFrameVoiceActive = meanSquareToDbfs(sumOfSquares / sampleCount) >= m_vadThresholdDbfs;
+    if (isFrameVoiceActive)
+    {
+        m_vadHangoverRemainingFrameCount = static_cast<size_t>(sampleRate) * m_vadHangoverMs / 1000;
+    }
+    else
+    {
+        m_vadHangoverRemainingFrameCount -= min(m_vadHangoverRemainingFrameCount, numberOfFrames);
+    }
+    m_isVoiceActive.store(isFrameVoiceActive || m_vadHangoverRemainingFrameCount > 0, memory_order_relaxed);
+
+    m_intervalSumOfSquares += sumOfSquares;
+    m_intervalSampleCount += sampleCount;
+    m_intervalFrameCount += numberOfFrames;
+    if (m_intervalFrameCount * 1000 < static_cast<size_t>(sampleRate) * m_updateIntervalMs)
+    {
+        return false;
+    }
+
+    m_levelDbfs.store(meanSquareToDbfs(m_intervalSumOfSquares / m_intervalSampleCount), memory_order_relaxed);
+    m_intervalSumOfSquares = 0.0;
+    m_intervalSampleCount = 0;
+    m_intervalFrameCount = 0;
+    return true;
+}
+
+/**
+ * @brief Computes the RMS level of audio data.
+ *
+ * @param audioData The audio data
+ * @param bitsPerSample The audio stream sample size (8, 16 or 32 bits)
+ * @param numberOfChannels The audio stream channel count
+ * @param numberOfFrames The number of frames
+ * @return The RMS level (dBFS, between -127 and 0)
+ * @throw runtime_error if bitsPerSample is invalid
+ */
+float opentera::computeRmsDbfs(
+    const void* audioData,
+    int bitsPerSample,
+    size_t numberOfChannels,
+    size_t numberOfFrames)
+{
+    size_t sampleCount = numberOfChannels * numberOfFrames;
+    if (sampleCount == 0)
+    {
+        return AudioLevelMeter::MinLevelDbfs;
+    }
+    return meanSquareToDbfs(normalizedSumOfSquares(audioData, bitsPerSample, sampleCount) / sampleCount);
+}
@@ -0,0 +1,232 @@
+#include <OpenteraWebrtcNativeClient/Utils/BufferedAmountTracker.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+BufferedAmountTracker::BufferedAmountTracker() : m_lowWatermark(0), m_highWatermark(UnboundedHighWatermark) {}
+
+/**
+ * @brief Sets the watermarks of the buffered amount.
+ *
+ * @param lowWatermark The buffered amount at or under which a blocked peer is unblocked (bytes)
+ * @param highWatermark The buffered amount over which reservations are refused (bytes)
+ * @throw runtime_error if the low watermark is greater than the high watermark
+ */
+void BufferedAmountTracker::setWatermarks(uint64_t lowWatermark, uint64_t highWatermark)
+{
+    if (lowWatermark > highWatermark)
+    {
+        throw runtime_error("The low watermark must be less than or equal to the high watermark.");
+    }
+
+    lock_guard<mutex> lock(m_mutex);
+    m_lowWatermark = lowWatermark;
+    m_highWatermark = highWatermark;
+}
+
+/**
+ * @brief Returns the low watermark.
+ * @return The low watermark (bytes)
+ */
+uint64_t BufferedAmountTracker::lowWatermark() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_lowWatermark;
+}
+
+/**
+ * @brief Returns the high watermark.
+ * @return The high watermark (bytes)
+ */
+uint64_t BufferedAmountTracker::highWatermark() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_highWatermark;
+}
+
+/**
+ * @brief Starts tracking a peer.
+ * @param id The peer id
+ */
+void BufferedAmountTracker::addPeer(const string& id)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_peerStatesById[id] = PeerState{0, false};
+}
+
+/**
+ * @brief Stops tracking a peer.
+ * @param id The peer id
+ */
+void BufferedAmountTracker::removePeer(const string& id)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_peerStatesById.erase(id);
+}
+
+/**
+ * @brief Returns the ids of the tracked peers.
+ * @return The ids of the tracked peers
+ */
+vector<string> BufferedAmountTracker::peerIds() const
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    vector<string> ids;
+    ids.reserve(m_peerStatesById.size());
+    for (const auto& pair : m_peerStatesById)
+    {
+        ids.push_back(pair.first);
+    }
+    return ids;
+}
+
+/**
+ * @brief Returns the number of bytes accepted for a peer and not sent yet.
+ *
+ * @param id The peer id
+ * @return The buffered amount of the peer, or 0 if the peer is not tracked (bytes)
+ */
+uint64_t BufferedAmountTracker::bufferedAmount(const string& id) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_peerStatesById.find(id);
+    return it == m_peerStatesById.end() ? 0 : it->second.bufferedAmount;
+}
+
+/**
+ * @brief Reserves the specified number of bytes for each peer, or nothing if one peer would exceed the high
+ * watermark.
+ *
+ * A peer with an empty buffer always accepts a reservation, so messages larger than the high watermark can be sent.
+ * The peers that are not tracked are ignored.
+ *
+ * @param sizesById The number of bytes to reserve for each peer
+ * @return true if the bytes are reserved, false if the caller should wait for the low watermark
+ */
+bool BufferedAmountTracker::tryReserve(const map<string, uint64_t>& sizesById)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    bool wouldBlock = false;
+    for (const auto& pair : sizesById)
+    {
+        auto it = m_peerStatesById.find(pair.first);
+        if (it == m_peerStatesById.end())
+        {
+            continue;
+        }
+
+        PeerState& state = it->second;
+        if (state.bufferedAmount > 0 &&
+            (state.bufferedAmount >= m_highWatermark || pair.second > m_highWatermark - state.bufferedAmount))
+        {
+            state.isBlocked = true;
+            wouldBlock = true;
+        }
+    }
+    if (wouldBlock)
+    {
+        return false;
+    }
+
+    for (const auto& pair : sizesById)
+    {
+        auto it = m_peerStatesById.find(pair.first);
+        if (it != m_peerStatesById.end())
+        {
+            it->second.bufferedAmount += pair.second;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Reserves the same number of bytes for the specified peers.
+ *
+ * @param ids The peer ids
+ * @param size The number of bytes to reserve for each peer
+ * @return true if the bytes are reserved, false if the caller should wait for the low watermark
+ */
+bool BufferedAmountTracker::tryReserve(const vector<string>& ids, uint64_t size)
+{
+    map<string, uint64_t> sizesById;
+    for (const auto& id : ids)
+    {
+        sizesById[id] += size;
+    }
+    return tryReserve(sizesById);
+}
+
+/**
+ * @brief Reserves the same number of bytes for all tracked peers.
+ *
+ * @param size The number of bytes to reserve for each peer
+ * @return true if the bytes are reserved, false if the caller should wait for the low watermark
+ */
+bool BufferedAmountTracker::tryReserveAll(uint64_t size) { return tryReserve(peerIds(), size); }
+
+/**
+ * @brief Reserves the same number of bytes for the specified peers, even if it exceeds the high watermark.
+ *
+ * The peers that are not tracked are ignored.
+ *
+ * @param ids The peer ids
+ * @param size The number of bytes to reserve for each peer
+ */
+void BufferedAmountTracker::reserve(const vector<string>& ids, uint64_t size)
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (const auto& id : ids)
+    {
+        auto it = m_peerStatesById.find(id);
+        if (it != m_peerStatesById.end())
+        {
+            it->second.bufferedAmount += size;
+        }
+    }
+}
+
+/**
+ * @brief Reserves the same number of bytes for all tracked peers, even if it exceeds the high watermark.
+ *
+ * @param size The number of bytes to reserve for each peer
+ */
+void BufferedAmountTracker::reserveAll(uint64_t size)
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto& pair : m_peerStatesById)
+    {
+        pair.second.bufferedAmount += size;
+    }
+}
+
+/**
+ * @brief Releases bytes that are sent or dropped.
+ *
+ * @param id The peer id
+ * @param size The number of bytes to release
+ * @return true if the peer was blocked and its buffered amount reached the low watermark
+ */
+bool BufferedAmountTracker::release(const string& id, uint64_t size)
+{
+    lock_guard<mutex> lock(m_mutex);
+
+    auto it = m_peerStatesById.find(id);
+    if (it == m_peerStatesById.end())
+    {
+        return false;
+    }
+
+    PeerState& state = it->second;
+    state.bufferedAmount -= min(size, state.bufferedAmount);
+    if (state.isBlocked && state.bufferedAmount <= m_lowWatermark)
+    {
+        state.isBlocked = false;
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,74 @@
+#include <OpenteraWebrtcNativeClient/Utils/ClockOffsetEstimator.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+// The smoothed round-trip time follows each sample with this weight, as the TCP smoothed round-trip time.
+constexpr int64_t SmoothingDivisor = 8;
+
+/**
+ * @brief Creates a clock offset estimator.
+ *
+ * @param windowSize The number of last samples the offset is selected from
+ * @throw runtime_error if the window size is 0
+ */
+ClockOffsetEstimator::ClockOffsetEstimator(size_t windowSize)
+    : m_windowSize(windowSize),
+      m_offsetUs(0),
+      m_roundTripTimeUs(0),
+      m_smoothedRoundTripTimeUs(0)
+{
+    if (m_windowSize == 0)
+    {
+        throw runtime_error("The window size must be greater than 0.");
+    }
+}
+
+/**
+ * @brief Adds the sample of a request-response exchange.
+ *
+ * @param originateTimeUs The time the request was sent, in the local clock (us)
+ * @param receiveTimeUs The time the request was received, in the peer clock (us)
+ * @param transmitTimeUs The time the response was sent, in the peer clock (us)
+ * @param destinationTimeUs The time the response was received, in the local clock (us)
+ * @return false if the sample is invalid and ignored
+ */
+bool ClockOffsetEstimator::addSample(
+    int64_t originateTimeUs,
+    int64_t receiveTimeUs,
+    int64_t transmitTimeUs,
+    int64_t destinationTimeUs)
+{
+    int64_t roundTripTimeUs = (destinationTimeUs - originateTimeUs) - (transmitTimeUs - receiveTimeUs);
+    if (transmitTimeUs < receiveTimeUs || roundTripTimeUs < 0)
+    {
+        return false;
+    }
+
+    int64_t offsetUs = ((receiveTimeUs - originateTimeUs) + (transmitTimeUs - destinationTimeUs)) / 2;
+    if (m_samples.empty())
+    {
+        m_smoothedRoundTripTimeUs = roundTripTimeUs;
+    }
+    else
+    {
+        m_smoothedRoundTripTimeUs += (roundTripTimeUs - m_smoothedRoundTripTimeUs) / SmoothingDivisor;
+    }
+
+    m_samples.push_back({offsetUs, roundTripTimeUs});
+    if (m_samples.size() > m_windowSize)
+    {
+        m_samples.pop_front();
+    }
+
+    auto bestSample = min_element(
+        m_samples.begin(),
+        m_samples.end(),
+        [](const Sample& a, const Sample& b) { return a.roundTripTimeUs < b.roundTripTimeUs; });
+    m_offsetUs = bestSample->offsetUs;
+    m_roundTripTimeUs = bestSample->roundTripTimeUs;
+    return true;
+}
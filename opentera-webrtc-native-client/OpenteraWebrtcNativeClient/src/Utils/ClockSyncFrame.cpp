@@ -0,0 +1,100 @@
+#include <OpenteraWebrtcNativeClient/Utils/ClockSyncFrame.h>
+
+using namespace opentera;
+using namespace std;
+
+static void writeInt64(uint8_t* data, int64_t value)
+{
+    uint64_t unsignedValue = static_cast<uint64_t>(value);
+    for (size_t i = 0; i < sizeof(unsignedValue); i++)
+    {
+        data[i] = static_cast<uint8_t>(unsignedValue >> (8 * i));
+    }
+}
+
+static int64_t readInt64(const uint8_t* data)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(value); i++)
+    {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return static_cast<int64_t>(value);
+}
+
+/**
+ * @brief Creates a request frame.
+ *
+ * @param originateTimeUs The time the request is sent, in the clock of the requester (us)
+ * @return The frame
+ */
+webrtc::DataBuffer ClockSyncFrame::encodeRequest(int64_t originateTimeUs)
+{
+    rtc::CopyOnWriteBuffer frame(RequestSize);
+    uint8_t* data = frame.MutableData();
+    data[0] = static_cast<uint8_t>(Type::Request);
+    writeInt64(data + 1, originateTimeUs);
+    return webrtc::DataBuffer(frame, true);
+}
+
+/**
+ * @brief Creates a response frame.
+ *
+ * @param originateTimeUs The originate time of the request (us)
+ * @param receiveTimeUs The time the request was received, in the clock of the responder (us)
+ * @param transmitTimeUs The time the response is sent, in the clock of the responder (us)
+ * @return The frame
+ */
+webrtc::DataBuffer
+    ClockSyncFrame::encodeResponse(int64_t originateTimeUs, int64_t receiveTimeUs, int64_t transmitTimeUs)
+{
+    rtc::CopyOnWriteBuffer frame(ResponseSize);
+    uint8_t* data = frame.MutableData();
+    data[0] = static_cast<uint8_t>(Type::Response);
+    writeInt64(data + 1, originateTimeUs);
+    writeInt64(data + 9, receiveTimeUs);
+    writeInt64(data + 17, transmitTimeUs);
+    return webrtc::DataBuffer(frame, true);
+}
+
+/**
+ * @brief Reads a frame.
+ *
+ * @param frame The frame
+ * @param type The frame type
+ * @param originateTimeUs The originate time (us)
+ * @param receiveTimeUs The receive time (us), 0 for a request
+ * @param transmitTimeUs The transmit time (us), 0 for a request
+ * @return false if the frame is invalid
+ */
+bool ClockSyncFrame::decode(
+    const webrtc::DataBuffer& frame,
+    Type& type,
+    int64_t& originateTimeUs,
+    int64_t& receiveTimeUs,
+    int64_t& transmitTimeUs)
+{
+    if (!frame.binary || frame.size() == 0)
+    {
+        return false;
+    }
+
+    const uint8_t* data = frame.data.data<uint8_t>();
+    if (data[0] == static_cast<uint8_t>(Type::Request) && frame.size() == RequestSize)
+    {
+        type = Type::Request;
+        originateTimeUs = readInt64(data + 1);
+        receiveTimeUs = 0;
+        transmitTimeUs = 0;
+        return true;
+    }
+    if (data[0] == static_cast<uint8_t>(Type::Response) && frame.size() == ResponseSize)
+    {
+        type = Type::Response;
+        originateTimeUs = readInt64(data + 1);
+        receiveTimeUs = readInt64(data + 9);
+        transmitTimeUs = readInt64(data + 17);
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,65 @@
+#include <OpenteraWebrtcNativeClient/Utils/ConflatingQueue.h>
+
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+/**
+ * @brief Creates a conflating queue.
+ *
+ * @param maxSize The maximum number of queued messages
+ * @throw runtime_error if the maximum number of queued messages is 0
+ */
+ConflatingQueue::ConflatingQueue(size_t maxSize) : m_maxSize(maxSize)
+{
+    if (m_maxSize == 0)
+    {
+        throw runtime_error("The maximum size must be greater than 0.");
+    }
+}
+
+/**
+ * @brief Adds a message, or replaces the queued message that has the same key.
+ *
+ * @param key The message key
+ * @param buffer The message
+ * @return The size of the replaced or dropped message, or 0 if no message is replaced or dropped (bytes)
+ */
+size_t ConflatingQueue::push(string key, const webrtc::DataBuffer& buffer)
+{
+    auto it = m_entriesByKey.find(key);
+    if (it != m_entriesByKey.end())
+    {
+        size_t replacedSize = it->second->buffer.size();
+        it->second->buffer = buffer;
+        return replacedSize;
+    }
+
+    size_t droppedSize = 0;
+    if (m_entries.size() >= m_maxSize)
+    {
+        droppedSize = m_entries.front().buffer.size();
+        m_entriesByKey.erase(m_entries.front().key);
+        m_entries.pop_front();
+    }
+
+    m_entries.push_back({move(key), buffer});
+    m_entriesByKey.emplace(m_entries.back().key, prev(m_entries.end()));
+    return droppedSize;
+}
+
+/**
+ * @brief Removes the oldest message.
+ *
+ * The queue must not be empty.
+ *
+ * @return The oldest message
+ */
+webrtc::DataBuffer ConflatingQueue::pop()
+{
+    webrtc::DataBuffer buffer = move(m_entries.front().buffer);
+    m_entriesByKey.erase(m_entries.front().key);
+    m_entries.pop_front();
+    return buffer;
+}
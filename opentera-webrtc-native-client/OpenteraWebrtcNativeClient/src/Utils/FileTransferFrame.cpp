@@ -0,0 +1,180 @@
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferFrame.h>
+
+#include <rtc_base/crc32.h>
+
+#include <algorithm>
+
+using namespace opentera;
+using namespace std;
+
+static void writeUint32(uint8_t* data, uint32_t value)
+{
+    for (size_t i = 0; i < sizeof(value); i++)
+    {
+        data[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+static void writeUint64(uint8_t* data, uint64_t value)
+{
+    for (size_t i = 0; i < sizeof(value); i++)
+    {
+        data[i] = static_cast<uint8_t>(value >> (8 * i));
+    }
+}
+
+static uint32_t readUint32(const uint8_t* data)
+{
+    uint32_t value = 0;
+    for (size_t i = 0; i < sizeof(value); i++)
+    {
+        value |= static_cast<uint32_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+static uint64_t readUint64(const uint8_t* data)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < sizeof(value); i++)
+    {
+        value |= static_cast<uint64_t>(data[i]) << (8 * i);
+    }
+    return value;
+}
+
+static rtc::CopyOnWriteBuffer encodeFrame(
+    FileTransferFrame::Type type,
+    uint32_t transferId,
+    uint64_t value,
+    uint32_t checksum,
+    size_t payloadSize)
+{
+    rtc::CopyOnWriteBuffer frame(FileTransferFrame::HeaderSize + payloadSize);
+    uint8_t* data = frame.MutableData();
+    data[0] = static_cast<uint8_t>(type);
+    writeUint32(data + 1, transferId);
+    writeUint64(data + 5, value);
+    writeUint32(data + 13, checksum);
+    return frame;
+}
+
+/**
+ * @brief Creates a frame without payload.
+ *
+ * @param type The frame type (Accept, Ack, Reject or Cancel)
+ * @param transferId The transfer id
+ * @param value The offset in the file, or 0 if the frame type has no offset
+ * @return The frame
+ */
+webrtc::DataBuffer FileTransferFrame::encode(Type type, uint32_t transferId, uint64_t value)
+{
+    return webrtc::DataBuffer(encodeFrame(type, transferId, value, 0, 0), true);
+}
+
+/**
+ * @brief Creates an offer frame.
+ *
+ * @param transferId The transfer id
+ * @param fileSize The file size (bytes)
+ * @param nonce The random number that identifies the transfer with the transfer id
+ * @param name The file name
+ * @return The frame
+ */
+webrtc::DataBuffer
+    FileTransferFrame::encodeOffer(uint32_t transferId, uint64_t fileSize, uint64_t nonce, const string& name)
+{
+    rtc::CopyOnWriteBuffer frame = encodeFrame(Type::Offer, transferId, fileSize, 0, OfferNonceSize + name.size());
+    writeUint64(frame.MutableData() + HeaderSize, nonce);
+    copy(name.begin(), name.end(), frame.MutableData() + HeaderSize + OfferNonceSize);
+    return webrtc::DataBuffer(frame, true);
+}
+
+/**
+ * @brief Creates a chunk frame, which holds a copy of the file data.
+ *
+ * @param transferId The transfer id
+ * @param offset The offset of the data in the file
+ * @param data The file data
+ * @param size The file data size
+ * @return The frame
+ */
+webrtc::DataBuffer
+    FileTransferFrame::encodeChunk(uint32_t transferId, uint64_t offset, const uint8_t* data, size_t size)
+{
+    rtc::CopyOnWriteBuffer frame = encodeFrame(Type::Chunk, transferId, offset, checksum(data, size), size);
+    copy_n(data, size, frame.MutableData() + HeaderSize);
+    return webrtc::DataBuffer(frame, true);
+}
+
+/**
+ * @brief Reads a frame.
+ *
+ * The checksum of the chunks is not verified, so the receiver can request the data again.
+ *
+ * @param frame The frame
+ * @param type The frame type
+ * @param transferId The transfer id
+ * @param value The file size for an offer, otherwise an offset in the file
+ * @param checksum The CRC-32 of the payload for a chunk, otherwise 0
+ * @param payload The payload, which shares the frame buffer
+ * @return false if the frame is invalid
+ */
+bool FileTransferFrame::decode(
+    const webrtc::DataBuffer& frame,
+    Type& type,
+    uint32_t& transferId,
+    uint64_t& value,
+    uint32_t& checksum,
+    rtc::CopyOnWriteBuffer& payload)
+{
+    if (!frame.binary || frame.size() < HeaderSize)
+    {
+        return false;
+    }
+
+    const uint8_t* data = frame.data.data<uint8_t>();
+    if (data[0] > static_cast<uint8_t>(Type::Cancel))
+    {
+        return false;
+    }
+
+    type = static_cast<Type>(data[0]);
+    transferId = readUint32(data + 1);
+    value = readUint64(data + 5);
+    checksum = readUint32(data + 13);
+    payload = frame.data.Slice(HeaderSize, frame.size() - HeaderSize);
+    return true;
+}
+
+/**
+ * @brief Reads the payload of an offer frame.
+ *
+ * @param payload The payload returned by decode
+ * @param nonce The random number that identifies the transfer with the transfer id
+ * @param name The file name
+ * @return false if the payload is invalid
+ */
+bool FileTransferFrame::decodeOffer(const rtc::CopyOnWriteBuffer& payload, uint64_t& nonce, string& name)
+{
+    if (payload.size() < OfferNonceSize)
+    {
+        return false;
+    }
+
+    nonce = readUint64(payload.data<uint8_t>());
+    name.assign(payload.data<char>() + OfferNonceSize, payload.size() - OfferNonceSize);
+    return true;
+}
+
+/**
+ * @brief Computes the checksum of chunk data.
+ *
+ * @param data The data
+ * @param size The data size
+ * @return The CRC-32 of the data
+ */
+uint32_t FileTransferFrame::checksum(const uint8_t* data, size_t size)
+{
+    return rtc::ComputeCrc32(data, size);
+}
@@ -0,0 +1,58 @@
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferReceiver.h>
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferFrame.h>
+
+using namespace opentera;
+using namespace std;
+
+/**
+ * @brief Creates a file transfer receiver and allocates the destination file.
+ *
+ * @param name The file name sent by the sender
+ * @param path The destination file path
+ * @param size The file size (bytes)
+ * @throw runtime_error if the destination file cannot be opened or allocated
+ */
+FileTransferReceiver::FileTransferReceiver(string name, const string& path, uint64_t size)
+    : m_name(move(name)),
+      m_size(size),
+      m_file(make_unique<PreallocatedFile>(path, size)),
+      m_writtenOffset(0)
+{
+    if (isComplete())
+    {
+        m_file.reset();
+    }
+}
+
+/**
+ * @brief Writes a received chunk.
+ *
+ * The chunks that do not start at the written offset are ignored, since they were sent before the sender went back
+ * to the written offset.
+ *
+ * @param offset The offset of the chunk in the file
+ * @param checksum The checksum of the chunk
+ * @param data The chunk data
+ * @param size The chunk size
+ * @return false if the chunk is corrupted or outside of the file
+ * @throw runtime_error if the file cannot be written
+ */
+bool FileTransferReceiver::write(uint64_t offset, uint32_t checksum, const uint8_t* data, size_t size)
+{
+    if (offset != m_writtenOffset || isComplete())
+    {
+        return true;
+    }
+    if (size == 0 || size > m_size - offset || FileTransferFrame::checksum(data, size) != checksum)
+    {
+        return false;
+    }
+
+    m_file->write(offset, data, size);
+    m_writtenOffset += size;
+    if (isComplete())
+    {
+        m_file.reset();
+    }
+    return true;
+}
@@ -0,0 +1,115 @@
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferSender.h>
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferFrame.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+/**
+ * @brief Creates a file transfer sender.
+ *
+ * @param id The transfer id, unique per sender
+ * @param nonce The random number sent in the offer, so the receiver does not mistake the transfer for another one
+ * with the same id
+ * @param name The file name sent to the receiver
+ * @param file The file to send
+ * @param chunkSize The maximum number of file bytes in a chunk frame
+ * @param windowSize The maximum number of bytes sent and not acknowledged by the receiver
+ * @throw runtime_error if the chunk size is 0 or greater than the window size
+ */
+FileTransferSender::FileTransferSender(
+    uint32_t id,
+    uint64_t nonce,
+    string name,
+    unique_ptr<MemoryMappedFile> file,
+    size_t chunkSize,
+    uint64_t windowSize)
+    : m_id(id),
+      m_nonce(nonce),
+      m_name(move(name)),
+      m_file(move(file)),
+      m_chunkSize(chunkSize),
+      m_windowSize(windowSize),
+      m_isStarted(false),
+      m_nextOffset(0),
+      m_acknowledgedOffset(0)
+{
+    if (m_chunkSize == 0 || m_chunkSize > m_windowSize)
+    {
+        throw runtime_error("The chunk size must be greater than 0 and less than or equal to the window size.");
+    }
+}
+
+/**
+ * @brief Returns the offer frame of the transfer.
+ * @return The offer frame
+ */
+webrtc::DataBuffer FileTransferSender::offer() const
+{
+    return FileTransferFrame::encodeOffer(m_id, size(), m_nonce, m_name);
+}
+
+/**
+ * @brief Starts sending the chunks from an offset.
+ *
+ * It is called when the receiver accepts the transfer, and when it requests the data again after a corrupted
+ * chunk, so the chunks already sent after the offset are sent again.
+ *
+ * @param offset The offset requested by the receiver
+ */
+void FileTransferSender::start(uint64_t offset)
+{
+    m_isStarted = true;
+    m_acknowledgedOffset = min(offset, size());
+    m_nextOffset = m_acknowledgedOffset;
+}
+
+/**
+ * @brief Stops sending the chunks until the receiver accepts the transfer again.
+ */
+void FileTransferSender::stop()
+{
+    m_isStarted = false;
+}
+
+/**
+ * @brief Indicates if a chunk can be sent without exceeding the window.
+ * @return true if a chunk can be sent
+ */
+bool FileTransferSender::hasChunkToSend() const
+{
+    return m_isStarted && m_nextOffset < size() && m_nextOffset - m_acknowledgedOffset < m_windowSize;
+}
+
+/**
+ * @brief Returns the next chunk frame to send.
+ *
+ * A chunk must be available.
+ *
+ * @return The next chunk frame
+ */
+webrtc::DataBuffer FileTransferSender::popChunk()
+{
+    size_t chunkSize = static_cast<size_t>(min<uint64_t>(m_chunkSize, size() - m_nextOffset));
+    webrtc::DataBuffer frame =
+        FileTransferFrame::encodeChunk(m_id, m_nextOffset, m_file->data() + m_nextOffset, chunkSize);
+    m_nextOffset += chunkSize;
+    return frame;
+}
+
+/**
+ * @brief Records the number of bytes written by the receiver.
+ *
+ * The acknowledgements of old chunks and of chunks that are not sent are ignored.
+ *
+ * @param offset The number of bytes written by the receiver
+ */
+void FileTransferSender::acknowledge(uint64_t offset)
+{
+    if (m_isStarted && offset > m_acknowledgedOffset && offset <= m_nextOffset)
+    {
+        m_acknowledgedOffset = offset;
+    }
+}
@@ -0,0 +1,53 @@
+#include <OpenteraWebrtcNativeClient/Utils/KeyedWorkerPool.h>
+
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+/**
+ * @brief Creates a keyed worker pool and starts its threads.
+ *
+ * @param threadCount The number of threads
+ * @throw runtime_error if the number of threads is 0
+ */
+KeyedWorkerPool::KeyedWorkerPool(size_t threadCount)
+{
+    if (threadCount == 0)
+    {
+        throw runtime_error("The number of threads must be greater than 0.");
+    }
+
+    m_workers.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        // Each worker has one thread, so its tasks run in the order they are posted.
+        m_workers.push_back(make_unique<WorkerPool>(1));
+    }
+}
+
+/**
+ * @brief Posts a task, which is run on the thread of its key.
+ *
+ * @param key The key, which selects the thread
+ * @param task The task, which must not throw
+ */
+void KeyedWorkerPool::post(const string& key, function<void()> task)
+{
+    m_workers[hash<string>()(key) % m_workers.size()]->post(move(task));
+}
+
+/**
+ * @brief Returns the number of tasks that wait in the queue of each thread.
+ * @return The number of tasks that are posted, but not started, for each thread
+ */
+vector<size_t> KeyedWorkerPool::queueDepths() const
+{
+    vector<size_t> depths;
+    depths.reserve(m_workers.size());
+    for (const auto& worker : m_workers)
+    {
+        depths.push_back(worker->pendingTaskCount());
+    }
+    return depths;
+}
@@ -0,0 +1,222 @@
+#include <OpenteraWebrtcNativeClient/Utils/Lz4Codec.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+
+using namespace opentera;
+using namespace std;
+
+constexpr size_t MinMatchSize = 4;
+constexpr size_t LastLiteralSize = 5;  // The last 5 bytes are always literals.
+constexpr size_t MatchFindLimit = 12;  // The last match must start at least 12 bytes before the end.
+constexpr size_t MaxOffset = 65535;
+constexpr int HashLog = 12;
+
+static uint32_t readUint32(const uint8_t* data)
+{
+    uint32_t value;
+    memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+static uint32_t hashSequence(uint32_t sequence) { return (sequence * 2654435761u) >> (32 - HashLog); }
+
+static uint8_t* writeLength(uint8_t* op, size_t length)
+{
+    for (; length >= 255; length -= 255)
+    {
+        *op++ = 255;
+    }
+    *op++ = static_cast<uint8_t>(length);
+    return op;
+}
+
+static bool readLength(const uint8_t*& ip, const uint8_t* iend, size_t& length)
+{
+    uint8_t value;
+    do
+    {
+        if (ip >= iend)
+        {
+            return false;
+        }
+        value = *ip++;
+        length += value;
+    } while (value == 255);
+    return true;
+}
+
+// Writes a sequence made of literals and an optional match, or returns nullptr if it does not fit.
+static uint8_t* writeSequence(
+    uint8_t* op,
+    const uint8_t* oend,
+    const uint8_t* literals,
+    size_t literalSize,
+    size_t offset,
+    size_t matchSize)
+{
+    size_t maxSequenceSize = 1 + literalSize / 255 + 1 + literalSize + 2 + matchSize / 255 + 1;
+    if (maxSequenceSize > static_cast<size_t>(oend - op))
+    {
+        return nullptr;
+    }
+
+    uint8_t* token = op++;
+    *token = static_cast<uint8_t>(min<size_t>(literalSize, 15) << 4);
+    if (literalSize >= 15)
+    {
+        op = writeLength(op, literalSize - 15);
+    }
+    copy_n(literals, literalSize, op);
+    op += literalSize;
+
+    if (matchSize > 0)
+    {
+        *op++ = static_cast<uint8_t>(offset);
+        *op++ = static_cast<uint8_t>(offset >> 8);
+
+        size_t matchLength = matchSize - MinMatchSize;
+        *token |= static_cast<uint8_t>(min<size_t>(matchLength, 15));
+        if (matchLength >= 15)
+        {
+            op = writeLength(op, matchLength - 15);
+        }
+    }
+    return op;
+}
+
+/**
+ * @brief Compresses data into a LZ4 block.
+ *
+ * @param src The data to compress
+ * @param srcSize The size of the data to compress
+ * @param dst The buffer that receives the block
+ * @param dstCapacity The size of the buffer that receives the block
+ * @return The block size, or 0 if the block does not fit in the buffer
+ */
+size_t Lz4Codec::compress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstCapacity)
+{
+    const uint8_t* ip = src;
+    const uint8_t* anchor = src;
+    const uint8_t* iend = src + srcSize;
+    uint8_t* op = dst;
+    const uint8_t* oend = dst + dstCapacity;
+
+    if (srcSize > MatchFindLimit)
+    {
+        const uint8_t* matchLimit = iend - LastLiteralSize;
+        const uint8_t* matchFindLimit = iend - MatchFindLimit;
+        array<uint32_t, 1 << HashLog> positions{};
+
+        ip++;
+        while (ip <= matchFindLimit)
+        {
+            uint32_t sequence = readUint32(ip);
+            uint32_t& position = positions[hashSequence(sequence)];
+            const uint8_t* match = src + position;
+            position = static_cast<uint32_t>(ip - src);
+
+            if (match >= ip || static_cast<size_t>(ip - match) > MaxOffset || readUint32(match) != sequence)
+            {
+                ip++;
+                continue;
+            }
+
+            while (ip > anchor && match > src && ip[-1] == match[-1])
+            {
+                ip--;
+                match--;
+            }
+            size_t matchSize = MinMatchSize;
+            while (ip + matchSize < matchLimit && ip[matchSize] == match[matchSize])
+            {
+                matchSize++;
+            }
+
+            op = writeSequence(op, oend, anchor, ip - anchor, ip - match, matchSize);
+            if (op == nullptr)
+            {
+                return 0;
+            }
+            ip += matchSize;
+            anchor = ip;
+        }
+    }
+
+    op = writeSequence(op, oend, anchor, iend - anchor, 0, 0);
+    return op == nullptr ? 0 : op - dst;
+}
+
+/**
+ * @brief Decompresses a LZ4 block.
+ *
+ * The block is validated, so invalid or malicious blocks never read or write out of the buffers.
+ *
+ * @param src The block
+ * @param srcSize The block size
+ * @param dst The buffer that receives the data
+ * @param dstSize The exact size of the decompressed data
+ * @return false if the block is invalid or if its decompressed size is not dstSize
+ */
+bool Lz4Codec::decompress(const uint8_t* src, size_t srcSize, uint8_t* dst, size_t dstSize)
+{
+    const uint8_t* ip = src;
+    const uint8_t* iend = src + srcSize;
+    uint8_t* op = dst;
+    uint8_t* oend = dst + dstSize;
+
+    while (ip < iend)
+    {
+        uint8_t token = *ip++;
+
+        size_t literalSize = token >> 4;
+        if (literalSize == 15 && !readLength(ip, iend, literalSize))
+        {
+            return false;
+        }
+        if (literalSize > static_cast<size_t>(iend - ip) || literalSize > static_cast<size_t>(oend - op))
+        {
+            return false;
+        }
+        copy_n(ip, literalSize, op);
+        ip += literalSize;
+        op += literalSize;
+
+        if (ip == iend)
+        {
+            return op == oend;
+        }
+
+        if (iend - ip < 2)
+        {
+            return false;
+        }
+        size_t offset = ip[0] | (ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst))
+        {
+            return false;
+        }
+
+        size_t matchSize = token & 0x0F;
+        if (matchSize == 15 && !readLength(ip, iend, matchSize))
+        {
+            return false;
+        }
+        matchSize += MinMatchSize;
+        if (matchSize > static_cast<size_t>(oend - op))
+        {
+            return false;
+        }
+
+        // The match can overlap the output, so it is copied byte by byte.
+        const uint8_t* match = op - offset;
+        for (size_t i = 0; i < matchSize; i++)
+        {
+            op[i] = match[i];
+        }
+        op += matchSize;
+    }
+    return false;
+}
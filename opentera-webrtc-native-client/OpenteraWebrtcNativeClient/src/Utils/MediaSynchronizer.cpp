@@ -0,0 +1,199 @@
+#include <OpenteraWebrtcNativeClient/Utils/MediaSynchronizer.h>
+
+#include <cstring>
+
+using namespace opentera;
+using namespace std;
+
+/**
+ * @brief Creates a media synchronizer.
+ *
+ * @param onAudioFrame The callback that receives the audio frames
+ * @param onVideoFrame The callback that receives the video frames
+ * @param maxDelayUs The maximum time a frame waits for the other stream
+ */
+MediaSynchronizer::MediaSynchronizer(
+    SynchronizedAudioCallback onAudioFrame,
+    SynchronizedVideoCallback onVideoFrame,
+    uint64_t maxDelayUs)
+    : m_onAudioFrame(move(onAudioFrame)),
+      m_onVideoFrame(move(onVideoFrame)),
+      m_maxDelayUs(maxDelayUs),
+      m_hasAudio(false),
+      m_hasVideo(false),
+      m_lastAudioTimestampUs(0),
+      m_lastVideoTimestampUs(0),
+      m_isDelivering(false)
+{
+}
+
+/**
+ * @brief Adds an audio frame.
+ *
+ * @param audioData The audio data
+ * @param bitsPerSample The audio stream sample size
+ * @param sampleRate The audio stream sample rate
+ * @param numberOfChannels The audio stream channel count
+ * @param numberOfFrames The number of frames
+ * @param timestampUs The timestamp in microseconds
+ */
+void MediaSynchronizer::pushAudio(
+    const void* audioData,
+    int bitsPerSample,
+    int sampleRate,
+    size_t numberOfChannels,
+    size_t numberOfFrames,
+    uint64_t timestampUs)
+{
+    unique_lock<mutex> lock(m_mutex);
+
+    AudioFrame frame;
+    if (!m_freeAudioFrames.empty())
+    {
+        frame = move(m_freeAudioFrames.back());
+        m_freeAudioFrames.pop_back();
+    }
+
+    size_t size = numberOfFrames * numberOfChannels * bitsPerSample / 8;
+    frame.data.resize(size);
+    memcpy(frame.data.data(), audioData, size);
+    frame.bitsPerSample = bitsPerSample;
+    frame.sampleRate = sampleRate;
+    frame.numberOfChannels = numberOfChannels;
+    frame.numberOfFrames = numberOfFrames;
+    frame.timestampUs = timestampUs;
+    m_audioFrames.push_back(move(frame));
+
+    m_hasAudio = true;
+    m_lastAudioTimestampUs = max(m_lastAudioTimestampUs, timestampUs);
+    moveReadyFrames();
+    deliverReadyFrames(lock);
+}
+
+/**
+ * @brief Adds a video frame.
+ *
+ * @param bgrImg The BGR image
+ * @param timestampUs The timestamp in microseconds
+ */
+void MediaSynchronizer::pushVideo(const cv::Mat& bgrImg, uint64_t timestampUs)
+{
+    unique_lock<mutex> lock(m_mutex);
+
+    VideoFrame frame;
+    if (!m_freeVideoFrames.empty())
+    {
+        frame = move(m_freeVideoFrames.back());
+        m_freeVideoFrames.pop_back();
+    }
+
+    bgrImg.copyTo(frame.bgrImg);
+    frame.timestampUs = timestampUs;
+    m_videoFrames.push_back(move(frame));
+
+    m_hasVideo = true;
+    m_lastVideoTimestampUs = max(m_lastVideoTimestampUs, timestampUs);
+    moveReadyFrames();
+    deliverReadyFrames(lock);
+}
+
+void MediaSynchronizer::moveReadyFrames()
+{
+    while (!m_audioFrames.empty() || !m_videoFrames.empty())
+    {
+        // The oldest frame is delivered first, so the streams are merged in timestamp order.
+        bool isAudioFirst =
+            m_videoFrames.empty() ||
+            (!m_audioFrames.empty() && m_audioFrames.front().timestampUs <= m_videoFrames.front().timestampUs);
+
+        if (isAudioFirst && isAudioFrameReady(m_audioFrames.front()))
+        {
+            m_readyAudioFrames.push_back(move(m_audioFrames.front()));
+            m_audioFrames.pop_front();
+            m_isReadyFrameAudio.push_back(true);
+        }
+        else if (!isAudioFirst && isVideoFrameReady(m_videoFrames.front()))
+        {
+            m_readyVideoFrames.push_back(move(m_videoFrames.front()));
+            m_videoFrames.pop_front();
+            m_isReadyFrameAudio.push_back(false);
+        }
+        else
+        {
+            break;
+        }
+    }
+}
+
+bool MediaSynchronizer::isAudioFrameReady(const AudioFrame& frame) const
+{
+    return !m_hasVideo || m_lastVideoTimestampUs >= frame.timestampUs ||
+           m_lastAudioTimestampUs - frame.timestampUs >= m_maxDelayUs;
+}
+
+bool MediaSynchronizer::isVideoFrameReady(const VideoFrame& frame) const
+{
+    return !m_hasAudio || m_lastAudioTimestampUs >= frame.timestampUs ||
+           m_lastVideoTimestampUs - frame.timestampUs >= m_maxDelayUs;
+}
+
+void MediaSynchronizer::deliverReadyFrames(unique_lock<mutex>& lock)
+{
+    // The thread that is already delivering also delivers the frames made ready by the other stream, so the callbacks
+    // stay in timestamp order and the other stream does not wait for them.
+    if (m_isDelivering)
+    {
+        return;
+    }
+
+    m_isDelivering = true;
+    while (!m_isReadyFrameAudio.empty())
+    {
+        bool isAudio = m_isReadyFrameAudio.front();
+        m_isReadyFrameAudio.pop_front();
+
+        if (isAudio)
+        {
+            AudioFrame frame = move(m_readyAudioFrames.front());
+            m_readyAudioFrames.pop_front();
+
+            lock.unlock();
+            deliverAudioFrame(frame);
+            lock.lock();
+            m_freeAudioFrames.push_back(move(frame));
+        }
+        else
+        {
+            VideoFrame frame = move(m_readyVideoFrames.front());
+            m_readyVideoFrames.pop_front();
+
+            lock.unlock();
+            deliverVideoFrame(frame);
+            lock.lock();
+            m_freeVideoFrames.push_back(move(frame));
+        }
+    }
+    m_isDelivering = false;
+}
+
+void MediaSynchronizer::deliverAudioFrame(const AudioFrame& frame)
+{
+    if (m_onAudioFrame)
+    {
+        m_onAudioFrame(
+            frame.data.data(),
+            frame.bitsPerSample,
+            frame.sampleRate,
+            frame.numberOfChannels,
+            frame.numberOfFrames,
+            frame.timestampUs);
+    }
+}
+
+void MediaSynchronizer::deliverVideoFrame(const VideoFrame& frame)
+{
+    if (m_onVideoFrame)
+    {
+        m_onVideoFrame(frame.bgrImg, frame.timestampUs);
+    }
+}
@@ -0,0 +1,130 @@
+#include <OpenteraWebrtcNativeClient/Utils/MemoryMappedFile.h>
+
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace opentera;
+using namespace std;
+
+#if defined(_WIN32)
+
+/**
+ * @brief Maps a file in memory.
+ * @param path The file path
+ * @throw runtime_error if the file cannot be mapped
+ */
+MemoryMappedFile::MemoryMappedFile(const string& path)
+    : m_data(nullptr),
+      m_size(0),
+      m_fileHandle(INVALID_HANDLE_VALUE),
+      m_mappingHandle(nullptr)
+{
+    m_fileHandle = CreateFileA(
+        path.c_str(),
+        GENERIC_READ,
+        FILE_SHARE_READ,
+        nullptr,
+        OPEN_EXISTING,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (m_fileHandle == INVALID_HANDLE_VALUE)
+    {
+        throw runtime_error("The file cannot be opened (" + path + ")");
+    }
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(m_fileHandle, &size))
+    {
+        CloseHandle(m_fileHandle);
+        throw runtime_error("The file size cannot be read (" + path + ")");
+    }
+    m_size = static_cast<size_t>(size.QuadPart);
+    if (m_size == 0)
+    {
+        return;
+    }
+
+    m_mappingHandle = CreateFileMappingA(m_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mappingHandle == nullptr)
+    {
+        CloseHandle(m_fileHandle);
+        throw runtime_error("The file cannot be mapped (" + path + ")");
+    }
+
+    m_data = static_cast<const uint8_t*>(MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0));
+    if (m_data == nullptr)
+    {
+        CloseHandle(m_mappingHandle);
+        CloseHandle(m_fileHandle);
+        throw runtime_error("The file cannot be mapped (" + path + ")");
+    }
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+    }
+    if (m_mappingHandle != nullptr)
+    {
+        CloseHandle(m_mappingHandle);
+    }
+    CloseHandle(m_fileHandle);
+}
+
+#else
+
+/**
+ * @brief Maps a file in memory.
+ * @param path The file path
+ * @throw runtime_error if the file cannot be mapped
+ */
+MemoryMappedFile::MemoryMappedFile(const string& path) : m_data(nullptr), m_size(0)
+{
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0)
+    {
+        throw runtime_error("The file cannot be opened (" + path + ")");
+    }
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) != 0)
+    {
+        close(fd);
+        throw runtime_error("The file size cannot be read (" + path + ")");
+    }
+    m_size = static_cast<size_t>(fileStat.st_size);
+    if (m_size == 0)
+    {
+        close(fd);
+        return;
+    }
+
+    void* data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    // The mapping stays valid after the file descriptor is closed.
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        throw runtime_error("The file cannot be mapped (" + path + ")");
+    }
+    m_data = static_cast<const uint8_t*>(data);
+}
+
+MemoryMappedFile::~MemoryMappedFile()
+{
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+}
+
+#endif
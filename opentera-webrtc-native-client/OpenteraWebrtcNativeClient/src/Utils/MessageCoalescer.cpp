@@ -0,0 +1,139 @@
+#include <OpenteraWebrtcNativeClient/Utils/MessageCoalescer.h>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+static uint32_t readUint32(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+/**
+ * @brief Creates a message coalescer.
+ *
+ * @param maxBatchSize The size at which a batch is ready, headers included (bytes)
+ * @throw runtime_error if the maximum batch size cannot hold a header and one byte
+ */
+MessageCoalescer::MessageCoalescer(size_t maxBatchSize) : m_maxBatchSize(maxBatchSize), m_currentBatch{{}, 0}
+{
+    if (maxBatchSize <= HeaderSize)
+    {
+        throw runtime_error("The maximum batch size must be greater than " + to_string(HeaderSize) + " bytes.");
+    }
+}
+
+/**
+ * @brief Adds a message to the current batch.
+ *
+ * The current batch is ready before the message is added if the message does not fit in it, and after if it is
+ * full.
+ *
+ * @param buffer The message
+ * @throw runtime_error if the message is 2 GiB or larger
+ */
+void MessageCoalescer::push(const webrtc::DataBuffer& buffer)
+{
+    if (buffer.size() > MaxMessageSize)
+    {
+        throw runtime_error("The message is too large.");
+    }
+    if (m_currentBatch.messageCount > 0 && m_currentBatch.data.size() + HeaderSize + buffer.size() > m_maxBatchSize)
+    {
+        flush();
+    }
+
+    uint32_t header = static_cast<uint32_t>(buffer.size()) | (buffer.binary ? BinaryFlag : 0);
+    uint8_t headerData[HeaderSize] = {
+        static_cast<uint8_t>(header),
+        static_cast<uint8_t>(header >> 8),
+        static_cast<uint8_t>(header >> 16),
+        static_cast<uint8_t>(header >> 24)};
+    m_currentBatch.data.AppendData(headerData, HeaderSize);
+    m_currentBatch.data.AppendData(buffer.data.data(), buffer.size());
+    m_currentBatch.messageCount++;
+
+    if (m_currentBatch.data.size() >= m_maxBatchSize)
+    {
+        flush();
+    }
+}
+
+/**
+ * @brief Makes the current batch ready, even if it is not full.
+ */
+void MessageCoalescer::flush()
+{
+    if (m_currentBatch.messageCount > 0)
+    {
+        m_readyBatches.push_back(move(m_currentBatch));
+        m_currentBatch = Batch{rtc::CopyOnWriteBuffer(), 0};
+    }
+}
+
+/**
+ * @brief Returns the next ready batch.
+ *
+ * A batch must be ready.
+ *
+ * @param messageCount The number of messages in the batch
+ * @return The next ready batch
+ */
+webrtc::DataBuffer MessageCoalescer::popBatch(size_t& messageCount)
+{
+    Batch batch = move(m_readyBatches.front());
+    m_readyBatches.pop_front();
+
+    messageCount = batch.messageCount;
+    return webrtc::DataBuffer(batch.data, true);
+}
+
+/**
+ * @brief Passes each message of a batch to a callback, in order.
+ *
+ * The message data are shared with the batch, not copied.
+ *
+ * @param batch The batch
+ * @param onMessage The callback that receives the messages
+ * @return false if the batch is invalid, in which case no message is passed to the callback
+ */
+bool MessageCoalescer::unpack(
+    const rtc::CopyOnWriteBuffer& batch,
+    const function<void(webrtc::DataBuffer)>& onMessage)
+{
+    if (batch.size() == 0)
+    {
+        return false;
+    }
+
+    // The batch is validated before passing the messages, so an invalid batch is dropped entirely.
+    vector<webrtc::DataBuffer> messages;
+    size_t offset = 0;
+    while (offset < batch.size())
+    {
+        if (batch.size() - offset < HeaderSize)
+        {
+            return false;
+        }
+
+        uint32_t header = readUint32(batch.data() + offset);
+        size_t size = header & MaxMessageSize;
+        offset += HeaderSize;
+        if (batch.size() - offset < size)
+        {
+            return false;
+        }
+
+        messages.emplace_back(batch.Slice(offset, size), (header & BinaryFlag) != 0);
+        offset += size;
+    }
+
+    for (auto& message : messages)
+    {
+        onMessage(move(message));
+    }
+    return true;
+}
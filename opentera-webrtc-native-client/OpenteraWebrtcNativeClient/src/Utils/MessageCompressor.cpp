@@ -0,0 +1,122 @@
+#include <OpenteraWebrtcNativeClient/Utils/MessageCompressor.h>
+#include <OpenteraWebrtcNativeClient/Utils/Lz4Codec.h>
+
+#include <algorithm>
+#include <limits>
+
+using namespace opentera;
+using namespace std;
+
+constexpr size_t UncompressedHeaderSize = 1;
+constexpr size_t CompressedHeaderSize = 5;
+
+MessageCompressor::MessageCompressor() : m_threshold(DefaultThreshold), m_uncompressedSize(0), m_compressedSize(0)
+{
+}
+
+/**
+ * @brief Creates the data to send for a message.
+ *
+ * @param message The message
+ * @return The binary data to send
+ */
+webrtc::DataBuffer MessageCompressor::compress(const webrtc::DataBuffer& message)
+{
+    const uint8_t* data = message.data.data<uint8_t>();
+    size_t size = message.size();
+    uint8_t flags = message.binary ? 0 : StringFlag;
+
+    rtc::CopyOnWriteBuffer frame;
+    if (size >= m_threshold && size > CompressedHeaderSize && size <= numeric_limits<uint32_t>::max())
+    {
+        // The compressed data must be smaller than the uncompressed data, so the buffer is not larger than the message.
+        frame = rtc::CopyOnWriteBuffer(size);
+        uint8_t* frameData = frame.MutableData();
+        size_t compressedSize =
+            Lz4Codec::compress(data, size, frameData + CompressedHeaderSize, size - CompressedHeaderSize);
+        if (compressedSize > 0)
+        {
+            frameData[0] = flags | CompressedFlag;
+            frameData[1] = static_cast<uint8_t>(size);
+            frameData[2] = static_cast<uint8_t>(size >> 8);
+            frameData[3] = static_cast<uint8_t>(size >> 16);
+            frameData[4] = static_cast<uint8_t>(size >> 24);
+            frame.SetSize(CompressedHeaderSize + compressedSize);
+        }
+        else
+        {
+            frame.Clear();
+        }
+    }
+    if (frame.size() == 0)
+    {
+        frame = rtc::CopyOnWriteBuffer(UncompressedHeaderSize + size);
+        uint8_t* frameData = frame.MutableData();
+        frameData[0] = flags;
+        copy_n(data, size, frameData + UncompressedHeaderSize);
+    }
+
+    m_uncompressedSize += size;
+    m_compressedSize += frame.size();
+    return webrtc::DataBuffer(frame, true);
+}
+
+/**
+ * @brief Restores a message from the received data.
+ *
+ * The uncompressed messages share the received data, without copy.
+ *
+ * @param frame The received data
+ * @param message The restored message data
+ * @param isBinary Indicates if the restored message is binary data or a string message
+ * @return false if the received data are invalid
+ */
+bool MessageCompressor::decompress(const webrtc::DataBuffer& frame, rtc::CopyOnWriteBuffer& message, bool& isBinary)
+{
+    if (!frame.binary || frame.size() < UncompressedHeaderSize)
+    {
+        return false;
+    }
+
+    const uint8_t* frameData = frame.data.data<uint8_t>();
+    uint8_t flags = frameData[0];
+    isBinary = (flags & StringFlag) == 0;
+    if ((flags & CompressedFlag) == 0)
+    {
+        message = frame.data.Slice(UncompressedHeaderSize, frame.size() - UncompressedHeaderSize);
+        return true;
+    }
+
+    if (frame.size() < CompressedHeaderSize)
+    {
+        return false;
+    }
+    size_t size = static_cast<size_t>(frameData[1]) | (static_cast<size_t>(frameData[2]) << 8) |
+                  (static_cast<size_t>(frameData[3]) << 16) | (static_cast<size_t>(frameData[4]) << 24);
+    // A LZ4 block cannot expand its data by more than 255 times, so corrupted sizes are not allocated.
+    if (size / 255 > frame.size())
+    {
+        return false;
+    }
+
+    message = rtc::CopyOnWriteBuffer(size);
+    return Lz4Codec::decompress(
+        frameData + CompressedHeaderSize,
+        frame.size() - CompressedHeaderSize,
+        message.MutableData(),
+        size);
+}
+
+/**
+ * @brief Returns the ratio between the uncompressed and the compressed sizes of the messages.
+ * @return The compression ratio, or 1 if no message was compressed
+ */
+double MessageCompressor::compressionRatio() const
+{
+    uint64_t compressedSize = m_compressedSize;
+    if (compressedSize == 0)
+    {
+        return 1.0;
+    }
+    return static_cast<double>(m_uncompressedSize) / static_cast<double>(compressedSize);
+}
@@ -0,0 +1,81 @@
+#include <OpenteraWebrtcNativeClient/Utils/MessageFragmenter.h>
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+static void writeUint32(uint8_t* data, uint32_t value)
+{
+    data[0] = static_cast<uint8_t>(value);
+    data[1] = static_cast<uint8_t>(value >> 8);
+    data[2] = static_cast<uint8_t>(value >> 16);
+    data[3] = static_cast<uint8_t>(value >> 24);
+}
+
+/**
+ * @brief Creates a message fragmenter.
+ *
+ * @param maxFrameSize The maximum size of a frame, header included (bytes)
+ * @throw runtime_error if the maximum frame size cannot hold the header and one byte
+ */
+MessageFragmenter::MessageFragmenter(size_t maxFrameSize) : m_nextMessageId(0)
+{
+    if (maxFrameSize <= HeaderSize)
+    {
+        throw runtime_error("The maximum frame size must be greater than " + to_string(HeaderSize) + " bytes.");
+    }
+    m_maxChunkSize = maxFrameSize - HeaderSize;
+}
+
+/**
+ * @brief Adds a message to send.
+ *
+ * The message data are shared with the buffer, not copied.
+ *
+ * @param buffer The message
+ * @throw runtime_error if the message is larger than 4 GiB
+ */
+void MessageFragmenter::push(const webrtc::DataBuffer& buffer)
+{
+    if (buffer.size() > numeric_limits<uint32_t>::max())
+    {
+        throw runtime_error("The message is too large.");
+    }
+    m_pendingMessages.push_back({buffer, m_nextMessageId++, 0});
+}
+
+/**
+ * @brief Returns the next frame to send.
+ *
+ * The fragmenter must not be empty.
+ *
+ * @return The next frame to send
+ */
+webrtc::DataBuffer MessageFragmenter::popFrame()
+{
+    PendingMessage message = move(m_pendingMessages.front());
+    m_pendingMessages.pop_front();
+
+    size_t chunkSize = min(m_maxChunkSize, message.buffer.size() - message.offset);
+    rtc::CopyOnWriteBuffer frame(HeaderSize + chunkSize);
+    uint8_t* data = frame.MutableData();
+    data[0] = message.buffer.binary ? BinaryFlag : 0;
+    data[1] = 0;
+    data[2] = 0;
+    data[3] = 0;
+    writeUint32(data + 4, message.id);
+    writeUint32(data + 8, static_cast<uint32_t>(message.buffer.size()));
+    writeUint32(data + 12, static_cast<uint32_t>(message.offset));
+    copy_n(message.buffer.data.data() + message.offset, chunkSize, data + HeaderSize);
+
+    message.offset += chunkSize;
+    if (message.offset < message.buffer.size())
+    {
+        m_pendingMessages.push_back(move(message));
+    }
+
+    return webrtc::DataBuffer(frame, true);
+}
@@ -0,0 +1,116 @@
+#include <OpenteraWebrtcNativeClient/Utils/MessageReassembler.h>
+#include <OpenteraWebrtcNativeClient/Utils/MessageFragmenter.h>
+
+#include <algorithm>
+
+using namespace opentera;
+using namespace std;
+
+static uint32_t readUint32(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) | (static_cast<uint32_t>(data[3]) << 24);
+}
+
+/**
+ * @brief Creates a message reassembler.
+ *
+ * @param onMessage The callback that is called with each complete message
+ * @param onChunk The callback that is called with each chunk of the messages larger than one frame. If it is null,
+ * these messages are reassembled.
+ * @param maxPartialSize The maximum total size of the messages being reassembled (bytes)
+ */
+MessageReassembler::MessageReassembler(
+    ReassembledMessageCallback onMessage,
+    MessageChunkCallback onChunk,
+    size_t maxPartialSize)
+    : m_onMessage(move(onMessage)),
+      m_onChunk(move(onChunk)),
+      m_maxPartialSize(maxPartialSize),
+      m_partialSize(0)
+{
+}
+
+/**
+ * @brief Processes a received frame.
+ *
+ * @param frame The frame
+ * @return false if the frame is invalid or if its message is dropped because it is too large
+ */
+bool MessageReassembler::push(const rtc::CopyOnWriteBuffer& frame)
+{
+    if (frame.size() < MessageFragmenter::HeaderSize)
+    {
+        return false;
+    }
+
+    const uint8_t* header = frame.data<uint8_t>();
+    bool isBinary = (header[0] & MessageFragmenter::BinaryFlag) != 0;
+    uint32_t messageId = readUint32(header + 4);
+    size_t messageSize = readUint32(header + 8);
+    size_t offset = readUint32(header + 12);
+    const uint8_t* chunk = header + MessageFragmenter::HeaderSize;
+    size_t chunkSize = frame.size() - MessageFragmenter::HeaderSize;
+
+    if (offset > messageSize || chunkSize > messageSize - offset)
+    {
+        return false;
+    }
+
+    if (chunkSize == messageSize)
+    {
+        m_onMessage(frame.Slice(MessageFragmenter::HeaderSize, chunkSize), isBinary);
+        return true;
+    }
+    if (m_onChunk)
+    {
+        m_onChunk(messageId, chunk, chunkSize, offset, messageSize, isBinary);
+        return true;
+    }
+
+    bool isLastChunk = offset + chunkSize == messageSize;
+    auto droppedIt = m_droppedMessageIds.find(messageId);
+    if (droppedIt != m_droppedMessageIds.end())
+    {
+        // The other frames of a dropped message are ignored, so the message is reported once.
+        if (isLastChunk)
+        {
+            m_droppedMessageIds.erase(droppedIt);
+        }
+        return true;
+    }
+
+    auto it = m_partialMessagesById.find(messageId);
+    if (it == m_partialMessagesById.end())
+    {
+        if (offset != 0)
+        {
+            return false;
+        }
+        if (messageSize > m_maxPartialSize - m_partialSize)
+        {
+            m_droppedMessageIds.insert(messageId);
+            return false;
+        }
+        it = m_partialMessagesById.emplace(messageId, PartialMessage{rtc::CopyOnWriteBuffer(messageSize), 0}).first;
+        m_partialSize += messageSize;
+    }
+    else if (it->second.data.size() != messageSize || it->second.receivedSize != offset)
+    {
+        m_partialSize -= it->second.data.size();
+        m_partialMessagesById.erase(it);
+        return false;
+    }
+
+    PartialMessage& message = it->second;
+    copy_n(chunk, chunkSize, message.data.MutableData() + offset);
+    message.receivedSize += chunkSize;
+    if (isLastChunk)
+    {
+        PartialMessage completeMessage = move(message);
+        m_partialMessagesById.erase(it);
+        m_partialSize -= messageSize;
+        m_onMessage(move(completeMessage.data), isBinary);
+    }
+    return true;
+}
@@ -0,0 +1,61 @@
+#include <OpenteraWebrtcNativeClient/Utils/OpusPacket.h>
+
+using namespace opentera;
+using namespace std;
+
+static size_t numberOfFramesPerOpusFrame(uint8_t toc)
+{
+    // The frame durations are defined by the configuration number (RFC 6716, section 3.1).
+    constexpr size_t FramesPerMs = OpusPacket::SampleRate / 1000;
+    uint8_t configuration = toc >> 3;
+    if (configuration < 12)
+    {
+        constexpr size_t SilkFrameCounts[] = {10 * FramesPerMs, 20 * FramesPerMs, 40 * FramesPerMs, 60 * FramesPerMs};
+        return SilkFrameCounts[configuration & 0x03];
+    }
+    else if (configuration < 16)
+    {
+        return (configuration & 0x01) == 0 ? 10 * FramesPerMs : 20 * FramesPerMs;
+    }
+    else
+    {
+        return (FramesPerMs * 5 / 2) << (configuration & 0x03);
+    }
+}
+
+/**
+ * @brief Returns the duration of an Opus packet from its TOC byte.
+ *
+ * @param data The Opus packet
+ * @param dataSize The Opus packet size
+ * @return The number of frames at 48000 Hz (0 if the packet is invalid)
+ */
+size_t OpusPacket::numberOfFrames(const uint8_t* data, size_t dataSize)
+{
+    if (dataSize < 1)
+    {
+        return 0;
+    }
+
+    size_t opusFrameCount;
+    switch (data[0] & 0x03)
+    {
+        case 0:
+            opusFrameCount = 1;
+            break;
+        case 1:
+        case 2:
+            opusFrameCount = 2;
+            break;
+        default:
+            if (dataSize < 2)
+            {
+                return 0;
+            }
+            opusFrameCount = data[1] & 0x3f;
+            break;
+    }
+
+    size_t numberOfFrames = opusFrameCount * numberOfFramesPerOpusFrame(data[0]);
+    return numberOfFrames <= MaxNumberOfFrames ? numberOfFrames : 0;
+}
@@ -0,0 +1,161 @@
+#include <OpenteraWebrtcNativeClient/Utils/PreallocatedFile.h>
+
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+using namespace opentera;
+using namespace std;
+
+static void checkRange(uint64_t fileSize, uint64_t offset, size_t size)
+{
+    if (offset > fileSize || size > fileSize - offset)
+    {
+        throw runtime_error("The data are outside of the file.");
+    }
+}
+
+#if defined(_WIN32)
+
+/**
+ * @brief Creates or truncates a file and allocates its size.
+ *
+ * @param path The file path
+ * @param size The file size (bytes)
+ * @throw runtime_error if the file cannot be opened or allocated
+ */
+PreallocatedFile::PreallocatedFile(const string& path, uint64_t size)
+    : m_size(size),
+      m_fileHandle(INVALID_HANDLE_VALUE)
+{
+    m_fileHandle = CreateFileA(
+        path.c_str(),
+        GENERIC_WRITE,
+        0,
+        nullptr,
+        CREATE_ALWAYS,
+        FILE_ATTRIBUTE_NORMAL,
+        nullptr);
+    if (m_fileHandle == INVALID_HANDLE_VALUE)
+    {
+        throw runtime_error("The file cannot be opened (" + path + ")");
+    }
+
+    LARGE_INTEGER distance;
+    distance.QuadPart = static_cast<LONGLONG>(size);
+    if (!SetFilePointerEx(m_fileHandle, distance, nullptr, FILE_BEGIN) || !SetEndOfFile(m_fileHandle))
+    {
+        CloseHandle(m_fileHandle);
+        throw runtime_error("The file cannot be allocated (" + path + ")");
+    }
+}
+
+PreallocatedFile::~PreallocatedFile()
+{
+    CloseHandle(m_fileHandle);
+}
+
+/**
+ * @brief Writes data at an offset.
+ *
+ * @param offset The offset in the file
+ * @param data The data
+ * @param size The data size
+ * @throw runtime_error if the data are outside of the file or cannot be written
+ */
+void PreallocatedFile::write(uint64_t offset, const uint8_t* data, size_t size)
+{
+    checkRange(m_size, offset, size);
+    while (size > 0)
+    {
+        OVERLAPPED overlapped = {};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        DWORD writtenSize;
+        DWORD sizeToWrite = size > MAXDWORD ? MAXDWORD : static_cast<DWORD>(size);
+        if (!WriteFile(m_fileHandle, data, sizeToWrite, &writtenSize, &overlapped))
+        {
+            throw runtime_error("The file cannot be written.");
+        }
+        offset += writtenSize;
+        data += writtenSize;
+        size -= writtenSize;
+    }
+}
+
+#else
+
+/**
+ * @brief Creates or truncates a file and allocates its size.
+ *
+ * @param path The file path
+ * @param size The file size (bytes)
+ * @throw runtime_error if the file cannot be opened or allocated
+ */
+PreallocatedFile::PreallocatedFile(const string& path, uint64_t size)
+    : m_size(size),
+      m_fileDescriptor(-1)
+{
+    m_fileDescriptor = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+    if (m_fileDescriptor < 0)
+    {
+        throw runtime_error("The file cannot be opened (" + path + ")");
+    }
+
+    bool isAllocated = ftruncate(m_fileDescriptor, static_cast<off_t>(size)) == 0;
+#if defined(__linux__)
+    // The blocks are reserved, so the transfer does not fail midway because the disk is full.
+    if (isAllocated && size > 0)
+    {
+        int error = posix_fallocate(m_fileDescriptor, 0, static_cast<off_t>(size));
+        isAllocated = error == 0 || error == EOPNOTSUPP || error == EINVAL;
+    }
+#endif
+    if (!isAllocated)
+    {
+        close(m_fileDescriptor);
+        throw runtime_error("The file cannot be allocated (" + path + ")");
+    }
+}
+
+PreallocatedFile::~PreallocatedFile()
+{
+    close(m_fileDescriptor);
+}
+
+/**
+ * @brief Writes data at an offset.
+ *
+ * @param offset The offset in the file
+ * @param data The data
+ * @param size The data size
+ * @throw runtime_error if the data are outside of the file or cannot be written
+ */
+void PreallocatedFile::write(uint64_t offset, const uint8_t* data, size_t size)
+{
+    checkRange(m_size, offset, size);
+    while (size > 0)
+    {
+        ssize_t writtenSize = pwrite(m_fileDescriptor, data, size, static_cast<off_t>(offset));
+        if (writtenSize < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (writtenSize <= 0)
+        {
+            throw runtime_error("The file cannot be written.");
+        }
+        offset += static_cast<uint64_t>(writtenSize);
+        data += writtenSize;
+        size -= static_cast<size_t>(writtenSize);
+    }
+}
+
+#endif
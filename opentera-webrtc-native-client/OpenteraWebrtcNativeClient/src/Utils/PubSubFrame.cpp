@@ -0,0 +1,83 @@
+#include <OpenteraWebrtcNativeClient/Utils/PubSubFrame.h>
+
+#include <algorithm>
+
+using namespace opentera;
+using namespace std;
+
+static void writeHeader(uint8_t* data, uint8_t type, uint16_t topic)
+{
+    data[0] = type;
+    data[1] = static_cast<uint8_t>(topic);
+    data[2] = static_cast<uint8_t>(topic >> 8);
+}
+
+/**
+ * @brief Creates a subscription or an unsubscription frame.
+ *
+ * @param type The frame type (Subscribe or Unsubscribe)
+ * @param topic The topic
+ * @return The frame
+ */
+webrtc::DataBuffer PubSubFrame::encode(Type type, uint16_t topic)
+{
+    rtc::CopyOnWriteBuffer frame(HeaderSize);
+    writeHeader(frame.MutableData(), static_cast<uint8_t>(type), topic);
+    return webrtc::DataBuffer(frame, true);
+}
+
+/**
+ * @brief Creates the frame of a published message.
+ *
+ * @param topic The topic
+ * @param message The message
+ * @return The frame
+ */
+webrtc::DataBuffer PubSubFrame::encode(uint16_t topic, const webrtc::DataBuffer& message)
+{
+    rtc::CopyOnWriteBuffer frame(HeaderSize + message.size());
+    uint8_t* data = frame.MutableData();
+    uint8_t type = static_cast<uint8_t>(Type::Publish) | (message.binary ? 0 : StringFlag);
+    writeHeader(data, type, topic);
+    copy_n(message.data.data<uint8_t>(), message.size(), data + HeaderSize);
+    return webrtc::DataBuffer(frame, true);
+}
+
+/**
+ * @brief Reads a frame.
+ *
+ * The message shares the frame buffer, so it is not copied.
+ *
+ * @param frame The frame
+ * @param type The frame type
+ * @param topic The topic
+ * @param message The published message, empty for the other frame types
+ * @param isBinary Indicates if the published message is binary data
+ * @return false if the frame is invalid
+ */
+bool PubSubFrame::decode(
+    const webrtc::DataBuffer& frame,
+    Type& type,
+    uint16_t& topic,
+    rtc::CopyOnWriteBuffer& message,
+    bool& isBinary)
+{
+    if (!frame.binary || frame.size() < HeaderSize)
+    {
+        return false;
+    }
+
+    const uint8_t* data = frame.data.data<uint8_t>();
+    uint8_t rawType = data[0] & ~StringFlag;
+    if (rawType > static_cast<uint8_t>(Type::Unsubscribe) ||
+        (rawType != static_cast<uint8_t>(Type::Publish) && frame.size() != HeaderSize))
+    {
+        return false;
+    }
+
+    type = static_cast<Type>(rawType);
+    topic = static_cast<uint16_t>(data[1] | (data[2] << 8));
+    isBinary = (data[0] & StringFlag) == 0;
+    message = frame.data.Slice(HeaderSize, frame.size() - HeaderSize);
+    return true;
+}
@@ -0,0 +1,91 @@
+#include <OpenteraWebrtcNativeClient/Utils/RpcCallRegistry.h>
+
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+/**
+ * @brief Adds a call waiting for its response.
+ *
+ * @param callId The call id, which must not be waiting for its response
+ * @param peerId The id of the called client
+ * @param callback The callback that receives the response or the error message
+ */
+void RpcCallRegistry::add(uint32_t callId, string peerId, Callback callback)
+{
+    m_pendingCallsById[callId] = PendingCall{move(peerId), move(callback)};
+}
+
+/**
+ * @brief Passes a response to the callback of its call and removes the call.
+ *
+ * @param callId The call id
+ * @param peerId The id of the client that answers
+ * @param response The response
+ * @return false if no call of this client has this id, for example because it timed out
+ */
+bool RpcCallRegistry::complete(uint32_t callId, const string& peerId, const DataChannelMessage& response)
+{
+    auto it = m_pendingCallsById.find(callId);
+    if (it == m_pendingCallsById.end() || it->second.peerId != peerId)
+    {
+        return false;
+    }
+
+    // The call is removed before calling the callback, so the callback can make other calls.
+    Callback callback = move(it->second.callback);
+    m_pendingCallsById.erase(it);
+    callback(response, "");
+    return true;
+}
+
+/**
+ * @brief Passes an error message to the callback of a call and removes the call.
+ *
+ * @param callId The call id
+ * @param peerId The id of the called client
+ * @param error The error message
+ * @return false if no call of this client has this id
+ */
+bool RpcCallRegistry::fail(uint32_t callId, const string& peerId, const string& error)
+{
+    auto it = m_pendingCallsById.find(callId);
+    if (it == m_pendingCallsById.end() || it->second.peerId != peerId)
+    {
+        return false;
+    }
+
+    Callback callback = move(it->second.callback);
+    m_pendingCallsById.erase(it);
+    callback(absl::nullopt, error);
+    return true;
+}
+
+/**
+ * @brief Passes an error message to the callbacks of all calls made to a client and removes them.
+ *
+ * @param peerId The client id
+ * @param error The error message
+ */
+void RpcCallRegistry::failPeer(const string& peerId, const string& error)
+{
+    vector<Callback> callbacks;
+    for (auto it = m_pendingCallsById.begin(); it != m_pendingCallsById.end();)
+    {
+        if (it->second.peerId == peerId)
+        {
+            callbacks.push_back(move(it->second.callback));
+            it = m_pendingCallsById.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+
+    for (const auto& callback : callbacks)
+    {
+        callback(absl::nullopt, error);
+    }
+}
@@ -0,0 +1,130 @@
+#include <OpenteraWebrtcNativeClient/Utils/RpcFrame.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+static webrtc::DataBuffer encodeFrame(
+    RpcFrame::Type type,
+    uint32_t callId,
+    const string& method,
+    const uint8_t* payload,
+    size_t payloadSize,
+    bool isBinary)
+{
+    rtc::CopyOnWriteBuffer frame(RpcFrame::HeaderSize + method.size() + payloadSize);
+    uint8_t* data = frame.MutableData();
+    data[0] = static_cast<uint8_t>(type) | (isBinary ? 0 : RpcFrame::StringFlag);
+    for (size_t i = 0; i < sizeof(callId); i++)
+    {
+        data[1 + i] = static_cast<uint8_t>(callId >> (8 * i));
+    }
+    data[5] = static_cast<uint8_t>(method.size());
+    copy(method.begin(), method.end(), data + RpcFrame::HeaderSize);
+    copy_n(payload, payloadSize, data + RpcFrame::HeaderSize + method.size());
+    return webrtc::DataBuffer(frame, true);
+}
+
+/**
+ * @brief Creates a request frame.
+ *
+ * @param callId The call id
+ * @param method The method name
+ * @param request The request message
+ * @return The frame
+ * @throw runtime_error if the method name is empty or longer than MaxMethodSize
+ */
+webrtc::DataBuffer RpcFrame::encodeRequest(uint32_t callId, const string& method, const webrtc::DataBuffer& request)
+{
+    if (method.empty() || method.size() > MaxMethodSize)
+    {
+        throw runtime_error("The RPC method name must not be empty or longer than 255 bytes.");
+    }
+    return encodeFrame(
+        Type::Request,
+        callId,
+        method,
+        request.data.data<uint8_t>(),
+        request.size(),
+        request.binary);
+}
+
+/**
+ * @brief Creates a response frame.
+ *
+ * @param callId The id of the answered call
+ * @param response The response message
+ * @return The frame
+ */
+webrtc::DataBuffer RpcFrame::encodeResponse(uint32_t callId, const webrtc::DataBuffer& response)
+{
+    return encodeFrame(Type::Response, callId, "", response.data.data<uint8_t>(), response.size(), response.binary);
+}
+
+/**
+ * @brief Creates an error frame.
+ *
+ * @param callId The id of the failed call
+ * @param error The error message
+ * @return The frame
+ */
+webrtc::DataBuffer RpcFrame::encodeError(uint32_t callId, const string& error)
+{
+    return encodeFrame(
+        Type::Error,
+        callId,
+        "",
+        reinterpret_cast<const uint8_t*>(error.data()),
+        error.size(),
+        false);
+}
+
+/**
+ * @brief Reads a frame.
+ *
+ * The payload shares the frame buffer, so it is not copied.
+ *
+ * @param frame The frame
+ * @param type The frame type
+ * @param callId The call id
+ * @param method The method name for a request, otherwise empty
+ * @param payload The request, response or error message
+ * @param isBinary Indicates if the payload is binary data
+ * @return false if the frame is invalid
+ */
+bool RpcFrame::decode(
+    const webrtc::DataBuffer& frame,
+    Type& type,
+    uint32_t& callId,
+    string& method,
+    rtc::CopyOnWriteBuffer& payload,
+    bool& isBinary)
+{
+    if (!frame.binary || frame.size() < HeaderSize)
+    {
+        return false;
+    }
+
+    const uint8_t* data = frame.data.data<uint8_t>();
+    uint8_t rawType = data[0] & ~StringFlag;
+    size_t methodSize = data[5];
+    bool isRequest = rawType == static_cast<uint8_t>(Type::Request);
+    if (rawType > static_cast<uint8_t>(Type::Error) || isRequest != (methodSize > 0) ||
+        methodSize > frame.size() - HeaderSize)
+    {
+        return false;
+    }
+
+    type = static_cast<Type>(rawType);
+    callId = 0;
+    for (size_t i = 0; i < sizeof(callId); i++)
+    {
+        callId |= static_cast<uint32_t>(data[1 + i]) << (8 * i);
+    }
+    method.assign(reinterpret_cast<const char*>(data + HeaderSize), methodSize);
+    isBinary = (data[0] & StringFlag) == 0;
+    payload = frame.data.Slice(HeaderSize + methodSize, frame.size() - HeaderSize - methodSize);
+    return true;
+}
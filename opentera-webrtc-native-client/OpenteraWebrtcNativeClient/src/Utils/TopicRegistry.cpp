@@ -0,0 +1,111 @@
+#include <OpenteraWebrtcNativeClient/Utils/TopicRegistry.h>
+
+using namespace opentera;
+using namespace std;
+
+/**
+ * @brief Adds a peer to the subscribers of a topic.
+ *
+ * @param topic The topic
+ * @param id The peer id
+ */
+void TopicRegistry::addSubscriber(uint16_t topic, const string& id)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_topicStatesByTopic[topic].subscriberIds.insert(id);
+}
+
+/**
+ * @brief Removes a peer from the subscribers of a topic.
+ *
+ * @param topic The topic
+ * @param id The peer id
+ */
+void TopicRegistry::removeSubscriber(uint16_t topic, const string& id)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_topicStatesByTopic.find(topic);
+    if (it != m_topicStatesByTopic.end())
+    {
+        it->second.subscriberIds.erase(id);
+    }
+}
+
+/**
+ * @brief Removes a peer from the subscribers of all topics.
+ *
+ * @param id The peer id
+ */
+void TopicRegistry::removePeer(const string& id)
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto& pair : m_topicStatesByTopic)
+    {
+        pair.second.subscriberIds.erase(id);
+    }
+}
+
+/**
+ * @brief Returns the ids of the peers subscribed to a topic.
+ *
+ * @param topic The topic
+ * @return The ids of the peers subscribed to the topic
+ */
+vector<string> TopicRegistry::subscriberIds(uint16_t topic) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_topicStatesByTopic.find(topic);
+    if (it == m_topicStatesByTopic.end())
+    {
+        return {};
+    }
+    return vector<string>(it->second.subscriberIds.begin(), it->second.subscriberIds.end());
+}
+
+/**
+ * @brief Counts a message sent to the subscribers of a topic.
+ *
+ * @param topic The topic
+ * @param size The message size (bytes)
+ * @param subscriberCount The number of subscribers the message is sent to
+ */
+void TopicRegistry::addSentMessages(uint16_t topic, size_t size, size_t subscriberCount)
+{
+    lock_guard<mutex> lock(m_mutex);
+    TopicStatistics& statistics = m_topicStatesByTopic[topic].statistics;
+    statistics = TopicStatistics(
+        statistics.sentMessageCount() + subscriberCount,
+        statistics.sentByteCount() + size * subscriberCount,
+        statistics.receivedMessageCount(),
+        statistics.receivedByteCount());
+}
+
+/**
+ * @brief Counts a message received on a topic.
+ *
+ * @param topic The topic
+ * @param size The message size (bytes)
+ */
+void TopicRegistry::addReceivedMessage(uint16_t topic, size_t size)
+{
+    lock_guard<mutex> lock(m_mutex);
+    TopicStatistics& statistics = m_topicStatesByTopic[topic].statistics;
+    statistics = TopicStatistics(
+        statistics.sentMessageCount(),
+        statistics.sentByteCount(),
+        statistics.receivedMessageCount() + 1,
+        statistics.receivedByteCount() + size);
+}
+
+/**
+ * @brief Returns the counters of a topic.
+ *
+ * @param topic The topic
+ * @return The counters of the topic
+ */
+TopicStatistics TopicRegistry::statistics(uint16_t topic) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_topicStatesByTopic.find(topic);
+    return it == m_topicStatesByTopic.end() ? TopicStatistics() : it->second.statistics;
+}
@@ -0,0 +1,89 @@
+#include <OpenteraWebrtcNativeClient/Utils/WorkerPool.h>
+
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+/**
+ * @brief Creates a worker pool and starts its threads.
+ *
+ * @param threadCount The number of threads
+ * @throw runtime_error if the number of threads is 0
+ */
+WorkerPool::WorkerPool(size_t threadCount) : m_isStopped(false)
+{
+    if (threadCount == 0)
+    {
+        throw runtime_error("The number of threads must be greater than 0.");
+    }
+
+    m_threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        m_threads.emplace_back(&WorkerPool::run, this);
+    }
+}
+
+/**
+ * @brief Waits for the running tasks and stops the threads. The tasks that are not started are discarded.
+ */
+WorkerPool::~WorkerPool()
+{
+    deque<function<void()>> discardedTasks;
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_isStopped = true;
+        discardedTasks.swap(m_tasks);
+    }
+    m_taskCondition.notify_all();
+
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * @brief Posts a task, which is run on the first available thread.
+ *
+ * @param task The task, which must not throw
+ */
+void WorkerPool::post(function<void()> task)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_tasks.push_back(move(task));
+    }
+    m_taskCondition.notify_one();
+}
+
+/**
+ * @brief Returns the number of tasks that wait for a thread.
+ * @return The number of tasks that are posted, but not started
+ */
+size_t WorkerPool::pendingTaskCount() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_tasks.size();
+}
+
+void WorkerPool::run()
+{
+    while (true)
+    {
+        function<void()> task;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_taskCondition.wait(lock, [this]() { return m_isStopped || !m_tasks.empty(); });
+            if (m_isStopped)
+            {
+                return;
+            }
+
+            task = move(m_tasks.front());
+            m_tasks.pop_front();
+        }
+        task();
+    }
+}
@@ -0,0 +1,39 @@
+#include <OpenteraWebrtcNativeClient/Configurations/AudioSinkConfiguration.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+TEST(AudioSinkConfigurationTests, create_shouldSetNullOpt)
+{
+    AudioSinkConfiguration testee = AudioSinkConfiguration::create();
+
+    EXPECT_EQ(testee.bitsPerSample(), absl::nullopt);
+    EXPECT_EQ(testee.sampleRate(), absl::nullopt);
+    EXPECT_EQ(testee.numberOfChannels(), absl::nullopt);
+    EXPECT_EQ(testee.numberOfFramesPerChunk(), absl::nullopt);
+    EXPECT_FALSE(testee.isConversionEnabled());
+}
+
+TEST(AudioSinkConfigurationTests, create_all_shouldSetTheAttributes)
+{
+    AudioSinkConfiguration testee = AudioSinkConfiguration::create(32, 16000, 1u, 320u);
+
+    EXPECT_EQ(testee.bitsPerSample(), 32);
+    EXPECT_EQ(testee.sampleRate(), 16000);
+    EXPECT_EQ(testee.numberOfChannels(), 1u);
+    EXPECT_EQ(testee.numberOfFramesPerChunk(), 320u);
+    EXPECT_TRUE(testee.isConversionEnabled());
+}
+
+TEST(AudioSinkConfigurationTests, create_numberOfFramesPerChunk_shouldEnableTheConversion)
+{
+    AudioSinkConfiguration testee = AudioSinkConfiguration::create(absl::nullopt, absl::nullopt, absl::nullopt, 256u);
+
+    EXPECT_EQ(testee.bitsPerSample(), absl::nullopt);
+    EXPECT_EQ(testee.sampleRate(), absl::nullopt);
+    EXPECT_EQ(testee.numberOfChannels(), absl::nullopt);
+    EXPECT_EQ(testee.numberOfFramesPerChunk(), 256u);
+    EXPECT_TRUE(testee.isConversionEnabled());
+}
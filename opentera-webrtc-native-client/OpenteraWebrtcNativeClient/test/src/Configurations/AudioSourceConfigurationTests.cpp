@@ -15,6 +15,7 @@ TEST(AudioSourceConfigurationTests, create_shouldSetNullOpt)
     EXPECT_EQ(testee.noiseSuppression(), absl::nullopt);
     EXPECT_EQ(testee.highpassFilter(), absl::nullopt);
     EXPECT_EQ(testee.stereoSwapping(), absl::nullopt);
+    EXPECT_FALSE(testee.isPassThrough());
 }
 
 TEST(AudioSourceConfigurationTests, create_echoCancellation_shouldSetTheAttributes)
@@ -220,3 +221,31 @@ TEST(AudioSourceConfigurationTests, create_transientSuppression_shouldSetTheAttr
     EXPECT_EQ(config.high_pass_filter.enabled, false);
     EXPECT_EQ(config.transient_suppression.enabled, true);
 }
+
+TEST(AudioSourceConfigurationTests, createPassThrough_shouldDisableTheAudioProcessing)
+{
+    AudioSourceConfiguration testee = AudioSourceConfiguration::createPassThrough();
+
+    EXPECT_EQ(testee.soundCardTotalDelayMs(), 0);
+    EXPECT_EQ(testee.echoCancellation(), false);
+    EXPECT_EQ(testee.autoGainControl(), false);
+    EXPECT_EQ(testee.noiseSuppression(), false);
+    EXPECT_EQ(testee.highpassFilter(), false);
+    EXPECT_EQ(testee.stereoSwapping(), false);
+    EXPECT_EQ(testee.transientSuppression(), false);
+    EXPECT_TRUE(testee.isPassThrough());
+
+    auto options = static_cast<cricket::AudioOptions>(testee);
+    EXPECT_EQ(options.echo_cancellation, false);
+    EXPECT_EQ(options.auto_gain_control, false);
+    EXPECT_EQ(options.noise_suppression, false);
+    EXPECT_EQ(options.highpass_filter, false);
+    EXPECT_EQ(options.stereo_swapping, false);
+
+    auto config = static_cast<webrtc::AudioProcessing::Config>(testee);
+    EXPECT_EQ(config.echo_canceller.enabled, false);
+    EXPECT_EQ(config.gain_controller2.enabled, false);
+    EXPECT_EQ(config.noise_suppression.enabled, false);
+    EXPECT_EQ(config.high_pass_filter.enabled, false);
+    EXPECT_EQ(config.transient_suppression.enabled, false);
+}
@@ -147,3 +147,83 @@ TEST(DataChannelConfigurationTests, operator_webrtcDataChannelInit_shouldSetTheA
     EXPECT_EQ(testee3.maxRetransmits, 10);
     EXPECT_EQ(testee3.protocol, "a");
 }
+
+TEST(DataChannelConfigurationTests, withPriority_shouldOnlySetThePriority)
+{
+    DataChannelConfiguration configuration = DataChannelConfiguration::createMaxRetransmits(false, 10, "a");
+    DataChannelConfiguration testee = configuration.withPriority(DataChannelPriority::Low);
+
+    EXPECT_EQ(configuration.priority(), absl::nullopt);
+    EXPECT_EQ(testee.ordered(), false);
+    EXPECT_EQ(testee.maxPacketLifeTime(), absl::nullopt);
+    EXPECT_EQ(testee.maxRetransmits(), 10);
+    EXPECT_EQ(testee.protocol(), "a");
+    EXPECT_EQ(testee.priority(), DataChannelPriority::Low);
+}
+
+TEST(DataChannelConfigurationTests, operator_webrtcDataChannelInit_priority_shouldSetThePriority)
+{
+    auto testee1 = static_cast<webrtc::DataChannelInit>(DataChannelConfiguration::create());
+    auto testee2 = static_cast<webrtc::DataChannelInit>(
+        DataChannelConfiguration::create().withPriority(DataChannelPriority::VeryLow));
+    auto testee3 = static_cast<webrtc::DataChannelInit>(
+        DataChannelConfiguration::create().withPriority(DataChannelPriority::High));
+
+    EXPECT_EQ(testee1.priority, absl::nullopt);
+    EXPECT_EQ(testee2.priority, webrtc::Priority::kVeryLow);
+    EXPECT_EQ(testee3.priority, webrtc::Priority::kHigh);
+}
+
+TEST(DataChannelConfigurationTests, isReliable_shouldReturnFalseIfARetransmissionLimitIsSet)
+{
+    EXPECT_TRUE(DataChannelConfiguration::create().isReliable());
+    EXPECT_TRUE(DataChannelConfiguration::create(false).isReliable());
+    EXPECT_FALSE(DataChannelConfiguration::createMaxPacketLifeTime(10).isReliable());
+    EXPECT_FALSE(DataChannelConfiguration::createMaxRetransmits(0).isReliable());
+}
+
+TEST(DataChannelConfigurationTests, isCompressed_shouldReturnTrueOnlyForTheCompressedProtocol)
+{
+    EXPECT_FALSE(DataChannelConfiguration::create().isCompressed());
+    EXPECT_FALSE(DataChannelConfiguration::createProtocol("a").isCompressed());
+    EXPECT_TRUE(DataChannelConfiguration::createProtocol(DataChannelConfiguration::CompressedProtocol).isCompressed());
+}
+
+TEST(DataChannelConfigurationTests, isCoalesced_shouldReturnTrueOnlyForTheCoalescedProtocol)
+{
+    EXPECT_FALSE(DataChannelConfiguration::create().isCoalesced());
+    EXPECT_FALSE(DataChannelConfiguration::createProtocol(DataChannelConfiguration::CompressedProtocol).isCoalesced());
+    EXPECT_TRUE(DataChannelConfiguration::createProtocol(DataChannelConfiguration::CoalescedProtocol).isCoalesced());
+}
+
+TEST(DataChannelConfigurationTests, isPubSub_shouldReturnTrueOnlyForThePubSubProtocol)
+{
+    EXPECT_FALSE(DataChannelConfiguration::create().isPubSub());
+    EXPECT_FALSE(DataChannelConfiguration::createProtocol(DataChannelConfiguration::CompressedProtocol).isPubSub());
+    EXPECT_TRUE(DataChannelConfiguration::createProtocol(DataChannelConfiguration::PubSubProtocol).isPubSub());
+}
+
+TEST(DataChannelConfigurationTests, isClockSync_shouldReturnTrueOnlyForTheClockSyncProtocol)
+{
+    EXPECT_FALSE(DataChannelConfiguration::create().isClockSync());
+    EXPECT_FALSE(DataChannelConfiguration::createProtocol(DataChannelConfiguration::PubSubProtocol).isClockSync());
+    EXPECT_TRUE(
+        DataChannelConfiguration::createMaxRetransmits(false, 0, DataChannelConfiguration::ClockSyncProtocol)
+            .isClockSync());
+}
+
+TEST(DataChannelConfigurationTests, isFileTransfer_shouldReturnTrueOnlyForTheFileTransferProtocol)
+{
+    EXPECT_FALSE(DataChannelConfiguration::create().isFileTransfer());
+    EXPECT_FALSE(
+        DataChannelConfiguration::createProtocol(DataChannelConfiguration::ClockSyncProtocol).isFileTransfer());
+    EXPECT_TRUE(
+        DataChannelConfiguration::createProtocol(DataChannelConfiguration::FileTransferProtocol).isFileTransfer());
+}
+
+TEST(DataChannelConfigurationTests, isRpc_shouldReturnTrueOnlyForTheRpcProtocol)
+{
+    EXPECT_FALSE(DataChannelConfiguration::create().isRpc());
+    EXPECT_FALSE(DataChannelConfiguration::createProtocol(DataChannelConfiguration::FileTransferProtocol).isRpc());
+    EXPECT_TRUE(DataChannelConfiguration::createProtocol(DataChannelConfiguration::RpcProtocol).isRpc());
+}
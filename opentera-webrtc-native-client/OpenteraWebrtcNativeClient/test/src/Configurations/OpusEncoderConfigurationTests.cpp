@@ -0,0 +1,72 @@
+#include <OpenteraWebrtcNativeClient/Configurations/OpusEncoderConfiguration.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+TEST(OpusEncoderConfigurationTests, create_shouldSetNullOpt)
+{
+    OpusEncoderConfiguration testee = OpusEncoderConfiguration::create();
+
+    EXPECT_EQ(testee.bitrateBps(), absl::nullopt);
+    EXPECT_EQ(testee.complexity(), absl::nullopt);
+    EXPECT_EQ(testee.frameSizeMs(), absl::nullopt);
+    EXPECT_EQ(testee.dtx(), absl::nullopt);
+    EXPECT_EQ(testee.inbandFec(), absl::nullopt);
+}
+
+TEST(OpusEncoderConfigurationTests, create_all_shouldSetTheAttributes)
+{
+    OpusEncoderConfiguration testee = OpusEncoderConfiguration::create(24000, 3, 40, true, false);
+
+    EXPECT_EQ(testee.bitrateBps(), 24000);
+    EXPECT_EQ(testee.complexity(), 3);
+    EXPECT_EQ(testee.frameSizeMs(), 40);
+    EXPECT_EQ(testee.dtx(), true);
+    EXPECT_EQ(testee.inbandFec(), false);
+}
+
+TEST(OpusEncoderConfigurationTests, apply_nullOpt_shouldKeepTheNegotiatedValues)
+{
+    webrtc::AudioEncoderOpusConfig negotiatedConfig;
+    negotiatedConfig.bitrate_bps = 32000;
+    negotiatedConfig.dtx_enabled = true;
+
+    auto config = OpusEncoderConfiguration::create().apply(negotiatedConfig);
+
+    EXPECT_EQ(config.bitrate_bps, 32000);
+    EXPECT_EQ(config.complexity, negotiatedConfig.complexity);
+    EXPECT_EQ(config.frame_size_ms, negotiatedConfig.frame_size_ms);
+    EXPECT_TRUE(config.dtx_enabled);
+    EXPECT_EQ(config.fec_enabled, negotiatedConfig.fec_enabled);
+}
+
+TEST(OpusEncoderConfigurationTests, apply_all_shouldOverrideTheNegotiatedValues)
+{
+    auto config = OpusEncoderConfiguration::create(24000, 3, 60, true, true).apply(webrtc::AudioEncoderOpusConfig());
+
+    EXPECT_EQ(config.bitrate_bps, 24000);
+    EXPECT_EQ(config.complexity, 3);
+    EXPECT_EQ(config.low_rate_complexity, 3);
+    EXPECT_EQ(config.frame_size_ms, 60);
+    EXPECT_TRUE(config.dtx_enabled);
+    EXPECT_TRUE(config.fec_enabled);
+    EXPECT_TRUE(config.IsOk());
+}
+
+TEST(OpusEncoderConfigurationTests, apply_outOfRangeValues_shouldClampOrIgnoreThem)
+{
+    webrtc::AudioEncoderOpusConfig negotiatedConfig;
+    negotiatedConfig.frame_size_ms = 20;
+
+    auto config1 = OpusEncoderConfiguration::create(1000, -1, 25, absl::nullopt, absl::nullopt).apply(negotiatedConfig);
+    auto config2 = OpusEncoderConfiguration::create(1000000, 11, absl::nullopt, absl::nullopt, absl::nullopt)
+                       .apply(negotiatedConfig);
+
+    EXPECT_EQ(config1.bitrate_bps, webrtc::AudioEncoderOpusConfig::kMinBitrateBps);
+    EXPECT_EQ(config1.complexity, 0);
+    EXPECT_EQ(config1.frame_size_ms, 20);
+    EXPECT_EQ(config2.bitrate_bps, webrtc::AudioEncoderOpusConfig::kMaxBitrateBps);
+    EXPECT_EQ(config2.complexity, 10);
+}
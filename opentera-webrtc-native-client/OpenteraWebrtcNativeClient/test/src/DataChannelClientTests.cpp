@@ -8,7 +8,13 @@
 
 #include <filesystem>
 
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <future>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 using namespace opentera;
@@ -18,6 +24,15 @@ namespace fs = std::filesystem;
 static const WebrtcConfiguration DefaultWebrtcConfiguration =
     WebrtcConfiguration::create({IceServer("stun:stun.l.google.com:19302")});
 
+static const map<string, DataChannelConfiguration> NamedDataChannelConfigurations = {
+    {"telemetry", DataChannelConfiguration::create(false)},
+    {"compressed", DataChannelConfiguration::createProtocol(DataChannelConfiguration::CompressedProtocol)},
+    {"coalesced", DataChannelConfiguration::createProtocol(DataChannelConfiguration::CoalescedProtocol)},
+    {"pubsub", DataChannelConfiguration::createProtocol(DataChannelConfiguration::PubSubProtocol)},
+    {"clock", DataChannelConfiguration::createProtocol(DataChannelConfiguration::ClockSyncProtocol)},
+    {"file", DataChannelConfiguration::createProtocol(DataChannelConfiguration::FileTransferProtocol)},
+    {"rpc", DataChannelConfiguration::createProtocol(DataChannelConfiguration::RpcProtocol)}};
+
 class DataChannelClientTests : public ::testing::TestWithParam<bool>
 {
     static unique_ptr<subprocess::Popen> m_signalingServerProcessTLS;
@@ -187,6 +202,12 @@ protected:
     string m_clientId2;
     string m_clientId3;
 
+    virtual DataChannelConfiguration dataChannelConfiguration(int clientIndex) const
+    {
+        return DataChannelConfiguration::create();
+    }
+    virtual map<string, DataChannelConfiguration> namedDataChannelConfigurations() const { return {}; }
+
     void SetUp() override
     {
         DataChannelClientTests::SetUp();
@@ -195,15 +216,18 @@ protected:
         m_client1 = make_unique<DataChannelClient>(
             SignalingServerConfiguration::create(m_baseUrl, "c1", sio::string_message::create("cd1"), "chat", "abc"),
             DefaultWebrtcConfiguration,
-            DataChannelConfiguration::create());
+            dataChannelConfiguration(1),
+            namedDataChannelConfigurations());
         m_client2 = make_unique<DataChannelClient>(
             SignalingServerConfiguration::create(m_baseUrl, "c2", sio::string_message::create("cd2"), "chat", "abc"),
             DefaultWebrtcConfiguration,
-            DataChannelConfiguration::create());
+            dataChannelConfiguration(2),
+            namedDataChannelConfigurations());
         m_client3 = make_unique<DataChannelClient>(
             SignalingServerConfiguration::create(m_baseUrl, "c3", sio::string_message::create("cd3"), "chat", "abc"),
             DefaultWebrtcConfiguration,
-            DataChannelConfiguration::create());
+            dataChannelConfiguration(3),
+            namedDataChannelConfigurations());
 
         m_client1->setTlsVerificationEnabled(false);
         m_client2->setTlsVerificationEnabled(false);
@@ -243,6 +267,231 @@ protected:
     }
 };
 
+class NamedDataChannelClientTests : public RightPasswordDataChannelClientTests
+{
+protected:
+    map<string, DataChannelConfiguration> namedDataChannelConfigurations() const override
+    {
+        return NamedDataChannelConfigurations;
+    }
+
+    // Calls all clients and waits until the named data channel between m_client1 and m_client2 is open.
+    void callAllAndWaitForNamedDataChannel(const string& channel)
+    {
+        CallbackAwaiter onDataChannelOpenedAwaiter(1, 15s);
+        m_client1->setOnDataChannelOpened(
+            channel,
+            [this, &onDataChannelOpenedAwaiter](const Client& client)
+            {
+                if (client.id() == m_clientId2)
+                {
+                    onDataChannelOpenedAwaiter.done();
+                }
+            });
+
+        m_client1->callAll();
+        onDataChannelOpenedAwaiter.wait(__FILE__, __LINE__);
+        m_client1->setOnDataChannelOpened(channel, nullptr);
+    }
+
+    // The state exchanged on the internal data channels has no callback, so it is polled.
+    template<class Predicate>
+    static bool waitUntil(Predicate predicate)
+    {
+        for (int i = 0; i < 1500 && !predicate(); i++)
+        {
+            this_thread::sleep_for(10ms);
+        }
+        return predicate();
+    }
+};
+
+class CompressionMismatchDataChannelClientTests : public RightPasswordDataChannelClientTests
+{
+protected:
+    // Only the second client compresses the messages of the default data channel.
+    DataChannelConfiguration dataChannelConfiguration(int clientIndex) const override
+    {
+        return clientIndex == 2 ? DataChannelConfiguration::createProtocol(DataChannelConfiguration::CompressedProtocol)
+                                : DataChannelConfiguration::create();
+    }
+
+    // Calls the callee from the caller and exchanges a compressible message between them.
+    void exchangeMessage(DataChannelClient& caller, DataChannelClient& callee)
+    {
+        const string message(10 * 1024, 'a');
+        const string callerId = caller.id();
+        const string calleeId = callee.id();
+        CallbackAwaiter onDataChannelMessageAwaiter(2, 15s);
+
+        caller.setOnDataChannelOpened(
+            [&](const Client& client)
+            {
+                if (client.id() == calleeId)
+                {
+                    caller.sendTo(message, {calleeId});
+                }
+            });
+        callee.setOnDataChannelOpened(
+            [&](const Client& client)
+            {
+                if (client.id() == callerId)
+                {
+                    callee.sendTo(message, {callerId});
+                }
+            });
+        auto onDataChannelMessageString = [&](const Client& client, const string& data)
+        {
+            EXPECT_EQ(data, message);
+            onDataChannelMessageAwaiter.done();
+        };
+        caller.setOnDataChannelMessageString(onDataChannelMessageString);
+        callee.setOnDataChannelMessageString(onDataChannelMessageString);
+        caller.setOnDataChannelError([](const Client& client, const string& error) { ADD_FAILURE() << error; });
+        callee.setOnDataChannelError([](const Client& client, const string& error) { ADD_FAILURE() << error; });
+
+        caller.callIds({calleeId});
+        onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+        caller.setOnDataChannelOpened([](const Client& client) {});
+        callee.setOnDataChannelOpened([](const Client& client) {});
+        caller.setOnDataChannelMessageString([](const Client& client, const string& data) {});
+        callee.setOnDataChannelMessageString([](const Client& client, const string& data) {});
+        caller.setOnDataChannelError([](const Client& client, const string& error) {});
+        callee.setOnDataChannelError([](const Client& client, const string& error) {});
+    }
+};
+
+TEST_P(DisconnectedDataChannelClientTests, constructor_invalidDataChannelName_shouldThrowRuntimeError)
+{
+    auto signalingServerConfiguration = SignalingServerConfiguration::create(
+        "http://localhost:8080",
+        "c2",
+        sio::string_message::create("cd2"),
+        "chat",
+        "");
+
+    EXPECT_THROW(
+        DataChannelClient(
+            signalingServerConfiguration,
+            DefaultWebrtcConfiguration,
+            DataChannelConfiguration::create(),
+            {{"", DataChannelConfiguration::create()}}),
+        runtime_error);
+    EXPECT_THROW(
+        DataChannelClient(
+            signalingServerConfiguration,
+            DefaultWebrtcConfiguration,
+            DataChannelConfiguration::create(),
+            {{"chat", DataChannelConfiguration::create()}}),
+        runtime_error);
+}
+
+TEST_P(DisconnectedDataChannelClientTests, constructor_severalPubSubDataChannels_shouldThrowRuntimeError)
+{
+    auto signalingServerConfiguration = SignalingServerConfiguration::create(
+        "http://localhost:8080",
+        "c2",
+        sio::string_message::create("cd2"),
+        "chat",
+        "");
+
+    EXPECT_THROW(
+        DataChannelClient(
+            signalingServerConfiguration,
+            DefaultWebrtcConfiguration,
+            DataChannelConfiguration::create(),
+            {{"a", DataChannelConfiguration::createProtocol(DataChannelConfiguration::PubSubProtocol)},
+             {"b", DataChannelConfiguration::createProtocol(DataChannelConfiguration::PubSubProtocol)}}),
+        runtime_error);
+}
+
+TEST_P(DisconnectedDataChannelClientTests, publish_noPubSubDataChannel_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(m_client1->subscribe(1), runtime_error);
+    EXPECT_THROW(m_client1->unsubscribe(1), runtime_error);
+    EXPECT_THROW(m_client1->publish(1, "abc"), runtime_error);
+}
+
+TEST_P(DisconnectedDataChannelClientTests, peerClockOffset_noClockSyncDataChannel_shouldReturnNothing)
+{
+    EXPECT_FALSE(m_client1->peerClockOffset("id").has_value());
+    EXPECT_FALSE(m_client1->peerRoundTripTime("id").has_value());
+    EXPECT_FALSE(m_client1->toPeerTime("id", 10).has_value());
+    EXPECT_FALSE(m_client1->fromPeerTime("id", 10).has_value());
+}
+
+TEST_P(DisconnectedDataChannelClientTests, constructor_unreliableFileTransferDataChannel_shouldThrowRuntimeError)
+{
+    auto signalingServerConfiguration = SignalingServerConfiguration::create(
+        "http://localhost:8080",
+        "c2",
+        sio::string_message::create("cd2"),
+        "chat",
+        "");
+
+    auto unreliableConfiguration =
+        DataChannelConfiguration::createMaxRetransmits(true, 0, DataChannelConfiguration::FileTransferProtocol);
+
+    EXPECT_THROW(
+        DataChannelClient(
+            signalingServerConfiguration,
+            DefaultWebrtcConfiguration,
+            DataChannelConfiguration::create(),
+            {{"a", unreliableConfiguration}}),
+        runtime_error);
+}
+
+TEST_P(DisconnectedDataChannelClientTests, sendFile_noFileTransferDataChannel_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(m_client1->sendFile("id", testing::TempDir() + "file.bin", "file.bin"), runtime_error);
+}
+
+TEST_P(DisconnectedDataChannelClientTests, call_noRpcDataChannel_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(m_client1->call("id", "method", "abc"), runtime_error);
+    EXPECT_THROW(m_client1->setRpcTimeout(0), runtime_error);
+    EXPECT_EQ(m_client1->rpcTimeout(), 10000);
+    EXPECT_EQ(m_client1->rpcWorkerCount(), 0);
+}
+
+TEST_P(DisconnectedDataChannelClientTests, setMessageDispatchWorkerCount_shouldSetTheNumberOfQueues)
+{
+    EXPECT_EQ(m_client1->messageDispatchWorkerCount(), 0);
+    EXPECT_TRUE(m_client1->messageDispatchQueueDepths().empty());
+
+    m_client1->setMessageDispatchWorkerCount(3);
+    EXPECT_EQ(m_client1->messageDispatchWorkerCount(), 3);
+    EXPECT_EQ(m_client1->messageDispatchQueueDepths(), vector<size_t>({0, 0, 0}));
+
+    m_client1->setMessageDispatchWorkerCount(0);
+    EXPECT_EQ(m_client1->messageDispatchWorkerCount(), 0);
+}
+
+TEST_P(DisconnectedDataChannelClientTests, setMaxFrameSizeAndFrameSendBufferSize_shouldValidateTheSizes)
+{
+    EXPECT_EQ(m_client1->maxFrameSize(), 16384);
+    EXPECT_EQ(m_client1->frameSendBufferSize(), 262144);
+
+    m_client1->setMaxFrameSize(65536);
+    m_client1->setFrameSendBufferSize(1048576);
+    EXPECT_EQ(m_client1->maxFrameSize(), 65536);
+    EXPECT_EQ(m_client1->frameSendBufferSize(), 1048576);
+
+    EXPECT_THROW(m_client1->setMaxFrameSize(1023), runtime_error);
+    EXPECT_THROW(m_client1->setMaxFrameSize(262145), runtime_error);
+    EXPECT_THROW(m_client1->setFrameSendBufferSize(0), runtime_error);
+    EXPECT_THROW(m_client1->setFrameSendBufferSize(16777217), runtime_error);
+    EXPECT_EQ(m_client1->maxFrameSize(), 65536);
+    EXPECT_EQ(m_client1->frameSendBufferSize(), 1048576);
+}
+
+TEST_P(DisconnectedDataChannelClientTests, compression_shouldHaveDefaultValues)
+{
+    EXPECT_EQ(m_client1->compressionThreshold(), MessageCompressor::DefaultThreshold);
+    EXPECT_EQ(m_client1->compressionRatio(), 1.0);
+}
+
 TEST_P(DisconnectedDataChannelClientTests, isConnected_shouldReturnFalse)
 {
     EXPECT_FALSE(m_client1->isConnected());
@@ -1147,16 +1396,983 @@ TEST_P(RightPasswordDataChannelClientTests, sendToAll_string_shouldSendTheDataTo
     m_client3->setOnDataChannelMessageString([](const Client& client, const string& data) {});
 }
 
-INSTANTIATE_TEST_SUITE_P(
-    WrongPasswordDataChannelClientTests,
-    WrongPasswordDataChannelClientTests,
-    ::testing::Values(false, true));
+TEST_P(RightPasswordDataChannelClientTests, sendBatch_shouldSendTheMessagesToTheirRecipients)
+{
+    CallbackAwaiter onDataChannelOpenedAwaiter(6, 60s);
+    CallbackAwaiter onDataChannelMessageAwaiter(3, 60s);
 
-INSTANTIATE_TEST_SUITE_P(SingleDataChannelClientTests, SingleDataChannelClientTests, ::testing::Values(false, true));
+    auto onDataChannelOpened = [this, &onDataChannelOpenedAwaiter](const Client& client)
+    {
+        if (onDataChannelOpenedAwaiter.done())
+        {
+            uint8_t data = 101;
 
-INSTANTIATE_TEST_SUITE_P(
-    RightPasswordDataChannelClientTests,
-    RightPasswordDataChannelClientTests,
+            DataChannelMessageBatch batch;
+            batch.addTo("data1", {m_clientId2});
+            batch.addToAll(&data, 1);
+            m_client1->sendBatch(move(batch));
+        }
+    };
+
+    m_client1->setOnDataChannelOpened(onDataChannelOpened);
+    m_client2->setOnDataChannelOpened(onDataChannelOpened);
+    m_client3->setOnDataChannelOpened(onDataChannelOpened);
+
+    m_client1->setOnDataChannelMessageString([](const Client& client, const string& data) { ADD_FAILURE(); });
+    m_client2->setOnDataChannelMessageString(
+        [this, &onDataChannelMessageAwaiter](const Client& client, const string& data)
+        {
+            onDataChannelMessageAwaiter.done();
+
+            EXPECT_EQ(client.id(), m_clientId1);
+            EXPECT_EQ(data, "data1");
+        });
+    m_client3->setOnDataChannelMessageString([](const Client& client, const string& data) { ADD_FAILURE(); });
+
+    m_client1->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size)
+                                             { ADD_FAILURE(); });
+    auto onDataChannelMessageBinary =
+        [this, &onDataChannelMessageAwaiter](const Client& client, const uint8_t* data, size_t size)
+    {
+        onDataChannelMessageAwaiter.done();
+
+        EXPECT_EQ(client.id(), m_clientId1);
+        ASSERT_EQ(size, 1);
+        EXPECT_EQ(data[0], 101);
+    };
+    m_client2->setOnDataChannelMessageBinary(onDataChannelMessageBinary);
+    m_client3->setOnDataChannelMessageBinary(onDataChannelMessageBinary);
+
+    m_client1->callAll();
+    onDataChannelOpenedAwaiter.wait(__FILE__, __LINE__);
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelOpened([](const Client& client) {});
+    m_client3->setOnDataChannelOpened([](const Client& client) {});
+
+    m_client1->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+    m_client2->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+    m_client3->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+
+    m_client1->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size) {});
+    m_client2->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size) {});
+    m_client3->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size) {});
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendBatch_manyMessages_shouldSendTheMessagesInOrder)
+{
+    constexpr int MessageCount = 1000;
+
+    CallbackAwaiter onDataChannelOpenedAwaiter(6, 60s);
+    CallbackAwaiter onDataChannelMessageAwaiter(MessageCount, 60s);
+
+    auto onDataChannelOpened = [this, &onDataChannelOpenedAwaiter](const Client& client)
+    {
+        if (onDataChannelOpenedAwaiter.done())
+        {
+            DataChannelMessageBatch batch(MessageCount);
+            for (int i = 0; i < MessageCount; i++)
+            {
+                batch.addTo(to_string(i), {m_clientId2});
+            }
+            m_client1->sendBatch(move(batch));
+        }
+    };
+
+    m_client1->setOnDataChannelOpened(onDataChannelOpened);
+    m_client2->setOnDataChannelOpened(onDataChannelOpened);
+    m_client3->setOnDataChannelOpened(onDataChannelOpened);
+
+    int expectedIndex = 0;
+    m_client2->setOnDataChannelMessageString(
+        [&onDataChannelMessageAwaiter, &expectedIndex](const Client& client, const string& data)
+        {
+            EXPECT_EQ(data, to_string(expectedIndex));
+            expectedIndex++;
+            onDataChannelMessageAwaiter.done();
+        });
+
+    m_client1->callAll();
+    onDataChannelOpenedAwaiter.wait(__FILE__, __LINE__);
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelOpened([](const Client& client) {});
+    m_client3->setOnDataChannelOpened([](const Client& client) {});
+
+    m_client2->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendTo_messageDispatchWorkers_shouldKeepTheOrderOfEachClient)
+{
+    constexpr int MessageCount = 500;
+
+    CallbackAwaiter onDataChannelOpenedAwaiter(6, 60s);
+    CallbackAwaiter onDataChannelMessageAwaiter(2 * MessageCount, 60s);
+
+    m_client2->setMessageDispatchWorkerCount(2);
+    auto onDataChannelOpened = [this, &onDataChannelOpenedAwaiter](const Client& client)
+    {
+        if (onDataChannelOpenedAwaiter.done())
+        {
+            for (int i = 0; i < MessageCount; i++)
+            {
+                m_client1->sendTo(to_string(i), {m_clientId2});
+                m_client3->sendTo(to_string(i), {m_clientId2});
+            }
+        }
+    };
+
+    m_client1->setOnDataChannelOpened(onDataChannelOpened);
+    m_client2->setOnDataChannelOpened(onDataChannelOpened);
+    m_client3->setOnDataChannelOpened(onDataChannelOpened);
+
+    // The messages of different clients can be handled at the same time, so the expected indexes are protected.
+    mutex expectedIndexesMutex;
+    map<string, int> expectedIndexesById;
+    m_client2->setOnDataChannelMessageString(
+        [&onDataChannelMessageAwaiter, &expectedIndexesMutex, &expectedIndexesById](
+            const Client& client,
+            const string& data)
+        {
+            {
+                lock_guard<mutex> lock(expectedIndexesMutex);
+                int& expectedIndex = expectedIndexesById[client.id()];
+                EXPECT_EQ(data, to_string(expectedIndex));
+                expectedIndex++;
+            }
+            onDataChannelMessageAwaiter.done();
+        });
+
+    m_client1->callAll();
+    onDataChannelOpenedAwaiter.wait(__FILE__, __LINE__);
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    EXPECT_EQ(expectedIndexesById[m_clientId1], MessageCount);
+    EXPECT_EQ(expectedIndexesById[m_clientId3], MessageCount);
+    EXPECT_EQ(m_client2->messageDispatchQueueDepths().size(), 2);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelOpened([](const Client& client) {});
+    m_client3->setOnDataChannelOpened([](const Client& client) {});
+
+    m_client2->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+    m_client2->setMessageDispatchWorkerCount(0);
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendTo_messageDispatchWorkers_shouldNotWaitForTheInternalClientThread)
+{
+    CallbackAwaiter onDataChannelOpenedAwaiter(1, 15s);
+    promise<void> messagePromise;
+    future<void> messageFuture = messagePromise.get_future();
+    future_status messageStatus = future_status::timeout;
+
+    m_client2->setMessageDispatchWorkerCount(1);
+    m_client1->setOnDataChannelOpened(
+        [this](const Client& client)
+        {
+            if (client.id() == m_clientId2)
+            {
+                m_client1->sendTo("message", {m_clientId2});
+            }
+        });
+    // The internal client thread of the receiver is blocked until the message is received by a worker.
+    m_client2->setOnDataChannelOpened(
+        [this, &onDataChannelOpenedAwaiter, &messageFuture, &messageStatus](const Client& client)
+        {
+            if (client.id() == m_clientId1)
+            {
+                messageStatus = messageFuture.wait_for(10s);
+                onDataChannelOpenedAwaiter.done();
+            }
+        });
+    m_client2->setOnDataChannelMessageString(
+        [&messagePromise](const Client& client, const string& data)
+        {
+            EXPECT_EQ(data, "message");
+            messagePromise.set_value();
+        });
+
+    m_client1->callAll();
+    onDataChannelOpenedAwaiter.wait(__FILE__, __LINE__);
+
+    EXPECT_EQ(messageStatus, future_status::ready);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+    m_client2->setMessageDispatchWorkerCount(0);
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendTo_fullSendQueue_shouldReturnFalseAndCallOnDataChannelBufferedAmountLow)
+{
+    CallbackAwaiter onDataChannelBufferedAmountLowAwaiter(1, 60s);
+    CallbackAwaiter onDataChannelMessageAwaiter(1, 60s);
+
+    m_client1->setSendQueueWatermarks(0, 1);
+    m_client1->setOnDataChannelOpened(
+        [this](const Client& client)
+        {
+            if (client.id() == m_clientId2)
+            {
+                // The callback is called from the internal client thread, so the first message cannot be sent
+                // before the second send call.
+                EXPECT_TRUE(m_client1->sendTo("data1", {m_clientId2}));
+                EXPECT_EQ(m_client1->bufferedAmount(m_clientId2), 5);
+                EXPECT_FALSE(m_client1->sendTo("data2", {m_clientId2}));
+            }
+        });
+    m_client1->setOnDataChannelBufferedAmountLow(
+        [this, &onDataChannelBufferedAmountLowAwaiter](const Client& client)
+        {
+            EXPECT_EQ(client.id(), m_clientId2);
+            EXPECT_EQ(m_client1->bufferedAmount(m_clientId2), 0);
+            onDataChannelBufferedAmountLowAwaiter.done();
+        });
+    m_client2->setOnDataChannelMessageString(
+        [&onDataChannelMessageAwaiter](const Client& client, const string& data)
+        {
+            EXPECT_EQ(data, "data1");
+            onDataChannelMessageAwaiter.done();
+        });
+
+    m_client1->callAll();
+    onDataChannelBufferedAmountLowAwaiter.wait(__FILE__, __LINE__);
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client1->setOnDataChannelBufferedAmountLow([](const Client& client) {});
+    m_client2->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendTo_fragmentation_shouldReassembleLargeMessagesWithoutBlockingSmallOnes)
+{
+    static constexpr size_t LargeMessageSize = 1024 * 1024;
+
+    CallbackAwaiter onDataChannelMessageAwaiter(2, 60s);
+
+    m_client1->setMessageFragmentationEnabled(true);
+    m_client2->setMessageFragmentationEnabled(true);
+    m_client3->setMessageFragmentationEnabled(true);
+
+    m_client1->setOnDataChannelOpened(
+        [this](const Client& client)
+        {
+            if (client.id() == m_clientId2)
+            {
+                vector<uint8_t> data(LargeMessageSize);
+                for (size_t i = 0; i < data.size(); i++)
+                {
+                    data[i] = static_cast<uint8_t>(i);
+                }
+                m_client1->sendTo(data.data(), data.size(), {m_clientId2});
+                m_client1->sendTo("small", {m_clientId2});
+            }
+        });
+
+    bool isSmallMessageReceived = false;
+    m_client2->setOnDataChannelMessageString(
+        [&onDataChannelMessageAwaiter, &isSmallMessageReceived](const Client& client, const string& data)
+        {
+            EXPECT_EQ(data, "small");
+            isSmallMessageReceived = true;
+            onDataChannelMessageAwaiter.done();
+        });
+    m_client2->setOnDataChannelMessageBinary(
+        [&onDataChannelMessageAwaiter, &isSmallMessageReceived](const Client& client, const uint8_t* data, size_t size)
+        {
+            EXPECT_TRUE(isSmallMessageReceived);
+            ASSERT_EQ(size, LargeMessageSize);
+            for (size_t i = 0; i < size; i++)
+            {
+                ASSERT_EQ(data[i], static_cast<uint8_t>(i));
+            }
+            onDataChannelMessageAwaiter.done();
+        });
+
+    m_client1->callAll();
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+    m_client2->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size) {});
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendTo_fragmentationSmallSendBuffer_shouldDrainTheQueueWhileSending)
+{
+    constexpr uint32_t MessageCount = 500;
+    constexpr size_t MessageSize = 8 * 1024;
+    CallbackAwaiter onDataChannelOpenedAwaiter(1, 15s);
+    CallbackAwaiter onDataChannelMessageAwaiter(1, 60s);
+
+    // The frames are small and only one fits in the send buffer, so the queue is drained by the buffered amount
+    // changes while the next messages are added to it.
+    for (DataChannelClient* client : {m_client1.get(), m_client2.get(), m_client3.get()})
+    {
+        client->setMessageFragmentationEnabled(true);
+        client->setMaxFrameSize(1024);
+        client->setFrameSendBufferSize(1);
+    }
+
+    m_client1->setOnDataChannelOpened(
+        [this, &onDataChannelOpenedAwaiter](const Client& client)
+        {
+            if (client.id() == m_clientId2)
+            {
+                onDataChannelOpenedAwaiter.done();
+            }
+        });
+
+    uint32_t expectedValue = 0;
+    m_client2->setOnDataChannelMessageBinary(
+        [&](const Client& client, const uint8_t* data, size_t size)
+        {
+            ASSERT_EQ(size, MessageSize);
+            uint32_t value;
+            memcpy(&value, data, sizeof(value));
+            EXPECT_EQ(value, expectedValue);
+            expectedValue++;
+
+            if (expectedValue == MessageCount)
+            {
+                onDataChannelMessageAwaiter.done();
+            }
+        });
+
+    m_client1->callAll();
+    onDataChannelOpenedAwaiter.wait(__FILE__, __LINE__);
+
+    vector<uint8_t> data(MessageSize, 0);
+    for (uint32_t i = 0; i < MessageCount; i++)
+    {
+        memcpy(data.data(), &i, sizeof(i));
+        EXPECT_TRUE(m_client1->sendTo(data.data(), data.size(), {m_clientId2}));
+    }
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    EXPECT_EQ(expectedValue, MessageCount);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size) {});
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendTo_fragmentationChunkCallback_shouldPassTheChunks)
+{
+    static constexpr size_t LargeMessageSize = 100 * 1024;
+
+    CallbackAwaiter onDataChannelMessageAwaiter(1, 60s);
+
+    m_client1->setMessageFragmentationEnabled(true);
+    m_client2->setMessageFragmentationEnabled(true);
+    m_client3->setMessageFragmentationEnabled(true);
+
+    m_client1->setOnDataChannelOpened(
+        [this](const Client& client)
+        {
+            if (client.id() == m_clientId2)
+            {
+                vector<uint8_t> data(LargeMessageSize, 42);
+                m_client1->sendTo(data.data(), data.size(), {m_clientId2});
+            }
+        });
+
+    size_t receivedSize = 0;
+    m_client2->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size)
+                                             { ADD_FAILURE(); });
+    m_client2->setOnDataChannelMessageChunk(
+        [&onDataChannelMessageAwaiter, &receivedSize](
+            const Client& client,
+            uint32_t messageId,
+            const uint8_t* data,
+            size_t size,
+            size_t offset,
+            size_t messageSize,
+            bool isBinary)
+        {
+            EXPECT_EQ(offset, receivedSize);
+            EXPECT_EQ(messageSize, LargeMessageSize);
+            EXPECT_TRUE(isBinary);
+            EXPECT_EQ(data[0], 42);
+            receivedSize += size;
+            if (receivedSize == messageSize)
+            {
+                onDataChannelMessageAwaiter.done();
+            }
+        });
+
+    m_client1->callAll();
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size) {});
+    m_client2->setOnDataChannelMessageChunk(nullptr);
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendTo_fragmentationEnabledByTheCalleeOnly_shouldSendPlainMessages)
+{
+    CallbackAwaiter onDataChannelMessageAwaiter(2, 15s);
+
+    // The caller does not propose the fragmentation, so the callee exchanges plain messages with it.
+    m_client2->setMessageFragmentationEnabled(true);
+
+    m_client1->setOnDataChannelOpened(
+        [this](const Client& client)
+        {
+            if (client.id() == m_clientId2)
+            {
+                m_client1->sendTo("from caller", {m_clientId2});
+            }
+        });
+    m_client2->setOnDataChannelOpened(
+        [this](const Client& client)
+        {
+            if (client.id() == m_clientId1)
+            {
+                m_client2->sendTo("from callee", {m_clientId1});
+            }
+        });
+    m_client1->setOnDataChannelMessageString(
+        [&onDataChannelMessageAwaiter](const Client& client, const string& data)
+        {
+            EXPECT_EQ(data, "from callee");
+            onDataChannelMessageAwaiter.done();
+        });
+    m_client2->setOnDataChannelMessageString(
+        [&onDataChannelMessageAwaiter](const Client& client, const string& data)
+        {
+            EXPECT_EQ(data, "from caller");
+            onDataChannelMessageAwaiter.done();
+        });
+    m_client2->setOnDataChannelError([](const Client& client, const string& error) { ADD_FAILURE() << error; });
+
+    m_client1->callAll();
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelOpened([](const Client& client) {});
+    m_client1->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+    m_client2->setOnDataChannelMessageString([](const Client& client, const string& data) {});
+    m_client2->setOnDataChannelError([](const Client& client, const string& error) {});
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendTo_fragmentationEnabledByTheCallerOnly_shouldReassembleTheMessages)
+{
+    static constexpr size_t LargeMessageSize = 100 * 1024;
+
+    CallbackAwaiter onDataChannelMessageAwaiter(1, 60s);
+
+    // The callee follows the protocol proposed by the caller.
+    m_client1->setMessageFragmentationEnabled(true);
+
+    m_client1->setOnDataChannelOpened(
+        [this](const Client& client)
+        {
+            if (client.id() == m_clientId2)
+            {
+                vector<uint8_t> data(LargeMessageSize, 42);
+                m_client1->sendTo(data.data(), data.size(), {m_clientId2});
+            }
+        });
+    m_client2->setOnDataChannelMessageBinary(
+        [&onDataChannelMessageAwaiter](const Client& client, const uint8_t* data, size_t size)
+        {
+            EXPECT_EQ(size, LargeMessageSize);
+            EXPECT_EQ(data[size - 1], 42);
+            onDataChannelMessageAwaiter.done();
+        });
+
+    m_client1->callAll();
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size) {});
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendTo_messageCallback_shouldPassTheMessagesWithoutCopy)
+{
+    CallbackAwaiter onDataChannelMessageAwaiter(2, 15s);
+
+    m_client1->setOnDataChannelOpened(
+        [this](const Client& client)
+        {
+            if (client.id() == m_clientId2)
+            {
+                const uint8_t data[] = {1, 2, 3};
+                m_client1->sendTo("abc", {m_clientId2});
+                m_client1->sendTo(data, sizeof(data), {m_clientId2});
+            }
+        });
+
+    vector<DataChannelMessage> messages;
+    m_client2->setOnDataChannelMessage(
+        [this, &messages, &onDataChannelMessageAwaiter](const Client& client, const DataChannelMessage& message)
+        {
+            EXPECT_EQ(client.id(), m_clientId1);
+            messages.push_back(message);
+            onDataChannelMessageAwaiter.done();
+        });
+
+    m_client1->callAll();
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    ASSERT_EQ(messages.size(), 2);
+    EXPECT_FALSE(messages[0].isBinary());
+    EXPECT_EQ(messages[0].view(), "abc");
+    EXPECT_TRUE(messages[1].isBinary());
+    ASSERT_EQ(messages[1].size(), 3);
+    EXPECT_EQ(messages[1].data()[2], 3);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelMessage(nullptr);
+}
+
+TEST_P(RightPasswordDataChannelClientTests, sendLatestTo_shouldSendTheLatestValues)
+{
+    constexpr uint32_t MessageCount = 1000;
+    CallbackAwaiter onDataChannelOpenedAwaiter(1, 15s);
+    CallbackAwaiter onDataChannelMessageAwaiter(1, 15s);
+
+    uint32_t lastValue = 0;
+    size_t receivedMessageCount = 0;
+
+    m_client1->setOnDataChannelOpened(
+        [this, &onDataChannelOpenedAwaiter](const Client& client)
+        {
+            if (client.id() == m_clientId2)
+            {
+                onDataChannelOpenedAwaiter.done();
+            }
+        });
+    m_client2->setOnDataChannelMessageBinary(
+        [&](const Client& client, const uint8_t* data, size_t size)
+        {
+            ASSERT_EQ(size, 4096);
+            uint32_t value;
+            memcpy(&value, data, sizeof(value));
+            if (receivedMessageCount > 0)
+            {
+                EXPECT_GT(value, lastValue);
+            }
+            lastValue = value;
+            receivedMessageCount++;
+
+            if (value == MessageCount - 1)
+            {
+                onDataChannelMessageAwaiter.done();
+            }
+        });
+
+    m_client1->callAll();
+    onDataChannelOpenedAwaiter.wait(__FILE__, __LINE__);
+
+    vector<uint8_t> data(4096, 0);
+    for (uint32_t i = 0; i < MessageCount; i++)
+    {
+        memcpy(data.data(), &i, sizeof(i));
+        m_client1->sendLatestTo("pose", data.data(), data.size(), {m_clientId2});
+    }
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    EXPECT_EQ(lastValue, MessageCount - 1);
+    EXPECT_LE(receivedMessageCount, MessageCount);
+
+    m_client1->setOnDataChannelOpened([](const Client& client) {});
+    m_client2->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size) {});
+}
+
+TEST_P(NamedDataChannelClientTests, sendTo_namedDataChannel_shouldSendTheMessagesOnTheSpecifiedChannel)
+{
+    CallbackAwaiter onDataChannelMessageAwaiter(2, 15s);
+
+
+    m_client2->setOnDataChannelMessageString([](const Client& client, const string& message) { ADD_FAILURE(); });
+    m_client2->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size)
+                                             { ADD_FAILURE(); });
+    m_client2->setOnDataChannelMessageString(
+        "telemetry",
+        [this, &onDataChannelMessageAwaiter](const Client& client, const string& message)
+        {
+            EXPECT_EQ(client.id(), m_clientId1);
+            EXPECT_EQ(message, "position");
+            onDataChannelMessageAwaiter.done();
+        });
+    m_client2->setOnDataChannelMessageBinary(
+        "telemetry",
+        [this, &onDataChannelMessageAwaiter](const Client& client, const uint8_t* data, size_t size)
+        {
+            EXPECT_EQ(client.id(), m_clientId1);
+            ASSERT_EQ(size, 2);
+            EXPECT_EQ(data[0], 10);
+            EXPECT_EQ(data[1], 20);
+            onDataChannelMessageAwaiter.done();
+        });
+
+    callAllAndWaitForNamedDataChannel("telemetry");
+
+    vector<uint8_t> data = {10, 20};
+    EXPECT_TRUE(m_client1->sendTo("telemetry", "position", {m_clientId2}));
+    EXPECT_TRUE(m_client1->sendTo("telemetry", data.data(), data.size(), {m_clientId2}));
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    m_client2->setOnDataChannelMessageString([](const Client& client, const string& message) {});
+    m_client2->setOnDataChannelMessageBinary([](const Client& client, const uint8_t* data, size_t size) {});
+    m_client2->setOnDataChannelMessageString("telemetry", nullptr);
+    m_client2->setOnDataChannelMessageBinary("telemetry", nullptr);
+}
+
+TEST_P(NamedDataChannelClientTests, sendTo_compressedDataChannel_shouldSendTheMessagesCompressed)
+{
+    CallbackAwaiter onDataChannelMessageAwaiter(2, 15s);
+
+    string json;
+    for (int i = 0; i < 100; i++)
+    {
+        json += R"({"x": 1.0, "y": 2.0, "status": "ok"},)";
+    }
+    vector<uint8_t> data(1000, 7);
+
+    m_client2->setOnDataChannelMessageString(
+        "compressed",
+        [this, &json, &onDataChannelMessageAwaiter](const Client& client, const string& message)
+        {
+            EXPECT_EQ(client.id(), m_clientId1);
+            EXPECT_EQ(message, json);
+            onDataChannelMessageAwaiter.done();
+        });
+    m_client2->setOnDataChannelMessageBinary(
+        "compressed",
+        [this, &data, &onDataChannelMessageAwaiter](const Client& client, const uint8_t* messageData, size_t size)
+        {
+            EXPECT_EQ(client.id(), m_clientId1);
+            EXPECT_EQ(vector<uint8_t>(messageData, messageData + size), data);
+            onDataChannelMessageAwaiter.done();
+        });
+
+    callAllAndWaitForNamedDataChannel("compressed");
+
+    EXPECT_TRUE(m_client1->sendTo("compressed", json, {m_clientId2}));
+    EXPECT_TRUE(m_client1->sendTo("compressed", data.data(), data.size(), {m_clientId2}));
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    EXPECT_GT(m_client1->compressionRatio(), 5.0);
+
+    m_client2->setOnDataChannelMessageString("compressed", nullptr);
+    m_client2->setOnDataChannelMessageBinary("compressed", nullptr);
+}
+
+TEST_P(NamedDataChannelClientTests, sendTo_coalescedDataChannel_shouldKeepTheMessageBoundariesAndOrder)
+{
+    constexpr int MessageCount = 1000;
+
+    CallbackAwaiter onDataChannelMessageAwaiter(MessageCount, 15s);
+    vector<string> expectedMessages;
+    vector<string> receivedMessages;
+
+    m_client2->setOnDataChannelMessageString(
+        "coalesced",
+        [&receivedMessages, &onDataChannelMessageAwaiter](const Client& client, const string& message)
+        {
+            receivedMessages.push_back("s" + message);
+            onDataChannelMessageAwaiter.done();
+        });
+    m_client2->setOnDataChannelMessageBinary(
+        "coalesced",
+        [&receivedMessages, &onDataChannelMessageAwaiter](const Client& client, const uint8_t* data, size_t size)
+        {
+            receivedMessages.push_back("b" + string(reinterpret_cast<const char*>(data), size));
+            onDataChannelMessageAwaiter.done();
+        });
+
+    callAllAndWaitForNamedDataChannel("coalesced");
+
+    for (int i = 0; i < MessageCount; i++)
+    {
+        // The sizes vary from 0 to 3 digits, so merged or split messages cannot go unnoticed.
+        string message = i % 7 == 0 ? "" : to_string(i);
+        if (i % 2 == 0)
+        {
+            EXPECT_TRUE(m_client1->sendTo("coalesced", message, {m_clientId2}));
+            expectedMessages.push_back("s" + message);
+        }
+        else
+        {
+            EXPECT_TRUE(m_client1->sendTo(
+                "coalesced",
+                reinterpret_cast<const uint8_t*>(message.data()),
+                message.size(),
+                {m_clientId2}));
+            expectedMessages.push_back("b" + message);
+        }
+    }
+    onDataChannelMessageAwaiter.wait(__FILE__, __LINE__);
+
+    EXPECT_EQ(receivedMessages, expectedMessages);
+    // The record headers are not counted, so the buffered amount goes back to 0.
+    EXPECT_TRUE(waitUntil([this]() { return m_client1->bufferedAmount(m_clientId2) == 0; }));
+
+    m_client2->setOnDataChannelMessageString("coalesced", nullptr);
+    m_client2->setOnDataChannelMessageBinary("coalesced", nullptr);
+}
+
+TEST_P(NamedDataChannelClientTests, publish_shouldSendTheMessagesOnlyToTheSubscribers)
+{
+    constexpr uint16_t Topic = 1000;
+    CallbackAwaiter onTopicMessageAwaiter(1, 15s);
+
+    m_client2->setOnTopicMessage(
+        [this, &onTopicMessageAwaiter](const Client& client, uint16_t topic, const DataChannelMessage& message)
+        {
+            EXPECT_EQ(client.id(), m_clientId1);
+            EXPECT_EQ(topic, Topic);
+            EXPECT_FALSE(message.isBinary());
+            EXPECT_EQ(message.view(), "abc");
+            onTopicMessageAwaiter.done();
+        });
+    m_client3->setOnTopicMessage(
+        [](const Client& client, uint16_t topic, const DataChannelMessage& message) { ADD_FAILURE(); });
+
+    m_client2->subscribe(Topic);
+    callAllAndWaitForNamedDataChannel("pubsub");
+
+    EXPECT_TRUE(m_client1->publish(Topic + 1, "def"));
+    // The subscription is sent when the channel opens, so the message is published until it has a subscriber.
+    EXPECT_TRUE(waitUntil(
+        [this]()
+        {
+            EXPECT_TRUE(m_client1->publish(Topic, "abc"));
+            return m_client1->topicStatistics(Topic).sentMessageCount() > 0;
+        }));
+    onTopicMessageAwaiter.wait(__FILE__, __LINE__);
+
+    EXPECT_EQ(m_client1->topicStatistics(Topic).sentMessageCount(), 1);
+    EXPECT_EQ(m_client1->topicStatistics(Topic).sentByteCount(), 3);
+    EXPECT_EQ(m_client1->topicStatistics(Topic + 1).sentMessageCount(), 0);
+    EXPECT_EQ(m_client2->topicStatistics(Topic).receivedMessageCount(), 1);
+    EXPECT_EQ(m_client2->topicStatistics(Topic).receivedByteCount(), 3);
+    EXPECT_EQ(m_client3->topicStatistics(Topic).receivedMessageCount(), 0);
+
+    m_client2->setOnTopicMessage(nullptr);
+    m_client3->setOnTopicMessage(nullptr);
+}
+
+TEST_P(NamedDataChannelClientTests, peerClockOffset_shouldEstimateTheClockOffset)
+{
+    callAllAndWaitForNamedDataChannel("clock");
+    ASSERT_TRUE(waitUntil(
+        [this]()
+        {
+            return m_client1->peerClockOffset(m_clientId2).has_value() &&
+                   m_client2->peerClockOffset(m_clientId1).has_value();
+        }));
+
+    // The clients are in the same process, so they share the same clock.
+    absl::optional<int64_t> offset = m_client1->peerClockOffset(m_clientId2);
+    ASSERT_TRUE(offset.has_value());
+    EXPECT_LT(abs(*offset), 10000);
+
+    absl::optional<int64_t> roundTripTime = m_client1->peerRoundTripTime(m_clientId2);
+    ASSERT_TRUE(roundTripTime.has_value());
+    EXPECT_GE(*roundTripTime, 0);
+
+    int64_t localTime = DataChannelClient::localTime();
+    EXPECT_EQ(m_client1->toPeerTime(m_clientId2, localTime), localTime + *offset);
+    EXPECT_EQ(m_client1->fromPeerTime(m_clientId2, localTime), localTime - *offset);
+    EXPECT_TRUE(m_client2->peerClockOffset(m_clientId1).has_value());
+}
+
+TEST_P(NamedDataChannelClientTests, sendFile_shouldWriteTheFileToTheDestination)
+{
+    constexpr size_t FileSize = 3 * 1024 * 1024 + 17;
+    string sourcePath = testing::TempDir() + "data_channel_client_source.bin";
+    string destinationPath = testing::TempDir() + "data_channel_client_destination.bin";
+    vector<char> content(FileSize);
+    for (size_t i = 0; i < content.size(); i++)
+    {
+        content[i] = static_cast<char>(i * 7);
+    }
+    {
+        ofstream file(sourcePath, ios::binary);
+        file.write(content.data(), content.size());
+    }
+
+    CallbackAwaiter onFileTransferCompletedAwaiter(2, 30s);
+
+    m_client2->setOnFileTransferRequested(
+        [&](const Client& client, const string& name, uint64_t size)
+        {
+            EXPECT_EQ(client.id(), m_clientId1);
+            EXPECT_EQ(name, "log.bin");
+            EXPECT_EQ(size, FileSize);
+            return destinationPath;
+        });
+    auto onFileTransferProgress =
+        [&](const Client& client, const string& name, bool isIncoming, uint64_t transferredSize, uint64_t size)
+    {
+        EXPECT_EQ(name, "log.bin");
+        EXPECT_LE(transferredSize, size);
+        if (transferredSize == size)
+        {
+            onFileTransferCompletedAwaiter.done();
+        }
+    };
+    m_client1->setOnFileTransferProgress(onFileTransferProgress);
+    m_client2->setOnFileTransferProgress(onFileTransferProgress);
+
+    callAllAndWaitForNamedDataChannel("file");
+    m_client1->sendFile(m_clientId2, sourcePath, "log.bin");
+    onFileTransferCompletedAwaiter.wait(__FILE__, __LINE__);
+
+    ifstream destination(destinationPath, ios::binary);
+    EXPECT_EQ(vector<char>(istreambuf_iterator<char>(destination), istreambuf_iterator<char>()), content);
+
+    m_client1->setOnFileTransferProgress(nullptr);
+    m_client2->setOnFileTransferRequested(nullptr);
+    m_client2->setOnFileTransferProgress(nullptr);
+}
+
+TEST_P(NamedDataChannelClientTests, sendFile_refusedFile_shouldCallOnDataChannelError)
+{
+    string sourcePath = testing::TempDir() + "data_channel_client_refused.bin";
+    {
+        ofstream file(sourcePath, ios::binary);
+        file << "abc";
+    }
+
+    CallbackAwaiter onDataChannelErrorAwaiter(1, 15s);
+
+    m_client1->setOnDataChannelError(
+        [&](const Client& client, const string& error) { onDataChannelErrorAwaiter.done(); });
+
+    callAllAndWaitForNamedDataChannel("file");
+    m_client1->sendFile(m_clientId2, sourcePath, "refused.bin");
+    onDataChannelErrorAwaiter.wait(__FILE__, __LINE__);
+
+    m_client1->setOnDataChannelError([](const Client& client, const string& error) {});
+}
+
+TEST_P(NamedDataChannelClientTests, call_shouldReturnTheResponsesOfTheHandlers)
+{
+    constexpr int CallCount = 20;
+
+    m_client2->setRpcWorkerCount(4);
+    m_client2->setRpcHandler(
+        "echo",
+        [this](const Client& client, const DataChannelMessage& request)
+        {
+            EXPECT_EQ(client.id(), m_clientId1);
+            return request;
+        });
+    m_client2->setRpcHandler(
+        "fail",
+        [](const Client& client, const DataChannelMessage& request) -> DataChannelMessage
+        { throw runtime_error("handler error"); });
+
+    callAllAndWaitForNamedDataChannel("rpc");
+
+    vector<future<DataChannelMessage>> responses;
+    for (int i = 0; i < CallCount; i++)
+    {
+        responses.push_back(m_client1->call(m_clientId2, "echo", to_string(i)));
+    }
+    const uint8_t data[] = {1, 2, 3};
+    future<DataChannelMessage> binaryResponse = m_client1->call(m_clientId2, "echo", data, sizeof(data));
+    future<DataChannelMessage> failedResponse = m_client1->call(m_clientId2, "fail", "abc");
+    future<DataChannelMessage> unknownResponse = m_client1->call(m_clientId2, "unknown", "abc");
+
+    for (int i = 0; i < CallCount; i++)
+    {
+        ASSERT_EQ(responses[i].wait_for(15s), future_status::ready);
+        DataChannelMessage response = responses[i].get();
+        EXPECT_FALSE(response.isBinary());
+        EXPECT_EQ(response.view(), to_string(i));
+    }
+    ASSERT_EQ(binaryResponse.wait_for(15s), future_status::ready);
+    DataChannelMessage response = binaryResponse.get();
+    EXPECT_TRUE(response.isBinary());
+    EXPECT_EQ(vector<uint8_t>(response.data(), response.data() + response.size()), vector<uint8_t>({1, 2, 3}));
+
+    ASSERT_EQ(failedResponse.wait_for(15s), future_status::ready);
+    try
+    {
+        failedResponse.get();
+        ADD_FAILURE();
+    }
+    catch (const runtime_error& e)
+    {
+        EXPECT_STREQ(e.what(), "handler error");
+    }
+    ASSERT_EQ(unknownResponse.wait_for(15s), future_status::ready);
+    EXPECT_THROW(unknownResponse.get(), runtime_error);
+
+    m_client2->setRpcHandler("echo", nullptr);
+    m_client2->setRpcHandler("fail", nullptr);
+    m_client2->setRpcWorkerCount(0);
+}
+
+TEST_P(NamedDataChannelClientTests, call_slowHandler_shouldTimeOut)
+{
+    CallbackAwaiter onRpcResponseAwaiter(1, 15s);
+
+    m_client2->setRpcWorkerCount(1);
+    m_client2->setRpcHandler(
+        "slow",
+        [](const Client& client, const DataChannelMessage& request)
+        {
+            this_thread::sleep_for(1s);
+            return request;
+        });
+
+    callAllAndWaitForNamedDataChannel("rpc");
+
+    m_client1->setRpcTimeout(100);
+    m_client1->call(
+        m_clientId2,
+        "slow",
+        "abc",
+        [&](const absl::optional<DataChannelMessage>& response, const string& error)
+        {
+            EXPECT_FALSE(response.has_value());
+            EXPECT_EQ(error, "The RPC call timed out.");
+            onRpcResponseAwaiter.done();
+        });
+    onRpcResponseAwaiter.wait(__FILE__, __LINE__);
+
+    m_client1->setRpcTimeout(10000);
+    m_client2->setRpcHandler("slow", nullptr);
+    m_client2->setRpcWorkerCount(0);
+}
+
+TEST_P(CompressionMismatchDataChannelClientTests, sendTo_uncompressedCaller_shouldSendUncompressedMessages)
+{
+    // The second client follows the uncompressed protocol proposed by the first one.
+    exchangeMessage(*m_client1, *m_client2);
+}
+
+TEST_P(CompressionMismatchDataChannelClientTests, sendTo_compressedCaller_shouldSendCompressedMessages)
+{
+    // The first client follows the compressed protocol proposed by the second one.
+    exchangeMessage(*m_client2, *m_client1);
+    EXPECT_LT(m_client1->compressionRatio(), 1.0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    WrongPasswordDataChannelClientTests,
+    WrongPasswordDataChannelClientTests,
+    ::testing::Values(false, true));
+
+INSTANTIATE_TEST_SUITE_P(SingleDataChannelClientTests, SingleDataChannelClientTests, ::testing::Values(false, true));
+
+INSTANTIATE_TEST_SUITE_P(
+    RightPasswordDataChannelClientTests,
+    RightPasswordDataChannelClientTests,
+    ::testing::Values(false, true));
+
+INSTANTIATE_TEST_SUITE_P(NamedDataChannelClientTests, NamedDataChannelClientTests, ::testing::Values(false, true));
+
+INSTANTIATE_TEST_SUITE_P(
+    CompressionMismatchDataChannelClientTests,
+    CompressionMismatchDataChannelClientTests,
     ::testing::Values(false, true));
 
 INSTANTIATE_TEST_SUITE_P(
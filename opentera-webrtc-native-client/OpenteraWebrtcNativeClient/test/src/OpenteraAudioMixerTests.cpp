@@ -0,0 +1,157 @@
+#include <OpenteraWebrtcNativeClient/OpenteraAudioMixer.h>
+
+#include <gtest/gtest.h>
+
+#include <rtc_base/ref_counted_object.h>
+
+using namespace opentera;
+using namespace std;
+
+class ConstantAudioMixerSource : public webrtc::AudioMixer::Source
+{
+    int m_ssrc;
+    int16_t m_value;
+    bool m_isMuted;
+
+public:
+    ConstantAudioMixerSource(int ssrc, int16_t value, bool isMuted = false)
+        : m_ssrc(ssrc),
+          m_value(value),
+          m_isMuted(isMuted)
+    {
+    }
+
+    AudioFrameInfo GetAudioFrameWithInfo(int sampleRate, webrtc::AudioFrame* audioFrame) override
+    {
+        size_t samplesPerChannel = static_cast<size_t>(sampleRate / 100);
+        audioFrame->UpdateFrame(
+            0,
+            nullptr,
+            samplesPerChannel,
+            sampleRate,
+            webrtc::AudioFrame::kNormalSpeech,
+            webrtc::AudioFrame::kVadActive,
+            1);
+        audioFrame->elapsed_time_ms_ = 10 * m_ssrc;
+        if (m_isMuted)
+        {
+            return AudioFrameInfo::kMuted;
+        }
+
+        int16_t* data = audioFrame->mutable_data();
+        for (size_t i = 0; i < samplesPerChannel; i++)
+        {
+            data[i] = m_value;
+        }
+        return AudioFrameInfo::kNormal;
+    }
+
+    int Ssrc() const override { return m_ssrc; }
+    int PreferredSampleRate() const override { return 16000; }
+};
+
+TEST(OpenteraAudioMixerTests, Mix_noSource_shouldReturnAnUntimedFrame)
+{
+    auto mixer = rtc::scoped_refptr<OpenteraAudioMixer>(new rtc::RefCountedObject<OpenteraAudioMixer>);
+    webrtc::AudioFrame frame;
+
+    mixer->Mix(1, &frame);
+
+    EXPECT_EQ(frame.sample_rate_hz_, 48000);
+    EXPECT_EQ(frame.samples_per_channel_, 480);
+    EXPECT_EQ(frame.num_channels_, 1);
+    EXPECT_EQ(frame.elapsed_time_ms_, -1);
+}
+
+TEST(OpenteraAudioMixerTests, AddSource_sameSource_shouldReturnFalse)
+{
+    auto mixer = rtc::scoped_refptr<OpenteraAudioMixer>(new rtc::RefCountedObject<OpenteraAudioMixer>);
+    ConstantAudioMixerSource source(1, 1000);
+
+    EXPECT_TRUE(mixer->AddSource(&source));
+    EXPECT_FALSE(mixer->AddSource(&source));
+}
+
+TEST(OpenteraAudioMixerTests, Mix_shouldOnlyMixTheLoudestSources)
+{
+    auto mixer = rtc::scoped_refptr<OpenteraAudioMixer>(new rtc::RefCountedObject<OpenteraAudioMixer>(2));
+    ConstantAudioMixerSource source1(1, 100);
+    ConstantAudioMixerSource source2(2, 1000);
+    ConstantAudioMixerSource source3(3, 10000);
+    mixer->AddSource(&source1);
+    mixer->AddSource(&source2);
+    mixer->AddSource(&source3);
+
+    webrtc::AudioFrame frame;
+    mixer->Mix(1, &frame);
+
+    EXPECT_EQ(frame.sample_rate_hz_, 16000);
+    ASSERT_EQ(frame.samples_per_channel_, 160);
+    EXPECT_EQ(frame.elapsed_time_ms_, 30);
+    for (size_t i = 0; i < frame.samples_per_channel_; i++)
+    {
+        EXPECT_EQ(frame.data()[i], 11000);
+    }
+}
+
+TEST(OpenteraAudioMixerTests, Mix_mutedAndSilentSources_shouldBeSkipped)
+{
+    auto mixer = rtc::scoped_refptr<OpenteraAudioMixer>(new rtc::RefCountedObject<OpenteraAudioMixer>);
+    ConstantAudioMixerSource mutedSource(1, 10000, true);
+    ConstantAudioMixerSource silentSource(2, 1);
+    ConstantAudioMixerSource activeSource(3, 1000);
+    mixer->AddSource(&mutedSource);
+    mixer->AddSource(&silentSource);
+    mixer->AddSource(&activeSource);
+
+    webrtc::AudioFrame frame;
+    mixer->Mix(2, &frame);
+
+    ASSERT_EQ(frame.num_channels_, 2);
+    for (size_t i = 0; i < frame.samples_per_channel_ * frame.num_channels_; i++)
+    {
+        EXPECT_EQ(frame.data()[i], 1000);
+    }
+}
+
+TEST(OpenteraAudioMixerTests, Mix_silentSource_shouldKeepTheTiming)
+{
+    auto mixer = rtc::scoped_refptr<OpenteraAudioMixer>(new rtc::RefCountedObject<OpenteraAudioMixer>);
+    ConstantAudioMixerSource silentSource(2, 0);
+    mixer->AddSource(&silentSource);
+
+    webrtc::AudioFrame frame;
+    mixer->Mix(1, &frame);
+
+    EXPECT_EQ(frame.elapsed_time_ms_, 20);
+    EXPECT_TRUE(frame.muted());
+}
+
+TEST(OpenteraAudioMixerTests, Mix_loudSources_shouldSaturate)
+{
+    auto mixer = rtc::scoped_refptr<OpenteraAudioMixer>(new rtc::RefCountedObject<OpenteraAudioMixer>);
+    ConstantAudioMixerSource source1(1, 30000);
+    ConstantAudioMixerSource source2(2, 30000);
+    mixer->AddSource(&source1);
+    mixer->AddSource(&source2);
+
+    webrtc::AudioFrame frame;
+    mixer->Mix(1, &frame);
+
+    EXPECT_EQ(frame.data()[0], numeric_limits<int16_t>::max());
+}
+
+TEST(OpenteraAudioMixerTests, RemoveSource_shouldNotMixTheSourceAnymore)
+{
+    auto mixer = rtc::scoped_refptr<OpenteraAudioMixer>(new rtc::RefCountedObject<OpenteraAudioMixer>);
+    ConstantAudioMixerSource source1(1, 1000);
+    ConstantAudioMixerSource source2(2, 2000);
+    mixer->AddSource(&source1);
+    mixer->AddSource(&source2);
+    mixer->RemoveSource(&source2);
+
+    webrtc::AudioFrame frame;
+    mixer->Mix(1, &frame);
+
+    EXPECT_EQ(frame.data()[0], 1000);
+}
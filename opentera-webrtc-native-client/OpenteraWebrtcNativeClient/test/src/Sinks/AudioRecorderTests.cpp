@@ -0,0 +1,226 @@
+#include <OpenteraWebrtcNativeClient/Sinks/AudioRecorder.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+static vector<uint8_t> readFile(const string& path)
+{
+    ifstream file(path, ios::binary);
+    return vector<uint8_t>(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+static uint32_t readUint32(const vector<uint8_t>& data, size_t offset)
+{
+    return data[offset] | (data[offset + 1] << 8) | (data[offset + 2] << 16) | (data[offset + 3] << 24);
+}
+
+static uint16_t readUint16(const vector<uint8_t>& data, size_t offset)
+{
+    return static_cast<uint16_t>(data[offset] | (data[offset + 1] << 8));
+}
+
+static uint32_t oggCrc(vector<uint8_t> page)
+{
+    for (size_t i = 22; i < 26; i++)
+    {
+        page[i] = 0;
+    }
+
+    uint32_t crc = 0;
+    for (uint8_t byte : page)
+    {
+        crc ^= static_cast<uint32_t>(byte) << 24;
+        for (int i = 0; i < 8; i++)
+        {
+            crc = (crc & 0x80000000) != 0 ? (crc << 1) ^ 0x04c11db7 : crc << 1;
+        }
+    }
+    return crc;
+}
+
+static vector<int16_t> createSineFrame(size_t frameIndex, size_t numberOfFrames, size_t numberOfChannels)
+{
+    vector<int16_t> data(numberOfFrames * numberOfChannels);
+    for (size_t i = 0; i < numberOfFrames; i++)
+    {
+        double t = static_cast<double>(frameIndex * numberOfFrames + i) / 48000.0;
+        for (size_t channel = 0; channel < numberOfChannels; channel++)
+        {
+            data[i * numberOfChannels + channel] = static_cast<int16_t>(10000 * sin(2 * M_PI * 440 * t));
+        }
+    }
+    return data;
+}
+
+TEST(AudioRecorderTests, write_wav_shouldWriteAValidFile)
+{
+    string path = testing::TempDir() + "audio_recorder_test.wav";
+    AudioRecorder testee(path, AudioRecordingFormat::Wav);
+
+    vector<int16_t> frame1 = {1, 2, 3, 4};
+    vector<int16_t> frame2 = {5, 6, 7, 8};
+    testee.write(frame1.data(), 16, 16000, 2, 2);
+    testee.write(frame2.data(), 16, 16000, 2, 2);
+    testee.close();
+
+    auto data = readFile(path);
+    ASSERT_EQ(data.size(), 44 + 16);
+    EXPECT_EQ(memcmp(data.data(), "RIFF", 4), 0);
+    EXPECT_EQ(readUint32(data, 4), 36 + 16);
+    EXPECT_EQ(memcmp(data.data() + 8, "WAVEfmt ", 8), 0);
+    EXPECT_EQ(readUint16(data, 20), 1);
+    EXPECT_EQ(readUint16(data, 22), 2);
+    EXPECT_EQ(readUint32(data, 24), 16000);
+    EXPECT_EQ(readUint32(data, 28), 16000 * 4);
+    EXPECT_EQ(readUint16(data, 32), 4);
+    EXPECT_EQ(readUint16(data, 34), 16);
+    EXPECT_EQ(memcmp(data.data() + 36, "data", 4), 0);
+    EXPECT_EQ(readUint32(data, 40), 16);
+    for (size_t i = 0; i < 8; i++)
+    {
+        EXPECT_EQ(readUint16(data, 44 + 2 * i), i + 1);
+    }
+    EXPECT_EQ(testee.droppedFrameCount(), 0);
+}
+
+TEST(AudioRecorderTests, write_wavFormatChange_shouldDropTheFrames)
+{
+    string path = testing::TempDir() + "audio_recorder_format_change_test.wav";
+    AudioRecorder testee(path, AudioRecordingFormat::Wav);
+
+    vector<int16_t> frame = {1, 2, 3, 4};
+    testee.write(frame.data(), 16, 16000, 1, 4);
+    testee.write(frame.data(), 16, 48000, 1, 4);
+    testee.write(frame.data(), 16, 16000, 2, 2);
+    testee.write(frame.data(), 12, 16000, 1, 4);
+    testee.close();
+
+    EXPECT_EQ(readFile(path).size(), 44 + 8);
+    EXPECT_EQ(testee.droppedFrameCount(), 10);
+}
+
+TEST(AudioRecorderTests, write_fullBuffer_shouldDropTheFrames)
+{
+    string path = testing::TempDir() + "audio_recorder_full_buffer_test.wav";
+    AudioRecorder testee(path, AudioRecordingFormat::Wav, 64);
+
+    vector<int16_t> frame(480);
+    testee.write(frame.data(), 16, 48000, 1, frame.size());
+    testee.close();
+
+    EXPECT_EQ(testee.droppedFrameCount(), frame.size());
+}
+
+TEST(AudioRecorderTests, write_oggOpus_shouldWriteValidPages)
+{
+    string path = testing::TempDir() + "audio_recorder_test.opus";
+    AudioRecorder testee(path, AudioRecordingFormat::OggOpus);
+
+    constexpr size_t NumberOfFrames = 480;
+    constexpr size_t NumberOfChannels = 3;
+    for (size_t i = 0; i < 200; i++)
+    {
+        auto frame = createSineFrame(i, NumberOfFrames, NumberOfChannels);
+        testee.write(frame.data(), 16, 48000, NumberOfChannels, NumberOfFrames);
+    }
+    testee.close();
+    EXPECT_EQ(testee.droppedFrameCount(), 0);
+
+    auto data = readFile(path);
+    size_t offset = 0;
+    size_t pageCount = 0;
+    uint8_t lastHeaderType = 0;
+    while (offset < data.size())
+    {
+        ASSERT_LE(offset + 27, data.size());
+        ASSERT_EQ(memcmp(data.data() + offset, "OggS", 4), 0);
+        EXPECT_EQ(readUint32(data, offset + 18), pageCount);
+
+        size_t segmentCount = data[offset + 26];
+        size_t pageSize = 27 + segmentCount;
+        for (size_t i = 0; i < segmentCount; i++)
+        {
+            pageSize += data[offset + 27 + i];
+        }
+        ASSERT_LE(offset + pageSize, data.size());
+
+        vector<uint8_t> page(data.begin() + offset, data.begin() + offset + pageSize);
+        EXPECT_EQ(readUint32(page, 22), oggCrc(page));
+        if (pageCount == 0)
+        {
+            EXPECT_EQ(page[5], 0x02);
+            EXPECT_EQ(memcmp(page.data() + 28, "OpusHead", 8), 0);
+            EXPECT_EQ(page[28 + 9], 2);
+        }
+        else if (pageCount == 1)
+        {
+            EXPECT_EQ(memcmp(page.data() + 27 + segmentCount, "OpusTags", 8), 0);
+        }
+
+        lastHeaderType = page[5];
+        offset += pageSize;
+        pageCount++;
+    }
+
+    EXPECT_GT(pageCount, 3);
+    EXPECT_EQ(lastHeaderType, 0x04);
+}
+
+TEST(AudioRecorderTests, writeEncoded_oggOpus_shouldWriteThePacketsAsTheyAre)
+{
+    string path = testing::TempDir() + "audio_recorder_encoded_test.opus";
+    AudioRecorder testee(path, AudioRecordingFormat::OggOpus);
+
+    vector<uint8_t> packet = {0xf8, 0x12, 0x34, 0x56};
+    testee.writeEncoded(packet.data(), packet.size(), 2);
+    testee.writeEncoded(packet.data(), packet.size(), 2);
+    vector<int16_t> frame(480);
+    testee.write(frame.data(), 16, 48000, 1, frame.size());
+    testee.close();
+    EXPECT_EQ(testee.droppedFrameCount(), frame.size());
+
+    auto data = readFile(path);
+    size_t offset = 0;
+    vector<vector<uint8_t>> pages;
+    while (offset < data.size())
+    {
+        ASSERT_LE(offset + 27, data.size());
+        size_t segmentCount = data[offset + 26];
+        size_t pageSize = 27 + segmentCount;
+        for (size_t i = 0; i < segmentCount; i++)
+        {
+            pageSize += data[offset + 27 + i];
+        }
+        ASSERT_LE(offset + pageSize, data.size());
+        pages.emplace_back(data.begin() + offset, data.begin() + offset + pageSize);
+        offset += pageSize;
+    }
+
+    ASSERT_EQ(pages.size(), 3);
+    EXPECT_EQ(pages[0][28 + 9], 2);
+    ASSERT_EQ(pages[2][26], 2);
+    EXPECT_EQ(readUint32(pages[2], 6), 1920);
+    EXPECT_EQ(vector<uint8_t>(pages[2].begin() + 29, pages[2].begin() + 33), packet);
+    EXPECT_EQ(vector<uint8_t>(pages[2].begin() + 33, pages[2].end()), packet);
+}
+
+TEST(AudioRecorderTests, writeEncoded_wav_shouldDropThePackets)
+{
+    string path = testing::TempDir() + "audio_recorder_encoded_test.wav";
+    AudioRecorder testee(path, AudioRecordingFormat::Wav);
+
+    vector<uint8_t> packet = {0xf8, 0x12, 0x34, 0x56};
+    testee.writeEncoded(packet.data(), packet.size(), 1);
+    testee.close();
+
+    EXPECT_EQ(readFile(path).size(), 44);
+    EXPECT_EQ(testee.droppedFrameCount(), 960);
+}
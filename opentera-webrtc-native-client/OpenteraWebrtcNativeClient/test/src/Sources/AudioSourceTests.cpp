@@ -35,7 +35,7 @@ public:
     {
         m_capturedData.emplace_back(
             reinterpret_cast<const int8_t*>(audioSamples),
-            reinterpret_cast<const int8_t*>(audioSamples) + nChannels * nSamples);
+            reinterpret_cast<const int8_t*>(audioSamples) + nBytesPerSample * nChannels * nSamples);
 
         m_bytesPerSample.emplace_back(nBytesPerSample);
         m_sampleRate.emplace_back(samplesPerSec);
@@ -80,6 +80,12 @@ TEST(AudioSourceTests, constructor_shouldOnlySupportValidBitsPerSample)
     EXPECT_THROW(AudioSource(AudioSourceConfiguration::create(0), 7, 48000, 1), runtime_error);
 }
 
+TEST(AudioSourceTests, constructor_invalidSelectedChannel_shouldThrowRuntimeError)
+{
+    EXPECT_NO_THROW(AudioSource(AudioSourceConfiguration::create(0), 16, 48000, 8, {0, 7}));
+    EXPECT_THROW(AudioSource(AudioSourceConfiguration::create(0), 16, 48000, 8, {0, 8}), runtime_error);
+}
+
 TEST(AudioSourceTests, configuration_shouldTheSpecifiedValues)
 {
     auto configuration = AudioSourceConfiguration::create(0, true, true, true, true, true, true);
@@ -158,3 +164,30 @@ TEST(AudioSourceTests, sendFrame_shouldCreate10msFrame)
     EXPECT_EQ(audioTransportMock.m_totalDelayMS, vector<uint32_t>({10, 10}));
     EXPECT_EQ(audioTransportMock.m_keyPressed, vector<bool>({false, true}));
 }
+
+TEST(AudioSourceTests, sendFrame_selectedChannels_shouldOnlySendTheSelectedChannels)
+{
+    AudioSource testee(AudioSourceConfiguration::create(10), 16, 400, 4, {3, 1});
+    rtc::scoped_refptr<OpenteraAudioDeviceModule> adm(new rtc::RefCountedObject<OpenteraAudioDeviceModule>);
+    AudioTransportMock audioTransportMock;
+    adm->RegisterAudioCallback(&audioTransportMock);
+    testee.setAudioDeviceModule(adm);
+
+    EXPECT_EQ(testee.bytesPerFrame(), 8);
+    EXPECT_EQ(testee.selectedChannels(), vector<size_t>({3, 1}));
+
+    int16_t data1[] = {0, 1, 2, 3, 10, 11, 12, 13, 20, 21, 22, 23};
+    int16_t data2[] = {30, 31, 32, 33, 40, 41, 42, 43, 50, 51, 52, 53};
+
+    testee.sendFrame(data1, 3);
+    testee.sendFrame(data2, 3);
+
+    ASSERT_EQ(audioTransportMock.m_numberOfChannels, vector<size_t>({2}));
+    EXPECT_EQ(audioTransportMock.m_numberOfFrames, vector<size_t>({4}));
+
+    vector<int16_t> expectedData = {3, 1, 13, 11, 23, 21, 33, 31};
+    vector<int8_t> expectedBytes(
+        reinterpret_cast<int8_t*>(expectedData.data()),
+        reinterpret_cast<int8_t*>(expectedData.data()) + expectedData.size() * sizeof(int16_t));
+    EXPECT_EQ(audioTransportMock.m_capturedData[0], expectedBytes);
+}
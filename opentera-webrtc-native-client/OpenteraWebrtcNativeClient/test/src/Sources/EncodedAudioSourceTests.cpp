@@ -0,0 +1,83 @@
+#include <OpenteraWebrtcNativeClient/Sources/EncodedAudioSource.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+constexpr uint8_t Celt20MsToc = 31 << 3;
+constexpr uint8_t Celt5MsToc = 17 << 3;
+
+TEST(EncodedAudioSourceTests, constructor_shouldOnlySupportMonoAndStereo)
+{
+    EXPECT_NO_THROW(EncodedAudioSource(1));
+    EXPECT_NO_THROW(EncodedAudioSource(2));
+    EXPECT_THROW(EncodedAudioSource(0), runtime_error);
+    EXPECT_THROW(EncodedAudioSource(3), runtime_error);
+}
+
+TEST(EncodedAudioSourceTests, constructor_shouldBypassTheAudioProcessing)
+{
+    EncodedAudioSource testee(2);
+
+    EXPECT_TRUE(testee.configuration().isPassThrough());
+    EXPECT_EQ(testee.bytesPerSample(), 2);
+    EXPECT_EQ(testee.bytesPerFrame(), 4);
+}
+
+TEST(EncodedAudioSourceTests, sendEncodedFrame_invalidPacket_shouldReturnFalse)
+{
+    EncodedAudioSource testee;
+    EncodedAudioFrameQueue queue;
+    testee.addEncodedAudioFrameQueue(&queue);
+
+    vector<uint8_t> frame;
+    EXPECT_FALSE(testee.sendEncodedFrame(nullptr, 0));
+    EXPECT_FALSE(testee.sendEncodedFrame(&Celt5MsToc, 1));
+    EXPECT_FALSE(queue.pop(frame));
+
+    testee.removeEncodedAudioFrameQueue(&queue);
+}
+
+TEST(EncodedAudioSourceTests, sendEncodedFrame_shouldPushThePacketToEveryQueue)
+{
+    EncodedAudioSource testee;
+    EncodedAudioFrameQueue queue1;
+    EncodedAudioFrameQueue queue2;
+    testee.addEncodedAudioFrameQueue(&queue1);
+    testee.addEncodedAudioFrameQueue(&queue2);
+
+    vector<uint8_t> packet = {Celt20MsToc, 1, 2, 3};
+    EXPECT_TRUE(testee.sendEncodedFrame(packet.data(), packet.size()));
+    testee.removeEncodedAudioFrameQueue(&queue2);
+    EXPECT_TRUE(testee.sendEncodedFrame(packet.data(), packet.size()));
+
+    vector<uint8_t> frame;
+    ASSERT_TRUE(queue1.pop(frame));
+    EXPECT_EQ(frame, packet);
+    ASSERT_TRUE(queue1.pop(frame));
+    EXPECT_EQ(frame, packet);
+    EXPECT_FALSE(queue1.pop(frame));
+
+    ASSERT_TRUE(queue2.pop(frame));
+    EXPECT_EQ(frame, packet);
+    EXPECT_FALSE(queue2.pop(frame));
+
+    testee.removeEncodedAudioFrameQueue(&queue1);
+}
+
+TEST(EncodedAudioSourceTests, EncodedAudioFrameQueue_push_full_shouldDropTheOldestPacket)
+{
+    EncodedAudioFrameQueue testee;
+    for (size_t i = 0; i < EncodedAudioFrameQueue::MaxSize + 1; i++)
+    {
+        uint8_t data = static_cast<uint8_t>(i);
+        testee.push(&data, 1);
+    }
+
+    vector<uint8_t> frame;
+    ASSERT_TRUE(testee.pop(frame));
+    EXPECT_EQ(frame, vector<uint8_t>{1});
+}
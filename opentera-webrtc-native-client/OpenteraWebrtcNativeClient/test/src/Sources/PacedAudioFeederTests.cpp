@@ -0,0 +1,125 @@
+#include <OpenteraWebrtcNativeClient/Sources/PacedAudioFeeder.h>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <thread>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+constexpr int SampleRate = 48000;
+constexpr size_t NumberOfFramesPerChunk = 480;
+
+static void appendUint16(vector<uint8_t>& data, uint16_t value)
+{
+    data.push_back(static_cast<uint8_t>(value));
+    data.push_back(static_cast<uint8_t>(value >> 8));
+}
+
+static void appendUint32(vector<uint8_t>& data, uint32_t value)
+{
+    appendUint16(data, static_cast<uint16_t>(value));
+    appendUint16(data, static_cast<uint16_t>(value >> 16));
+}
+
+static void writeWavFile(const string& path, uint16_t numberOfChannels, uint32_t sampleRate, size_t numberOfFrames)
+{
+    uint32_t dataSize = static_cast<uint32_t>(numberOfFrames * numberOfChannels * 2);
+
+    vector<uint8_t> data = {'R', 'I', 'F', 'F'};
+    appendUint32(data, 36 + dataSize);
+    data.insert(data.end(), {'W', 'A', 'V', 'E', 'f', 'm', 't', ' '});
+    appendUint32(data, 16);
+    appendUint16(data, 1);
+    appendUint16(data, numberOfChannels);
+    appendUint32(data, sampleRate);
+    appendUint32(data, sampleRate * numberOfChannels * 2);
+    appendUint16(data, static_cast<uint16_t>(numberOfChannels * 2));
+    appendUint16(data, 16);
+    data.insert(data.end(), {'d', 'a', 't', 'a'});
+    appendUint32(data, dataSize);
+    data.resize(data.size() + dataSize, 0);
+
+    ofstream file(path, ios::binary);
+    file.write(reinterpret_cast<const char*>(data.data()), data.size());
+}
+
+static bool waitForQueuedNumberOfFrames(PacedAudioFeeder& testee, size_t numberOfFrames)
+{
+    for (int i = 0; i < 1000 && testee.queuedNumberOfFrames() != numberOfFrames; i++)
+    {
+        this_thread::sleep_for(1ms);
+    }
+    return testee.queuedNumberOfFrames() == numberOfFrames;
+}
+
+static shared_ptr<AudioSource> createAudioSource()
+{
+    return make_shared<AudioSource>(AudioSourceConfiguration::createPassThrough(), 16, SampleRate, 1);
+}
+
+TEST(PacedAudioFeederTests, enqueue_shouldQueueTheFrames)
+{
+    PacedAudioFeeder testee(createAudioSource());
+    vector<int16_t> frames(1000, 0);
+
+    testee.enqueue(frames.data(), frames.size());
+    testee.enqueue(frames.data(), 10);
+
+    EXPECT_FALSE(testee.isStarted());
+    EXPECT_EQ(testee.queuedNumberOfFrames(), 1010);
+
+    testee.clear();
+    EXPECT_EQ(testee.queuedNumberOfFrames(), 0);
+}
+
+TEST(PacedAudioFeederTests, start_shouldSendOneChunkPerPeriodAndReportTheUnderrun)
+{
+    auto clock = make_shared<VirtualAudioClock>(false);
+    PacedAudioFeeder testee(createAudioSource(), clock);
+    vector<int16_t> frames(2 * NumberOfFramesPerChunk + 40, 0);
+    atomic<size_t> onUnderrunCount(0);
+    testee.setOnUnderrun([&]() { onUnderrunCount++; });
+
+    testee.enqueue(frames.data(), frames.size());
+    testee.start();
+    EXPECT_TRUE(testee.isStarted());
+    EXPECT_TRUE(waitForQueuedNumberOfFrames(testee, NumberOfFramesPerChunk + 40));
+    EXPECT_EQ(testee.underrunCount(), 0);
+
+    clock->advance(10ms);
+    EXPECT_TRUE(waitForQueuedNumberOfFrames(testee, 40));
+    EXPECT_EQ(testee.underrunCount(), 0);
+
+    clock->advance(10ms);
+    EXPECT_TRUE(waitForQueuedNumberOfFrames(testee, 0));
+    testee.stop();
+    EXPECT_FALSE(testee.isStarted());
+
+    EXPECT_EQ(testee.underrunCount(), 1);
+    EXPECT_EQ(onUnderrunCount.load(), 1);
+}
+
+TEST(PacedAudioFeederTests, enqueueWavFile_shouldQueueTheFrames)
+{
+    string path = testing::TempDir() + "paced_audio_feeder_test.wav";
+    writeWavFile(path, 1, SampleRate, 1234);
+    PacedAudioFeeder testee(createAudioSource());
+
+    testee.enqueueWavFile(path);
+
+    EXPECT_EQ(testee.queuedNumberOfFrames(), 1234);
+}
+
+TEST(PacedAudioFeederTests, enqueueWavFile_invalidFormat_shouldThrowRuntimeError)
+{
+    string path = testing::TempDir() + "paced_audio_feeder_invalid_test.wav";
+    writeWavFile(path, 2, SampleRate, 1234);
+    PacedAudioFeeder testee(createAudioSource());
+
+    EXPECT_THROW(testee.enqueueWavFile(path), runtime_error);
+    EXPECT_THROW(testee.enqueueWavFile(testing::TempDir() + "paced_audio_feeder_missing_test.wav"), runtime_error);
+    EXPECT_EQ(testee.queuedNumberOfFrames(), 0);
+}
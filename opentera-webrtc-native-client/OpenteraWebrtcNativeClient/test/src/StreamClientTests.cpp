@@ -13,6 +13,7 @@
 #include <atomic>
 #include <chrono>
 #include <memory>
+#include <mutex>
 #include <thread>
 
 using namespace opentera;
@@ -105,6 +106,37 @@ private:
     }
 };
 
+class ConstantEncodedAudioSource : public EncodedAudioSource
+{
+    vector<uint8_t> m_packet;
+    atomic_bool m_stopped;
+    thread m_thread;
+
+public:
+    explicit ConstantEncodedAudioSource(vector<uint8_t> packet)
+        : m_packet(move(packet)),
+          m_stopped(false),
+          m_thread(&ConstantEncodedAudioSource::run, this)
+    {
+    }
+
+    ~ConstantEncodedAudioSource() override
+    {
+        m_stopped.store(true);
+        m_thread.join();
+    }
+
+private:
+    void run()
+    {
+        while (!m_stopped.load())
+        {
+            sendEncodedFrame(m_packet.data(), m_packet.size());
+            this_thread::sleep_for(20ms);
+        }
+    }
+};
+
 static const WebrtcConfiguration DefaultWebrtcConfiguration =
     WebrtcConfiguration::create({IceServer("stun:stun.l.google.com:19302")});
 
@@ -884,4 +916,133 @@ TEST_P(StreamClientTests, audioStream_unidirectional_shouldBeSentAndReceived)
     EXPECT_EQ(onAddRemoteStreamClient->name(), "c1");
 }
 
+TEST_P(StreamClientTests, encodedAudioStream_unidirectional_shouldBeSentAndReceivedWithoutTranscoding)
+{
+    // Initialize the clients
+    const vector<uint8_t> Packet = {0xf8, 0x12, 0x34, 0x56, 0x78};
+    shared_ptr<ConstantEncodedAudioSource> audioSource = make_shared<ConstantEncodedAudioSource>(Packet);
+
+    CallbackAwaiter setupAwaiter(2, 15s);
+    unique_ptr<StreamClient> client1 = make_unique<StreamClient>(
+        SignalingServerConfiguration::create(m_baseUrl, "c1", sio::string_message::create("cd1"), "chat", "abc"),
+        DefaultWebrtcConfiguration,
+        audioSource);
+    unique_ptr<StreamClient> client2 = make_unique<StreamClient>(
+        SignalingServerConfiguration::create(m_baseUrl, "c2", sio::string_message::create("cd2"), "chat", "abc"),
+        DefaultWebrtcConfiguration);
+
+    client1->setTlsVerificationEnabled(false);
+    client2->setTlsVerificationEnabled(false);
+
+    client1->setOnSignalingConnectionOpened([&] { setupAwaiter.done(); });
+    client2->setOnSignalingConnectionOpened([&] { setupAwaiter.done(); });
+
+    client1->setOnError([](const string& error) { ADD_FAILURE() << error; });
+    client2->setOnError([](const string& error) { ADD_FAILURE() << error; });
+
+    client1->connect();
+    this_thread::sleep_for(250ms);
+    client2->connect();
+    setupAwaiter.wait(__FILE__, __LINE__);
+
+    // Setup the callback
+    CallbackAwaiter onEncodedAudioFrameAwaiter(10, 15s);
+
+    client1->setOnAudioFrameReceived([](const Client&, const void*, int, int, size_t, size_t) { ADD_FAILURE(); });
+    client1->setOnEncodedAudioFrameReceived([](const Client&, const uint8_t*, size_t, size_t, uint32_t)
+                                            { ADD_FAILURE(); });
+
+    client2->setOnEncodedAudioFrameReceived(
+        [&](const Client&, const uint8_t* data, size_t dataSize, size_t numberOfFrames, uint32_t)
+        {
+            EXPECT_EQ(vector<uint8_t>(data, data + dataSize), Packet);
+            EXPECT_EQ(numberOfFrames, 960);
+            onEncodedAudioFrameAwaiter.done();
+        });
+
+    // Setup the call
+    client1->callAll();
+    onEncodedAudioFrameAwaiter.wait(__FILE__, __LINE__);
+    client1->hangUpAll();
+
+    client1->closeSync();
+    client2->closeSync();
+}
+
+TEST_P(StreamClientTests, audioVideoStream_synchronized_shouldBeReceivedInTimestampOrder)
+{
+    // Initialize the clients
+    constexpr int16_t Amplitude = 5000;
+    shared_ptr<ConstantVideoSource> videoSource = make_shared<ConstantVideoSource>(cv::Scalar(0, 0, 255));
+    shared_ptr<SinAudioSource> audioSource = make_shared<SinAudioSource>(Amplitude);
+
+    CallbackAwaiter setupAwaiter(2, 15s);
+    unique_ptr<StreamClient> client1 = make_unique<StreamClient>(
+        SignalingServerConfiguration::create(m_baseUrl, "c1", sio::string_message::create("cd1"), "chat", "abc"),
+        DefaultWebrtcConfiguration,
+        videoSource,
+        audioSource);
+    unique_ptr<StreamClient> client2 = make_unique<StreamClient>(
+        SignalingServerConfiguration::create(m_baseUrl, "c2", sio::string_message::create("cd2"), "chat", "abc"),
+        DefaultWebrtcConfiguration);
+
+    client1->setTlsVerificationEnabled(false);
+    client2->setTlsVerificationEnabled(false);
+    client2->setAudioVideoSynchronizationEnabled(true);
+    EXPECT_TRUE(client2->isAudioVideoSynchronizationEnabled());
+
+    client1->setOnSignalingConnectionOpened([&] { setupAwaiter.done(); });
+    client2->setOnSignalingConnectionOpened([&] { setupAwaiter.done(); });
+
+    client1->setOnError([](const string& error) { ADD_FAILURE() << error; });
+    client2->setOnError([](const string& error) { ADD_FAILURE() << error; });
+
+    client1->connect();
+    this_thread::sleep_for(250ms);
+    client2->connect();
+    setupAwaiter.wait(__FILE__, __LINE__);
+
+    // Setup the callback
+    CallbackAwaiter onAudioFrameAwaiter(50, 15s);
+    CallbackAwaiter onVideoFrameAwaiter(5, 15s);
+
+    mutex timestampMutex;
+    uint64_t lastTimestampUs = 0;
+    size_t outOfOrderCount = 0;
+    auto checkTimestamp = [&](uint64_t timestampUs)
+    {
+        lock_guard<mutex> lock(timestampMutex);
+        if (timestampUs < lastTimestampUs)
+        {
+            outOfOrderCount++;
+        }
+        lastTimestampUs = timestampUs;
+    };
+
+    client2->setOnVideoFrameReceived(
+        [&](const Client&, const cv::Mat&, uint64_t timestampUs)
+        {
+            checkTimestamp(timestampUs);
+            onVideoFrameAwaiter.done();
+        });
+    client2->setOnTimestampedAudioFrameReceived(
+        [&](const Client&, const void*, int, int, size_t, size_t, uint64_t timestampUs)
+        {
+            checkTimestamp(timestampUs);
+            onAudioFrameAwaiter.done();
+        });
+
+    // Setup the call
+    client1->callAll();
+    onAudioFrameAwaiter.wait(__FILE__, __LINE__);
+    onVideoFrameAwaiter.wait(__FILE__, __LINE__);
+    client1->hangUpAll();
+
+    client1->closeSync();
+    client2->closeSync();
+
+    // Asserts
+    EXPECT_EQ(outOfOrderCount, 0);
+}
+
 INSTANTIATE_TEST_SUITE_P(StreamClientTests, StreamClientTests, ::testing::Values(false, true));
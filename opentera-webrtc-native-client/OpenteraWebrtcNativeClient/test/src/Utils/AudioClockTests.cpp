@@ -0,0 +1,80 @@
+#include <OpenteraWebrtcNativeClient/Utils/AudioClock.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <thread>
+
+using namespace opentera;
+using namespace std;
+
+TEST(AudioClockTests, sleepUntil_realTime_shouldWaitTheWallClock)
+{
+    RealTimeAudioClock testee;
+
+    auto start = testee.now();
+    testee.sleepUntil(start + 20ms);
+
+    EXPECT_GE(testee.now() - start, 20ms);
+}
+
+TEST(AudioClockTests, sleepUntil_freeRunning_shouldJumpToTheRequestedTime)
+{
+    VirtualAudioClock testee;
+    EXPECT_TRUE(testee.isFreeRunning());
+    EXPECT_EQ(testee.now(), 0ns);
+
+    auto start = chrono::steady_clock::now();
+    for (int i = 1; i <= 6000; i++)
+    {
+        testee.sleepUntil(i * 10ms);
+    }
+
+    EXPECT_EQ(testee.now(), 60s);
+    EXPECT_LT(chrono::steady_clock::now() - start, 10s);
+}
+
+TEST(AudioClockTests, sleepUntil_freeRunningPastTime_shouldNotGoBackInTime)
+{
+    VirtualAudioClock testee;
+
+    testee.sleepUntil(20ms);
+    testee.sleepUntil(10ms);
+
+    EXPECT_EQ(testee.now(), 20ms);
+}
+
+TEST(AudioClockTests, sleepUntil_stepped_shouldWaitForAdvance)
+{
+    VirtualAudioClock testee(false);
+    EXPECT_FALSE(testee.isFreeRunning());
+
+    atomic_bool isAwake(false);
+    thread sleepingThread(
+        [&]()
+        {
+            testee.sleepUntil(20ms);
+            isAwake.store(true);
+        });
+
+    testee.advance(10ms);
+    this_thread::sleep_for(50ms);
+    EXPECT_FALSE(isAwake.load());
+
+    testee.advance(10ms);
+    sleepingThread.join();
+    EXPECT_TRUE(isAwake.load());
+    EXPECT_EQ(testee.now(), 20ms);
+}
+
+TEST(AudioClockTests, wakeUp_stepped_shouldWakeUpTheSleepingThread)
+{
+    VirtualAudioClock testee(false);
+
+    thread sleepingThread([&]() { testee.sleepUntil(10ms); });
+    this_thread::sleep_for(10ms);
+    testee.wakeUp();
+    sleepingThread.join();
+
+    EXPECT_EQ(testee.now(), 0ns);
+}
@@ -0,0 +1,197 @@
+#include <OpenteraWebrtcNativeClient/Utils/AudioConverter.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+
+using namespace opentera;
+using namespace std;
+
+struct ConvertedFrame
+{
+    vector<uint8_t> data;
+    int bitsPerSample;
+    int sampleRate;
+    size_t numberOfChannels;
+    size_t numberOfFrames;
+    uint64_t timestampUs;
+};
+
+static void convert(
+    AudioConverter& testee,
+    const vector<int16_t>& data,
+    int sampleRate,
+    size_t numberOfChannels,
+    vector<ConvertedFrame>& frames,
+    uint64_t timestampUs = 0)
+{
+    testee.convert(
+        data.data(),
+        16,
+        sampleRate,
+        numberOfChannels,
+        data.size() / numberOfChannels,
+        timestampUs,
+        [&](const void* audioData,
+            int bitsPerSample,
+            int sampleRate,
+            size_t numberOfChannels,
+            size_t numberOfFrames,
+            uint64_t timestampUs)
+        {
+            auto bytes = reinterpret_cast<const uint8_t*>(audioData);
+            size_t size = numberOfFrames * numberOfChannels * bitsPerSample / 8;
+            frames.push_back(
+                {vector<uint8_t>(bytes, bytes + size),
+                 bitsPerSample,
+                 sampleRate,
+                 numberOfChannels,
+                 numberOfFrames,
+                 timestampUs});
+        });
+}
+
+template<class T>
+static vector<T> samples(const ConvertedFrame& frame)
+{
+    vector<T> values(frame.data.size() / sizeof(T));
+    memcpy(values.data(), frame.data.data(), frame.data.size());
+    return values;
+}
+
+TEST(AudioConverterTests, constructor_invalidValues_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(
+        AudioConverter(AudioSinkConfiguration::create(24, absl::nullopt, absl::nullopt, absl::nullopt)),
+        runtime_error);
+    EXPECT_THROW(
+        AudioConverter(AudioSinkConfiguration::create(absl::nullopt, 44101, absl::nullopt, absl::nullopt)),
+        runtime_error);
+    EXPECT_THROW(
+        AudioConverter(AudioSinkConfiguration::create(absl::nullopt, absl::nullopt, 0u, absl::nullopt)),
+        runtime_error);
+    EXPECT_THROW(
+        AudioConverter(AudioSinkConfiguration::create(absl::nullopt, absl::nullopt, absl::nullopt, 0u)),
+        runtime_error);
+}
+
+TEST(AudioConverterTests, convert_stereoToMono_shouldAverageTheChannels)
+{
+    AudioConverter testee(AudioSinkConfiguration::create(absl::nullopt, absl::nullopt, 1u, absl::nullopt));
+    vector<ConvertedFrame> frames;
+
+    convert(testee, {100, 200, -300, -100, 10, 20, 0, 0}, 400, 2, frames);
+
+    ASSERT_EQ(frames.size(), 1u);
+    EXPECT_EQ(frames[0].bitsPerSample, 16);
+    EXPECT_EQ(frames[0].sampleRate, 400);
+    EXPECT_EQ(frames[0].numberOfChannels, 1u);
+    EXPECT_EQ(frames[0].numberOfFrames, 4u);
+    EXPECT_EQ(samples<int16_t>(frames[0]), vector<int16_t>({150, -200, 15, 0}));
+}
+
+TEST(AudioConverterTests, convert_monoToStereo_shouldDuplicateTheChannel)
+{
+    AudioConverter testee(AudioSinkConfiguration::create(absl::nullopt, absl::nullopt, 2u, absl::nullopt));
+    vector<ConvertedFrame> frames;
+
+    convert(testee, {1, 2, 3, 4}, 400, 1, frames);
+
+    ASSERT_EQ(frames.size(), 1u);
+    EXPECT_EQ(frames[0].numberOfChannels, 2u);
+    EXPECT_EQ(frames[0].numberOfFrames, 4u);
+    EXPECT_EQ(samples<int16_t>(frames[0]), vector<int16_t>({1, 1, 2, 2, 3, 3, 4, 4}));
+}
+
+TEST(AudioConverterTests, convert_bitsPerSample_shouldConvertTheSamples)
+{
+    AudioConverter testee8(AudioSinkConfiguration::create(8, absl::nullopt, absl::nullopt, absl::nullopt));
+    AudioConverter testee32(AudioSinkConfiguration::create(32, absl::nullopt, absl::nullopt, absl::nullopt));
+    vector<ConvertedFrame> frames8;
+    vector<ConvertedFrame> frames32;
+
+    convert(testee8, {-32768, -256, 256, 32767}, 400, 1, frames8);
+    convert(testee32, {-32768, -1, 1, 32767}, 400, 1, frames32);
+
+    ASSERT_EQ(frames8.size(), 1u);
+    EXPECT_EQ(frames8[0].bitsPerSample, 8);
+    EXPECT_EQ(samples<int8_t>(frames8[0]), vector<int8_t>({-128, -1, 1, 127}));
+
+    ASSERT_EQ(frames32.size(), 1u);
+    EXPECT_EQ(frames32[0].bitsPerSample, 32);
+    EXPECT_EQ(samples<int32_t>(frames32[0]), vector<int32_t>({-2147483648, -65536, 65536, 2147418112}));
+}
+
+TEST(AudioConverterTests, convert_sampleRate_shouldResampleTheFrames)
+{
+    AudioConverter testee(AudioSinkConfiguration::create(absl::nullopt, 16000, absl::nullopt, absl::nullopt));
+    vector<ConvertedFrame> frames;
+
+    convert(testee, vector<int16_t>(480, 0), 48000, 1, frames);
+    convert(testee, vector<int16_t>(960, 0), 48000, 2, frames);
+
+    ASSERT_EQ(frames.size(), 2u);
+    EXPECT_EQ(frames[0].sampleRate, 16000);
+    EXPECT_EQ(frames[0].numberOfChannels, 1u);
+    EXPECT_EQ(frames[0].numberOfFrames, 160u);
+    EXPECT_EQ(frames[1].sampleRate, 16000);
+    EXPECT_EQ(frames[1].numberOfChannels, 2u);
+    EXPECT_EQ(frames[1].numberOfFrames, 160u);
+}
+
+TEST(AudioConverterTests, convert_numberOfFramesPerChunk_shouldGroupTheFrames)
+{
+    AudioConverter testee(AudioSinkConfiguration::create(absl::nullopt, absl::nullopt, absl::nullopt, 3u));
+    vector<ConvertedFrame> frames;
+
+    convert(testee, {1, 2}, 200, 1, frames);
+    EXPECT_EQ(frames.size(), 0u);
+
+    convert(testee, {3, 4}, 200, 1, frames);
+    ASSERT_EQ(frames.size(), 1u);
+    EXPECT_EQ(frames[0].numberOfFrames, 3u);
+    EXPECT_EQ(samples<int16_t>(frames[0]), vector<int16_t>({1, 2, 3}));
+
+    convert(testee, {5, 6}, 200, 1, frames);
+    ASSERT_EQ(frames.size(), 2u);
+    EXPECT_EQ(samples<int16_t>(frames[1]), vector<int16_t>({4, 5, 6}));
+}
+
+TEST(AudioConverterTests, convert_numberOfFramesPerChunk_shouldSetTheTimestampOfTheFirstFrame)
+{
+    AudioConverter testee(AudioSinkConfiguration::create(absl::nullopt, absl::nullopt, absl::nullopt, 3u));
+    vector<ConvertedFrame> frames;
+
+    convert(testee, {1, 2}, 200, 1, frames, 10000);
+    convert(testee, {3, 4}, 200, 1, frames, 20000);
+    convert(testee, {5, 6}, 200, 1, frames, 30000);
+
+    ASSERT_EQ(frames.size(), 2u);
+    EXPECT_EQ(frames[0].timestampUs, 10000u);
+    EXPECT_EQ(frames[1].timestampUs, 25000u);
+}
+
+TEST(AudioConverterTests, convert_numberOfFramesPerChunk_formatChange_shouldDropThePartialChunk)
+{
+    AudioConverter testee(AudioSinkConfiguration::create(absl::nullopt, absl::nullopt, absl::nullopt, 2u));
+    vector<ConvertedFrame> frames;
+
+    convert(testee, {1}, 100, 1, frames);
+    convert(testee, {2, 3, 4, 5}, 200, 2, frames);
+
+    ASSERT_EQ(frames.size(), 1u);
+    EXPECT_EQ(frames[0].sampleRate, 200);
+    EXPECT_EQ(frames[0].numberOfChannels, 2u);
+    EXPECT_EQ(samples<int16_t>(frames[0]), vector<int16_t>({2, 3, 4, 5}));
+}
+
+TEST(AudioConverterTests, convert_not16Bits_shouldDropTheFrame)
+{
+    AudioConverter testee(AudioSinkConfiguration::create(absl::nullopt, absl::nullopt, 1u, absl::nullopt));
+    int32_t data[] = {1, 2};
+    bool isCalled = false;
+
+    testee.convert(data, 32, 100, 2, 1, 0, [&](const void*, int, int, size_t, size_t, uint64_t) { isCalled = true; });
+
+    EXPECT_FALSE(isCalled);
+}
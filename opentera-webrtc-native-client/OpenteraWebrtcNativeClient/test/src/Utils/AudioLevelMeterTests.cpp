@@ -0,0 +1,88 @@
+#include <OpenteraWebrtcNativeClient/Utils/AudioLevelMeter.h>
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+constexpr int SampleRate = 48000;
+constexpr size_t FrameCount = 480;
+
+static vector<int16_t> createSquareWave(int16_t amplitude, size_t numberOfChannels = 1)
+{
+    vector<int16_t> data(FrameCount * numberOfChannels);
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = (i / numberOfChannels) % 2 == 0 ? amplitude : static_cast<int16_t>(-amplitude);
+    }
+    return data;
+}
+
+TEST(AudioLevelMeterTests, computeRmsDbfs_shouldReturnTheRmsLevel)
+{
+    auto fullScale = createSquareWave(32767, 2);
+    auto halfScale = createSquareWave(16384);
+    vector<int16_t> silence(FrameCount);
+    vector<int8_t> fullScale8Bits(FrameCount, 127);
+    vector<int32_t> fullScale32Bits(FrameCount, 2147483647);
+
+    EXPECT_NEAR(computeRmsDbfs(fullScale.data(), 16, 2, FrameCount), 0.f, 0.01f);
+    EXPECT_NEAR(computeRmsDbfs(halfScale.data(), 16, 1, FrameCount), -6.02f, 0.01f);
+    EXPECT_EQ(computeRmsDbfs(silence.data(), 16, 1, FrameCount), AudioLevelMeter::MinLevelDbfs);
+    EXPECT_NEAR(computeRmsDbfs(fullScale8Bits.data(), 8, 1, FrameCount), 0.f, 0.1f);
+    EXPECT_NEAR(computeRmsDbfs(fullScale32Bits.data(), 32, 1, FrameCount), 0.f, 0.01f);
+}
+
+TEST(AudioLevelMeterTests, computeRmsDbfs_invalidBitsPerSample_shouldThrowRuntimeError)
+{
+    vector<int16_t> silence(FrameCount);
+    EXPECT_THROW(computeRmsDbfs(silence.data(), 12, 1, FrameCount), runtime_error);
+}
+
+TEST(AudioLevelMeterTests, update_shouldUpdateTheLevelAtTheEndOfEachInterval)
+{
+    AudioLevelMeter testee(30);
+    auto halfScale = createSquareWave(16384);
+    vector<int16_t> silence(FrameCount);
+
+    EXPECT_FALSE(testee.update(halfScale.data(), 16, SampleRate, 1, FrameCount));
+    EXPECT_FALSE(testee.update(halfScale.data(), 16, SampleRate, 1, FrameCount));
+    EXPECT_EQ(testee.level().levelDbfs(), AudioLevelMeter::MinLevelDbfs);
+
+    EXPECT_TRUE(testee.update(silence.data(), 16, SampleRate, 1, FrameCount));
+    EXPECT_NEAR(testee.level().levelDbfs(), -6.02f + 10.f * log10(2.f / 3.f), 0.01f);
+}
+
+TEST(AudioLevelMeterTests, update_shouldDetectVoiceActivityWithHangover)
+{
+    AudioLevelMeter testee(100, -40.f, 20);
+    auto voice = createSquareWave(1000);
+    vector<int16_t> silence(FrameCount);
+
+    EXPECT_FALSE(testee.level().isVoiceActive());
+
+    testee.update(voice.data(), 16, SampleRate, 1, FrameCount);
+    EXPECT_TRUE(testee.level().isVoiceActive());
+
+    testee.update(silence.data(), 16, SampleRate, 1, FrameCount);
+    EXPECT_TRUE(testee.level().isVoiceActive());
+
+    testee.update(silence.data(), 16, SampleRate, 1, FrameCount);
+    EXPECT_FALSE(testee.level().isVoiceActive());
+}
+
+TEST(AudioLevelMeterTests, update_noHangover_shouldOnlyReportActiveFrames)
+{
+    AudioLevelMeter testee(100, -40.f, 0);
+    auto voice = createSquareWave(1000);
+    vector<int16_t> silence(FrameCount);
+
+    testee.update(voice.data(), 16, SampleRate, 1, FrameCount);
+    EXPECT_TRUE(testee.level().isVoiceActive());
+
+    testee.update(silence.data(), 16, SampleRate, 1, FrameCount);
+    EXPECT_FALSE(testee.level().isVoiceActive());
+}
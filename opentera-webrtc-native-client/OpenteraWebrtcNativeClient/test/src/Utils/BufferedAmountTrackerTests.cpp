@@ -0,0 +1,118 @@
+#include <OpenteraWebrtcNativeClient/Utils/BufferedAmountTracker.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+TEST(BufferedAmountTrackerTests, setWatermarks_invalid_shouldThrowRuntimeError)
+{
+    BufferedAmountTracker testee;
+
+    EXPECT_THROW(testee.setWatermarks(10, 5), runtime_error);
+}
+
+TEST(BufferedAmountTrackerTests, tryReserve_unbounded_shouldAlwaysReserve)
+{
+    BufferedAmountTracker testee;
+    testee.addPeer("a");
+
+    EXPECT_TRUE(testee.tryReserve({"a"}, 1000));
+    EXPECT_TRUE(testee.tryReserve({"a", "b"}, 1000));
+
+    EXPECT_EQ(testee.bufferedAmount("a"), 2000);
+    EXPECT_EQ(testee.bufferedAmount("b"), 0);
+}
+
+TEST(BufferedAmountTrackerTests, tryReserve_overHighWatermark_shouldReserveNothing)
+{
+    BufferedAmountTracker testee;
+    testee.setWatermarks(10, 100);
+    testee.addPeer("a");
+    testee.addPeer("b");
+
+    EXPECT_TRUE(testee.tryReserve({"a"}, 90));
+    EXPECT_FALSE(testee.tryReserve({"a", "b"}, 20));
+
+    EXPECT_EQ(testee.bufferedAmount("a"), 90);
+    EXPECT_EQ(testee.bufferedAmount("b"), 0);
+}
+
+TEST(BufferedAmountTrackerTests, tryReserve_emptyBuffer_shouldAcceptAMessageLargerThanTheHighWatermark)
+{
+    BufferedAmountTracker testee;
+    testee.setWatermarks(10, 100);
+    testee.addPeer("a");
+
+    EXPECT_TRUE(testee.tryReserve({"a"}, 1000));
+    EXPECT_FALSE(testee.tryReserve({"a"}, 1));
+}
+
+TEST(BufferedAmountTrackerTests, tryReserveAll_shouldReserveForAllPeers)
+{
+    BufferedAmountTracker testee;
+    testee.addPeer("a");
+    testee.addPeer("b");
+
+    EXPECT_TRUE(testee.tryReserveAll(10));
+
+    EXPECT_EQ(testee.bufferedAmount("a"), 10);
+    EXPECT_EQ(testee.bufferedAmount("b"), 10);
+}
+
+TEST(BufferedAmountTrackerTests, release_shouldReturnTrueOnceWhenABlockedPeerReachesTheLowWatermark)
+{
+    BufferedAmountTracker testee;
+    testee.setWatermarks(10, 100);
+    testee.addPeer("a");
+    ASSERT_TRUE(testee.tryReserve({"a"}, 60));
+    ASSERT_TRUE(testee.tryReserve({"a"}, 40));
+    ASSERT_FALSE(testee.tryReserve({"a"}, 1));
+
+    EXPECT_FALSE(testee.release("a", 60));
+    EXPECT_TRUE(testee.release("a", 30));
+    EXPECT_FALSE(testee.release("a", 10));
+
+    EXPECT_EQ(testee.bufferedAmount("a"), 0);
+}
+
+TEST(BufferedAmountTrackerTests, release_notBlocked_shouldReturnFalse)
+{
+    BufferedAmountTracker testee;
+    testee.setWatermarks(10, 100);
+    testee.addPeer("a");
+    ASSERT_TRUE(testee.tryReserve({"a"}, 60));
+
+    EXPECT_FALSE(testee.release("a", 100));
+    EXPECT_FALSE(testee.release("b", 100));
+
+    EXPECT_EQ(testee.bufferedAmount("a"), 0);
+}
+
+TEST(BufferedAmountTrackerTests, reserve_shouldIgnoreTheHighWatermark)
+{
+    BufferedAmountTracker testee;
+    testee.setWatermarks(10, 100);
+    testee.addPeer("a");
+    testee.addPeer("b");
+
+    testee.reserve({"a", "c"}, 150);
+    testee.reserveAll(20);
+
+    EXPECT_EQ(testee.bufferedAmount("a"), 170);
+    EXPECT_EQ(testee.bufferedAmount("b"), 20);
+    EXPECT_EQ(testee.bufferedAmount("c"), 0);
+}
+
+TEST(BufferedAmountTrackerTests, removePeer_shouldStopTrackingThePeer)
+{
+    BufferedAmountTracker testee;
+    testee.addPeer("a");
+    testee.addPeer("b");
+    ASSERT_TRUE(testee.tryReserve({"a"}, 60));
+
+    testee.removePeer("a");
+
+    EXPECT_EQ(testee.bufferedAmount("a"), 0);
+    EXPECT_EQ(testee.peerIds(), vector<string>({"b"}));
+}
@@ -0,0 +1,56 @@
+#include <OpenteraWebrtcNativeClient/Utils/ClockOffsetEstimator.h>
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+
+using namespace opentera;
+using namespace std;
+
+TEST(ClockOffsetEstimatorTests, constructor_zeroWindowSize_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(ClockOffsetEstimator(0), runtime_error);
+}
+
+TEST(ClockOffsetEstimatorTests, addSample_symmetricDelays_shouldEstimateTheExactOffset)
+{
+    ClockOffsetEstimator testee;
+    EXPECT_FALSE(testee.hasEstimate());
+
+    // The peer clock is 5000 us ahead, each way takes 100 us and the peer takes 30 us to respond.
+    EXPECT_TRUE(testee.addSample(1000, 6100, 6130, 1230));
+
+    EXPECT_TRUE(testee.hasEstimate());
+    EXPECT_EQ(testee.offsetUs(), 5000);
+    EXPECT_EQ(testee.roundTripTimeUs(), 200);
+    EXPECT_EQ(testee.smoothedRoundTripTimeUs(), 200);
+}
+
+TEST(ClockOffsetEstimatorTests, addSample_shouldUseTheSampleWithTheSmallestRoundTripTime)
+{
+    ClockOffsetEstimator testee(2);
+
+    // The response of the first sample is delayed by 1000 us of queuing, so its offset is wrong.
+    EXPECT_TRUE(testee.addSample(0, 5100, 5100, 1200));
+    EXPECT_EQ(testee.offsetUs(), 4500);
+
+    EXPECT_TRUE(testee.addSample(2000, 7100, 7100, 2200));
+    EXPECT_EQ(testee.offsetUs(), 5000);
+    EXPECT_EQ(testee.roundTripTimeUs(), 200);
+    EXPECT_EQ(testee.smoothedRoundTripTimeUs(), 1200 + (200 - 1200) / 8);
+
+    // The best sample leaves the window.
+    EXPECT_TRUE(testee.addSample(4000, 9100, 9100, 4400));
+    EXPECT_TRUE(testee.addSample(6000, 11100, 11100, 6400));
+    EXPECT_EQ(testee.offsetUs(), 4900);
+    EXPECT_EQ(testee.roundTripTimeUs(), 400);
+}
+
+TEST(ClockOffsetEstimatorTests, addSample_invalidSample_shouldReturnFalse)
+{
+    ClockOffsetEstimator testee;
+
+    EXPECT_FALSE(testee.addSample(1000, 6130, 6100, 1230));
+    EXPECT_FALSE(testee.addSample(1000, 6100, 6500, 1230));
+    EXPECT_FALSE(testee.hasEstimate());
+}
@@ -0,0 +1,61 @@
+#include <OpenteraWebrtcNativeClient/Utils/ClockSyncFrame.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+TEST(ClockSyncFrameTests, encodeRequest_shouldBeDecodedWithTheSameTime)
+{
+    webrtc::DataBuffer frame = ClockSyncFrame::encodeRequest(-1234567890123);
+
+    EXPECT_TRUE(frame.binary);
+    EXPECT_EQ(frame.size(), ClockSyncFrame::RequestSize);
+
+    ClockSyncFrame::Type type;
+    int64_t originateTimeUs;
+    int64_t receiveTimeUs;
+    int64_t transmitTimeUs;
+    ASSERT_TRUE(ClockSyncFrame::decode(frame, type, originateTimeUs, receiveTimeUs, transmitTimeUs));
+    EXPECT_EQ(type, ClockSyncFrame::Type::Request);
+    EXPECT_EQ(originateTimeUs, -1234567890123);
+    EXPECT_EQ(receiveTimeUs, 0);
+    EXPECT_EQ(transmitTimeUs, 0);
+}
+
+TEST(ClockSyncFrameTests, encodeResponse_shouldBeDecodedWithTheSameTimes)
+{
+    webrtc::DataBuffer frame = ClockSyncFrame::encodeResponse(1, 0x0102030405060708, 3);
+
+    EXPECT_TRUE(frame.binary);
+    EXPECT_EQ(frame.size(), ClockSyncFrame::ResponseSize);
+    EXPECT_EQ(frame.data.data<uint8_t>()[9], 0x08);
+
+    ClockSyncFrame::Type type;
+    int64_t originateTimeUs;
+    int64_t receiveTimeUs;
+    int64_t transmitTimeUs;
+    ASSERT_TRUE(ClockSyncFrame::decode(frame, type, originateTimeUs, receiveTimeUs, transmitTimeUs));
+    EXPECT_EQ(type, ClockSyncFrame::Type::Response);
+    EXPECT_EQ(originateTimeUs, 1);
+    EXPECT_EQ(receiveTimeUs, 0x0102030405060708);
+    EXPECT_EQ(transmitTimeUs, 3);
+}
+
+TEST(ClockSyncFrameTests, decode_invalidFrame_shouldReturnFalse)
+{
+    webrtc::DataBuffer request = ClockSyncFrame::encodeRequest(1);
+    webrtc::DataBuffer truncatedResponse(ClockSyncFrame::encodeResponse(1, 2, 3).data.Slice(0, 24), true);
+    webrtc::DataBuffer requestWithResponseType(request.data.Slice(0, request.size()), true);
+    requestWithResponseType.data.MutableData()[0] = static_cast<uint8_t>(ClockSyncFrame::Type::Response);
+
+    ClockSyncFrame::Type type;
+    int64_t originateTimeUs;
+    int64_t receiveTimeUs;
+    int64_t transmitTimeUs;
+    EXPECT_FALSE(
+        ClockSyncFrame::decode(webrtc::DataBuffer("abc"), type, originateTimeUs, receiveTimeUs, transmitTimeUs));
+    EXPECT_FALSE(ClockSyncFrame::decode(truncatedResponse, type, originateTimeUs, receiveTimeUs, transmitTimeUs));
+    EXPECT_FALSE(
+        ClockSyncFrame::decode(requestWithResponseType, type, originateTimeUs, receiveTimeUs, transmitTimeUs));
+}
@@ -0,0 +1,65 @@
+#include <OpenteraWebrtcNativeClient/Utils/ConflatingQueue.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+static string toString(const webrtc::DataBuffer& buffer) { return string(buffer.data.data<char>(), buffer.size()); }
+
+TEST(ConflatingQueueTests, constructor_maxSize0_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(ConflatingQueue(0), runtime_error);
+}
+
+TEST(ConflatingQueueTests, push_differentKeys_shouldAppendTheMessages)
+{
+    ConflatingQueue testee;
+
+    EXPECT_EQ(testee.push("a", webrtc::DataBuffer("1")), 0);
+    EXPECT_EQ(testee.push("b", webrtc::DataBuffer("2")), 0);
+
+    ASSERT_EQ(testee.size(), 2);
+    EXPECT_EQ(toString(testee.pop()), "1");
+    EXPECT_EQ(toString(testee.pop()), "2");
+    EXPECT_TRUE(testee.empty());
+}
+
+TEST(ConflatingQueueTests, push_sameKey_shouldReplaceTheMessageInPlace)
+{
+    ConflatingQueue testee;
+    testee.push("a", webrtc::DataBuffer("1"));
+    testee.push("b", webrtc::DataBuffer("2"));
+
+    EXPECT_EQ(testee.push("a", webrtc::DataBuffer("33")), 1);
+
+    ASSERT_EQ(testee.size(), 2);
+    EXPECT_EQ(toString(testee.pop()), "33");
+    EXPECT_EQ(toString(testee.pop()), "2");
+}
+
+TEST(ConflatingQueueTests, push_fullQueue_shouldDropTheOldestMessage)
+{
+    ConflatingQueue testee(2);
+    testee.push("a", webrtc::DataBuffer("1"));
+    testee.push("b", webrtc::DataBuffer("2"));
+
+    EXPECT_EQ(testee.push("c", webrtc::DataBuffer("3")), 1);
+
+    ASSERT_EQ(testee.size(), 2);
+    EXPECT_EQ(toString(testee.pop()), "2");
+    EXPECT_EQ(toString(testee.pop()), "3");
+}
+
+TEST(ConflatingQueueTests, pop_shouldAllowTheKeyToBePushedAgain)
+{
+    ConflatingQueue testee;
+    testee.push("a", webrtc::DataBuffer("1"));
+    testee.pop();
+
+    EXPECT_EQ(testee.push("a", webrtc::DataBuffer("2")), 0);
+    EXPECT_EQ(testee.size(), 1);
+
+    testee.clear();
+    EXPECT_TRUE(testee.empty());
+}
@@ -0,0 +1,39 @@
+#include <OpenteraWebrtcNativeClient/Utils/DataChannelMessageBatch.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+TEST(DataChannelMessageBatchTests, constructor_shouldCreateAnEmptyBatch)
+{
+    DataChannelMessageBatch testee;
+
+    EXPECT_EQ(testee.size(), 0);
+    EXPECT_TRUE(testee.empty());
+}
+
+TEST(DataChannelMessageBatchTests, add_shouldAppendTheMessages)
+{
+    const uint8_t data[] = {1, 2, 3};
+    DataChannelMessageBatch testee(4);
+
+    testee.addTo(data, sizeof(data), {"id1"});
+    testee.addTo("message", {"id1", "id2"});
+    testee.addToAll(data, sizeof(data));
+    testee.addToAll("message");
+
+    EXPECT_EQ(testee.size(), 4);
+    EXPECT_FALSE(testee.empty());
+}
+
+TEST(DataChannelMessageBatchTests, clear_shouldRemoveAllMessages)
+{
+    DataChannelMessageBatch testee;
+    testee.addToAll("message");
+
+    testee.clear();
+
+    EXPECT_EQ(testee.size(), 0);
+    EXPECT_TRUE(testee.empty());
+}
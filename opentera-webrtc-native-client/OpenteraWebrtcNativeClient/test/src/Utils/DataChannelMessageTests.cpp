@@ -0,0 +1,28 @@
+#include <OpenteraWebrtcNativeClient/Utils/DataChannelMessage.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+TEST(DataChannelMessageTests, constructor_shouldSetTheAttributes)
+{
+    DataChannelMessage testee(rtc::CopyOnWriteBuffer(string("abc")), false);
+
+    EXPECT_EQ(testee.size(), 3);
+    EXPECT_EQ(testee.data()[0], 'a');
+    EXPECT_FALSE(testee.isBinary());
+    EXPECT_EQ(testee.view(), "abc");
+}
+
+TEST(DataChannelMessageTests, copyConstructor_shouldShareTheData)
+{
+    const uint8_t data[] = {1, 2, 3};
+    DataChannelMessage message(rtc::CopyOnWriteBuffer(data, sizeof(data)), true);
+
+    DataChannelMessage testee(message);
+
+    EXPECT_EQ(testee.data(), message.data());
+    EXPECT_EQ(testee.size(), 3);
+    EXPECT_TRUE(testee.isBinary());
+}
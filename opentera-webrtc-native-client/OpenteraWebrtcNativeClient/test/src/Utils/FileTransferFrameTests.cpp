@@ -0,0 +1,104 @@
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferFrame.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+TEST(FileTransferFrameTests, encode_shouldHaveOnlyAHeader)
+{
+    webrtc::DataBuffer frame = FileTransferFrame::encode(FileTransferFrame::Type::Ack, 0x01020304, 0x1122334455667788);
+
+    EXPECT_TRUE(frame.binary);
+    ASSERT_EQ(frame.size(), FileTransferFrame::HeaderSize);
+    const uint8_t* data = frame.data.data<uint8_t>();
+    EXPECT_EQ(data[0], 3);
+    EXPECT_EQ(data[1], 0x04);
+    EXPECT_EQ(data[4], 0x01);
+    EXPECT_EQ(data[5], 0x88);
+    EXPECT_EQ(data[12], 0x11);
+
+    FileTransferFrame::Type type;
+    uint32_t transferId;
+    uint64_t value;
+    uint32_t checksum;
+    rtc::CopyOnWriteBuffer payload;
+    ASSERT_TRUE(FileTransferFrame::decode(frame, type, transferId, value, checksum, payload));
+    EXPECT_EQ(type, FileTransferFrame::Type::Ack);
+    EXPECT_EQ(transferId, 0x01020304);
+    EXPECT_EQ(value, 0x1122334455667788);
+    EXPECT_EQ(checksum, 0);
+    EXPECT_EQ(payload.size(), 0);
+}
+
+TEST(FileTransferFrameTests, encodeOfferAndChunk_shouldBeDecodedWithTheSamePayload)
+{
+    const uint8_t Data[] = {1, 2, 3, 4};
+    webrtc::DataBuffer offer = FileTransferFrame::encodeOffer(1, 5000000000, 42, "log.bag");
+    webrtc::DataBuffer chunk = FileTransferFrame::encodeChunk(2, 4096, Data, sizeof(Data));
+
+    FileTransferFrame::Type type;
+    uint32_t transferId;
+    uint64_t value;
+    uint32_t checksum;
+    rtc::CopyOnWriteBuffer payload;
+    ASSERT_TRUE(FileTransferFrame::decode(offer, type, transferId, value, checksum, payload));
+    EXPECT_EQ(type, FileTransferFrame::Type::Offer);
+    EXPECT_EQ(transferId, 1);
+    EXPECT_EQ(value, 5000000000);
+    uint64_t nonce;
+    string name;
+    ASSERT_TRUE(FileTransferFrame::decodeOffer(payload, nonce, name));
+    EXPECT_EQ(nonce, 42);
+    EXPECT_EQ(name, "log.bag");
+
+    ASSERT_TRUE(FileTransferFrame::decode(chunk, type, transferId, value, checksum, payload));
+    EXPECT_EQ(type, FileTransferFrame::Type::Chunk);
+    EXPECT_EQ(transferId, 2);
+    EXPECT_EQ(value, 4096);
+    EXPECT_EQ(checksum, FileTransferFrame::checksum(Data, sizeof(Data)));
+    EXPECT_EQ(
+        vector<uint8_t>(payload.data<uint8_t>(), payload.data<uint8_t>() + payload.size()),
+        vector<uint8_t>({1, 2, 3, 4}));
+}
+
+TEST(FileTransferFrameTests, checksum_shouldReturnTheCrc32)
+{
+    const uint8_t Data[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+    EXPECT_EQ(FileTransferFrame::checksum(Data, sizeof(Data)), 0xCBF43926);
+}
+
+TEST(FileTransferFrameTests, decode_invalidFrame_shouldReturnFalse)
+{
+    webrtc::DataBuffer frame = FileTransferFrame::encode(FileTransferFrame::Type::Cancel, 1, 0);
+    rtc::CopyOnWriteBuffer invalidType = frame.data;
+    invalidType.MutableData()[0] = 6;
+
+    FileTransferFrame::Type type;
+    uint32_t transferId;
+    uint64_t value;
+    uint32_t checksum;
+    rtc::CopyOnWriteBuffer payload;
+    EXPECT_FALSE(FileTransferFrame::decode(webrtc::DataBuffer("abc"), type, transferId, value, checksum, payload));
+    EXPECT_FALSE(FileTransferFrame::decode(
+        webrtc::DataBuffer(frame.data.Slice(0, FileTransferFrame::HeaderSize - 1), true),
+        type,
+        transferId,
+        value,
+        checksum,
+        payload));
+    EXPECT_FALSE(
+        FileTransferFrame::decode(webrtc::DataBuffer(invalidType, true), type, transferId, value, checksum, payload));
+}
+
+TEST(FileTransferFrameTests, decodeOffer_tooSmallPayload_shouldReturnFalse)
+{
+    uint64_t nonce;
+    string name;
+    EXPECT_FALSE(FileTransferFrame::decodeOffer(
+        rtc::CopyOnWriteBuffer(FileTransferFrame::OfferNonceSize - 1),
+        nonce,
+        name));
+}
@@ -0,0 +1,59 @@
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferFrame.h>
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferReceiver.h>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+static vector<uint8_t> readFile(const string& path)
+{
+    ifstream file(path, ios::binary);
+    return vector<uint8_t>(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+TEST(FileTransferReceiverTests, write_chunksInOrder_shouldWriteTheFile)
+{
+    string path = testing::TempDir() + "file_transfer_receiver_test.bin";
+    const uint8_t Data1[] = {1, 2, 3};
+    const uint8_t Data2[] = {4, 5};
+    FileTransferReceiver testee("a", path, 5);
+
+    EXPECT_TRUE(testee.write(0, FileTransferFrame::checksum(Data1, sizeof(Data1)), Data1, sizeof(Data1)));
+    EXPECT_EQ(testee.writtenOffset(), 3);
+    EXPECT_FALSE(testee.isComplete());
+    EXPECT_TRUE(testee.write(3, FileTransferFrame::checksum(Data2, sizeof(Data2)), Data2, sizeof(Data2)));
+    EXPECT_EQ(testee.writtenOffset(), 5);
+    EXPECT_TRUE(testee.isComplete());
+
+    EXPECT_EQ(readFile(path), vector<uint8_t>({1, 2, 3, 4, 5}));
+}
+
+TEST(FileTransferReceiverTests, write_corruptedChunk_shouldReturnFalse)
+{
+    const uint8_t Data[] = {1, 2, 3};
+    FileTransferReceiver testee("a", testing::TempDir() + "file_transfer_receiver_corrupted_test.bin", 5);
+
+    EXPECT_FALSE(testee.write(0, FileTransferFrame::checksum(Data, sizeof(Data)) + 1, Data, sizeof(Data)));
+    EXPECT_FALSE(testee.write(0, FileTransferFrame::checksum(Data, 0), Data, 0));
+    EXPECT_EQ(testee.writtenOffset(), 0);
+}
+
+TEST(FileTransferReceiverTests, write_chunkAfterTheWrittenOffset_shouldBeIgnored)
+{
+    const uint8_t Data[] = {1, 2, 3};
+    FileTransferReceiver testee("a", testing::TempDir() + "file_transfer_receiver_ignored_test.bin", 6);
+
+    EXPECT_TRUE(testee.write(3, FileTransferFrame::checksum(Data, sizeof(Data)), Data, sizeof(Data)));
+    EXPECT_EQ(testee.writtenOffset(), 0);
+}
+
+TEST(FileTransferReceiverTests, constructor_emptyFile_shouldBeComplete)
+{
+    FileTransferReceiver testee("a", testing::TempDir() + "file_transfer_receiver_empty_test.bin", 0);
+    EXPECT_TRUE(testee.isComplete());
+}
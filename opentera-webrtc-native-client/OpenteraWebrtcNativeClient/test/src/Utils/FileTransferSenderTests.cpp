@@ -0,0 +1,112 @@
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferFrame.h>
+#include <OpenteraWebrtcNativeClient/Utils/FileTransferSender.h>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+static unique_ptr<MemoryMappedFile> createFile(const string& name, size_t size)
+{
+    string path = testing::TempDir() + name;
+    {
+        ofstream file(path, ios::binary);
+        for (size_t i = 0; i < size; i++)
+        {
+            file.put(static_cast<char>(i));
+        }
+    }
+    return make_unique<MemoryMappedFile>(path);
+}
+
+static uint64_t readChunkOffset(const webrtc::DataBuffer& frame, size_t& chunkSize)
+{
+    FileTransferFrame::Type type;
+    uint32_t transferId;
+    uint64_t offset;
+    uint32_t checksum;
+    rtc::CopyOnWriteBuffer payload;
+    EXPECT_TRUE(FileTransferFrame::decode(frame, type, transferId, offset, checksum, payload));
+    EXPECT_EQ(type, FileTransferFrame::Type::Chunk);
+    EXPECT_EQ(checksum, FileTransferFrame::checksum(payload.data<uint8_t>(), payload.size()));
+    chunkSize = payload.size();
+    return offset;
+}
+
+TEST(FileTransferSenderTests, constructor_invalidSizes_shouldThrowRuntimeError)
+{
+    const string FileName = "file_transfer_sender_invalid_test.bin";
+    EXPECT_THROW(FileTransferSender(0, 0, "a", createFile(FileName, 1), 0, 10), runtime_error);
+    EXPECT_THROW(FileTransferSender(0, 0, "a", createFile(FileName, 1), 11, 10), runtime_error);
+}
+
+TEST(FileTransferSenderTests, offer_shouldContainTheFileSizeNonceAndName)
+{
+    FileTransferSender testee(7, 0x0102030405060708, "log.bag", createFile("file_transfer_sender_offer_test.bin", 10));
+
+    FileTransferFrame::Type type;
+    uint32_t transferId;
+    uint64_t size;
+    uint32_t checksum;
+    rtc::CopyOnWriteBuffer payload;
+    ASSERT_TRUE(FileTransferFrame::decode(testee.offer(), type, transferId, size, checksum, payload));
+    EXPECT_EQ(type, FileTransferFrame::Type::Offer);
+    EXPECT_EQ(transferId, 7);
+    EXPECT_EQ(size, 10);
+
+    uint64_t nonce;
+    string name;
+    ASSERT_TRUE(FileTransferFrame::decodeOffer(payload, nonce, name));
+    EXPECT_EQ(nonce, 0x0102030405060708);
+    EXPECT_EQ(name, "log.bag");
+}
+
+TEST(FileTransferSenderTests, popChunk_shouldNotExceedTheWindow)
+{
+    FileTransferSender testee(0, 0, "a", createFile("file_transfer_sender_window_test.bin", 10), 3, 6);
+    EXPECT_FALSE(testee.hasChunkToSend());
+
+    testee.start(0);
+    size_t chunkSize;
+    ASSERT_TRUE(testee.hasChunkToSend());
+    EXPECT_EQ(readChunkOffset(testee.popChunk(), chunkSize), 0);
+    ASSERT_TRUE(testee.hasChunkToSend());
+    EXPECT_EQ(readChunkOffset(testee.popChunk(), chunkSize), 3);
+    EXPECT_FALSE(testee.hasChunkToSend());
+
+    testee.acknowledge(3);
+    EXPECT_EQ(testee.acknowledgedOffset(), 3);
+    ASSERT_TRUE(testee.hasChunkToSend());
+    EXPECT_EQ(readChunkOffset(testee.popChunk(), chunkSize), 6);
+    testee.acknowledge(9);
+    ASSERT_TRUE(testee.hasChunkToSend());
+    EXPECT_EQ(readChunkOffset(testee.popChunk(), chunkSize), 9);
+    EXPECT_EQ(chunkSize, 1);
+    EXPECT_FALSE(testee.hasChunkToSend());
+
+    EXPECT_FALSE(testee.isComplete());
+    testee.acknowledge(10);
+    EXPECT_TRUE(testee.isComplete());
+}
+
+TEST(FileTransferSenderTests, start_offset_shouldResumeFromTheOffset)
+{
+    FileTransferSender testee(0, 0, "a", createFile("file_transfer_sender_resume_test.bin", 10), 4, 8);
+    testee.start(0);
+    testee.popChunk();
+    testee.popChunk();
+
+    testee.stop();
+    EXPECT_FALSE(testee.hasChunkToSend());
+    testee.acknowledge(8);
+    EXPECT_EQ(testee.acknowledgedOffset(), 0);
+
+    testee.start(4);
+    size_t chunkSize;
+    EXPECT_EQ(testee.acknowledgedOffset(), 4);
+    ASSERT_TRUE(testee.hasChunkToSend());
+    EXPECT_EQ(readChunkOffset(testee.popChunk(), chunkSize), 4);
+}
@@ -0,0 +1,102 @@
+#include <OpenteraWebrtcNativeClient/Utils/KeyedWorkerPool.h>
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <mutex>
+
+using namespace opentera;
+using namespace std;
+
+TEST(KeyedWorkerPoolTests, constructor_threadCount0_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(KeyedWorkerPool(0), runtime_error);
+}
+
+TEST(KeyedWorkerPoolTests, post_shouldRunTheTasksOfAKeyInOrder)
+{
+    constexpr int TaskCountByKey = 100;
+    const vector<string> keys = {"a", "b", "c", "d", "e"};
+
+    KeyedWorkerPool testee(3);
+    EXPECT_EQ(testee.threadCount(), 3);
+
+    mutex valuesMutex;
+    map<string, vector<int>> valuesByKey;
+    vector<future<void>> futures;
+    for (int i = 0; i < TaskCountByKey; i++)
+    {
+        for (const auto& key : keys)
+        {
+            auto promise = make_shared<std::promise<void>>();
+            futures.push_back(promise->get_future());
+            testee.post(
+                key,
+                [&valuesMutex, &valuesByKey, key, i, promise]()
+                {
+                    {
+                        lock_guard<mutex> lock(valuesMutex);
+                        valuesByKey[key].push_back(i);
+                    }
+                    promise->set_value();
+                });
+        }
+    }
+
+    for (auto& future : futures)
+    {
+        ASSERT_EQ(future.wait_for(chrono::seconds(5)), future_status::ready);
+    }
+    for (const auto& key : keys)
+    {
+        vector<int>& values = valuesByKey[key];
+        ASSERT_EQ(values.size(), TaskCountByKey);
+        for (int i = 0; i < TaskCountByKey; i++)
+        {
+            EXPECT_EQ(values[i], i);
+        }
+    }
+}
+
+TEST(KeyedWorkerPoolTests, post_blockedKey_shouldRunTheTasksOfTheOtherThreads)
+{
+    KeyedWorkerPool testee(2);
+    promise<void> unblockPromise;
+    shared_future<void> unblockFuture = unblockPromise.get_future().share();
+    promise<void> startedPromise;
+
+    testee.post(
+        "a",
+        [&startedPromise, unblockFuture]()
+        {
+            startedPromise.set_value();
+            unblockFuture.wait();
+        });
+    startedPromise.get_future().wait();
+    testee.post("a", []() {});
+    testee.post("a", []() {});
+
+    vector<size_t> queueDepths = testee.queueDepths();
+    ASSERT_EQ(queueDepths.size(), 2);
+    size_t blockedThread = queueDepths[0] == 2 ? 0 : 1;
+    EXPECT_EQ(queueDepths[blockedThread], 2);
+    EXPECT_EQ(queueDepths[1 - blockedThread], 0);
+
+    // The key of the other task must be assigned to the other thread.
+    string otherKey;
+    for (int i = 0; otherKey.empty(); i++)
+    {
+        string key = "b" + to_string(i);
+        if (hash<string>()(key) % 2 != blockedThread)
+        {
+            otherKey = key;
+        }
+    }
+
+    promise<void> otherTaskPromise;
+    testee.post(otherKey, [&otherTaskPromise]() { otherTaskPromise.set_value(); });
+    EXPECT_EQ(otherTaskPromise.get_future().wait_for(chrono::seconds(5)), future_status::ready);
+    unblockPromise.set_value();
+}
@@ -0,0 +1,91 @@
+#include <OpenteraWebrtcNativeClient/Utils/Lz4Codec.h>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+static vector<uint8_t> compress(const vector<uint8_t>& data)
+{
+    vector<uint8_t> block(Lz4Codec::maxCompressedSize(data.size()));
+    size_t blockSize = Lz4Codec::compress(data.data(), data.size(), block.data(), block.size());
+    block.resize(blockSize);
+    return block;
+}
+
+static vector<uint8_t> createRepetitiveData()
+{
+    string json;
+    for (int i = 0; i < 200; i++)
+    {
+        json += R"({"x": )" + to_string(i % 10) + R"(, "y": 0.0, "status": "ok"},)";
+    }
+    return vector<uint8_t>(json.begin(), json.end());
+}
+
+TEST(Lz4CodecTests, compress_decompress_emptyData_shouldReturnTheData)
+{
+    vector<uint8_t> block = compress({});
+    ASSERT_EQ(block.size(), 1);
+
+    EXPECT_TRUE(Lz4Codec::decompress(block.data(), block.size(), nullptr, 0));
+}
+
+TEST(Lz4CodecTests, compress_decompress_repetitiveData_shouldShrinkAndReturnTheData)
+{
+    vector<uint8_t> data = createRepetitiveData();
+
+    vector<uint8_t> block = compress(data);
+    ASSERT_GT(block.size(), 0);
+    EXPECT_LT(block.size() * 5, data.size());
+
+    vector<uint8_t> decompressedData(data.size());
+    ASSERT_TRUE(Lz4Codec::decompress(block.data(), block.size(), decompressedData.data(), decompressedData.size()));
+    EXPECT_EQ(decompressedData, data);
+}
+
+TEST(Lz4CodecTests, compress_decompress_randomData_shouldReturnTheData)
+{
+    mt19937 generator(42);
+    uniform_int_distribution<int> distribution(0, 255);
+    for (size_t size : {1, 12, 13, 100, 70000})
+    {
+        vector<uint8_t> data(size);
+        for (auto& value : data)
+        {
+            value = static_cast<uint8_t>(distribution(generator));
+        }
+
+        vector<uint8_t> block = compress(data);
+        ASSERT_GT(block.size(), 0);
+
+        vector<uint8_t> decompressedData(data.size());
+        ASSERT_TRUE(Lz4Codec::decompress(block.data(), block.size(), decompressedData.data(), decompressedData.size()));
+        EXPECT_EQ(decompressedData, data);
+    }
+}
+
+TEST(Lz4CodecTests, compress_tooSmallBuffer_shouldReturn0)
+{
+    vector<uint8_t> data = createRepetitiveData();
+    vector<uint8_t> block(10);
+
+    EXPECT_EQ(Lz4Codec::compress(data.data(), data.size(), block.data(), block.size()), 0);
+}
+
+TEST(Lz4CodecTests, decompress_invalidBlock_shouldReturnFalse)
+{
+    vector<uint8_t> data = createRepetitiveData();
+    vector<uint8_t> block = compress(data);
+    vector<uint8_t> decompressedData(data.size());
+
+    EXPECT_FALSE(Lz4Codec::decompress(block.data(), block.size() - 1, decompressedData.data(), data.size()));
+    EXPECT_FALSE(Lz4Codec::decompress(block.data(), block.size(), decompressedData.data(), data.size() - 1));
+
+    const uint8_t invalidOffsetBlock[] = {0x10, 'a', 0x02, 0x00, 0x00};
+    EXPECT_FALSE(Lz4Codec::decompress(invalidOffsetBlock, sizeof(invalidOffsetBlock), decompressedData.data(), 5));
+}
@@ -0,0 +1,111 @@
+#include <OpenteraWebrtcNativeClient/Utils/MediaSynchronizer.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace opentera;
+using namespace std;
+
+class MediaSynchronizerTests : public ::testing::Test
+{
+protected:
+    vector<string> m_events;
+    unique_ptr<MediaSynchronizer> m_testee;
+
+    void SetUp() override
+    {
+        m_testee = make_unique<MediaSynchronizer>(
+            [this](const void* audioData, int, int, size_t, size_t numberOfFrames, uint64_t timestampUs)
+            {
+                EXPECT_EQ(numberOfFrames, 1u);
+                EXPECT_EQ(*reinterpret_cast<const int16_t*>(audioData), static_cast<int16_t>(timestampUs));
+                m_events.push_back("a" + to_string(timestampUs));
+            },
+            [this](const cv::Mat&, uint64_t timestampUs) { m_events.push_back("v" + to_string(timestampUs)); },
+            100);
+    }
+
+    void pushAudio(uint64_t timestampUs)
+    {
+        int16_t sample = static_cast<int16_t>(timestampUs);
+        m_testee->pushAudio(&sample, 16, 48000, 1, 1, timestampUs);
+    }
+
+    void pushVideo(uint64_t timestampUs) { m_testee->pushVideo(cv::Mat(2, 2, CV_8UC3), timestampUs); }
+};
+
+TEST_F(MediaSynchronizerTests, push_oneStream_shouldDeliverTheFramesImmediately)
+{
+    pushAudio(10);
+    pushAudio(20);
+
+    EXPECT_EQ(m_events, vector<string>({"a10", "a20"}));
+}
+
+TEST_F(MediaSynchronizerTests, push_videoAhead_shouldWaitForTheAudio)
+{
+    pushAudio(0);
+    pushVideo(25);
+    pushAudio(10);
+    pushAudio(20);
+    EXPECT_EQ(m_events, vector<string>({"a0", "a10", "a20"}));
+
+    pushAudio(30);
+    EXPECT_EQ(m_events, vector<string>({"a0", "a10", "a20", "v25"}));
+}
+
+TEST_F(MediaSynchronizerTests, push_audioAhead_shouldMergeTheStreamsInTimestampOrder)
+{
+    pushVideo(0);
+    pushAudio(10);
+    pushAudio(20);
+    pushAudio(30);
+    EXPECT_EQ(m_events, vector<string>({"v0"}));
+
+    pushVideo(15);
+    EXPECT_EQ(m_events, vector<string>({"v0", "a10", "v15"}));
+
+    pushVideo(40);
+    EXPECT_EQ(m_events, vector<string>({"v0", "a10", "v15", "a20", "a30"}));
+}
+
+TEST_F(MediaSynchronizerTests, push_otherStreamStopped_shouldDeliverTheFramesAfterTheMaxDelay)
+{
+    pushAudio(0);
+    pushVideo(0);
+    pushAudio(50);
+    pushAudio(100);
+    EXPECT_EQ(m_events, vector<string>({"a0", "v0"}));
+
+    pushAudio(150);
+    EXPECT_EQ(m_events, vector<string>({"a0", "v0", "a50"}));
+
+    pushAudio(200);
+    EXPECT_EQ(m_events, vector<string>({"a0", "v0", "a50", "a100"}));
+}
+
+TEST(MediaSynchronizerCallbackTests, push_fromCallback_shouldDeliverTheFramesInTimestampOrder)
+{
+    vector<string> events;
+    unique_ptr<MediaSynchronizer> testee;
+    int16_t sample = 0;
+    testee = make_unique<MediaSynchronizer>(
+        [&](const void*, int, int, size_t, size_t, uint64_t timestampUs)
+        {
+            events.push_back("a" + to_string(timestampUs));
+            if (timestampUs == 10)
+            {
+                testee->pushAudio(&sample, 16, 48000, 1, 1, 30);
+                events.push_back("pushed");
+            }
+        },
+        [&](const cv::Mat&, uint64_t timestampUs) { events.push_back("v" + to_string(timestampUs)); },
+        100);
+
+    testee->pushVideo(cv::Mat(2, 2, CV_8UC3), 0);
+    testee->pushAudio(&sample, 16, 48000, 1, 1, 10);
+    testee->pushVideo(cv::Mat(2, 2, CV_8UC3), 20);
+
+    EXPECT_EQ(events, vector<string>({"v0", "a10", "pushed", "v20"}));
+}
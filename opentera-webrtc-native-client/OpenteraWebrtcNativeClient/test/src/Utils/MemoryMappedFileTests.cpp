@@ -0,0 +1,42 @@
+#include <OpenteraWebrtcNativeClient/Utils/MemoryMappedFile.h>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+TEST(MemoryMappedFileTests, constructor_existingFile_shouldMapTheContent)
+{
+    string path = testing::TempDir() + "memory_mapped_file_test.bin";
+    const vector<uint8_t> Content = {1, 2, 3, 4, 5};
+    {
+        ofstream file(path, ios::binary);
+        file.write(reinterpret_cast<const char*>(Content.data()), Content.size());
+    }
+
+    MemoryMappedFile testee(path);
+
+    ASSERT_EQ(testee.size(), Content.size());
+    EXPECT_EQ(vector<uint8_t>(testee.data(), testee.data() + testee.size()), Content);
+}
+
+TEST(MemoryMappedFileTests, constructor_emptyFile_shouldMapNothing)
+{
+    string path = testing::TempDir() + "memory_mapped_file_empty_test.bin";
+    {
+        ofstream file(path, ios::binary);
+    }
+
+    MemoryMappedFile testee(path);
+
+    EXPECT_EQ(testee.data(), nullptr);
+    EXPECT_EQ(testee.size(), 0);
+}
+
+TEST(MemoryMappedFileTests, constructor_missingFile_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(MemoryMappedFile(testing::TempDir() + "memory_mapped_file_missing_test.bin"), runtime_error);
+}
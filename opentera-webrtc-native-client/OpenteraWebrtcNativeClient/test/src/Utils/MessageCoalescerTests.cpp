@@ -0,0 +1,143 @@
+#include <OpenteraWebrtcNativeClient/Utils/MessageCoalescer.h>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+static webrtc::DataBuffer createBinaryBuffer(size_t size, uint8_t firstValue)
+{
+    vector<uint8_t> data(size);
+    iota(data.begin(), data.end(), firstValue);
+    return webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data.data(), data.size()), true);
+}
+
+static vector<webrtc::DataBuffer> unpack(const webrtc::DataBuffer& batch)
+{
+    vector<webrtc::DataBuffer> messages;
+    EXPECT_TRUE(MessageCoalescer::unpack(
+        batch.data,
+        [&messages](webrtc::DataBuffer message) { messages.push_back(move(message)); }));
+    return messages;
+}
+
+static string toString(const webrtc::DataBuffer& buffer)
+{
+    return string(buffer.data.data<char>(), buffer.size());
+}
+
+TEST(MessageCoalescerTests, constructor_tooSmallBatchSize_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(MessageCoalescer(MessageCoalescer::HeaderSize), runtime_error);
+}
+
+TEST(MessageCoalescerTests, flush_shouldMakeTheMessagesReadyInOneBatch)
+{
+    MessageCoalescer testee(64);
+    EXPECT_TRUE(testee.empty());
+    testee.push(webrtc::DataBuffer("abc"));
+    testee.push(createBinaryBuffer(2, 10));
+    testee.push(webrtc::DataBuffer(""));
+    EXPECT_FALSE(testee.empty());
+    EXPECT_FALSE(testee.hasReadyBatch());
+
+    testee.flush();
+    ASSERT_TRUE(testee.hasReadyBatch());
+    size_t messageCount;
+    webrtc::DataBuffer batch = testee.popBatch(messageCount);
+
+    EXPECT_TRUE(testee.empty());
+    EXPECT_TRUE(batch.binary);
+    EXPECT_EQ(messageCount, 3);
+    EXPECT_EQ(batch.size(), 3 * MessageCoalescer::HeaderSize + 5);
+
+    vector<webrtc::DataBuffer> messages = unpack(batch);
+    ASSERT_EQ(messages.size(), 3);
+    EXPECT_FALSE(messages[0].binary);
+    EXPECT_EQ(toString(messages[0]), "abc");
+    EXPECT_TRUE(messages[1].binary);
+    ASSERT_EQ(messages[1].size(), 2);
+    EXPECT_EQ(messages[1].data.data<uint8_t>()[0], 10);
+    EXPECT_EQ(messages[1].data.data<uint8_t>()[1], 11);
+    EXPECT_FALSE(messages[2].binary);
+    EXPECT_EQ(messages[2].size(), 0);
+}
+
+TEST(MessageCoalescerTests, push_messageNotFitting_shouldMakeTheCurrentBatchReady)
+{
+    MessageCoalescer testee(16);
+    testee.push(webrtc::DataBuffer("abcd"));
+    EXPECT_FALSE(testee.hasReadyBatch());
+    testee.push(webrtc::DataBuffer("efghi"));
+    ASSERT_TRUE(testee.hasReadyBatch());
+
+    size_t messageCount;
+    vector<webrtc::DataBuffer> messages = unpack(testee.popBatch(messageCount));
+    EXPECT_EQ(messageCount, 1);
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(toString(messages[0]), "abcd");
+    EXPECT_FALSE(testee.hasReadyBatch());
+    EXPECT_FALSE(testee.empty());
+}
+
+TEST(MessageCoalescerTests, push_fullBatch_shouldMakeItReady)
+{
+    MessageCoalescer testee(16);
+    testee.push(webrtc::DataBuffer("abcd"));
+    testee.push(webrtc::DataBuffer("efgh"));
+    ASSERT_TRUE(testee.hasReadyBatch());
+
+    size_t messageCount;
+    vector<webrtc::DataBuffer> messages = unpack(testee.popBatch(messageCount));
+    EXPECT_EQ(messageCount, 2);
+    ASSERT_EQ(messages.size(), 2);
+    EXPECT_EQ(toString(messages[0]), "abcd");
+    EXPECT_EQ(toString(messages[1]), "efgh");
+    EXPECT_TRUE(testee.empty());
+}
+
+TEST(MessageCoalescerTests, push_largeMessage_shouldBeAloneInItsBatch)
+{
+    MessageCoalescer testee(16);
+    testee.push(createBinaryBuffer(100, 0));
+    ASSERT_TRUE(testee.hasReadyBatch());
+
+    size_t messageCount;
+    vector<webrtc::DataBuffer> messages = unpack(testee.popBatch(messageCount));
+    EXPECT_EQ(messageCount, 1);
+    ASSERT_EQ(messages.size(), 1);
+    EXPECT_EQ(messages[0].size(), 100);
+    EXPECT_EQ(messages[0].data.data<uint8_t>()[99], 99);
+}
+
+TEST(MessageCoalescerTests, clear_shouldDropThePendingMessages)
+{
+    MessageCoalescer testee(16);
+    testee.push(createBinaryBuffer(100, 0));
+    testee.push(webrtc::DataBuffer("abc"));
+
+    testee.clear();
+
+    EXPECT_TRUE(testee.empty());
+    EXPECT_FALSE(testee.hasReadyBatch());
+}
+
+TEST(MessageCoalescerTests, unpack_invalidBatch_shouldReturnFalseWithoutPassingMessages)
+{
+    int messageCount = 0;
+    auto onMessage = [&messageCount](webrtc::DataBuffer) { messageCount++; };
+
+    EXPECT_FALSE(MessageCoalescer::unpack(rtc::CopyOnWriteBuffer(), onMessage));
+    EXPECT_FALSE(MessageCoalescer::unpack(rtc::CopyOnWriteBuffer(string("\x01\x00\x00", 3)), onMessage));
+    // The first record is valid, but the second one is truncated.
+    string truncatedBatch("\x01\x00\x00\x00"
+                          "a\x05\x00\x00\x00"
+                          "ab",
+                          11);
+    EXPECT_FALSE(MessageCoalescer::unpack(rtc::CopyOnWriteBuffer(truncatedBatch), onMessage));
+
+    EXPECT_EQ(messageCount, 0);
+}
@@ -0,0 +1,66 @@
+#include <OpenteraWebrtcNativeClient/Utils/MessageCompressor.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+TEST(MessageCompressorTests, compress_smallMessage_shouldNotCompress)
+{
+    MessageCompressor testee;
+
+    webrtc::DataBuffer frame = testee.compress(webrtc::DataBuffer("abc"));
+
+    EXPECT_TRUE(frame.binary);
+    ASSERT_EQ(frame.size(), 4);
+    EXPECT_EQ(frame.data.data<uint8_t>()[0], MessageCompressor::StringFlag);
+
+    rtc::CopyOnWriteBuffer message;
+    bool isBinary = true;
+    ASSERT_TRUE(MessageCompressor::decompress(frame, message, isBinary));
+    EXPECT_FALSE(isBinary);
+    EXPECT_EQ(string(message.data<char>(), message.size()), "abc");
+}
+
+TEST(MessageCompressorTests, compress_largeMessage_shouldCompress)
+{
+    MessageCompressor testee;
+    testee.setThreshold(16);
+    vector<uint8_t> data(1000, 7);
+
+    webrtc::DataBuffer frame =
+        testee.compress(webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data.data(), data.size()), true));
+
+    EXPECT_TRUE(frame.binary);
+    EXPECT_LT(frame.size(), 100);
+    EXPECT_EQ(frame.data.data<uint8_t>()[0], MessageCompressor::CompressedFlag);
+    EXPECT_EQ(testee.uncompressedSize(), 1000);
+    EXPECT_EQ(testee.compressedSize(), frame.size());
+    EXPECT_GT(testee.compressionRatio(), 10.0);
+
+    rtc::CopyOnWriteBuffer message;
+    bool isBinary = false;
+    ASSERT_TRUE(MessageCompressor::decompress(frame, message, isBinary));
+    EXPECT_TRUE(isBinary);
+    EXPECT_EQ(vector<uint8_t>(message.data<uint8_t>(), message.data<uint8_t>() + message.size()), data);
+}
+
+TEST(MessageCompressorTests, decompress_invalidFrame_shouldReturnFalse)
+{
+    const uint8_t invalidSizeFrame[] = {MessageCompressor::CompressedFlag, 0xFF, 0xFF, 0xFF, 0xFF, 0x00};
+    rtc::CopyOnWriteBuffer message;
+    bool isBinary;
+
+    EXPECT_FALSE(MessageCompressor::decompress(webrtc::DataBuffer("abc"), message, isBinary));
+    EXPECT_FALSE(MessageCompressor::decompress(
+        webrtc::DataBuffer(rtc::CopyOnWriteBuffer(invalidSizeFrame, sizeof(invalidSizeFrame)), true),
+        message,
+        isBinary));
+}
+
+TEST(MessageCompressorTests, compressionRatio_noMessage_shouldReturn1)
+{
+    MessageCompressor testee;
+
+    EXPECT_EQ(testee.compressionRatio(), 1.0);
+}
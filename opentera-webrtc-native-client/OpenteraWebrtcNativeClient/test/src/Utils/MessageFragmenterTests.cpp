@@ -0,0 +1,159 @@
+#include <OpenteraWebrtcNativeClient/Utils/MessageFragmenter.h>
+#include <OpenteraWebrtcNativeClient/Utils/MessageReassembler.h>
+
+#include <gtest/gtest.h>
+
+#include <numeric>
+
+using namespace opentera;
+using namespace std;
+
+static webrtc::DataBuffer createBinaryBuffer(size_t size, uint8_t firstValue)
+{
+    vector<uint8_t> data(size);
+    iota(data.begin(), data.end(), firstValue);
+    return webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data.data(), data.size()), true);
+}
+
+TEST(MessageFragmenterTests, constructor_tooSmallFrameSize_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(MessageFragmenter(MessageFragmenter::HeaderSize), runtime_error);
+}
+
+TEST(MessageFragmenterTests, popFrame_smallMessage_shouldReturnOneFrame)
+{
+    MessageFragmenter testee(32);
+    testee.push(webrtc::DataBuffer("abc"));
+
+    webrtc::DataBuffer frame = testee.popFrame();
+
+    EXPECT_TRUE(testee.empty());
+    EXPECT_TRUE(frame.binary);
+    ASSERT_EQ(frame.size(), MessageFragmenter::HeaderSize + 3);
+    const uint8_t* data = frame.data.data<uint8_t>();
+    EXPECT_EQ(data[0], 0);
+    EXPECT_EQ(data[8], 3);
+    EXPECT_EQ(data[12], 0);
+    EXPECT_EQ(string(reinterpret_cast<const char*>(data + MessageFragmenter::HeaderSize), 3), "abc");
+}
+
+TEST(MessageFragmenterTests, popFrame_shouldInterleaveTheMessagesRoundRobin)
+{
+    MessageFragmenter testee(MessageFragmenter::HeaderSize + 4);
+    testee.push(createBinaryBuffer(10, 0));
+    testee.push(createBinaryBuffer(2, 100));
+
+    vector<pair<uint8_t, uint8_t>> idAndOffsets;
+    while (!testee.empty())
+    {
+        webrtc::DataBuffer frame = testee.popFrame();
+        idAndOffsets.emplace_back(frame.data.data<uint8_t>()[4], frame.data.data<uint8_t>()[12]);
+    }
+
+    EXPECT_EQ(idAndOffsets, (vector<pair<uint8_t, uint8_t>>{{0, 0}, {1, 0}, {0, 4}, {0, 8}}));
+}
+
+TEST(MessageReassemblerTests, push_invalidFrame_shouldReturnFalse)
+{
+    MessageReassembler testee([](rtc::CopyOnWriteBuffer message, bool isBinary) { ADD_FAILURE(); });
+    uint8_t frame[MessageFragmenter::HeaderSize + 4] = {0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0};
+
+    EXPECT_FALSE(testee.push(rtc::CopyOnWriteBuffer(frame, MessageFragmenter::HeaderSize - 1)));
+    EXPECT_FALSE(testee.push(rtc::CopyOnWriteBuffer(frame, sizeof(frame))));
+}
+
+TEST(MessageReassemblerTests, push_shouldReassembleInterleavedMessages)
+{
+    vector<pair<vector<uint8_t>, bool>> messages;
+    MessageReassembler testee(
+        [&](rtc::CopyOnWriteBuffer message, bool isBinary)
+        {
+            const uint8_t* data = message.data<uint8_t>();
+            messages.emplace_back(vector<uint8_t>(data, data + message.size()), isBinary);
+        });
+    MessageFragmenter fragmenter(MessageFragmenter::HeaderSize + 3);
+    fragmenter.push(createBinaryBuffer(8, 0));
+    fragmenter.push(webrtc::DataBuffer("ab"));
+    fragmenter.push(createBinaryBuffer(0, 0));
+
+    while (!fragmenter.empty())
+    {
+        webrtc::DataBuffer frame = fragmenter.popFrame();
+        ASSERT_TRUE(testee.push(frame.data));
+    }
+
+    ASSERT_EQ(messages.size(), 3);
+    EXPECT_EQ(messages[0].first, vector<uint8_t>({'a', 'b'}));
+    EXPECT_FALSE(messages[0].second);
+    EXPECT_EQ(messages[1].first, vector<uint8_t>());
+    EXPECT_TRUE(messages[1].second);
+    EXPECT_EQ(messages[2].first, vector<uint8_t>({0, 1, 2, 3, 4, 5, 6, 7}));
+    EXPECT_TRUE(messages[2].second);
+    EXPECT_EQ(testee.partialMessageCount(), 0);
+}
+
+TEST(MessageReassemblerTests, push_chunkCallback_shouldPassTheChunksOfLargeMessages)
+{
+    size_t messageCount = 0;
+    vector<size_t> offsets;
+    MessageReassembler testee(
+        [&](rtc::CopyOnWriteBuffer message, bool isBinary) { messageCount++; },
+        [&](uint32_t messageId, const uint8_t* data, size_t size, size_t offset, size_t messageSize, bool isBinary)
+        {
+            EXPECT_EQ(messageSize, 8);
+            EXPECT_EQ(data[0], offset);
+            offsets.push_back(offset);
+        });
+    MessageFragmenter fragmenter(MessageFragmenter::HeaderSize + 3);
+    fragmenter.push(createBinaryBuffer(8, 0));
+    fragmenter.push(webrtc::DataBuffer("ab"));
+
+    while (!fragmenter.empty())
+    {
+        webrtc::DataBuffer frame = fragmenter.popFrame();
+        ASSERT_TRUE(testee.push(frame.data));
+    }
+
+    EXPECT_EQ(messageCount, 1);
+    EXPECT_EQ(offsets, vector<size_t>({0, 3, 6}));
+    EXPECT_EQ(testee.partialMessageCount(), 0);
+}
+
+TEST(MessageReassemblerTests, push_tooLargeMessage_shouldDropItAndReportItOnce)
+{
+    vector<size_t> messageSizes;
+    MessageReassembler testee(
+        [&](rtc::CopyOnWriteBuffer message, bool isBinary) { messageSizes.push_back(message.size()); },
+        nullptr,
+        8);
+    MessageFragmenter fragmenter(MessageFragmenter::HeaderSize + 3);
+    fragmenter.push(createBinaryBuffer(9, 0));
+    fragmenter.push(createBinaryBuffer(6, 0));
+
+    vector<bool> results;
+    while (!fragmenter.empty())
+    {
+        webrtc::DataBuffer frame = fragmenter.popFrame();
+        results.push_back(testee.push(frame.data));
+    }
+
+    EXPECT_EQ(results, vector<bool>({false, true, true, true, true}));
+    EXPECT_EQ(messageSizes, vector<size_t>({6}));
+    EXPECT_EQ(testee.partialMessageCount(), 0);
+    EXPECT_EQ(testee.partialSize(), 0);
+}
+
+TEST(MessageReassemblerTests, push_missingFrame_shouldDropTheMessage)
+{
+    MessageReassembler testee([](rtc::CopyOnWriteBuffer message, bool isBinary) { ADD_FAILURE(); });
+    MessageFragmenter fragmenter(MessageFragmenter::HeaderSize + 3);
+    fragmenter.push(createBinaryBuffer(9, 0));
+
+    EXPECT_TRUE(testee.push(fragmenter.popFrame().data));
+    EXPECT_EQ(testee.partialSize(), 9);
+    fragmenter.popFrame();
+    EXPECT_FALSE(testee.push(fragmenter.popFrame().data));
+
+    EXPECT_EQ(testee.partialMessageCount(), 0);
+    EXPECT_EQ(testee.partialSize(), 0);
+}
@@ -0,0 +1,46 @@
+#include <OpenteraWebrtcNativeClient/Utils/OpusPacket.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+TEST(OpusPacketTests, numberOfFrames_empty_shouldReturn0)
+{
+    EXPECT_EQ(OpusPacket::numberOfFrames(nullptr, 0), 0);
+}
+
+TEST(OpusPacketTests, numberOfFrames_oneFrame_shouldReturnTheFrameDuration)
+{
+    uint8_t silk10Ms = 0 << 3;
+    uint8_t silk60Ms = 3 << 3;
+    uint8_t hybrid20Ms = 13 << 3;
+    uint8_t celt2_5Ms = 16 << 3;
+    uint8_t celt20Ms = 31 << 3;
+
+    EXPECT_EQ(OpusPacket::numberOfFrames(&silk10Ms, 1), 480);
+    EXPECT_EQ(OpusPacket::numberOfFrames(&silk60Ms, 1), 2880);
+    EXPECT_EQ(OpusPacket::numberOfFrames(&hybrid20Ms, 1), 960);
+    EXPECT_EQ(OpusPacket::numberOfFrames(&celt2_5Ms, 1), 120);
+    EXPECT_EQ(OpusPacket::numberOfFrames(&celt20Ms, 1), 960);
+}
+
+TEST(OpusPacketTests, numberOfFrames_twoFrames_shouldReturnTheDoubleDuration)
+{
+    uint8_t equalSizes = (31 << 3) | 1;
+    uint8_t differentSizes = (31 << 3) | 2;
+
+    EXPECT_EQ(OpusPacket::numberOfFrames(&equalSizes, 1), 1920);
+    EXPECT_EQ(OpusPacket::numberOfFrames(&differentSizes, 1), 1920);
+}
+
+TEST(OpusPacketTests, numberOfFrames_arbitraryFrameCount_shouldUseTheFrameCountByte)
+{
+    uint8_t valid[] = {(31 << 3) | 3, 3};
+    uint8_t tooLong[] = {(3 << 3) | 3, 3};
+    uint8_t missingFrameCount[] = {(31 << 3) | 3};
+
+    EXPECT_EQ(OpusPacket::numberOfFrames(valid, 2), 2880);
+    EXPECT_EQ(OpusPacket::numberOfFrames(tooLong, 2), 0);
+    EXPECT_EQ(OpusPacket::numberOfFrames(missingFrameCount, 1), 0);
+}
@@ -0,0 +1,63 @@
+#include <OpenteraWebrtcNativeClient/Utils/PreallocatedFile.h>
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+static vector<uint8_t> readFile(const string& path)
+{
+    ifstream file(path, ios::binary);
+    return vector<uint8_t>(istreambuf_iterator<char>(file), istreambuf_iterator<char>());
+}
+
+TEST(PreallocatedFileTests, constructor_shouldAllocateTheFile)
+{
+    string path = testing::TempDir() + "preallocated_file_test.bin";
+    {
+        ofstream file(path, ios::binary);
+        file << "previous content";
+    }
+
+    {
+        PreallocatedFile testee(path, 4);
+        EXPECT_EQ(testee.size(), 4);
+    }
+
+    EXPECT_EQ(readFile(path), vector<uint8_t>({0, 0, 0, 0}));
+}
+
+TEST(PreallocatedFileTests, write_shouldWriteTheDataAtTheOffset)
+{
+    string path = testing::TempDir() + "preallocated_file_write_test.bin";
+    const uint8_t Data1[] = {1, 2};
+    const uint8_t Data2[] = {3, 4};
+
+    {
+        PreallocatedFile testee(path, 5);
+        testee.write(3, Data2, sizeof(Data2));
+        testee.write(0, Data1, sizeof(Data1));
+    }
+
+    EXPECT_EQ(readFile(path), vector<uint8_t>({1, 2, 0, 3, 4}));
+}
+
+TEST(PreallocatedFileTests, write_outsideOfTheFile_shouldThrowRuntimeError)
+{
+    const uint8_t Data[] = {1, 2};
+    PreallocatedFile testee(testing::TempDir() + "preallocated_file_outside_test.bin", 3);
+
+    EXPECT_THROW(testee.write(2, Data, sizeof(Data)), runtime_error);
+    EXPECT_THROW(testee.write(4, Data, 0), runtime_error);
+}
+
+TEST(PreallocatedFileTests, constructor_invalidPath_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(
+        PreallocatedFile(testing::TempDir() + "missing_directory/preallocated_file_test.bin", 1),
+        runtime_error);
+}
@@ -0,0 +1,85 @@
+#include <OpenteraWebrtcNativeClient/Utils/PubSubFrame.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace opentera;
+using namespace std;
+
+TEST(PubSubFrameTests, encode_subscription_shouldHaveOnlyAHeader)
+{
+    webrtc::DataBuffer frame = PubSubFrame::encode(PubSubFrame::Type::Unsubscribe, 0x1234);
+
+    EXPECT_TRUE(frame.binary);
+    ASSERT_EQ(frame.size(), PubSubFrame::HeaderSize);
+    EXPECT_EQ(frame.data.data<uint8_t>()[0], 2);
+    EXPECT_EQ(frame.data.data<uint8_t>()[1], 0x34);
+    EXPECT_EQ(frame.data.data<uint8_t>()[2], 0x12);
+
+    PubSubFrame::Type type;
+    uint16_t topic;
+    rtc::CopyOnWriteBuffer message;
+    bool isBinary;
+    ASSERT_TRUE(PubSubFrame::decode(frame, type, topic, message, isBinary));
+    EXPECT_EQ(type, PubSubFrame::Type::Unsubscribe);
+    EXPECT_EQ(topic, 0x1234);
+    EXPECT_EQ(message.size(), 0);
+}
+
+TEST(PubSubFrameTests, encode_publishedMessage_shouldBeDecodedWithTheSameTopicAndMessage)
+{
+    const uint8_t data[] = {1, 2, 3};
+    webrtc::DataBuffer binaryFrame =
+        PubSubFrame::encode(65535, webrtc::DataBuffer(rtc::CopyOnWriteBuffer(data, sizeof(data)), true));
+    webrtc::DataBuffer stringFrame = PubSubFrame::encode(7, webrtc::DataBuffer("abc"));
+
+    PubSubFrame::Type type;
+    uint16_t topic;
+    rtc::CopyOnWriteBuffer message;
+    bool isBinary;
+    ASSERT_TRUE(PubSubFrame::decode(binaryFrame, type, topic, message, isBinary));
+    EXPECT_EQ(type, PubSubFrame::Type::Publish);
+    EXPECT_EQ(topic, 65535);
+    EXPECT_TRUE(isBinary);
+    EXPECT_EQ(
+        vector<uint8_t>(message.data<uint8_t>(), message.data<uint8_t>() + message.size()),
+        vector<uint8_t>({1, 2, 3}));
+
+    ASSERT_TRUE(PubSubFrame::decode(stringFrame, type, topic, message, isBinary));
+    EXPECT_EQ(type, PubSubFrame::Type::Publish);
+    EXPECT_EQ(topic, 7);
+    EXPECT_FALSE(isBinary);
+    EXPECT_EQ(string(message.data<char>(), message.size()), "abc");
+}
+
+TEST(PubSubFrameTests, decode_invalidFrame_shouldReturnFalse)
+{
+    const uint8_t unknownType[] = {3, 0, 0};
+    const uint8_t subscriptionWithPayload[] = {1, 0, 0, 0};
+    const uint8_t tooShort[] = {0, 0};
+
+    PubSubFrame::Type type;
+    uint16_t topic;
+    rtc::CopyOnWriteBuffer message;
+    bool isBinary;
+    EXPECT_FALSE(PubSubFrame::decode(webrtc::DataBuffer("abc"), type, topic, message, isBinary));
+    EXPECT_FALSE(PubSubFrame::decode(
+        webrtc::DataBuffer(rtc::CopyOnWriteBuffer(unknownType, sizeof(unknownType)), true),
+        type,
+        topic,
+        message,
+        isBinary));
+    EXPECT_FALSE(PubSubFrame::decode(
+        webrtc::DataBuffer(rtc::CopyOnWriteBuffer(subscriptionWithPayload, sizeof(subscriptionWithPayload)), true),
+        type,
+        topic,
+        message,
+        isBinary));
+    EXPECT_FALSE(PubSubFrame::decode(
+        webrtc::DataBuffer(rtc::CopyOnWriteBuffer(tooShort, sizeof(tooShort)), true),
+        type,
+        topic,
+        message,
+        isBinary));
+}
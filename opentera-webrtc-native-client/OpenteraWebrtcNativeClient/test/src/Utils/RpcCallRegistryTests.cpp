@@ -0,0 +1,98 @@
+#include <OpenteraWebrtcNativeClient/Utils/RpcCallRegistry.h>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace opentera;
+using namespace std;
+
+struct RpcResult
+{
+    absl::optional<string> response;
+    string error;
+};
+
+static RpcCallRegistry::Callback createCallback(vector<RpcResult>& results)
+{
+    return [&results](const absl::optional<DataChannelMessage>& response, const string& error)
+    {
+        RpcResult result;
+        if (response.has_value())
+        {
+            result.response = string(response->view());
+        }
+        result.error = error;
+        results.push_back(result);
+    };
+}
+
+static DataChannelMessage createMessage(const string& message)
+{
+    return DataChannelMessage(rtc::CopyOnWriteBuffer(message), false);
+}
+
+TEST(RpcCallRegistryTests, complete_shouldCallTheCallbackOfTheCallOnce)
+{
+    vector<RpcResult> results1;
+    vector<RpcResult> results2;
+    RpcCallRegistry testee;
+    testee.add(1, "a", createCallback(results1));
+    testee.add(2, "a", createCallback(results2));
+
+    EXPECT_TRUE(testee.complete(2, "a", createMessage("2")));
+    EXPECT_TRUE(testee.complete(1, "a", createMessage("1")));
+    EXPECT_FALSE(testee.complete(1, "a", createMessage("1")));
+
+    ASSERT_EQ(results1.size(), 1);
+    EXPECT_EQ(results1[0].response, "1");
+    EXPECT_EQ(results1[0].error, "");
+    ASSERT_EQ(results2.size(), 1);
+    EXPECT_EQ(results2[0].response, "2");
+    EXPECT_EQ(testee.size(), 0);
+}
+
+TEST(RpcCallRegistryTests, completeAndFail_otherPeer_shouldReturnFalse)
+{
+    vector<RpcResult> results;
+    RpcCallRegistry testee;
+    testee.add(1, "a", createCallback(results));
+
+    EXPECT_FALSE(testee.complete(1, "b", createMessage("1")));
+    EXPECT_FALSE(testee.fail(1, "b", "error"));
+
+    EXPECT_TRUE(results.empty());
+    EXPECT_EQ(testee.size(), 1);
+}
+
+TEST(RpcCallRegistryTests, fail_shouldPassTheErrorMessage)
+{
+    vector<RpcResult> results;
+    RpcCallRegistry testee;
+    testee.add(1, "a", createCallback(results));
+
+    EXPECT_TRUE(testee.fail(1, "a", "timeout"));
+    EXPECT_FALSE(testee.complete(1, "a", createMessage("1")));
+
+    ASSERT_EQ(results.size(), 1);
+    EXPECT_FALSE(results[0].response.has_value());
+    EXPECT_EQ(results[0].error, "timeout");
+}
+
+TEST(RpcCallRegistryTests, failPeer_shouldFailOnlyTheCallsOfThePeer)
+{
+    vector<RpcResult> resultsA;
+    vector<RpcResult> resultsB;
+    RpcCallRegistry testee;
+    testee.add(1, "a", createCallback(resultsA));
+    testee.add(2, "b", createCallback(resultsB));
+    testee.add(3, "a", createCallback(resultsA));
+
+    testee.failPeer("a", "disconnected");
+
+    ASSERT_EQ(resultsA.size(), 2);
+    EXPECT_EQ(resultsA[0].error, "disconnected");
+    EXPECT_EQ(resultsA[1].error, "disconnected");
+    EXPECT_TRUE(resultsB.empty());
+    EXPECT_EQ(testee.size(), 1);
+}
@@ -0,0 +1,95 @@
+#include <OpenteraWebrtcNativeClient/Utils/RpcFrame.h>
+
+#include <gtest/gtest.h>
+
+#include <string>
+
+using namespace opentera;
+using namespace std;
+
+TEST(RpcFrameTests, encodeRequest_shouldBeDecodedWithTheSameCallIdMethodAndRequest)
+{
+    const uint8_t data[] = {1, 2, 3};
+    webrtc::DataBuffer request(rtc::CopyOnWriteBuffer(data, sizeof(data)), true);
+    webrtc::DataBuffer frame = RpcFrame::encodeRequest(0x12345678, "add", request);
+
+    EXPECT_TRUE(frame.binary);
+    ASSERT_EQ(frame.size(), RpcFrame::HeaderSize + 3 + sizeof(data));
+    EXPECT_EQ(frame.data.data<uint8_t>()[0], 0);
+    EXPECT_EQ(frame.data.data<uint8_t>()[1], 0x78);
+    EXPECT_EQ(frame.data.data<uint8_t>()[4], 0x12);
+    EXPECT_EQ(frame.data.data<uint8_t>()[5], 3);
+
+    RpcFrame::Type type;
+    uint32_t callId;
+    string method;
+    rtc::CopyOnWriteBuffer payload;
+    bool isBinary;
+    ASSERT_TRUE(RpcFrame::decode(frame, type, callId, method, payload, isBinary));
+    EXPECT_EQ(type, RpcFrame::Type::Request);
+    EXPECT_EQ(callId, 0x12345678);
+    EXPECT_EQ(method, "add");
+    EXPECT_TRUE(isBinary);
+    EXPECT_EQ(
+        vector<uint8_t>(payload.data<uint8_t>(), payload.data<uint8_t>() + payload.size()),
+        vector<uint8_t>({1, 2, 3}));
+}
+
+TEST(RpcFrameTests, encodeResponseAndError_shouldBeDecodedWithoutMethod)
+{
+    webrtc::DataBuffer responseFrame = RpcFrame::encodeResponse(7, webrtc::DataBuffer("abc"));
+    webrtc::DataBuffer errorFrame = RpcFrame::encodeError(8, "error");
+
+    RpcFrame::Type type;
+    uint32_t callId;
+    string method;
+    rtc::CopyOnWriteBuffer payload;
+    bool isBinary;
+    ASSERT_TRUE(RpcFrame::decode(responseFrame, type, callId, method, payload, isBinary));
+    EXPECT_EQ(type, RpcFrame::Type::Response);
+    EXPECT_EQ(callId, 7);
+    EXPECT_EQ(method, "");
+    EXPECT_FALSE(isBinary);
+    EXPECT_EQ(string(payload.data<char>(), payload.size()), "abc");
+
+    ASSERT_TRUE(RpcFrame::decode(errorFrame, type, callId, method, payload, isBinary));
+    EXPECT_EQ(type, RpcFrame::Type::Error);
+    EXPECT_EQ(callId, 8);
+    EXPECT_EQ(method, "");
+    EXPECT_FALSE(isBinary);
+    EXPECT_EQ(string(payload.data<char>(), payload.size()), "error");
+}
+
+TEST(RpcFrameTests, encodeRequest_invalidMethod_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(RpcFrame::encodeRequest(0, "", webrtc::DataBuffer("")), runtime_error);
+    EXPECT_THROW(
+        RpcFrame::encodeRequest(0, string(RpcFrame::MaxMethodSize + 1, 'a'), webrtc::DataBuffer("")),
+        runtime_error);
+    EXPECT_NO_THROW(RpcFrame::encodeRequest(0, string(RpcFrame::MaxMethodSize, 'a'), webrtc::DataBuffer("")));
+}
+
+TEST(RpcFrameTests, decode_invalidFrame_shouldReturnFalse)
+{
+    const uint8_t unknownType[] = {3, 0, 0, 0, 0, 0};
+    const uint8_t requestWithoutMethod[] = {0, 0, 0, 0, 0, 0};
+    const uint8_t responseWithMethod[] = {1, 0, 0, 0, 0, 1, 'a'};
+    const uint8_t truncatedMethod[] = {0, 0, 0, 0, 0, 2, 'a'};
+    const uint8_t tooShort[] = {1, 0, 0, 0, 0};
+
+    RpcFrame::Type type;
+    uint32_t callId;
+    string method;
+    rtc::CopyOnWriteBuffer payload;
+    bool isBinary;
+    EXPECT_FALSE(RpcFrame::decode(webrtc::DataBuffer("abcdef"), type, callId, method, payload, isBinary));
+    for (const auto& frame :
+         {rtc::CopyOnWriteBuffer(unknownType, sizeof(unknownType)),
+          rtc::CopyOnWriteBuffer(requestWithoutMethod, sizeof(requestWithoutMethod)),
+          rtc::CopyOnWriteBuffer(responseWithMethod, sizeof(responseWithMethod)),
+          rtc::CopyOnWriteBuffer(truncatedMethod, sizeof(truncatedMethod)),
+          rtc::CopyOnWriteBuffer(tooShort, sizeof(tooShort))})
+    {
+        EXPECT_FALSE(RpcFrame::decode(webrtc::DataBuffer(frame, true), type, callId, method, payload, isBinary));
+    }
+}
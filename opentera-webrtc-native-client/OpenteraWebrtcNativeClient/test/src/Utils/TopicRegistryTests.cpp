@@ -0,0 +1,47 @@
+#include <OpenteraWebrtcNativeClient/Utils/TopicRegistry.h>
+
+#include <gtest/gtest.h>
+
+using namespace opentera;
+using namespace std;
+
+TEST(TopicRegistryTests, subscriberIds_shouldReturnOnlyTheSubscribersOfTheTopic)
+{
+    TopicRegistry testee;
+    testee.addSubscriber(1, "a");
+    testee.addSubscriber(1, "b");
+    testee.addSubscriber(2, "b");
+
+    EXPECT_EQ(testee.subscriberIds(1), vector<string>({"a", "b"}));
+    EXPECT_EQ(testee.subscriberIds(2), vector<string>({"b"}));
+    EXPECT_EQ(testee.subscriberIds(3), vector<string>());
+
+    testee.removeSubscriber(1, "a");
+    EXPECT_EQ(testee.subscriberIds(1), vector<string>({"b"}));
+
+    testee.removePeer("b");
+    EXPECT_EQ(testee.subscriberIds(1), vector<string>());
+    EXPECT_EQ(testee.subscriberIds(2), vector<string>());
+}
+
+TEST(TopicRegistryTests, statistics_shouldCountTheMessagesOfEachTopic)
+{
+    TopicRegistry testee;
+    testee.addSentMessages(1, 10, 3);
+    testee.addSentMessages(1, 5, 1);
+    testee.addReceivedMessage(1, 20);
+    testee.addReceivedMessage(2, 7);
+
+    TopicStatistics statistics1 = testee.statistics(1);
+    EXPECT_EQ(statistics1.sentMessageCount(), 4);
+    EXPECT_EQ(statistics1.sentByteCount(), 35);
+    EXPECT_EQ(statistics1.receivedMessageCount(), 1);
+    EXPECT_EQ(statistics1.receivedByteCount(), 20);
+
+    TopicStatistics statistics2 = testee.statistics(2);
+    EXPECT_EQ(statistics2.sentMessageCount(), 0);
+    EXPECT_EQ(statistics2.receivedMessageCount(), 1);
+    EXPECT_EQ(statistics2.receivedByteCount(), 7);
+
+    EXPECT_EQ(testee.statistics(3).receivedMessageCount(), 0);
+}
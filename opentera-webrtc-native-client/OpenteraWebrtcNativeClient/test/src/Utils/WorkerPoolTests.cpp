@@ -0,0 +1,108 @@
+#include <OpenteraWebrtcNativeClient/Utils/WorkerPool.h>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <future>
+
+using namespace opentera;
+using namespace std;
+
+TEST(WorkerPoolTests, constructor_threadCount0_shouldThrowRuntimeError)
+{
+    EXPECT_THROW(WorkerPool(0), runtime_error);
+}
+
+TEST(WorkerPoolTests, post_shouldRunTheTasks)
+{
+    WorkerPool testee(2);
+    EXPECT_EQ(testee.threadCount(), 2);
+
+    atomic<int> sum(0);
+    vector<future<void>> futures;
+    for (int i = 1; i <= 10; i++)
+    {
+        auto promise = make_shared<std::promise<void>>();
+        futures.push_back(promise->get_future());
+        testee.post(
+            [&sum, i, promise]()
+            {
+                sum += i;
+                promise->set_value();
+            });
+    }
+
+    for (auto& future : futures)
+    {
+        ASSERT_EQ(future.wait_for(chrono::seconds(5)), future_status::ready);
+    }
+    EXPECT_EQ(sum, 55);
+}
+
+TEST(WorkerPoolTests, post_blockedTask_shouldRunTheOtherTasksOnTheOtherThreads)
+{
+    WorkerPool testee(2);
+    promise<void> unblockPromise;
+    shared_future<void> unblockFuture = unblockPromise.get_future().share();
+    promise<void> otherTaskPromise;
+
+    testee.post([unblockFuture]() { unblockFuture.wait(); });
+    testee.post([&otherTaskPromise]() { otherTaskPromise.set_value(); });
+
+    EXPECT_EQ(otherTaskPromise.get_future().wait_for(chrono::seconds(5)), future_status::ready);
+    unblockPromise.set_value();
+}
+
+TEST(WorkerPoolTests, destructor_shouldDiscardTheTasksThatAreNotStarted)
+{
+    atomic<int> runTaskCount(0);
+    promise<void> startedPromise;
+    promise<void> unblockPromise;
+    shared_future<void> unblockFuture = unblockPromise.get_future().share();
+    thread unblockThread;
+    {
+        WorkerPool testee(1);
+        testee.post(
+            [&runTaskCount, &startedPromise, unblockFuture]()
+            {
+                startedPromise.set_value();
+                unblockFuture.wait();
+                runTaskCount++;
+            });
+        testee.post([&runTaskCount]() { runTaskCount++; });
+        startedPromise.get_future().wait();
+
+        unblockThread = thread(
+            [&unblockPromise]()
+            {
+                this_thread::sleep_for(chrono::milliseconds(50));
+                unblockPromise.set_value();
+            });
+    }
+    unblockThread.join();
+
+    EXPECT_EQ(runTaskCount, 1);
+}
+
+TEST(WorkerPoolTests, pendingTaskCount_shouldReturnTheNumberOfTasksThatAreNotStarted)
+{
+    WorkerPool testee(1);
+    promise<void> startedPromise;
+    promise<void> unblockPromise;
+    shared_future<void> unblockFuture = unblockPromise.get_future().share();
+
+    testee.post(
+        [&startedPromise, unblockFuture]()
+        {
+            startedPromise.set_value();
+            unblockFuture.wait();
+        });
+    startedPromise.get_future().wait();
+    EXPECT_EQ(testee.pendingTaskCount(), 0);
+
+    testee.post([]() {});
+    testee.post([]() {});
+    EXPECT_EQ(testee.pendingTaskCount(), 2);
+    unblockPromise.set_value();
+}